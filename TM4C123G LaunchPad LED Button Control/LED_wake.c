@@ -0,0 +1,64 @@
+/*!
+ * @author      Yash Bansod
+ * @date        17th October 2026
+ *
+ * @brief       Source containing the LED update and the wake statistics of LED Button Control
+ * @details     Cycle counts are differences of 32 bit counter reads, correct across a
+ *              wrap of the counter as long as a wake lasts less than 2^32 cycles.
+ * @file        LED_wake.c
+ */
+/* -----------------------          Include Files       --------------------- */
+#include "LED_wake.h"
+
+/* -----------------------      Function Definition     --------------------- */
+// Function to take the events of the switches, returns true with the new colour when there were some
+bool LED_service(tBtnPort *psBtn, uint8_t *pui8Leds){
+    uint8_t ui8Event;
+    bool bEvent = false;
+
+    // The colour only depends on the switches pressed after the last event
+    while (BTN_get(psBtn, &ui8Event))
+        bEvent = true;
+    if (bEvent)
+        *pui8Leds = LED_COLOUR(psBtn->ui8Pressed);
+    return bEvent;
+}
+
+// Function to reset the statistics, the core being awake from ui32Now
+void LED_statsInit(tLedStats *psStats, uint32_t ui32Now){
+    psStats->ui32Wakes = 0;
+    psStats->ui32SwitchWakes = 0;
+    psStats->ui32Updates = 0;
+    psStats->ui32Wake = ui32Now;
+    psStats->ui32LatencyLast = 0;
+    psStats->ui32LatencyMax = 0;
+    psStats->ui32ActiveLast = 0;
+    psStats->ui32ActiveMax = 0;
+    psStats->ui64Active = 0;
+}
+
+// Function to count a wake, by a switch or by the SysTick
+void LED_statsWake(tLedStats *psStats, uint32_t ui32Now, bool bSwitch){
+    psStats->ui32Wakes++;
+    if (bSwitch) psStats->ui32SwitchWakes++;
+    psStats->ui32Wake = ui32Now;
+}
+
+// Function to count an LED update of the current wake
+void LED_statsUpdate(tLedStats *psStats, uint32_t ui32Now){
+    uint32_t ui32Latency = ui32Now - psStats->ui32Wake;
+
+    psStats->ui32Updates++;
+    psStats->ui32LatencyLast = ui32Latency;
+    if (ui32Latency > psStats->ui32LatencyMax) psStats->ui32LatencyMax = ui32Latency;
+}
+
+// Function to end the current wake before the core sleeps
+void LED_statsSleep(tLedStats *psStats, uint32_t ui32Now){
+    uint32_t ui32Active = ui32Now - psStats->ui32Wake;
+
+    psStats->ui32ActiveLast = ui32Active;
+    if (ui32Active > psStats->ui32ActiveMax) psStats->ui32ActiveMax = ui32Active;
+    psStats->ui64Active += ui32Active;
+    LED_WAKE_HOOK(psStats);
+}
@@ -0,0 +1,68 @@
+/*!
+ * @author      Yash Bansod
+ * @date        17th October 2026
+ *
+ * @brief       Header containing the LED update and the wake statistics of LED Button Control
+ * @details     The main loop only runs when an interrupt wakes the core: the SysTick
+ *              while the switches are being debounced, or a switch once they are idle
+ *              and the SysTick is stopped. LED_service() turns the button events of a
+ *              wake into the colour of the LEDs and the LED_stats functions count, from
+ *              cycle counter reads given by the caller, the cycles from each wake to its
+ *              LED update (wake latency) and the cycles awake per wake (active cycles).
+ *              LED_WAKE_HOOK(psStats) is expanded at the end of every wake, when the
+ *              statistics of the wake are complete, and is empty unless it is defined
+ *              on the command line. This file only needs "BTN_event.h" and is also
+ *              compiled by LED_sleep (Host Tools).
+ * @file        LED_wake.h
+ */
+/* -----------------------          Include Files       --------------------- */
+#include <stdint.h>                         // Library of Standard Integer Types
+#include <stdbool.h>                        // Library of Standard Boolean Types
+#include "BTN_event.h"
+
+#ifndef LED_WAKE_H_
+#define LED_WAKE_H_
+
+/* -----------------------      Macro Definitions       --------------------- */
+// Pins of PortF
+#define LED_RED             0x02                    // PF1
+#define LED_BLUE            0x04                    // PF2
+#define LED_GREEN           0x08                    // PF3
+#define LED_WHITE           (LED_RED | LED_BLUE | LED_GREEN)
+#define LED_SW1             0x10                    // PF4
+#define LED_SW2             0x01                    // PF0
+#define LED_SWITCHES        (LED_SW1 | LED_SW2)
+
+// Macro for the colour of the LEDs for the pressed switches
+#define LED_COLOUR(ui8Pressed)  (((ui8Pressed) & LED_SWITCHES) == LED_SWITCHES ? LED_RED :      \
+                                 ((ui8Pressed) & LED_SWITCHES) == LED_SW1 ? LED_BLUE :          \
+                                 ((ui8Pressed) & LED_SWITCHES) == LED_SW2 ? LED_GREEN : LED_WHITE)
+
+// Macro for switches that no longer need the SysTick: idle and all their events taken
+#define LED_TICK_DONE(psBtn)    (BTN_IDLE(psBtn) && BTN_EMPTY(psBtn))
+
+#ifndef LED_WAKE_HOOK
+#define LED_WAKE_HOOK(psStats)                      // Macro for the instrumentation hook of a wake
+#endif
+
+/* -----------------------      Global Variables        --------------------- */
+typedef struct {
+    uint32_t ui32Wakes;                             // Wakes from sleep
+    uint32_t ui32SwitchWakes;                       // Wakes by a switch with the SysTick stopped
+    uint32_t ui32Updates;                           // LED updates
+    uint32_t ui32Wake;                              // Cycle counter at the last wake
+    uint32_t ui32LatencyLast;                       // Cycles from the wake to the LED update, last update
+    uint32_t ui32LatencyMax;                        // Cycles from the wake to the LED update, longest
+    uint32_t ui32ActiveLast;                        // Cycles awake, last wake
+    uint32_t ui32ActiveMax;                         // Cycles awake, longest wake
+    uint64_t ui64Active;                            // Cycles awake, all the wakes
+} tLedStats;
+
+/* -----------------------      Function Prototypes     --------------------- */
+bool LED_service(tBtnPort *psBtn, uint8_t *pui8Leds);                  // Take the events, new colour
+void LED_statsInit(tLedStats *psStats, uint32_t ui32Now);              // Reset, awake from now
+void LED_statsWake(tLedStats *psStats, uint32_t ui32Now, bool bSwitch); // Count a wake
+void LED_statsUpdate(tLedStats *psStats, uint32_t ui32Now);            // Count an LED update
+void LED_statsSleep(tLedStats *psStats, uint32_t ui32Now);             // End the wake
+
+#endif /* LED_WAKE_H_ */
@@ -7,7 +7,18 @@
  *              TM4C123G LaunchPad (with TM4C123GH6PM microcontroller) using
  *              the onboard switches SW1(PF4) and SW2(PF0).
  *              Different combinations of button presses cause different LEDs to glow.
+ *              The switches are sampled by the SysTick and debounced (see "BTN_event.h"),
+ *              the LEDs are only updated when a switch is pressed or released.
+ *              The core sleeps between interrupts. Once the switches are idle the SysTick
+ *              is stopped and the core enters deep-sleep (sleep if LED_DEEP_SLEEP is 0)
+ *              until the low level of a pressed switch wakes it and restarts the SysTick.
+ *              The wake latency (cycles from a wake to its LED update) and the active
+ *              cycles of each wake are counted with the DWT cycle counter in sLedStats
+ *              and passed to LED_WAKE_HOOK (see "LED_wake.h").
  * @note        The SW2(PF0) is locked by default and has to be unlocked before use.
+ *              The tm4c123ghpm_startup_ccs.c contains the vector table for the
+ *              microcontroller. It was modified to execute the specified ISR on
+ *              SysTick and PortF Interrupts.
  */
 /* -----------------------          Include Files       --------------------- */
 #include <stdint.h>                     // Library of Standard Integer Types
@@ -15,12 +26,34 @@
 #include "inc/hw_memmap.h"              // Macros defining the memory map of the Tiva C Series device
 #include "inc/hw_gpio.h"                // Defines macros for GPIO hardware
 #include "inc/hw_types.h"               // Defines common types and macros
+#include "inc/hw_ints.h"                // Macros defining the interrupt assignments
+#include "inc/hw_nvic.h"                // Macros for the NVIC and SysTick registers
 #include "driverlib/sysctl.h"           // Defines and macros for System Control API of DriverLib
 #include "driverlib/pin_map.h"          // Mapping of peripherals to pins of all parts
 #include "driverlib/gpio.h"             // Defines and macros for GPIO API of DriverLib
+#include "driverlib/interrupt.h"        // Defines and macros for NVIC Controller API of DriverLib
+#include "driverlib/systick.h"          // Defines and macros for SysTick API of DriverLib
+#include "BTN_event.h"                  // Debounced button events
+#include "LED_wake.h"                   // LED update and wake statistics
+
+#define BUTTON_TICK_HZ 100              // Define a macro for the SysTick rate sampling the switches in Hz
+#define BUTTON_PINS (GPIO_PIN_4 | GPIO_PIN_0)
+#define LED_DEEP_SLEEP 1                // Define a macro to deep-sleep while the SysTick is stopped
+
+// Define macros for the DWT cycle counter of the Cortex-M4
+#define CORE_DEMCR 0xE000EDFC           // Debug Exception and Monitor Control, bit 24 enables the DWT
+#define CORE_DWT_CTRL 0xE0001000        // DWT Control, bit 0 enables the cycle counter
+#define CORE_DWT_CYCCNT 0xE0001004      // DWT Cycle Count
+#define CORE_CYCLES() HWREG(CORE_DWT_CYCCNT)
 
 /* -----------------------      Global Variables        --------------------- */
-uint32_t ui32PinStatus = 0x00000000;    // Variable to store the pin status of GPIO PortF
+tBtnPort sBtnPort;                      // Variable to store the debounced switches of GPIO PortF
+tLedStats sLedStats;                    // Variable to store the wake statistics
+volatile bool boolTicking = true;       // Variable to store if the SysTick samples the switches
+
+/* -----------------------      Function Prototypes     --------------------- */
+void SysTickIntHandler(void);           // Prototype for ISR of SysTick
+void PortFIntHandler(void);             // Prototype for ISR of GPIO PortF
 
 /* -----------------------          Main Program        --------------------- */
 int main(void){
@@ -38,19 +71,77 @@ int main(void){
     GPIOPinTypeGPIOInput(GPIO_PORTF_BASE, GPIO_PIN_4 | GPIO_PIN_0);
     GPIOPadConfigSet(GPIO_PORTF_BASE, GPIO_PIN_4 | GPIO_PIN_0, GPIO_STRENGTH_2MA, GPIO_PIN_TYPE_STD_WPU);
 
-    // Start an Infinite Loop
+    // Glow the white LED until a switch is pressed
+    GPIOPinWrite(GPIO_PORTF_BASE, GPIO_PIN_3 | GPIO_PIN_2 | GPIO_PIN_1, GPIO_PIN_3 | GPIO_PIN_2 | GPIO_PIN_1);
+
+    // Keep PortF clocked in sleep and deep-sleep, deep-sleep runs from the 16 MHz PIOSC
+    SysCtlPeripheralSleepEnable(SYSCTL_PERIPH_GPIOF);
+    SysCtlPeripheralDeepSleepEnable(SYSCTL_PERIPH_GPIOF);
+    SysCtlDeepSleepClockSet(SYSCTL_DSLP_DIV_1 | SYSCTL_DSLP_OSC_INT);
+    SysCtlPeripheralClockGating(true);
+
+    // Start the DWT cycle counter for the wake statistics
+    HWREG(CORE_DEMCR) |= 0x01000000;
+    HWREG(CORE_DWT_CYCCNT) = 0;
+    HWREG(CORE_DWT_CTRL) |= 0x00000001;
+    LED_statsInit(&sLedStats, CORE_CYCLES());
+
+    // A low level of PF0 or PF4 wakes the core while the SysTick is stopped
+    GPIOIntTypeSet(GPIO_PORTF_BASE, BUTTON_PINS, GPIO_LOW_LEVEL);
+    IntEnable(INT_GPIOF);
+
+    // Sample PF0 and PF4 on the SysTick Interrupt, both switches are Active Low
+    BTN_init(&sBtnPort, BUTTON_PINS, BUTTON_PINS, BUTTON_TICK_HZ);
+    SysTickPeriodSet(SysCtlClockGet() / BUTTON_TICK_HZ);
+    SysTickIntEnable();
+    SysTickEnable();
+    IntMasterEnable();
+
+    // Start an Infinite Loop, run once per wake
     while (true){
-        // Read the status of Input
-        ui32PinStatus = GPIOPinRead(GPIO_PORTF_BASE, GPIO_PIN_4 | GPIO_PIN_0);
-
-        if (ui32PinStatus == 0x00){   // If both buttons pressed then
-            GPIOPinWrite(GPIO_PORTF_BASE, GPIO_PIN_3 | GPIO_PIN_2 | GPIO_PIN_1, GPIO_PIN_1);
-        }else if (ui32PinStatus == GPIO_PIN_0){   // If only SW2 (PF0) NOT pressed then
-            GPIOPinWrite(GPIO_PORTF_BASE, GPIO_PIN_3 | GPIO_PIN_2 | GPIO_PIN_1, GPIO_PIN_2);
-        }else if (ui32PinStatus == GPIO_PIN_4){   // If only SW1 (PF4) NOT pressed then
-            GPIOPinWrite(GPIO_PORTF_BASE, GPIO_PIN_3 | GPIO_PIN_2 | GPIO_PIN_1, GPIO_PIN_3);
-        }else if (ui32PinStatus == GPIO_PIN_4 | GPIO_PIN_0){   // If both SW2 (PF0) and SW1 (PF4) NOT pressed then
-            GPIOPinWrite(GPIO_PORTF_BASE, GPIO_PIN_3 | GPIO_PIN_2 | GPIO_PIN_1, GPIO_PIN_3 | GPIO_PIN_2 | GPIO_PIN_1);
+        uint8_t ui8Leds;
+
+        // Update the LEDs with the events of the switches
+        if (LED_service(&sBtnPort, &ui8Leds)){
+            GPIOPinWrite(GPIO_PORTF_BASE, GPIO_PIN_3 | GPIO_PIN_2 | GPIO_PIN_1, ui8Leds);
+            LED_statsUpdate(&sLedStats, CORE_CYCLES());
         }
+
+        // Hold off the interrupts, the one that wakes the core runs at IntMasterEnable()
+        IntMasterDisable();
+        if (boolTicking && LED_TICK_DONE(&sBtnPort)){
+            // Stop the SysTick, a pressed switch restarts it
+            SysTickDisable();
+            boolTicking = false;
+            GPIOIntEnable(GPIO_PORTF_BASE, GPIO_INT_PIN_4 | GPIO_INT_PIN_0);
+        }
+        // Sleep unless the SysTick posted an event since LED_service()
+        if (BTN_EMPTY(&sBtnPort)){
+            LED_statsSleep(&sLedStats, CORE_CYCLES());
+            if (boolTicking || !LED_DEEP_SLEEP) SysCtlSleep();
+            else SysCtlDeepSleep();
+            LED_statsWake(&sLedStats, CORE_CYCLES(), !boolTicking);
+        }
+        IntMasterEnable();
     }
 }
+
+/* -----------------------      Function Definition     --------------------- */
+void SysTickIntHandler(void){
+    // The ISR for SysTick Interrupt Handling
+    // Sample SW1 and SW2, their events are handled by the main loop
+    BTN_sample(&sBtnPort, HWREG(GPIO_PORTF_BASE + GPIO_O_DATA + (BUTTON_PINS << 2)));
+}
+
+void PortFIntHandler(void){
+    // The ISR for GPIO PortF Interrupt Handling
+    // A switch is pressed while the SysTick is stopped, the level would interrupt again
+    GPIOIntDisable(GPIO_PORTF_BASE, GPIO_INT_PIN_4 | GPIO_INT_PIN_0);
+    GPIOIntClear(GPIO_PORTF_BASE, GPIO_INT_PIN_4 | GPIO_INT_PIN_0);
+
+    // Sample the switches now and restart the SysTick for a full period
+    BTN_sample(&sBtnPort, HWREG(GPIO_PORTF_BASE + GPIO_O_DATA + (BUTTON_PINS << 2)));
+    HWREG(NVIC_ST_CURRENT) = 0;
+    SysTickEnable();
+    boolTicking = true;
+}
@@ -15,5 +15,6 @@
 
 void QEI1IntHandler(void);                          // ISR Prototype for QEI1 Interrupts
 void UART0IntHandler(void);                          // ISR Prototype for UART0 Interrupts
+void WTIMER0AIntHandler(void);                      // ISR Prototype for Wide Timer 0A Interrupts
 
 #endif /* INT_HANDLERS_H_ */
@@ -0,0 +1,67 @@
+/*!
+ * @author      Yash Bansod
+ * @date        17th October 2026
+ *
+ * @brief       Source containing the position and velocity observer of the PID axes
+ * @file        OBS_filter.c
+ */
+/* -----------------------          Include Files       --------------------- */
+#include <math.h>                           // Library of Math functions
+#include "OBS_filter.h"
+
+/* -----------------------      Function Definition     --------------------- */
+// Function to select the mode of the observer, the estimate restarts at the next reading
+void OBS_init(tObserver *psObs, uint8_t ui8Mode){
+    psObs->ui8Mode = ui8Mode;
+    psObs->bStart = false;
+
+    if (ui8Mode == OBS_KALMAN){
+        psObs->f32Kx = OBS_KF_KX;
+        psObs->f32Kv = OBS_KF_KV;
+        psObs->f32Ka = OBS_KF_KA;
+    }
+    else if (ui8Mode == OBS_ALPHA_BETA){
+        psObs->f32Kx = OBS_AB_ALPHA;
+        psObs->f32Kv = OBS_AB_BETA;
+        psObs->f32Ka = 0;
+    }
+    else {
+        psObs->f32Kx = 0;
+        psObs->f32Kv = 0;
+        psObs->f32Ka = 0;
+    }
+}
+
+// Function to predict the state of every axis one tick ahead and correct it with its reading
+void OBS_update(tObserver *psObs, uint32_t ui32Axes, const int64_t *pi64Pos){
+    uint32_t ui32Axis;
+
+    if (!psObs->bStart){
+        for (ui32Axis = 0; ui32Axis < ui32Axes; ui32Axis++){
+            psObs->i64Pos[ui32Axis] = pi64Pos[ui32Axis];
+            psObs->f32Frac[ui32Axis] = 0;
+            psObs->f32Vel[ui32Axis] = 0;
+            psObs->f32Acc[ui32Axis] = 0;
+        }
+        psObs->bStart = true;
+        return;
+    }
+
+    for (ui32Axis = 0; ui32Axis < ui32Axes; ui32Axis++){
+        float f32Acc = psObs->f32Acc[ui32Axis];
+        float f32Vel = psObs->f32Vel[ui32Axis];
+        float f32Frac = psObs->f32Frac[ui32Axis] + f32Vel + 0.5f * f32Acc;
+        f32Vel += f32Acc;
+
+        // The residual is taken against the whole ticks first so that it stays small
+        float f32Res = (float)(pi64Pos[ui32Axis] - psObs->i64Pos[ui32Axis]) - f32Frac;
+        f32Frac += psObs->f32Kx * f32Res;
+        psObs->f32Vel[ui32Axis] = f32Vel + psObs->f32Kv * f32Res;
+        psObs->f32Acc[ui32Axis] = f32Acc + psObs->f32Ka * f32Res;
+
+        // Move the whole ticks of the fraction into the integer part
+        float f32Whole = floorf(f32Frac);
+        psObs->i64Pos[ui32Axis] += (int64_t)f32Whole;
+        psObs->f32Frac[ui32Axis] = f32Frac - f32Whole;
+    }
+}
@@ -0,0 +1,52 @@
+/*!
+ * @author      Yash Bansod
+ * @date        17th October 2026
+ *
+ * @brief       Header containing the position and velocity observer of the PID axes
+ * @details     The difference of two encoder readings is a whole number of ticks, at
+ *              4096 Hz mostly 0 or 1 and noisy as a Derivative term. The observer runs
+ *              between the QEI1 read and the control law and estimates the position,
+ *              velocity and acceleration of every axis from its encoder position.
+ *              Each tick it predicts the state one tick ahead with a constant
+ *              acceleration model and corrects it by fixed gains times the difference
+ *              of the reading and the predicted position:
+ *                  x += v + a / 2, v += a, r = pos - x
+ *                  x += Kx r, v += Kv r, a += Ka r
+ *              The gains are the steady-state Kalman gains of a model with 1/12 tick^2
+ *              of quantisation noise on the reading, computed offline by
+ *              "PID_sim --obs-gains" and set in "macros.h":
+ *              OBS_ALPHA_BETA is the constant velocity model (Ka = 0) driven by white
+ *              acceleration, the classic alpha-beta filter; OBS_KALMAN is the constant
+ *              acceleration model driven by white jerk, which follows a velocity ramp
+ *              without a lag. Both modes cost the same, a fixed handful of float
+ *              operations per axis.
+ *              The estimate is kept as whole ticks plus a float fraction, so the float
+ *              keeps its resolution over the whole 64 bit position range. The first
+ *              update after OBS_init() starts the estimate at the reading, at rest.
+ *              Units are ticks and QEI1 ticks (1 / 2^VEL_INT_FREQ s).
+ * @file        OBS_filter.h
+ */
+/* -----------------------          Include Files       --------------------- */
+#include <stdint.h>                         // Library of Standard Integer Types
+#include <stdbool.h>                        // Library of Standard Boolean Types
+#include "macros.h"
+
+#ifndef OBS_FILTER_H_
+#define OBS_FILTER_H_
+
+/* -----------------------      Global Variables        --------------------- */
+typedef struct {
+    uint8_t ui8Mode;                                // OBS_OFF, OBS_ALPHA_BETA or OBS_KALMAN
+    bool bStart;                                    // The estimate has been started at a reading
+    float f32Kx, f32Kv, f32Ka;                      // Gains of the position, velocity and acceleration
+    int64_t i64Pos[PID_MAX_AXES];                   // Whole ticks of the position estimate
+    float f32Frac[PID_MAX_AXES];                    // Fraction of the position estimate in ticks
+    float f32Vel[PID_MAX_AXES];                     // Velocity estimate in ticks per tick
+    float f32Acc[PID_MAX_AXES];                     // Acceleration estimate in ticks per tick^2
+} tObserver;
+
+/* -----------------------      Function Prototypes     --------------------- */
+void OBS_init(tObserver *psObs, uint8_t ui8Mode);                      // Select the mode, restart at the next reading
+void OBS_update(tObserver *psObs, uint32_t ui32Axes, const int64_t *pi64Pos);  // Correct with the readings of this tick
+
+#endif /* OBS_FILTER_H_ */
@@ -0,0 +1,70 @@
+/*!
+ * @author      Yash Bansod
+ * @date        17th October 2026
+ *
+ * @brief       Source containing the storage of the PID parameters in the EEPROM
+ * @file        PARAM_store.c
+ */
+/* -----------------------          Include Files       --------------------- */
+#include <stddef.h>                         // Library for offsetof
+#include "includes.h"
+#include "PARAM_store.h"
+#include "PID_control.h"
+#include "PROTO_frame.h"
+
+/* -----------------------      Global Variables        --------------------- */
+typedef struct {
+    uint32_t ui32Magic;                             // PARAM_MAGIC for a valid record
+    uint8_t ui8Source;                              // Input of the gain schedule
+    uint8_t ui8Shift;                               // Breakpoints every 2^ui8Shift of the input
+    uint8_t pui8Pad[2];                             // Pad to a whole word
+    float pf32Gains[PID_SCHED_POINTS][3];           // K_P, K_I and K_D of every breakpoint
+    uint32_t ui32Crc;                               // CRC-16 of the bytes above
+} tParamRecord;
+
+/* -----------------------      Function Definition     --------------------- */
+// Function to compute the CRC-16 of the record without its CRC field
+static uint32_t PARAM_crc(const tParamRecord *psRecord){
+    const uint8_t *pui8Byte = (const uint8_t *)psRecord;
+    uint16_t ui16Crc = 0xFFFF;
+    uint32_t ui32Index;
+
+    for (ui32Index = 0; ui32Index < offsetof(tParamRecord, ui32Crc); ui32Index++)
+        ui16Crc = PROTO_crc16(ui16Crc, pui8Byte[ui32Index]);
+    return ui16Crc;
+}
+
+// Function to enable the EEPROM, false if it did not recover from an interrupted write
+static bool PARAM_init(void){
+    ROM_SysCtlPeripheralEnable(SYSCTL_PERIPH_EEPROM0);
+    // EEPROMInit() is used from the flash library, the ROM copy misses the errata fixes
+    return EEPROMInit() == EEPROM_INIT_OK;
+}
+
+// Function to load the stored parameters, false if there are none
+bool PARAM_load(void){
+    tParamRecord sRecord;
+
+    if (!PARAM_init())
+        return false;
+    ROM_EEPROMRead((uint32_t *)&sRecord, PARAM_EEPROM_ADDR, sizeof(sRecord));
+    if (sRecord.ui32Magic != PARAM_MAGIC || sRecord.ui32Crc != PARAM_crc(&sRecord))
+        return false;
+
+    PID_scheduleSet(sRecord.ui8Source, sRecord.ui8Shift, (const float (*)[3])sRecord.pf32Gains);
+    return true;
+}
+
+// Function to store the parameters in use, false on an EEPROM error
+bool PARAM_save(void){
+    tParamRecord sRecord;
+
+    memset(&sRecord, 0, sizeof(sRecord));
+    sRecord.ui32Magic = PARAM_MAGIC;
+    PID_scheduleGet(&sRecord.ui8Source, &sRecord.ui8Shift, sRecord.pf32Gains);
+    sRecord.ui32Crc = PARAM_crc(&sRecord);
+
+    if (!PARAM_init())
+        return false;
+    return ROM_EEPROMProgram((uint32_t *)&sRecord, PARAM_EEPROM_ADDR, sizeof(sRecord)) == 0;
+}
@@ -0,0 +1,29 @@
+/*!
+ * @author      Yash Bansod
+ * @date        17th October 2026
+ *
+ * @brief       Header containing the storage of the PID parameters in the EEPROM
+ * @details     The gain schedule in use (see "PID_control.h") is kept in one record at
+ *              PARAM_EEPROM_ADDR of the on-chip EEPROM, with a magic word that holds
+ *              PID_SCHED_POINTS and a CRC-16 of the record. PARAM_load() at power up loads
+ *              a valid record and leaves the K_P, K_I and K_D of "macros.h" otherwise.
+ *              Both functions are for the main loop only.
+ * @file        PARAM_store.h
+ */
+/* -----------------------          Include Files       --------------------- */
+#include <stdint.h>                         // Library of Standard Integer Types
+#include <stdbool.h>                        // Library of Standard Boolean Types
+#include "macros.h"
+
+#ifndef PARAM_STORE_H_
+#define PARAM_STORE_H_
+
+/* -----------------------      Macro Definitions       --------------------- */
+#define PARAM_EEPROM_ADDR   0                       // Macro for the byte address of the record (multiple of 4)
+#define PARAM_MAGIC         (0x50494400UL | PID_SCHED_POINTS)   // Macro for "PID" and the number of breakpoints
+
+/* -----------------------      Function Prototypes     --------------------- */
+bool PARAM_load(void);                              // Load the stored parameters, false if there are none
+bool PARAM_save(void);                              // Store the parameters in use, false on an EEPROM error
+
+#endif /* PARAM_STORE_H_ */
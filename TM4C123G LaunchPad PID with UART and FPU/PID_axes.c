@@ -0,0 +1,81 @@
+/*!
+ * @author      Yash Bansod
+ * @date        17th October 2026
+ *
+ * @brief       Source containing the multi-axis PID controller
+ * @file        PID_axes.c
+ */
+/* -----------------------          Include Files       --------------------- */
+#include <stdlib.h>                         // Standard Library
+#include <string.h>                         // Library for String functions
+#include "PID_axes.h"
+#include "PID_control.h"
+
+/* -----------------------      Macro Definitions       --------------------- */
+// Macro to saturate X to +/-LIM
+#define PID_AXES_SAT(X, LIM)    ((X) > (LIM) ? (LIM) : ((X) < -(LIM) ? -(LIM) : (X)))
+
+/* -----------------------      Function Definition     --------------------- */
+// Function to reset the controller with ui32Axes axes in use
+void PID_axesInit(tPIDAxes *psAxes, uint32_t ui32Axes){
+    memset(psAxes, 0, sizeof(*psAxes));
+    psAxes->ui32Axes = (ui32Axes > PID_MAX_AXES) ? PID_MAX_AXES : ui32Axes;
+    OBS_init(&psAxes->sObs, OBS_MODE);
+}
+
+// Function for the error of the position i64Pos to i64DesPos, saturated to +/-PID_ERROR_MAX
+int32_t PID_axesError(int64_t i64DesPos, int64_t i64Pos){
+    int64_t i64Error = i64DesPos - i64Pos;
+
+    if (i64Error > PID_ERROR_MAX) return PID_ERROR_MAX;
+    if (i64Error < -PID_ERROR_MAX) return -PID_ERROR_MAX;
+    return (int32_t)i64Error;
+}
+
+// Function to update all axes from their encoder positions and speeds in RPM
+void PID_axesUpdate(tPIDAxes *psAxes, const int64_t *pi64Pos, const int32_t *pi32Rpm){
+    const uint32_t ui32Axes = psAxes->ui32Axes;
+    uint32_t ui32Axis;
+
+    // Estimate the velocity of every axis, the desired positions start with the estimate
+    if (psAxes->sObs.ui8Mode != OBS_OFF){
+        if (!psAxes->sObs.bStart)
+            memcpy(psAxes->i64DesOld, psAxes->i64DesPos, sizeof(psAxes->i64DesOld));
+        OBS_update(&psAxes->sObs, ui32Axes, pi64Pos);
+    }
+
+    // Calculate the Error and Difference of Error of every axis
+    for (ui32Axis = 0; ui32Axis < ui32Axes; ui32Axis++){
+        int32_t i32Error = PID_axesError(psAxes->i64DesPos[ui32Axis], pi64Pos[ui32Axis]);
+
+        if (psAxes->sObs.ui8Mode == OBS_OFF){
+            int32_t i32Diff = i32Error - psAxes->i32ErrorNew[ui32Axis];
+            psAxes->i32DiffError[ui32Axis] = PID_AXES_SAT(i32Diff, PID_DIFF_MAX) * (1 << PID_DIFF_SHIFT);
+        }
+        else {
+            float f32Diff = (float)(psAxes->i64DesPos[ui32Axis] - psAxes->i64DesOld[ui32Axis]) -
+                            psAxes->sObs.f32Vel[ui32Axis];
+            f32Diff *= (float)(1 << PID_DIFF_SHIFT);
+            psAxes->i32DiffError[ui32Axis] = (int32_t)PID_AXES_SAT(f32Diff, (float)(PID_DIFF_MAX << PID_DIFF_SHIFT));
+        }
+        psAxes->i64DesOld[ui32Axis] = psAxes->i64DesPos[ui32Axis];
+        psAxes->i32ErrorNew[ui32Axis] = i32Error;
+    }
+
+    // Select the scheduled gains of every axis from its own error and speed, then compute its
+    // Control signal with the selected arithmetic
+    for (ui32Axis = 0; ui32Axis < ui32Axes; ui32Axis++){
+        PID_gainsSchedule(psAxes->i32ErrorNew[ui32Axis], pi32Rpm[ui32Axis]);
+        psAxes->i16Control[ui32Axis] = PID_compute(psAxes->i32ErrorNew[ui32Axis],
+                                                   psAxes->i32DiffError[ui32Axis],
+                                                   &psAxes->i32SumError[ui32Axis]);
+    }
+
+    // Stop the axes that are inside the dead band and clear their Sum of Error
+    for (ui32Axis = 0; ui32Axis < ui32Axes; ui32Axis++){
+        if (abs(psAxes->i32ErrorNew[ui32Axis]) <= PID_DEADBAND){
+            psAxes->i32SumError[ui32Axis] = 0;
+            psAxes->i16Control[ui32Axis] = 0;
+        }
+    }
+}
@@ -0,0 +1,51 @@
+/*!
+ * @author      Yash Bansod
+ * @date        17th October 2026
+ *
+ * @brief       Header containing the multi-axis PID controller
+ * @details     The controller updates all of its axes in one call. Its state is kept
+ *              as one array per field (struct of arrays) so that every pass of the
+ *              update walks a contiguous block of memory.
+ *              Positions are signed 64 bit multi-turn ticks (see "POS_track.h"). The
+ *              error is saturated to +/-PID_ERROR_MAX, so that the difference of two
+ *              errors still fits in an int32_t.
+ *              The Difference of Error has PID_DIFF_SHIFT fractional bits. With OBS_MODE
+ *              off it is the difference of the last two errors; otherwise it is the move
+ *              of the desired position in the tick less the velocity estimate of the
+ *              observer (see "OBS_filter.h"). The Error and the Sum of Error always
+ *              come from the reading itself.
+ *              Each axis picks its scheduled gains (see "PID_control.h") from its own
+ *              error and RPM just before its control law.
+ * @file        PID_axes.h
+ */
+/* -----------------------          Include Files       --------------------- */
+#include <stdint.h>                         // Library of Standard Integer Types
+#include "macros.h"
+#include "OBS_filter.h"
+
+#ifndef PID_AXES_H_
+#define PID_AXES_H_
+
+/* -----------------------      Macro Definitions       --------------------- */
+#define PID_ERROR_MAX   (INT32_MAX / 2)             // Macro for the largest |error| in ticks given to the control law
+#define PID_DIFF_MAX    (INT32_C(1) << (30 - PID_DIFF_SHIFT))   // Macro for the largest |Difference of Error| in whole ticks
+
+/* -----------------------      Global Variables        --------------------- */
+typedef struct {
+    uint32_t ui32Axes;                              // Number of axes in use
+    int64_t i64DesPos[PID_MAX_AXES];                // Desired Shaft position in ticks
+    int64_t i64DesOld[PID_MAX_AXES];                // Desired Shaft position of the last update
+    int32_t i32ErrorNew[PID_MAX_AXES];              // Error in ticks
+    int32_t i32DiffError[PID_MAX_AXES];             // Difference of Error in 1/2^PID_DIFF_SHIFT ticks
+    int32_t i32SumError[PID_MAX_AXES];              // Sum of Error in ticks
+    int16_t i16Control[PID_MAX_AXES];               // Signed Control signal in %, 0 inside the dead band
+    tObserver sObs;                                 // Observer of the velocity of every axis
+} tPIDAxes;
+
+/* -----------------------      Function Prototypes     --------------------- */
+void PID_axesInit(tPIDAxes *psAxes, uint32_t ui32Axes);                 // Function to reset the controller
+void PID_axesUpdate(tPIDAxes *psAxes, const int64_t *pi64Pos,
+                    const int32_t *pi32Rpm);                            // Function to update all axes
+int32_t PID_axesError(int64_t i64DesPos, int64_t i64Pos);               // Function for the saturated error of a position
+
+#endif /* PID_AXES_H_ */
@@ -0,0 +1,294 @@
+/*!
+ * @author      Yash Bansod
+ * @date        17th October 2026
+ *
+ * @brief       Source containing function definitions for the PID control law
+ * @details     The Proportional term is computed from the error, the Derivative term
+ *              from the difference of error and the Integral term from the sum of error.
+ *              The difference of error has PID_DIFF_SHIFT fractional bits (see "PID_axes.h").
+ *              The Integral term is not updated while the Proportional term alone gives
+ *              >= 100% of control signal and is limited to contribute max 50%.
+ *              Only the variant selected by PID_ARITHMETIC is compiled for the target.
+ *              The gains start at K_P, K_I and K_D and can be replaced at run time by
+ *              PID_gainsSet() or by a gain schedule with PID_scheduleSet(), which also
+ *              keep their Q15 and Q31 forms. A Q15 or Q31 gain gives up as many fractional
+ *              bits as it needs integer bits, and its products are shifted back by them.
+ *              The parameters are held in two banks. The main loop writes the spare bank
+ *              and then makes it the one in use with a single store, so QEI1IntHandler,
+ *              which only reads the bank in use, never sees half of an update. Only one
+ *              context (the main loop) may write the banks.
+ *              PID_gainsSchedule() picks the gains for an axis: with a schedule they are
+ *              interpolated between the two breakpoints around |input|, which are spaced
+ *              2^ui8Shift apart so that the index and fraction take a shift and a mask.
+ * @file        PID_control.c
+ */
+/* -----------------------          Include Files       --------------------- */
+#include "PID_control.h"
+
+/* -----------------------      Macro Definitions       --------------------- */
+#define PID_OUT_MAX     100                         // Macro for the limit of the Control signal in %
+#define PID_I_MAX       50                          // Macro for the limit of the Integral term in %
+
+// Macros to convert a gain to Q15 and Q31 with S integer bits taken from the fraction
+#define PID_Q15_GAIN(K, S)  ((int32_t)((K) * (double)(INT32_C(1) << (15 - (S))) + 0.5))
+#define PID_Q31_GAIN(K, S)  ((int64_t)((K) * (double)(INT64_C(1) << (31 - (S))) + 0.5))
+// Macro for 1 if the gain K does not fit Q15 with N - 1 integer bits, Q31 then fits as well
+#define PID_GAIN_OVER(K, N) ((K) * (double)(INT32_C(1) << (16 - (N))) + 0.5 >= 32768.0)
+// Macro for the integer bits needed by the gain K (0 .. PID_GAIN_MAX)
+#define PID_GAIN_SHIFT(K)   (PID_GAIN_OVER(K, 1) + PID_GAIN_OVER(K, 2) + PID_GAIN_OVER(K, 3) + \
+                             PID_GAIN_OVER(K, 4) + PID_GAIN_OVER(K, 5) + PID_GAIN_OVER(K, 6) + \
+                             PID_GAIN_OVER(K, 7) + PID_GAIN_OVER(K, 8) + PID_GAIN_OVER(K, 9) + \
+                             PID_GAIN_OVER(K, 10) + PID_GAIN_OVER(K, 11) + PID_GAIN_OVER(K, 12) + \
+                             PID_GAIN_OVER(K, 13) + PID_GAIN_OVER(K, 14) + PID_GAIN_OVER(K, 15))
+#define PID_SHIFT_MAX   15                          // Macro for the widest breakpoint spacing (Q15 products fit 31 bits)
+
+// Macro to saturate X to +/-LIM
+#define PID_SAT(X, LIM) ((X) > (LIM) ? (LIM) : ((X) < -(LIM) ? -(LIM) : (X)))
+// Macro to drop N fractional bits of X rounding towards zero, as a float to int cast does
+#define PID_TRUNC(X, N) ((X) < 0 ? -((-(X)) >> (N)) : (X) >> (N))
+// Macros to bring a product of a gain with S integer bits back to Q15 or Q31, saturated to 2^29 or 2^61
+#define PID_Q15_TERM(X, S)  (PID_SAT(X, (INT32_C(1) << 29) >> (S)) * (INT32_C(1) << (S)))
+#define PID_Q31_TERM(X, S)  (PID_SAT(X, (INT64_C(1) << 61) >> (S)) * (INT64_C(1) << (S)))
+
+/* -----------------------      Global Variables        --------------------- */
+typedef struct {
+    float f32Kp, f32Ki, f32Kd;                      // Gains in single precision float
+    int32_t i32KpQ15, i32KiQ15, i32KdQ15;           // Gains in Q15
+    int64_t i64KpQ31, i64KiQ31, i64KdQ31;           // Gains in Q31
+    uint8_t ui8KpShift, ui8KiShift, ui8KdShift;     // Integer bits of the Q15 and Q31 gains
+} tPIDGains;
+
+typedef struct {
+    uint8_t ui8Source;                              // PID_SCHED_OFF, PID_SCHED_ERROR or PID_SCHED_RPM
+    uint8_t ui8Shift;                               // Breakpoints every 2^ui8Shift of the input
+    float f32Scale;                                 // 1 / 2^ui8Shift
+    tPIDGains psPoint[PID_SCHED_POINTS];            // Gains at the breakpoints, psPoint[0] alone when off
+} tPIDParams;
+
+#define PID_GAINS_INIT(KP, KI, KD)  {(float)(KP), (float)(KI), (float)(KD), \
+                                     PID_Q15_GAIN(KP, PID_GAIN_SHIFT(KP)), PID_Q15_GAIN(KI, PID_GAIN_SHIFT(KI)), \
+                                     PID_Q15_GAIN(KD, PID_GAIN_SHIFT(KD)), \
+                                     PID_Q31_GAIN(KP, PID_GAIN_SHIFT(KP)), PID_Q31_GAIN(KI, PID_GAIN_SHIFT(KI)), \
+                                     PID_Q31_GAIN(KD, PID_GAIN_SHIFT(KD)), \
+                                     PID_GAIN_SHIFT(KP), PID_GAIN_SHIFT(KI), PID_GAIN_SHIFT(KD)}
+
+static tPIDParams psBank[2] = {
+    {PID_SCHED_OFF, 0, 1.0f, {PID_GAINS_INIT(K_P, K_I, K_D)}},
+};
+static volatile uint32_t ui32Active = 0;            // Index of the bank in use
+static tPIDGains sSched;                            // Gains interpolated for the axis being updated
+static const tPIDGains *psGains = &psBank[0].psPoint[0];   // Gains used by the control law
+
+/* -----------------------      Function Definition     --------------------- */
+// Function to limit a gain to 0 .. PID_GAIN_MAX (NaN gives 0), sets ui8Clip in *pui8Clipped if it was
+static float PID_gainLimit(float f32K, uint8_t ui8Clip, uint8_t *pui8Clipped){
+    if (f32K >= 0 && f32K <= PID_GAIN_MAX)
+        return f32K;
+    *pui8Clipped |= ui8Clip;
+    return (f32K > PID_GAIN_MAX) ? PID_GAIN_MAX : 0;
+}
+
+// Function to store a gain set, the Q15 and Q31 gains with the integer bits of pui8Shift
+static void PID_pointSet(volatile tPIDGains *psPoint, const float pf32K[3], const uint8_t pui8Shift[3]){
+    psPoint->f32Kp = pf32K[0];
+    psPoint->f32Ki = pf32K[1];
+    psPoint->f32Kd = pf32K[2];
+    psPoint->i32KpQ15 = PID_Q15_GAIN(pf32K[0], pui8Shift[0]);
+    psPoint->i32KiQ15 = PID_Q15_GAIN(pf32K[1], pui8Shift[1]);
+    psPoint->i32KdQ15 = PID_Q15_GAIN(pf32K[2], pui8Shift[2]);
+    psPoint->i64KpQ31 = PID_Q31_GAIN(pf32K[0], pui8Shift[0]);
+    psPoint->i64KiQ31 = PID_Q31_GAIN(pf32K[1], pui8Shift[1]);
+    psPoint->i64KdQ31 = PID_Q31_GAIN(pf32K[2], pui8Shift[2]);
+    psPoint->ui8KpShift = pui8Shift[0];
+    psPoint->ui8KiShift = pui8Shift[1];
+    psPoint->ui8KdShift = pui8Shift[2];
+}
+
+// Function to write the spare bank and make it the bank in use, returns the PID_CLIP_x bits of the
+// limited gains. The spare bank is written through a volatile pointer so that the compiler cannot
+// move its stores past the swap. A gain has the same integer bits at every breakpoint, enough for
+// the largest, so that the Q15 and Q31 gains can be interpolated.
+static uint8_t PID_paramsLoad(uint8_t ui8Source, uint8_t ui8Shift, const float pf32Gains[][3], uint32_t ui32Points){
+    uint32_t ui32Spare = ui32Active ^ 1;
+    volatile tPIDParams *psSpare = &psBank[ui32Spare];
+    float pf32K[PID_SCHED_POINTS][3];
+    float pf32Max[3] = {0, 0, 0};
+    uint8_t pui8Shift[3];
+    uint8_t ui8Clipped = 0;
+    uint32_t ui32Point, ui32Gain;
+
+    for (ui32Point = 0; ui32Point < PID_SCHED_POINTS; ui32Point++){
+        const float *pf32Point = pf32Gains[(ui32Point < ui32Points) ? ui32Point : ui32Points - 1];
+        for (ui32Gain = 0; ui32Gain < 3; ui32Gain++){
+            pf32K[ui32Point][ui32Gain] = PID_gainLimit(pf32Point[ui32Gain], PID_CLIP_KP << ui32Gain, &ui8Clipped);
+            if (pf32K[ui32Point][ui32Gain] > pf32Max[ui32Gain]) pf32Max[ui32Gain] = pf32K[ui32Point][ui32Gain];
+        }
+    }
+    for (ui32Gain = 0; ui32Gain < 3; ui32Gain++)
+        pui8Shift[ui32Gain] = PID_GAIN_SHIFT(pf32Max[ui32Gain]);
+
+    ui8Shift = (ui8Shift > PID_SHIFT_MAX) ? PID_SHIFT_MAX : ui8Shift;
+    psSpare->ui8Source = (ui8Source > PID_SCHED_RPM) ? PID_SCHED_OFF : ui8Source;
+    psSpare->ui8Shift = ui8Shift;
+    psSpare->f32Scale = 1.0f / (float)(1UL << ui8Shift);
+    for (ui32Point = 0; ui32Point < PID_SCHED_POINTS; ui32Point++)
+        PID_pointSet(&psSpare->psPoint[ui32Point], pf32K[ui32Point], pui8Shift);
+
+    ui32Active = ui32Spare;
+    psGains = &psBank[ui32Spare].psPoint[0];
+    return ui8Clipped;
+}
+
+// Function to load new gains and turn the gain schedule off, returns the PID_CLIP_x bits of the limited gains
+uint8_t PID_gainsSet(float f32Kp, float f32Ki, float f32Kd){
+    const float pf32Gains[1][3] = {{f32Kp, f32Ki, f32Kd}};
+    return PID_paramsLoad(PID_SCHED_OFF, 0, pf32Gains, 1);
+}
+
+// Function to read the gains in use
+void PID_gainsGet(float *pf32Kp, float *pf32Ki, float *pf32Kd){
+    *pf32Kp = psGains->f32Kp;
+    *pf32Ki = psGains->f32Ki;
+    *pf32Kd = psGains->f32Kd;
+}
+
+// Function to load a gain schedule of PID_SCHED_POINTS breakpoints, 2^ui8Shift apart, returns the
+// PID_CLIP_x bits of the limited gains
+uint8_t PID_scheduleSet(uint8_t ui8Source, uint8_t ui8Shift, const float pf32Gains[][3]){
+    return PID_paramsLoad(ui8Source, ui8Shift, pf32Gains, PID_SCHED_POINTS);
+}
+
+// Function to read the gain schedule in use
+void PID_scheduleGet(uint8_t *pui8Source, uint8_t *pui8Shift, float pf32Gains[][3]){
+    const tPIDParams *psParams = &psBank[ui32Active];
+    uint32_t ui32Point;
+
+    *pui8Source = psParams->ui8Source;
+    *pui8Shift = psParams->ui8Shift;
+    for (ui32Point = 0; ui32Point < PID_SCHED_POINTS; ui32Point++){
+        pf32Gains[ui32Point][0] = psParams->psPoint[ui32Point].f32Kp;
+        pf32Gains[ui32Point][1] = psParams->psPoint[ui32Point].f32Ki;
+        pf32Gains[ui32Point][2] = psParams->psPoint[ui32Point].f32Kd;
+    }
+}
+
+// Function to select the gains of an axis from its error or RPM, called before its control law
+void PID_gainsSchedule(int32_t i32Error, int32_t i32Rpm){
+    const tPIDParams *psParams = &psBank[ui32Active];
+    const uint32_t ui32Shift = psParams->ui8Shift;
+
+    if (psParams->ui8Source == PID_SCHED_OFF){
+        psGains = &psParams->psPoint[0];
+        return;
+    }
+
+    int32_t i32Input = (psParams->ui8Source == PID_SCHED_ERROR) ? i32Error : i32Rpm;
+    uint32_t ui32Input = (i32Input < 0) ? -(uint32_t)i32Input : (uint32_t)i32Input;
+    uint32_t ui32Index = ui32Input >> ui32Shift;
+    if (ui32Index >= PID_SCHED_POINTS - 1){
+        psGains = &psParams->psPoint[PID_SCHED_POINTS - 1];
+        return;
+    }
+
+    // Linear interpolation between the breakpoints below and above the input
+    const tPIDGains *psLo = &psParams->psPoint[ui32Index];
+    const tPIDGains *psHi = psLo + 1;
+    int32_t i32Frac = (int32_t)(ui32Input & ((1UL << ui32Shift) - 1));
+#if PID_ARITHMETIC == PID_F32 || defined(HOST_SIM)
+    float f32Frac = i32Frac * psParams->f32Scale;
+    sSched.f32Kp = psLo->f32Kp + (psHi->f32Kp - psLo->f32Kp) * f32Frac;
+    sSched.f32Ki = psLo->f32Ki + (psHi->f32Ki - psLo->f32Ki) * f32Frac;
+    sSched.f32Kd = psLo->f32Kd + (psHi->f32Kd - psLo->f32Kd) * f32Frac;
+#endif
+#if PID_ARITHMETIC == PID_Q15 || defined(HOST_SIM)
+    sSched.i32KpQ15 = psLo->i32KpQ15 + PID_TRUNC((psHi->i32KpQ15 - psLo->i32KpQ15) * i32Frac, ui32Shift);
+    sSched.i32KiQ15 = psLo->i32KiQ15 + PID_TRUNC((psHi->i32KiQ15 - psLo->i32KiQ15) * i32Frac, ui32Shift);
+    sSched.i32KdQ15 = psLo->i32KdQ15 + PID_TRUNC((psHi->i32KdQ15 - psLo->i32KdQ15) * i32Frac, ui32Shift);
+#endif
+#if PID_ARITHMETIC == PID_Q31 || defined(HOST_SIM)
+    sSched.i64KpQ31 = psLo->i64KpQ31 + PID_TRUNC((psHi->i64KpQ31 - psLo->i64KpQ31) * i32Frac, ui32Shift);
+    sSched.i64KiQ31 = psLo->i64KiQ31 + PID_TRUNC((psHi->i64KiQ31 - psLo->i64KiQ31) * i32Frac, ui32Shift);
+    sSched.i64KdQ31 = psLo->i64KdQ31 + PID_TRUNC((psHi->i64KdQ31 - psLo->i64KdQ31) * i32Frac, ui32Shift);
+#endif
+#if PID_ARITHMETIC != PID_F32 || defined(HOST_SIM)
+    sSched.ui8KpShift = psLo->ui8KpShift;
+    sSched.ui8KiShift = psLo->ui8KiShift;
+    sSched.ui8KdShift = psLo->ui8KdShift;
+#endif
+    psGains = &sSched;
+}
+
+#if PID_ARITHMETIC == PID_F32 || defined(HOST_SIM)
+// Function for PID control in single precision float
+int16_t PID_computeF32(int32_t i32Error, int32_t i32DiffError, int32_t *pi32SumError){
+    float f32P_Control = i32Error * psGains->f32Kp;
+    float f32I_Control = 0;
+    float f32D_Control = i32DiffError * psGains->f32Kd * (1.0f / (1 << PID_DIFF_SHIFT));
+
+    if (f32P_Control < PID_OUT_MAX && f32P_Control > -PID_OUT_MAX){
+        *pi32SumError += i32Error;
+        f32I_Control = *pi32SumError * psGains->f32Ki;
+
+        if (f32I_Control > PID_I_MAX || f32I_Control < -PID_I_MAX){
+            *pi32SumError -= i32Error;
+            f32I_Control = (f32I_Control > 0) ? PID_I_MAX : -PID_I_MAX;
+        }
+    }
+
+    float f32Control = f32P_Control + f32I_Control + f32D_Control;
+    return (int16_t)PID_SAT(f32Control, PID_OUT_MAX);
+}
+#endif
+
+#if PID_ARITHMETIC == PID_Q15 || defined(HOST_SIM)
+// Function for PID control in Q15 fixed point
+int16_t PID_computeQ15(int32_t i32Error, int32_t i32DiffError, int32_t *pi32SumError){
+    // Error and Difference of Error are saturated to 16 bits so that the products fit in 31 bits.
+    // SumError is not, and its product is taken in 64 bits (SMULL) before it is saturated.
+    // The products are in Q15 less the integer bits of the gain and are brought back to Q15.
+    int32_t i32P_Control = PID_Q15_TERM(PID_SAT(i32Error, INT16_MAX) * psGains->i32KpQ15, psGains->ui8KpShift);
+    int32_t i32I_Control = 0;
+    int32_t i32D_Control = PID_Q15_TERM(PID_TRUNC(PID_SAT(i32DiffError, INT16_MAX) * psGains->i32KdQ15, PID_DIFF_SHIFT),
+                                        psGains->ui8KdShift);
+
+    if (i32P_Control < (PID_OUT_MAX << 15) && i32P_Control > -(PID_OUT_MAX << 15)){
+        *pi32SumError += i32Error;
+        i32I_Control = (int32_t)PID_Q15_TERM((int64_t)*pi32SumError * psGains->i32KiQ15, psGains->ui8KiShift);
+
+        if (i32I_Control > (PID_I_MAX << 15) || i32I_Control < -(PID_I_MAX << 15)){
+            *pi32SumError -= i32Error;
+            i32I_Control = (i32I_Control > 0) ? (PID_I_MAX << 15) : -(PID_I_MAX << 15);
+        }
+    }
+
+    // P and D are limited to 2^29 so that the sum of the three terms cannot overflow
+    int32_t i32Control = PID_TRUNC(i32P_Control + i32I_Control + i32D_Control, 15);
+    return (int16_t)PID_SAT(i32Control, PID_OUT_MAX);
+}
+#endif
+
+#if PID_ARITHMETIC == PID_Q31 || defined(HOST_SIM)
+// Function for PID control in Q31 fixed point
+int16_t PID_computeQ31(int32_t i32Error, int32_t i32DiffError, int32_t *pi32SumError){
+    // Error and Difference of Error are saturated to 30 bits so that the sum fits in 63 bits.
+    // The products are in Q31 less the integer bits of the gain and are brought back to Q31.
+    int64_t i64P_Control = PID_Q31_TERM((int64_t)PID_SAT(i32Error, INT32_C(1) << 30) * psGains->i64KpQ31,
+                                        psGains->ui8KpShift);
+    int64_t i64I_Control = 0;
+    int64_t i64D_Control = PID_Q31_TERM(PID_TRUNC((int64_t)PID_SAT(i32DiffError, INT32_C(1) << 30) * psGains->i64KdQ31,
+                                                  PID_DIFF_SHIFT), psGains->ui8KdShift);
+
+    if (i64P_Control < ((int64_t)PID_OUT_MAX << 31) && i64P_Control > -((int64_t)PID_OUT_MAX << 31)){
+        *pi32SumError += i32Error;
+        i64I_Control = PID_Q31_TERM((int64_t)*pi32SumError * psGains->i64KiQ31, psGains->ui8KiShift);
+
+        if (i64I_Control > ((int64_t)PID_I_MAX << 31) || i64I_Control < -((int64_t)PID_I_MAX << 31)){
+            *pi32SumError -= i32Error;
+            i64I_Control = (i64I_Control > 0) ? ((int64_t)PID_I_MAX << 31) : -((int64_t)PID_I_MAX << 31);
+        }
+    }
+
+    int64_t i64Control = PID_TRUNC(i64P_Control + i64I_Control + i64D_Control, 31);
+    return (int16_t)PID_SAT(i64Control, PID_OUT_MAX);
+}
+#endif
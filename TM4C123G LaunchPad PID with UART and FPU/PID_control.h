@@ -0,0 +1,55 @@
+/*!
+ * @author      Yash Bansod
+ * @date        17th October 2026
+ *
+ * @brief       Header containing function prototypes for the PID control law
+ * @details     The control law is available in single precision float (FPU), Q15 and
+ *              Q31 fixed point. PID_ARITHMETIC in "macros.h" selects the one used by
+ *              PID_Update(). All variants return the signed duty cycle in percent,
+ *              limited to +/-100, and apply the same anti-windup rules.
+ *              The gains are limited to 0 .. PID_GAIN_MAX. The Q15 and Q31 forms of a gain
+ *              have as many integer bits as it needs, taken from the fraction, so gains
+ *              above 1 are applied as they are in every variant. The setters return the
+ *              PID_CLIP_x bits of the gains that were limited (or NaN).
+ *              The gains can be scheduled on |error| or |RPM|: PID_SCHED_POINTS sets of
+ *              gains at 0, 2^n, 2*2^n .. of the input, interpolated linearly in between
+ *              and held beyond the last one. PID_gainsSchedule() must be called for each
+ *              axis, with its own error and RPM, right before its control law, as the
+ *              selected gains hold until the next call. PID_gainsSet(), PID_scheduleSet() and
+ *              PID_gainsGet() are for the main loop only; see PID_control.c.
+ * @file        PID_control.h
+ */
+/* -----------------------          Include Files       --------------------- */
+#include <stdint.h>                         // Library of Standard Integer Types
+#include "macros.h"
+
+/* -----------------------      Function Prototypes     --------------------- */
+#ifndef PID_CONTROL_H_
+#define PID_CONTROL_H_
+
+#define PID_GAIN_MAX    32767.0f                    // Macro for the largest gain (Q15 with 15 integer bits)
+#define PID_CLIP_KP     0x01                        // Macro for K_P limited by the setter
+#define PID_CLIP_KI     0x02                        // Macro for K_I limited by the setter
+#define PID_CLIP_KD     0x04                        // Macro for K_D limited by the setter
+#define PID_SCHED_OFF   0                           // Macro for fixed gains
+#define PID_SCHED_ERROR 1                           // Macro for gains scheduled on |error| in ticks
+#define PID_SCHED_RPM   2                           // Macro for gains scheduled on |RPM|
+
+uint8_t PID_gainsSet(float f32Kp, float f32Ki, float f32Kd);            // Load new gains, no schedule
+void PID_gainsGet(float *pf32Kp, float *pf32Ki, float *pf32Kd);         // Read the gains in use
+uint8_t PID_scheduleSet(uint8_t ui8Source, uint8_t ui8Shift, const float pf32Gains[][3]);  // Load a gain schedule
+void PID_scheduleGet(uint8_t *pui8Source, uint8_t *pui8Shift, float pf32Gains[][3]);       // Read the gain schedule
+void PID_gainsSchedule(int32_t i32Error, int32_t i32Rpm);               // Select the gains of this axis
+int16_t PID_computeF32(int32_t i32Error, int32_t i32DiffError, int32_t *pi32SumError);
+int16_t PID_computeQ15(int32_t i32Error, int32_t i32DiffError, int32_t *pi32SumError);
+int16_t PID_computeQ31(int32_t i32Error, int32_t i32DiffError, int32_t *pi32SumError);
+
+#if PID_ARITHMETIC == PID_Q15
+#define PID_compute     PID_computeQ15              // Macro for the PID control law in use
+#elif PID_ARITHMETIC == PID_Q31
+#define PID_compute     PID_computeQ31              // Macro for the PID control law in use
+#else
+#define PID_compute     PID_computeF32              // Macro for the PID control law in use
+#endif
+
+#endif /* PID_CONTROL_H_ */
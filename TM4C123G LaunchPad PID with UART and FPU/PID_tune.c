@@ -0,0 +1,77 @@
+/*!
+ * @author      Yash Bansod
+ * @date        17th October 2026
+ *
+ * @brief       Source containing the relay feedback auto-tuner of the position PID
+ * @file        PID_tune.c
+ */
+/* -----------------------          Include Files       --------------------- */
+#include <math.h>                           // Library of Math functions
+#include "PID_tune.h"
+
+/* -----------------------      Function Definition     --------------------- */
+// Function to start the relay experiment around the position i64Center
+void PID_tuneStart(tPIDTune *psTune, int64_t i64Center){
+    psTune->i16Out = TUNE_RELAY;
+    psTune->i64Center = i64Center;
+    psTune->i64Max = i64Center;
+    psTune->i64Min = i64Center;
+    psTune->ui32Tick = 0;
+    psTune->ui32CycleStart = 0;
+    psTune->ui32Switch = 0;
+    psTune->ui32PeriodSum = 0;
+    psTune->ui32PeakSum = 0;
+    psTune->bLoaded = false;
+    psTune->ui8State = TUNE_RUN;
+}
+
+// Function to compute the relay output for the position of this tick
+int16_t PID_tuneUpdate(tPIDTune *psTune, int64_t i64Pos){
+    if (psTune->ui8State != TUNE_RUN)
+        return 0;
+
+    if (++psTune->ui32Tick > TUNE_TIMEOUT){
+        psTune->ui8State = TUNE_FAIL;
+        return 0;
+    }
+
+    if (i64Pos > psTune->i64Max) psTune->i64Max = i64Pos;
+    if (i64Pos < psTune->i64Min) psTune->i64Min = i64Pos;
+
+    if (psTune->i16Out > 0 && i64Pos > psTune->i64Center + TUNE_HYST){
+        psTune->i16Out = -TUNE_RELAY;
+    }
+    else if (psTune->i16Out < 0 && i64Pos < psTune->i64Center - TUNE_HYST){
+        psTune->i16Out = TUNE_RELAY;
+
+        // A switch to +TUNE_RELAY ends a cycle, measure it once the run in is over
+        if (++psTune->ui32Switch > TUNE_SKIP){
+            psTune->ui32PeriodSum += psTune->ui32Tick - psTune->ui32CycleStart;
+            psTune->ui32PeakSum += (uint32_t)(psTune->i64Max - psTune->i64Min);
+        }
+        psTune->ui32CycleStart = psTune->ui32Tick;
+        psTune->i64Max = i64Pos;
+        psTune->i64Min = i64Pos;
+
+        if (psTune->ui32Switch == TUNE_SKIP + TUNE_CYCLES){
+            float f32Amp = 0.5f * (float)psTune->ui32PeakSum / TUNE_CYCLES;
+            float f32Root = f32Amp * f32Amp - (float)(TUNE_HYST * TUNE_HYST);
+
+            if (f32Root <= 0){
+                psTune->ui8State = TUNE_FAIL;
+                return 0;
+            }
+            psTune->f32Ku = 4.0f * TUNE_RELAY / (3.14159265f * sqrtf(f32Root));
+            psTune->f32Pu = (float)psTune->ui32PeriodSum / TUNE_CYCLES;
+
+            // Ziegler-Nichols "no overshoot" rule in the per tick form of PID_control.c
+            psTune->f32Kp = 0.2f * psTune->f32Ku;
+            psTune->f32Ki = psTune->f32Kp / (0.5f * psTune->f32Pu);
+            psTune->f32Kd = psTune->f32Kp * psTune->f32Pu / 3.0f;
+            psTune->ui8State = TUNE_DONE;
+            return 0;
+        }
+    }
+
+    return psTune->i16Out;
+}
@@ -0,0 +1,57 @@
+/*!
+ * @author      Yash Bansod
+ * @date        17th October 2026
+ *
+ * @brief       Header containing the relay feedback auto-tuner of the position PID
+ * @details     While the tuner runs, the motor is driven by a relay of +/-TUNE_RELAY %
+ *              duty with TUNE_HYST ticks of hysteresis around the held position, which
+ *              makes the position loop oscillate at its ultimate period. The peak to peak
+ *              amplitude and the period are averaged over TUNE_CYCLES cycles after
+ *              TUNE_SKIP cycles of run in, and give the ultimate gain
+ *              Ku = 4 * relay / (pi * sqrt(a^2 - hyst^2)) in % of duty per tick and the
+ *              ultimate period Pu in ticks of the QEI1 interrupt.
+ *              The PID gains follow the Ziegler-Nichols "no overshoot" rule
+ *              Kp = 0.2 Ku, Ti = Pu / 2, Td = Pu / 3, in the per tick form used by
+ *              PID_control.c (K_I = Kp / Ti, K_D = Kp * Td). The encoder resolution keeps
+ *              the oscillation small, so Kp and K_D often come out above 1. They are loaded
+ *              as they are by PID_gainsSet(), which reports any gain it had to limit.
+ * @file        PID_tune.h
+ */
+/* -----------------------          Include Files       --------------------- */
+#include <stdint.h>                         // Library of Standard Integer Types
+#include <stdbool.h>                        // Library of Standard Boolean Types
+#include "macros.h"
+
+#ifndef PID_TUNE_H_
+#define PID_TUNE_H_
+
+/* -----------------------      Macro Definitions       --------------------- */
+#define TUNE_IDLE       0                           // Macro for the tuner not running
+#define TUNE_RUN        1                           // Macro for the relay experiment running
+#define TUNE_DONE       2                           // Macro for new gains available
+#define TUNE_FAIL       3                           // Macro for no steady oscillation before the timeout
+
+/* -----------------------      Global Variables        --------------------- */
+typedef struct {
+    volatile uint8_t ui8State;                      // TUNE_IDLE, TUNE_RUN, TUNE_DONE or TUNE_FAIL
+    int16_t i16Out;                                 // Relay output in % of duty
+    int64_t i64Center;                              // Position the relay oscillates around
+    int64_t i64Max;                                 // Highest position of the present cycle
+    int64_t i64Min;                                 // Lowest position of the present cycle
+    uint32_t ui32Tick;                              // Ticks since the start
+    uint32_t ui32CycleStart;                        // Tick of the last switch to +TUNE_RELAY
+    uint32_t ui32Switch;                            // Number of switches to +TUNE_RELAY
+    uint32_t ui32PeriodSum;                         // Sum of the measured periods in ticks
+    uint32_t ui32PeakSum;                           // Sum of the measured peak to peak amplitudes
+    float f32Ku;                                    // Ultimate gain in % per tick
+    float f32Pu;                                    // Ultimate period in ticks
+    float f32Kp, f32Ki, f32Kd;                      // Gains computed from Ku and Pu
+    bool bLoaded;                                   // Gains loaded by the main loop
+    uint8_t ui8Clipped;                             // PID_CLIP_x bits of the gains limited when loaded
+} tPIDTune;
+
+/* -----------------------      Function Prototypes     --------------------- */
+void PID_tuneStart(tPIDTune *psTune, int64_t i64Center);               // Start the relay experiment
+int16_t PID_tuneUpdate(tPIDTune *psTune, int64_t i64Pos);              // Relay output for this tick
+
+#endif /* PID_TUNE_H_ */
@@ -0,0 +1,24 @@
+/*!
+ * @author      Yash Bansod
+ * @date        17th October 2026
+ *
+ * @brief       Source containing the 64 bit multi-turn position of QEI1
+ * @file        POS_track.c
+ */
+/* -----------------------          Include Files       --------------------- */
+#include "POS_track.h"
+
+/* -----------------------      Function Definition     --------------------- */
+// Function to start the position at i64Pos with the counter at ui32Raw
+void POS_init(tPosTrack *psTrack, uint32_t ui32Raw, int64_t i64Pos){
+    psTrack->ui32Raw = ui32Raw;
+    psTrack->i64Pos = i64Pos;
+}
+
+// Function to extend the counter value read this tick to the 64 bit position
+int64_t POS_update(tPosTrack *psTrack, uint32_t ui32Raw){
+    // The modulo 2^32 difference read as signed is the move since the last tick, wrap or not
+    psTrack->i64Pos += (int32_t)(ui32Raw - psTrack->ui32Raw);
+    psTrack->ui32Raw = ui32Raw;
+    return psTrack->i64Pos;
+}
@@ -0,0 +1,33 @@
+/*!
+ * @author      Yash Bansod
+ * @date        17th October 2026
+ *
+ * @brief       Header containing the 64 bit multi-turn position of QEI1
+ * @details     The QEI1 position counter is 32 bits wide and wraps from 0xFFFFFFFF to 0
+ *              (and back) on long multi-turn runs. POS_update() is called every QEI1 tick
+ *              with the raw counter and adds the change since the last tick, taken as a
+ *              signed 32 bit difference, to a signed 64 bit position. The difference is
+ *              right across the wrap of the counter as long as the motor moves less than
+ *              2^31 ticks between two updates, which is far beyond any motor at 4096 Hz.
+ *              The position starts at the value given to POS_init(), so the positions of
+ *              the controller, the motion profile and the commands are plain signed
+ *              ticks from the power up position.
+ * @file        POS_track.h
+ */
+/* -----------------------          Include Files       --------------------- */
+#include <stdint.h>                         // Library of Standard Integer Types
+
+#ifndef POS_TRACK_H_
+#define POS_TRACK_H_
+
+/* -----------------------      Global Variables        --------------------- */
+typedef struct {
+    uint32_t ui32Raw;                               // Raw counter value of the last update
+    int64_t i64Pos;                                 // Signed multi-turn position in ticks
+} tPosTrack;
+
+/* -----------------------      Function Prototypes     --------------------- */
+void POS_init(tPosTrack *psTrack, uint32_t ui32Raw, int64_t i64Pos);   // The counter at ui32Raw is position i64Pos
+int64_t POS_update(tPosTrack *psTrack, uint32_t ui32Raw);              // Extend the counter read this tick
+
+#endif /* POS_TRACK_H_ */
@@ -0,0 +1,121 @@
+/*!
+ * @author      Yash Bansod
+ * @date        17th October 2026
+ *
+ * @brief       Header containing the framed binary command protocol of UART0
+ * @details     A frame is  SOF | LEN | TYPE | PAYLOAD[LEN] | CRC_HI | CRC_LO  where
+ *              SOF is PROTO_SOF, LEN is 0 .. PROTO_MAX_PAYLOAD and the CRC is the
+ *              CRC-16/CCITT-FALSE of LEN, TYPE and PAYLOAD. Multi byte fields of the
+ *              payload are little endian, floats are IEEE 754 single precision.
+ *              Every command is answered by a frame of type (TYPE | PROTO_REPLY) whose
+ *              first payload byte is a PROTO_STATUS_x code, followed by the data of the
+ *              query commands.
+ *              The parser takes one byte at a time in constant time. A frame with a bad
+ *              length or CRC is dropped and the parser waits for the next SOF. A frame
+ *              never spans an idle line: PROTO_parserIdle(), called when bytes arrive
+ *              after the line was idle, drops the frame in progress, so that a stray or
+ *              corrupted SOF cannot take the next frame as its payload.
+ *              PROTO_TELEM_DATA frames are sent without a request while the telemetry
+ *              stream is on, between the replies.
+ *              This file only needs <stdint.h> and <stdbool.h>, so the host tools use it
+ *              as their encoder and decoder. Tools that decode the telemetry frames build
+ *              it with a PROTO_MAX_PAYLOAD of at least PROTO_TELEM_PAYLOAD.
+ * @file        PROTO_frame.h
+ */
+/* -----------------------          Include Files       --------------------- */
+#include <stdint.h>                         // Library of Standard Integer Types
+#include <stdbool.h>                        // Library of Standard Boolean Types
+
+#ifndef PROTO_FRAME_H_
+#define PROTO_FRAME_H_
+
+/* -----------------------      Macro Definitions       --------------------- */
+#define PROTO_SOF           0xA5                    // Macro for the Start Of Frame byte
+#ifndef PROTO_MAX_PAYLOAD
+#define PROTO_MAX_PAYLOAD   51                      // Macro for the largest payload in bytes (PROTO_GET_SCHED reply)
+#endif
+#if PROTO_MAX_PAYLOAD > 255
+#error "PROTO_MAX_PAYLOAD must fit in the LEN byte"
+#endif
+#define PROTO_OVERHEAD      5                       // Macro for the bytes of a frame besides the payload
+#define PROTO_MAX_FRAME     (PROTO_MAX_PAYLOAD + PROTO_OVERHEAD)
+
+// Command types, payloads are given after the type
+#define PROTO_SET_POS       0x01                    // i64 desired multi-turn position in ticks from the power up position
+#define PROTO_SET_LIMITS    0x02                    // f32 velocity, acceleration, jerk limits in ticks/s^n
+#define PROTO_SET_GAINS     0x03                    // f32 K_P, K_I, K_D
+#define PROTO_GET_STATE     0x04                    // reply: i64 position, i64 desired position, i16 duty, u16 RPM, u8 flags
+#define PROTO_GET_GAINS     0x05                    // reply: f32 K_P, K_I, K_D
+#define PROTO_TUNE          0x06                    // start the relay feedback auto-tuner
+#define PROTO_GET_TUNE      0x07                    // reply: u8 tuner state, f32 Ku, f32 Pu in ticks (PROTO_STATUS_CLIP: gains limited)
+#define PROTO_TELEMETRY     0x08                    // u16 QEI1 ticks per telemetry record, 0 to stop
+#define PROTO_SET_SCHED     0x09                    // u8 input, u8 shift, PROTO_SCHED_POINTS x f32 K_P, K_I, K_D
+#define PROTO_GET_SCHED     0x0A                    // reply: as PROTO_SET_SCHED
+#define PROTO_SAVE_PARAMS   0x0B                    // store the gain schedule in use in the EEPROM
+#define PROTO_TELEM_DATA    0x40                    // u16 sequence, u16 ticks per record, u32 tick, low 32 bits of the position, records
+#define PROTO_REPLY         0x80                    // Macro for the flag of the reply types
+
+// Status codes, first byte of every reply
+#define PROTO_STATUS_OK     0                       // Command executed
+#define PROTO_STATUS_LEN    1                       // Payload length does not match the type
+#define PROTO_STATUS_TYPE   2                       // Unknown type
+#define PROTO_STATUS_BUSY   3                       // Command not allowed while the motor is moving
+#define PROTO_STATUS_FAIL   4                       // The EEPROM could not be written
+#define PROTO_STATUS_CLIP   5                       // Gains applied, PID_GAIN_MAX or 0 in place of some
+#define PROTO_STATUS_RANGE  6                       // A value out of range or not a number, nothing changed
+
+// Gain schedule of PROTO_SET_SCHED: input 0 = fixed gains, 1 = |error| in ticks, 2 = |RPM|,
+// breakpoints at 0, 2^shift, 2 * 2^shift ..
+#define PROTO_SCHED_POINTS  4                       // Macro for the breakpoints of the gain schedule
+#define PROTO_SCHED_LEN     (2 + 12 * PROTO_SCHED_POINTS)   // Macro for the payload of PROTO_SET_SCHED
+
+// Layout of PROTO_TELEM_DATA. A record is i16 change of position since the previous record,
+// i16 error, i8 difference of error, i16 sum of error, i8 duty in %, i8 QEI1 velocity count,
+// all signed and saturated. The sequence number, the QEI1 tick (counted from the power up) and
+// the position belong to the first record, the others follow it every "ticks per record".
+#define PROTO_TELEM_BATCH   16                      // Macro for the records per frame
+#define PROTO_TELEM_RECORD  9                       // Macro for the bytes per record
+#define PROTO_TELEM_HEADER  12                      // Macro for the bytes before the first record
+#define PROTO_TELEM_PAYLOAD (PROTO_TELEM_HEADER + PROTO_TELEM_BATCH * PROTO_TELEM_RECORD)
+
+// Bits of the flags byte of PROTO_GET_STATE
+#define PROTO_FLAG_DONE     0x01                    // The motion profile has reached the target
+#define PROTO_FLAG_TUNING   0x02                    // The auto-tuner is running
+
+/* -----------------------      Global Variables        --------------------- */
+typedef struct {
+    uint8_t ui8Type;                                // Type of the frame
+    uint8_t ui8Len;                                 // Payload length in bytes
+    uint8_t pui8Payload[PROTO_MAX_PAYLOAD];         // Payload
+} tProtoFrame;
+
+typedef struct {
+    uint8_t ui8State;                               // Field expected next
+    uint8_t ui8Index;                               // Payload bytes received
+    uint16_t ui16Crc;                               // CRC of the bytes received so far
+    uint16_t ui16CrcRx;                             // CRC sent with the frame
+    tProtoFrame sFrame;                             // Frame being received, valid when PROTO_parse returns true
+    uint32_t ui32Frames;                            // Number of valid frames
+    uint32_t ui32CrcErrors;                         // Number of frames dropped for their CRC
+    uint32_t ui32LenErrors;                         // Number of frames dropped for their length
+    uint32_t ui32Aborts;                            // Number of frames cut short by an idle line
+} tProtoParser;
+
+/* -----------------------      Function Prototypes     --------------------- */
+void PROTO_parserInit(tProtoParser *psParser);                          // Reset the parser
+bool PROTO_parse(tProtoParser *psParser, uint8_t ui8Byte);              // Feed a byte, true on a valid frame
+void PROTO_parserIdle(tProtoParser *psParser);                          // Drop the frame in progress
+uint32_t PROTO_encode(uint8_t ui8Type, const uint8_t *pui8Payload,
+                      uint8_t ui8Len, uint8_t *pui8Out);                // Build a frame, returns its length
+uint16_t PROTO_crc16(uint16_t ui16Crc, uint8_t ui8Byte);                // Add a byte to the CRC
+
+void PROTO_putU16(uint8_t *pui8Dst, uint16_t ui16Value);
+void PROTO_putU32(uint8_t *pui8Dst, uint32_t ui32Value);
+void PROTO_putU64(uint8_t *pui8Dst, uint64_t ui64Value);
+void PROTO_putF32(uint8_t *pui8Dst, float f32Value);
+uint16_t PROTO_getU16(const uint8_t *pui8Src);
+uint32_t PROTO_getU32(const uint8_t *pui8Src);
+uint64_t PROTO_getU64(const uint8_t *pui8Src);
+float PROTO_getF32(const uint8_t *pui8Src);
+
+#endif /* PROTO_FRAME_H_ */
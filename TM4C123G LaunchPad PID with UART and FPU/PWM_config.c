@@ -8,6 +8,10 @@
 /* -----------------------          Include Files       --------------------- */
 #include "PWM_config.h"
 
+/* -----------------------      Global Variables        --------------------- */
+static uint16_t ui16Cmp_PWM1_0[PWM_LUT_ENTRIES(PWM_LUT_PERCENT)];  // Array to store the compare value of each duty cycle
+static tPwmLut sLut_PWM1_0;                         // Duty cycle (in %) to compare value table of PWM1_0
+
 /* -----------------------      Function Definition     --------------------- */
 // Function for Initializing PWM1_0
 void PWM1_0_init(void){
@@ -35,8 +39,11 @@ void PWM1_0_init(void){
     // Load the calculated time period to the Generator0 of the PWM1 Module
     ROM_PWMGenPeriodSet(PWM1_BASE, PWM_GEN_0, ui32Period_PWM1_0);
 
+    // Build the compare values of the duty cycles for this period
+    PWM_lutInit(&sLut_PWM1_0, PWM_LUT_PERCENT, ui32Period_PWM1_0, ui32PWMClock, ui16Cmp_PWM1_0);
+
     // Set the PWM duty cycle to a specified value
-    ROM_PWMPulseWidthSet(PWM1_BASE, PWM_OUT_0, i16Adjust_PWM1_0 * ui32Period_PWM1_0 / 100);
+    HWREG(PWM_LUT_CMP_REG(PWM1_BASE, PWM_OUT_0)) = PWM_LUT_CMP(&sLut_PWM1_0, i16Adjust_PWM1_0);
     // Enable the PWM0 pin of the PWM Module 1 as output
     ROM_PWMOutputState(PWM1_BASE, PWM_OUT_0_BIT, true);
 
@@ -47,3 +54,9 @@ void PWM1_0_enable(void){
     // Enable the PWM1 Generator0
     ROM_PWMGenEnable(PWM1_BASE, PWM_GEN_0);
 }
+
+// Function for Updating PWM1_0 Duty Cycle (in %)
+void PWM1_0_update(uint16_t ui16Duty){
+    // Set the PWM duty cycle to a specified value, a table load instead of a multiply and divide
+    HWREG(PWM_LUT_CMP_REG(PWM1_BASE, PWM_OUT_0)) = PWM_LUT_CMP(&sLut_PWM1_0, ui16Duty);
+}
@@ -10,6 +10,7 @@
 #include "macros.h"
 #include "Int_handlers.h"
 #include "globalVariables.h"
+#include "PWM_lut.h"
 
  /* -----------------------      Function Prototypes     --------------------- */
 #ifndef PWM_CONFIG_H_
@@ -17,5 +18,6 @@
 
  void PWM1_0_init(void);                            // Function for Initializing PWM1_0
  void PWM1_0_enable(void);                          // Function for Enabling PWM1_0
+ void PWM1_0_update(uint16_t ui16Duty);             // Function for Updating PWM1_0 Duty Cycle (in %)
 
 #endif /* PWM_CONFIG_H_ */
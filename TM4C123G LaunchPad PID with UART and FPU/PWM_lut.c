@@ -0,0 +1,36 @@
+/*!
+ * @author      Yash Bansod
+ * @date        17th October 2026
+ *
+ * @brief       Source containing the duty cycle to compare value tables of the PWM outputs
+ * @file        PWM_lut.c
+ */
+/* -----------------------          Include Files       --------------------- */
+#include "PWM_lut.h"
+
+/* -----------------------      Function Definition     --------------------- */
+// Function to get the pulse width in PWM clocks of a duty cycle, ui32Period as given to PWMGenPeriodSet()
+uint32_t PWM_lutWidth(uint8_t ui8Unit, uint32_t ui32Duty, uint32_t ui32Period, uint32_t ui32PwmClock){
+    switch (ui8Unit){
+    case PWM_LUT_PERCENT:
+        return ui32Duty * ui32Period / 100;
+    case PWM_LUT_PERMILLE:
+        return ui32Duty * ui32Period / 1000;
+    default:
+        if (ui32Duty < PWM_LUT_US_MIN) ui32Duty = PWM_LUT_US_MIN;
+        return (uint32_t)((uint64_t)ui32Duty * ui32PwmClock / 1000000);
+    }
+}
+
+// Function to fill the table of a generator in count down mode with ui32Period as given to PWMGenPeriodSet()
+void PWM_lutInit(tPwmLut *psLut, uint8_t ui8Unit, uint32_t ui32Period, uint32_t ui32PwmClock, uint16_t *pui16Cmp){
+    uint32_t ui32Duty;
+
+    psLut->ui8Unit = ui8Unit;
+    psLut->ui16Last = PWM_LUT_ENTRIES(ui8Unit) - 1;
+    psLut->pui16Cmp = pui16Cmp;
+
+    // The counter reloads with ui32Period - 1, the output goes low when it counts down to the compare value
+    for (ui32Duty = 0; ui32Duty <= psLut->ui16Last; ui32Duty++)
+        pui16Cmp[ui32Duty] = (uint16_t)(ui32Period - 1 - PWM_lutWidth(ui8Unit, ui32Duty, ui32Period, ui32PwmClock));
+}
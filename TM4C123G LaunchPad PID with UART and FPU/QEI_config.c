@@ -37,7 +37,6 @@ void QEI1_enable(void){
     // Enable the QEI1
     ROM_QEIEnable(QEI1_BASE);
 
-    ROM_QEIPositionSet(QEI1_BASE, CENTER_POSITION);
-    // Update the position reading of the encoder
-    ui32Qei1Pos = ROM_QEIPositionGet(QEI1_BASE);
+    // The multi-turn position starts at 0 here, main() takes the reading of the encoder
+    ROM_QEIPositionSet(QEI1_BASE, 0);
 }
@@ -0,0 +1,156 @@
+/*!
+ * @author      Yash Bansod
+ * @date        17th October 2026
+ *
+ * @brief       Source containing the telemetry stream and the UART0 transmitter
+ * @file        TELEM_stream.c
+ */
+/* -----------------------          Include Files       --------------------- */
+#include "includes.h"
+#include "TELEM_stream.h"
+
+/* -----------------------      Macro Definitions       --------------------- */
+#define TELEM_TX_IDLE       0                       // Macro for the transmitter between frames
+#define TELEM_TX_RECORDS    1                       // Macro for the transmitter inside a telemetry frame
+
+// Macro to saturate X to the range of a signed N bit integer
+#define TELEM_SAT(X, N)     ((X) > INT##N##_MAX ? INT##N##_MAX : ((X) < INT##N##_MIN ? INT##N##_MIN : (X)))
+
+/* -----------------------      Function Definition     --------------------- */
+// Function to reset the stream, no records are taken until TELEM_start()
+void TELEM_init(tTelemStream *psTelem){
+    memset(psTelem, 0, sizeof(*psTelem));
+}
+
+// Function to take a record every ui32Decim QEI1 ticks, 0 stops the stream
+void TELEM_start(tTelemStream *psTelem, uint32_t ui32Decim){
+    // The full batches already in the ring are still sent, an unfinished one is dropped
+    psTelem->ui32Head -= psTelem->ui32Batch;
+    psTelem->ui32Dropped += psTelem->ui32Batch;
+    psTelem->ui32Batch = 0;
+    psTelem->ui32Skip = 0;
+    psTelem->ui32Decim = ui32Decim;
+    psTelem->ui32Count = 0;
+}
+
+// Function to record the state of the loop, called every QEI1 tick
+void TELEM_sample(tTelemStream *psTelem, int32_t i32Pos, int32_t i32Error, int32_t i32DiffError,
+                  int32_t i32SumError, int32_t i32Duty, int32_t i32Vel){
+    psTelem->ui32Tick++;
+    if (psTelem->ui32Decim == 0 || ++psTelem->ui32Count < psTelem->ui32Decim)
+        return;
+    psTelem->ui32Count = 0;
+
+    // A batch is only started with room for all of it, otherwise all its records are dropped
+    if (psTelem->ui32Batch == 0 && psTelem->ui32Skip == 0 &&
+        TELEM_RING - (psTelem->ui32Head - psTelem->ui32Tail) < PROTO_TELEM_BATCH)
+        psTelem->ui32Skip = PROTO_TELEM_BATCH;
+    if (psTelem->ui32Skip){
+        psTelem->ui32Skip--;
+        psTelem->ui32Dropped++;
+        psTelem->ui16Seq++;
+        return;
+    }
+
+    tTelemRecord *psRec = &psTelem->psRing[psTelem->ui32Head & (TELEM_RING - 1)];
+    psRec->i32Pos = i32Pos;
+    psRec->i16Error = (int16_t)TELEM_SAT(i32Error, 16);
+    psRec->i16SumError = (int16_t)TELEM_SAT(i32SumError, 16);
+    psRec->i8DiffError = (int8_t)TELEM_SAT(i32DiffError, 8);
+    psRec->i8Duty = (int8_t)TELEM_SAT(i32Duty, 8);
+    psRec->i8Vel = (int8_t)TELEM_SAT(i32Vel, 8);
+    psRec->ui16Seq = psTelem->ui16Seq++;
+    psRec->ui16Decim = (uint16_t)psTelem->ui32Decim;
+    psRec->ui32Tick = psTelem->ui32Tick;
+    psTelem->ui32Head++;
+    if (++psTelem->ui32Batch == PROTO_TELEM_BATCH)
+        psTelem->ui32Batch = 0;
+}
+
+// Function to queue a reply frame, returns false while the previous reply is still waiting
+bool TELEM_reply(tTelemStream *psTelem, const uint8_t *pui8Frame, uint32_t ui32Len){
+    if (psTelem->ui32ReplyLen || ui32Len > PROTO_MAX_FRAME)
+        return false;
+    memcpy(psTelem->pui8Reply, pui8Frame, ui32Len);
+    psTelem->ui32ReplyLen = ui32Len;
+    return true;
+}
+
+// Function to add the staged bytes from ui32First on to the CRC of the frame
+static void TELEM_crc(tTelemStream *psTelem, uint32_t ui32First){
+    uint32_t ui32Index;
+    for (ui32Index = ui32First; ui32Index < psTelem->ui32StageLen; ui32Index++)
+        psTelem->ui16Crc = PROTO_crc16(psTelem->ui16Crc, psTelem->pui8Stage[ui32Index]);
+}
+
+// Function to load the next part of the output into the stage buffer, false when there is none
+static bool TELEM_stage(tTelemStream *psTelem){
+    uint8_t *pui8Stage = psTelem->pui8Stage;
+    psTelem->ui32StageIdx = 0;
+
+    if (psTelem->ui8Phase == TELEM_TX_RECORDS){
+        if (psTelem->ui32TxRec < PROTO_TELEM_BATCH){
+            // Next record, with its position as the change from the previous one
+            const tTelemRecord *psRec = &psTelem->psRing[(psTelem->ui32Tail + psTelem->ui32TxRec) & (TELEM_RING - 1)];
+            int32_t i32Delta = psRec->i32Pos - psTelem->i32TxPos;
+            psTelem->i32TxPos = psRec->i32Pos;
+            PROTO_putU16(pui8Stage, (uint16_t)TELEM_SAT(i32Delta, 16));
+            PROTO_putU16(pui8Stage + 2, (uint16_t)psRec->i16Error);
+            pui8Stage[4] = (uint8_t)psRec->i8DiffError;
+            PROTO_putU16(pui8Stage + 5, (uint16_t)psRec->i16SumError);
+            pui8Stage[7] = (uint8_t)psRec->i8Duty;
+            pui8Stage[8] = (uint8_t)psRec->i8Vel;
+            psTelem->ui32StageLen = PROTO_TELEM_RECORD;
+            TELEM_crc(psTelem, 0);
+            psTelem->ui32TxRec++;
+            return true;
+        }
+
+        // The CRC closes the frame and frees its records
+        pui8Stage[0] = (uint8_t)(psTelem->ui16Crc >> 8);
+        pui8Stage[1] = (uint8_t)psTelem->ui16Crc;
+        psTelem->ui32StageLen = 2;
+        psTelem->ui32Tail += PROTO_TELEM_BATCH;
+        psTelem->ui32Frames++;
+        psTelem->ui8Phase = TELEM_TX_IDLE;
+        return true;
+    }
+
+    // Between frames a waiting reply goes first, then a full batch of records
+    if (psTelem->ui32ReplyLen){
+        memcpy(pui8Stage, psTelem->pui8Reply, psTelem->ui32ReplyLen);
+        psTelem->ui32StageLen = psTelem->ui32ReplyLen;
+        psTelem->ui32ReplyLen = 0;
+        return true;
+    }
+
+    if (psTelem->ui32Head - psTelem->ui32Tail >= PROTO_TELEM_BATCH){
+        const tTelemRecord *psRec = &psTelem->psRing[psTelem->ui32Tail & (TELEM_RING - 1)];
+        pui8Stage[0] = PROTO_SOF;
+        pui8Stage[1] = PROTO_TELEM_PAYLOAD;
+        pui8Stage[2] = PROTO_TELEM_DATA;
+        PROTO_putU16(pui8Stage + 3, psRec->ui16Seq);
+        PROTO_putU16(pui8Stage + 5, psRec->ui16Decim);
+        PROTO_putU32(pui8Stage + 7, psRec->ui32Tick);
+        PROTO_putU32(pui8Stage + 11, (uint32_t)psRec->i32Pos);
+        psTelem->ui32StageLen = 3 + PROTO_TELEM_HEADER;
+        psTelem->ui16Crc = 0xFFFF;
+        TELEM_crc(psTelem, 1);
+        psTelem->i32TxPos = psRec->i32Pos;
+        psTelem->ui32TxRec = 0;
+        psTelem->ui8Phase = TELEM_TX_RECORDS;
+        return true;
+    }
+
+    psTelem->ui32StageLen = 0;
+    return false;
+}
+
+// Function to write the pending output to the UART0 TX FIFO until it is full
+void TELEM_txFill(tTelemStream *psTelem){
+    while (ROM_UARTSpaceAvail(UART0_BASE)){
+        if (psTelem->ui32StageIdx == psTelem->ui32StageLen && !TELEM_stage(psTelem))
+            break;
+        ROM_UARTCharPutNonBlocking(UART0_BASE, psTelem->pui8Stage[psTelem->ui32StageIdx++]);
+    }
+}
@@ -0,0 +1,90 @@
+/*!
+ * @author      Yash Bansod
+ * @date        17th October 2026
+ *
+ * @brief       Header containing the telemetry stream and the UART0 transmitter
+ * @details     Every ui32Decim QEI1 ticks QEI1IntHandler stores a record of the loop in
+ *              a ring of TELEM_RING records. Once PROTO_TELEM_BATCH records are ready
+ *              they are sent as one PROTO_TELEM_DATA frame (see "PROTO_frame.h").
+ *              All of UART0 TX goes through TELEM_txFill(), which is called from the
+ *              QEI1 and UART0 TX interrupts and only writes while the TX FIFO has space.
+ *              The frame is serialised into a small stage buffer one record at a time,
+ *              so nothing waits on the UART. Command replies are queued with
+ *              TELEM_reply() and go out between two telemetry frames.
+ *              Records are kept or dropped in whole batches: a batch is only started
+ *              with room in the ring for all of it, otherwise its PROTO_TELEM_BATCH records
+ *              are dropped and counted and their sequence numbers skipped. The records of
+ *              a frame are therefore always consecutive and the host sees every gap as a
+ *              jump of the sequence number. TELEM_start() drops an unfinished batch, so a
+ *              frame holds one rate, and the frame header carries the QEI1 tick of its
+ *              first record.
+ * @file        TELEM_stream.h
+ */
+/* -----------------------          Include Files       --------------------- */
+#include <stdint.h>                         // Library of Standard Integer Types
+#include <stdbool.h>                        // Library of Standard Boolean Types
+#include "macros.h"
+#include "PROTO_frame.h"
+
+#ifndef TELEM_STREAM_H_
+#define TELEM_STREAM_H_
+
+/* -----------------------      Macro Definitions       --------------------- */
+#define TELEM_STAGE     PROTO_MAX_FRAME             // Macro for the stage buffer (fits a reply or a header)
+
+#if PROTO_TELEM_HEADER + 3 > TELEM_STAGE || PROTO_TELEM_RECORD > TELEM_STAGE
+#error "The telemetry header and records must fit in the stage buffer"
+#endif
+#if PROTO_TELEM_PAYLOAD > 255
+#error "PROTO_TELEM_BATCH records do not fit in a frame"
+#endif
+#if (TELEM_RING & (TELEM_RING - 1)) || TELEM_RING < 2 * PROTO_TELEM_BATCH
+#error "TELEM_RING must be a power of 2 and hold two frames"
+#endif
+
+/* -----------------------      Global Variables        --------------------- */
+typedef struct {
+    int32_t i32Pos;                                 // Low 32 bits of the multi-turn position in ticks
+    int16_t i16Error;                               // Error
+    int16_t i16SumError;                            // Sum of Error
+    int8_t i8DiffError;                             // Difference of Error in 1/2^PID_DIFF_SHIFT ticks
+    int8_t i8Duty;                                  // Signed duty cycle in %
+    int8_t i8Vel;                                   // Signed QEI1 velocity count
+    uint16_t ui16Seq;                               // Sequence number
+    uint16_t ui16Decim;                             // QEI1 ticks per record
+    uint32_t ui32Tick;                              // QEI1 tick of the record
+} tTelemRecord;
+
+typedef struct {
+    uint32_t ui32Decim;                             // QEI1 ticks per record, 0 when stopped
+    uint32_t ui32Count;                             // QEI1 ticks since the last record
+    uint32_t ui32Tick;                              // QEI1 ticks since TELEM_init()
+    uint16_t ui16Seq;                               // Sequence number of the next record
+    uint32_t ui32Batch;                             // Records of the unfinished batch
+    uint32_t ui32Skip;                              // Records left of the batch being dropped
+    uint32_t ui32Head;                              // Records written by TELEM_sample()
+    uint32_t ui32Tail;                              // Records sent by TELEM_txFill()
+    uint32_t ui32Dropped;                           // Records dropped on a full ring
+    uint32_t ui32Frames;                            // Telemetry frames sent
+    tTelemRecord psRing[TELEM_RING];                // Ring of records
+
+    uint8_t ui8Phase;                               // Part of the frame in the stage buffer
+    uint32_t ui32TxRec;                             // Records of the present frame staged
+    int32_t i32TxPos;                               // Position of the last record staged
+    uint16_t ui16Crc;                               // CRC of the present frame
+    uint8_t pui8Stage[TELEM_STAGE];                 // Bytes waiting for the TX FIFO
+    uint32_t ui32StageLen;                          // Bytes in pui8Stage
+    uint32_t ui32StageIdx;                          // Bytes of pui8Stage already sent
+    uint8_t pui8Reply[PROTO_MAX_FRAME];             // Reply frame waiting to be sent
+    uint32_t ui32ReplyLen;                          // Bytes in pui8Reply, 0 when free
+} tTelemStream;
+
+/* -----------------------      Function Prototypes     --------------------- */
+void TELEM_init(tTelemStream *psTelem);                                 // Reset the stream, stopped
+void TELEM_start(tTelemStream *psTelem, uint32_t ui32Decim);            // Record every ui32Decim ticks, 0 stops
+void TELEM_sample(tTelemStream *psTelem, int32_t i32Pos, int32_t i32Error, int32_t i32DiffError,
+                  int32_t i32SumError, int32_t i32Duty, int32_t i32Vel);// Called every QEI1 tick
+bool TELEM_reply(tTelemStream *psTelem, const uint8_t *pui8Frame, uint32_t ui32Len);   // Queue a reply frame
+void TELEM_txFill(tTelemStream *psTelem);                               // Fill the UART0 TX FIFO
+
+#endif /* TELEM_STREAM_H_ */
@@ -0,0 +1,156 @@
+/*!
+ * @author      Yash Bansod
+ * @date        17th October 2026
+ *
+ * @brief       Source containing the motion profile generator
+ * @details     Every tick the trapezoidal core brakes at the acceleration limit when its
+ *              stopping distance has caught up with the remaining distance, else it
+ *              accelerates up to the velocity limit. It stops on the target once the
+ *              target is within one step at the lowest speed. The stopping distance is the
+ *              discrete ramp S(v) = v + S(v - acceleration), so a step of the speed moves
+ *              it by one addition; only the clamp to the velocity limit loads the value
+ *              computed by TRAJ_limits(). The desired position then advances by the mean
+ *              core velocity of the jerk window, kept as a running sum of core velocity
+ *              >> log2(window). The window holds the same total distance as
+ *              the core, so the desired position ends on the target ui32Window ticks after
+ *              the core; the rounding of the division is removed by placing it exactly on
+ *              the target at that point.
+ *              The core can swap from accelerating to braking in one tick, which the window
+ *              turns into a change of 2 * acceleration, so the window is 2 * acceleration /
+ *              jerk long, rounded up to a power of 2 and limited to 1 .. TRAJ_WINDOW_MAX.
+ *              With a jerk limit of 0 the window is 1 tick and the profile is trapezoidal.
+ * @file        TRAJ_profile.c
+ */
+/* -----------------------          Include Files       --------------------- */
+#include <string.h>                         // Library for String functions
+#include "TRAJ_profile.h"
+
+/* -----------------------      Macro Definitions       --------------------- */
+#define TRAJ_ONE        (INT32_C(1) << 24)          // Macro for one tick in Q24
+// Macro to limit a position in ticks to +/-TRAJ_POS_MAX
+#define TRAJ_CLAMP(P)   ((P) > TRAJ_POS_MAX ? TRAJ_POS_MAX : ((P) < -TRAJ_POS_MAX ? -TRAJ_POS_MAX : (P)))
+
+/* -----------------------      Function Definition     --------------------- */
+// Function to get the distance to stop from the speed i32Vel >= 0 braking by i32Acc every tick
+static int64_t TRAJ_stop(int32_t i32Vel, int32_t i32Acc){
+    // Sum of the ramp i32Vel, i32Vel - i32Acc, ... down to its last positive speed
+    int64_t i64Steps = ((int64_t)i32Vel + i32Acc - 1) / i32Acc;
+    return i64Steps * i32Vel - (int64_t)i32Acc * i64Steps * (i64Steps - 1) / 2;
+}
+
+// Function to start the generator at rest at i64Pos
+void TRAJ_init(tTrajProfile *psTraj, int64_t i64Pos){
+    psTraj->i64CorePos = TRAJ_CLAMP(i64Pos) * TRAJ_ONE;
+    psTraj->i64Target = psTraj->i64CorePos;
+    psTraj->i64Pos = psTraj->i64CorePos;
+    psTraj->i32CoreVel = 0;
+    psTraj->i32Vel = 0;
+    psTraj->i64Stop = 0;
+    psTraj->ui32Index = 0;
+    psTraj->ui32Settle = 0;
+    psTraj->bDone = true;
+    memset(psTraj->pi32VelHist, 0, sizeof(psTraj->pi32VelHist));
+}
+
+// Function to load the limits, given in ticks/s, ticks/s^2 and ticks/s^3. Call at rest.
+// Returns false, with the limits unchanged, for limits out of range or not a number.
+bool TRAJ_limits(tTrajProfile *psTraj, float f32VelMax, float f32AccMax,
+                 float f32JerkMax, float f32TickHz){
+    // Convert the limits to Q24 ticks per QEI1 tick, the comparisons are false for NaN
+    float f32Vel = f32VelMax / f32TickHz * TRAJ_ONE;
+    float f32Acc = f32AccMax / (f32TickHz * f32TickHz) * TRAJ_ONE;
+    if (!(f32Vel > 0 && f32Vel < TRAJ_LIMIT_MAX && f32Acc > 0 && f32Acc < TRAJ_LIMIT_MAX && f32JerkMax >= 0))
+        return false;
+
+    psTraj->i32VelMax = (int32_t)f32Vel;
+    psTraj->i32AccMax = (int32_t)f32Acc;
+    if (psTraj->i32VelMax < 1) psTraj->i32VelMax = 1;
+    if (psTraj->i32AccMax < 1) psTraj->i32AccMax = 1;
+
+    // Ticks needed to swing the acceleration from -limit to +limit at the jerk limit, rounded
+    // up to a power of 2 so that the window mean is a shift
+    float f32Window = (f32JerkMax > 0) ? 2 * f32AccMax / f32JerkMax * f32TickHz : 1;
+    psTraj->ui32Shift = 0;
+    while ((float)(1U << psTraj->ui32Shift) < f32Window && (1U << psTraj->ui32Shift) < TRAJ_WINDOW_MAX)
+        psTraj->ui32Shift++;
+    psTraj->ui32Window = 1U << psTraj->ui32Shift;
+
+    // The stopping distances the update cannot step to are computed once here
+    psTraj->i64StopMax = TRAJ_stop(psTraj->i32VelMax, psTraj->i32AccMax);
+    psTraj->i64Stop = TRAJ_stop((psTraj->i32CoreVel < 0) ? -psTraj->i32CoreVel : psTraj->i32CoreVel,
+                                psTraj->i32AccMax);
+    psTraj->ui32Index = 0;
+    return true;
+}
+
+// Function to replace the target position, the move continues from the current state
+void TRAJ_target(tTrajProfile *psTraj, int64_t i64Target){
+    psTraj->i64Target = TRAJ_CLAMP(i64Target) * TRAJ_ONE;
+    psTraj->ui32Settle = psTraj->ui32Window;
+    psTraj->bDone = false;
+}
+
+// Function to advance the profile by one tick and return the desired position in ticks
+int64_t TRAJ_update(tTrajProfile *psTraj){
+    if (psTraj->bDone)
+        return psTraj->i64Pos >> 24;
+
+    int64_t i64Dist = psTraj->i64Target - psTraj->i64CorePos;
+    bool bBack = (i64Dist < 0);
+    int32_t i32Speed = (psTraj->i32CoreVel < 0) ? -psTraj->i32CoreVel : psTraj->i32CoreVel;
+    // Remaining distance and core velocity in the direction of the target
+    int32_t i32Vel = bBack ? -psTraj->i32CoreVel : psTraj->i32CoreVel;
+    if (bBack) i64Dist = -i64Dist;
+
+    if (i64Dist <= psTraj->i32AccMax && i32Vel <= psTraj->i32AccMax && i32Vel >= -psTraj->i32AccMax){
+        // Stop the core on the target, the window then drains to it
+        psTraj->i64CorePos = psTraj->i64Target;
+        i32Vel = 0;
+        psTraj->ui32Settle--;
+    }
+    else {
+        // Brake once the distance to stop at the acceleration limit reaches the target
+        if (i32Vel > 0 && psTraj->i64Stop >= i64Dist)
+            i32Vel -= psTraj->i32AccMax;
+        else if (i32Vel > psTraj->i32VelMax)
+            i32Vel -= psTraj->i32AccMax;
+        else if (i32Vel + psTraj->i32AccMax > psTraj->i32VelMax)
+            i32Vel = psTraj->i32VelMax;
+        else
+            i32Vel += psTraj->i32AccMax;
+
+        psTraj->ui32Settle = psTraj->ui32Window;
+    }
+    psTraj->i32CoreVel = bBack ? -i32Vel : i32Vel;
+    psTraj->i64CorePos += psTraj->i32CoreVel;
+
+    // Step the stopping distance with the speed. A speed within one step stops in one tick, a
+    // step of the acceleration adds or removes one term of the ramp, else it is the clamp.
+    int32_t i32Last = i32Speed;
+    i32Speed = (i32Vel < 0) ? -i32Vel : i32Vel;
+    if (i32Speed <= psTraj->i32AccMax)
+        psTraj->i64Stop = i32Speed;
+    else if (i32Speed == i32Last + psTraj->i32AccMax)
+        psTraj->i64Stop += i32Speed;
+    else if (i32Speed == i32Last - psTraj->i32AccMax)
+        psTraj->i64Stop -= i32Last;
+    else
+        psTraj->i64Stop = psTraj->i64StopMax;
+
+    // Running mean of the core velocity over the window
+    int32_t i32Share = psTraj->i32CoreVel >> psTraj->ui32Shift;
+    psTraj->i32Vel += i32Share - psTraj->pi32VelHist[psTraj->ui32Index];
+    psTraj->pi32VelHist[psTraj->ui32Index] = i32Share;
+    if (++psTraj->ui32Index >= psTraj->ui32Window) psTraj->ui32Index = 0;
+
+    if (psTraj->ui32Settle == 0){
+        // The window is empty, the desired position is exactly on the target
+        psTraj->i64Pos = psTraj->i64Target;
+        psTraj->i32Vel = 0;
+        psTraj->bDone = true;
+    }
+    else
+        psTraj->i64Pos += psTraj->i32Vel;
+
+    return psTraj->i64Pos >> 24;
+}
@@ -0,0 +1,58 @@
+/*!
+ * @author      Yash Bansod
+ * @date        17th October 2026
+ *
+ * @brief       Header containing the motion profile generator
+ * @details     The generator moves the desired position towards the target once per
+ *              QEI1 tick. A trapezoidal core keeps the velocity and acceleration within
+ *              their limits and the core velocity is then averaged over the last
+ *              ui32Window ticks, which limits the jerk to acceleration / window (S-curve).
+ *              The target can be replaced at any time, also during a move. Position and
+ *              velocity are integrated in Q24 ticks, the window mean is kept as a running
+ *              sum and the stopping distance is stepped along with the velocity, so a
+ *              tick costs only integer additions, compares and one shift.
+ *              Positions are 64 bit multi-turn ticks; Q24 leaves them +/-TRAJ_POS_MAX.
+ *              TRAJ_limits() refuses, and keeps the limits in use, a velocity or
+ *              acceleration that is not a positive number below TRAJ_LIMIT_MAX in Q24 per
+ *              tick (their sum must fit in 31 bits) or a jerk that is not a number >= 0.
+ * @file        TRAJ_profile.h
+ */
+/* -----------------------          Include Files       --------------------- */
+#include <stdint.h>                         // Library of Standard Integer Types
+#include <stdbool.h>                        // Library of Standard Boolean Types
+
+#ifndef TRAJ_PROFILE_H_
+#define TRAJ_PROFILE_H_
+
+/* -----------------------      Macro Definitions       --------------------- */
+#define TRAJ_WINDOW_MAX 256                         // Macro for the longest jerk window in ticks (a power of 2)
+#define TRAJ_POS_MAX    ((INT64_C(1) << 38) - 1)    // Macro for the largest |position| in ticks (Q24 in int64_t, 2x margin)
+#define TRAJ_LIMIT_MAX  1073741824.0f               // Macro for the bound of the Q24 velocity and acceleration limits (2^30)
+
+/* -----------------------      Global Variables        --------------------- */
+typedef struct {
+    int64_t i64CorePos;                             // Trapezoidal core position in Q24 ticks
+    int64_t i64Target;                              // Target position in Q24 ticks
+    int64_t i64Pos;                                 // Desired (smoothed) position in Q24 ticks
+    int32_t i32CoreVel;                             // Core velocity in Q24 ticks per tick
+    int32_t i32Vel;                                 // Desired velocity (window mean) in Q24 ticks per tick
+    int32_t i32VelMax;                              // Velocity limit in Q24 ticks per tick
+    int32_t i32AccMax;                              // Acceleration limit in Q24 ticks per tick^2
+    int64_t i64Stop;                                // Distance to stop from |i32CoreVel| in Q24 ticks
+    int64_t i64StopMax;                             // Distance to stop from i32VelMax in Q24 ticks
+    uint32_t ui32Window;                            // Length of the jerk window in ticks
+    uint32_t ui32Shift;                             // log2(ui32Window)
+    uint32_t ui32Index;                             // Oldest entry of pi32VelHist
+    uint32_t ui32Settle;                            // Ticks of the window still to drain after the core stopped
+    bool bDone;                                     // Set when the target has been reached
+    int32_t pi32VelHist[TRAJ_WINDOW_MAX];           // Core velocity >> ui32Shift of the last ui32Window ticks
+} tTrajProfile;
+
+/* -----------------------      Function Prototypes     --------------------- */
+void TRAJ_init(tTrajProfile *psTraj, int64_t i64Pos);                  // Start at rest at i64Pos
+bool TRAJ_limits(tTrajProfile *psTraj, float f32VelMax, float f32AccMax,
+                 float f32JerkMax, float f32TickHz);                   // Load the limits in ticks/s, /s^2, /s^3
+void TRAJ_target(tTrajProfile *psTraj, int64_t i64Target);             // Replace the target position
+int64_t TRAJ_update(tTrajProfile *psTraj);                             // Advance by one tick
+
+#endif /* TRAJ_PROFILE_H_ */
@@ -25,7 +25,9 @@ void UART0_init(void){
 
     // Configure and enable the interrupt for UART0
     ROM_IntEnable(INT_UART0);
-    ROM_UARTIntEnable(UART0_BASE, UART_INT_RX | UART_INT_RT);
+    // The TX interrupt comes when the TX FIFO drains to 1/8 so that TELEM_txFill() can refill it
+    ROM_UARTFIFOLevelSet(UART0_BASE, UART_FIFO_TX1_8, UART_FIFO_RX4_8);
+    ROM_UARTIntEnable(UART0_BASE, UART_INT_RX | UART_INT_RT | UART_INT_TX);
 }
 
 // Function for Enabling UART0 Peripheral
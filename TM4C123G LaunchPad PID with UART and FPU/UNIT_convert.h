@@ -0,0 +1,51 @@
+/*!
+ * @author      Yash Bansod
+ * @date        17th October 2026
+ *
+ * @brief       Header containing the division-free unit conversions of the encoder
+ * @details     A conversion Y = X * NUM / DEN is done as Y = (X * MUL) >> SHIFT with
+ *              MUL = ceil(NUM * 2^SHIFT / DEN), computed here from QEI1_CPR and
+ *              VEL_INT_FREQ. With E = MUL * DEN - NUM * 2^SHIFT (0 <= E < DEN) the result
+ *              equals the integer division for every 0 <= X <= XMAX as long as
+ *              XMAX * E < 2^SHIFT, which is checked below for the range of each
+ *              conversion. MUL is kept below 2^32 so that the product is one 32 x 32
+ *              -> 64 bit multiply (UMULL) and cannot overflow.
+ *              Negative degrees are converted by magnitude, so they round towards zero
+ *              as the signed division did.
+ *              The RPM of QEI1 comes from VEL_update() of VEL_estimate.c, whose count
+ *              branch takes the float scale of VEL_init(), so there is no RPM conversion
+ *              here; the one of PID with UART is UNIT_VEL_TO_RPM of its UNIT_convert.h.
+ * @file        UNIT_convert.h
+ */
+/* -----------------------          Include Files       --------------------- */
+#include <stdint.h>                         // Library of Standard Integer Types
+#include "macros.h"
+
+#ifndef UNIT_CONVERT_H_
+#define UNIT_CONVERT_H_
+
+/* -----------------------      Macro Definitions       --------------------- */
+// Macros for the multiplier of X * NUM / DEN and its excess E (also usable in #if)
+#define UNIT_MUL(NUM, DEN, SHIFT)   (((NUM) * (1ULL << (SHIFT)) + (DEN) - 1) / (DEN))
+#define UNIT_ERR(NUM, DEN, SHIFT)   (UNIT_MUL(NUM, DEN, SHIFT) * (DEN) - (NUM) * (1ULL << (SHIFT)))
+
+// Ticks from tenths of a degree at the gearbox output: X * QEI1_CPR / 3600
+#define UNIT_DEG_NUM        QEI1_CPR
+#define UNIT_DEG_DEN        3600
+#define UNIT_DEG_SHIFT      32
+#define UNIT_DEG_MUL        UNIT_MUL(UNIT_DEG_NUM, UNIT_DEG_DEN, UNIT_DEG_SHIFT)
+#define UNIT_DEG_MAX        360000                  // Macro for the largest |angle| converted exactly (100 turns)
+
+#if UNIT_DEG_MUL >= (1ULL << 32)
+#error "Lower the SHIFT of the conversion so that MUL fits in 32 bits"
+#endif
+#if UNIT_DEG_MAX * UNIT_ERR(UNIT_DEG_NUM, UNIT_DEG_DEN, UNIT_DEG_SHIFT) >= (1ULL << UNIT_DEG_SHIFT)
+#error "UNIT_DEG_TO_TICKS is not exact up to UNIT_DEG_MAX, raise UNIT_DEG_SHIFT"
+#endif
+
+// Macro to convert a non-negative angle in tenths of a degree to ticks
+#define UNIT_DEG_TO_TICKS_U(D)  ((int32_t)(((uint64_t)(uint32_t)(D) * UNIT_DEG_MUL) >> UNIT_DEG_SHIFT))
+// Macro to convert a signed angle in tenths of a degree to ticks, rounding towards zero
+#define UNIT_DEG_TO_TICKS(D)    ((D) < 0 ? -UNIT_DEG_TO_TICKS_U(-(D)) : UNIT_DEG_TO_TICKS_U(D))
+
+#endif /* UNIT_CONVERT_H_ */
@@ -0,0 +1,94 @@
+/*!
+ * @author      Yash Bansod
+ * @date        17th October 2026
+ *
+ * @brief       Source containing the combined M/T-method velocity estimator of QEI1
+ * @details     Both edges of PhA are captured, which gives QEI1_CPR / 2 edges per
+ *              revolution. The reference edge is the last edge seen by the previous
+ *              tick, so consecutive spans join without a gap and no edge is counted twice.
+ * @file        VEL_estimate.c
+ */
+/* -----------------------          Include Files       --------------------- */
+#include "VEL_estimate.h"
+
+/* -----------------------      Function Definition     --------------------- */
+// Function to reset the estimator for QEI1 ticks at f32TickHz and a capture timer at f32TimerHz
+void VEL_init(tVelEstimate *psVel, float f32TickHz, float f32TimerHz){
+    psVel->ui32Edges = 0;
+    psVel->ui32EdgeTime = 0;
+    psVel->ui32RefEdges = 0;
+    psVel->ui32RefTime = 0;
+    psVel->ui32StopTime = (uint32_t)(f32TimerHz * (VEL_STOP_MS / 1000.0f));
+    psVel->bCapture = true;
+    psVel->bRef = false;
+    psVel->f32CountScale = 60.0f * f32TickHz / QEI1_CPR;
+    psVel->f32EdgeScale = 120.0f * f32TimerHz / QEI1_CPR;
+    psVel->f32RpmM = 0;
+    psVel->f32RpmT = 0;
+    psVel->f32Rpm = 0;
+}
+
+// Function to record a PhA edge captured at ui32Time, called by the capture interrupt
+void VEL_edge(tVelEstimate *psVel, uint32_t ui32Time){
+    psVel->ui32EdgeTime = ui32Time;
+    psVel->ui32Edges++;
+}
+
+// Function to estimate the velocity from the QEI1 count of the tick, the direction and the timer value now
+float VEL_update(tVelEstimate *psVel, uint32_t ui32Count, int32_t i32Dir, uint32_t ui32Now){
+    float f32Rpm;
+
+    psVel->f32RpmM = (float)ui32Count * psVel->f32CountScale;
+
+    if (!psVel->bCapture)
+        f32Rpm = psVel->f32RpmM;
+    else {
+        uint32_t ui32EdgesNow = psVel->ui32Edges;
+        uint32_t ui32Edges = ui32EdgesNow - psVel->ui32RefEdges;
+        uint32_t ui32Time = psVel->ui32EdgeTime;
+
+        if (!psVel->bRef)
+            psVel->f32RpmT = psVel->f32RpmM;
+        else if (ui32Edges)
+            psVel->f32RpmT = (float)ui32Edges * psVel->f32EdgeScale / (float)(ui32Time - psVel->ui32RefTime);
+        else {
+            // No edge in this tick: the next edge is at least as far as the time since the last one
+            uint32_t ui32Since = ui32Now - psVel->ui32RefTime;
+            if (ui32Since >= psVel->ui32StopTime){
+                psVel->bRef = false;
+                psVel->f32RpmT = 0;
+            }
+            else if (ui32Since && psVel->f32EdgeScale < psVel->f32RpmT * (float)ui32Since)
+                psVel->f32RpmT = psVel->f32EdgeScale / (float)ui32Since;
+        }
+
+        // The last edge of this tick is the reference of the next span
+        if (ui32Edges){
+            psVel->ui32RefEdges = ui32EdgesNow;
+            psVel->ui32RefTime = ui32Time;
+            psVel->bRef = true;
+        }
+
+        // Blend from the edge times at VEL_MT_LOW into the count at VEL_MT_HIGH
+        if (ui32Count <= VEL_MT_LOW)
+            f32Rpm = psVel->f32RpmT;
+        else if (ui32Count >= VEL_MT_HIGH)
+            f32Rpm = psVel->f32RpmM;
+        else
+            f32Rpm = psVel->f32RpmT + (psVel->f32RpmM - psVel->f32RpmT) *
+                     ((float)(ui32Count - VEL_MT_LOW) / (VEL_MT_HIGH - VEL_MT_LOW));
+    }
+
+    // Capture the edges of the next tick only below VEL_MT_HIGH
+    if (ui32Count >= VEL_MT_HIGH){
+        psVel->bCapture = false;
+        psVel->bRef = false;
+    }
+    else if (!psVel->bCapture){
+        psVel->bCapture = true;
+        psVel->ui32RefEdges = psVel->ui32Edges;
+    }
+
+    psVel->f32Rpm = (i32Dir < 0) ? -f32Rpm : f32Rpm;
+    return psVel->f32Rpm;
+}
@@ -0,0 +1,62 @@
+/*!
+ * @author      Yash Bansod
+ * @date        17th October 2026
+ *
+ * @brief       Header containing the combined M/T-method velocity estimator of QEI1
+ * @details     The QEI1 velocity count (M method) resolves 60 * 2^VEL_INT_FREQ / QEI1_CPR
+ *              = 80 RPM per count, more than the 120 RPM of the gearbox output. PhA1 is
+ *              therefore also wired to PC4 (WT0CCP0), where Wide Timer 0A captures the
+ *              time of both edges of PhA at the system clock. Every QEI1 tick the PhA
+ *              edges since the last tick are divided by the time between the last edge
+ *              of the previous tick and the last edge of this tick (T method), which
+ *              measures the speed over a whole number of edges with 12.5 ns resolution.
+ *              A tick without an edge bounds the speed by one edge over the time since
+ *              the last edge, so the estimate falls towards 0 when the motor stops and
+ *              reads 0 after VEL_STOP_MS without an edge.
+ *              At high speed the edge interrupts cost more than the M method loses, so
+ *              above VEL_MT_LOW counts per tick the result is blended linearly into the
+ *              count, and from VEL_MT_HIGH counts per tick the count is used alone and
+ *              the capture interrupt is switched off. The first tick after switching it
+ *              back on has no reference edge and uses the count.
+ *              VEL_edge() is called by the capture interrupt and VEL_update() by the
+ *              QEI1 interrupt. Both run at the same priority, so neither interrupts the
+ *              other and the edge count and time are always read as a pair.
+ *              The sign comes from the QEI1 direction, so the edges of a reversal within
+ *              one span are counted as if they were in the new direction.
+ * @file        VEL_estimate.h
+ */
+/* -----------------------          Include Files       --------------------- */
+#include <stdint.h>                         // Library of Standard Integer Types
+#include <stdbool.h>                        // Library of Standard Boolean Types
+#include "macros.h"
+
+#ifndef VEL_ESTIMATE_H_
+#define VEL_ESTIMATE_H_
+
+#if VEL_MT_LOW >= VEL_MT_HIGH
+#error "VEL_MT_LOW must be below VEL_MT_HIGH"
+#endif
+
+/* -----------------------      Global Variables        --------------------- */
+typedef struct {
+    volatile uint32_t ui32Edges;                    // PhA edges captured by VEL_edge()
+    volatile uint32_t ui32EdgeTime;                 // Timer value of the last PhA edge
+    uint32_t ui32RefEdges;                          // ui32Edges at the reference edge
+    uint32_t ui32RefTime;                           // Timer value of the reference edge
+    uint32_t ui32StopTime;                          // Timer counts without an edge that read as stopped
+    bool bCapture;                                  // Edge capture wanted (below VEL_MT_HIGH)
+    bool bRef;                                      // ui32RefTime holds an edge
+    float f32CountScale;                            // RPM per QEI1 count per tick
+    float f32EdgeScale;                             // RPM per PhA edge per timer count
+    float f32RpmM;                                  // Speed from the count (M method)
+    float f32RpmT;                                  // Speed from the edge times (T method)
+    float f32Rpm;                                   // Signed estimate in RPM
+} tVelEstimate;
+
+/* -----------------------      Function Prototypes     --------------------- */
+void VEL_init(tVelEstimate *psVel, float f32TickHz, float f32TimerHz);  // Reset, capture wanted
+void VEL_edge(tVelEstimate *psVel, uint32_t ui32Time);                  // PhA edge captured at ui32Time
+float VEL_update(tVelEstimate *psVel, uint32_t ui32Count, int32_t i32Dir,
+                 uint32_t ui32Now);                                     // Estimate of this QEI1 tick
+
+#endif /* VEL_ESTIMATE_H_ */
@@ -0,0 +1,51 @@
+/*!
+ * @author      Yash Bansod
+ * @date        17th October 2026
+ *
+ * @brief       Source containing function definitions for Wide Timer 0 configuration
+ * @details     PhA1 (PC5) is also wired to PC4, which is WT0CCP0. Wide Timer 0A counts up
+ *              at the system clock and captures the time of both edges of PhA. Wide Timer
+ *              0B counts up from the same start in periodic mode, so that its value is the
+ *              time now on the same scale as the captures.
+ * @file        WTIMER_config.c
+ */
+/* -----------------------          Include Files       --------------------- */
+#include "WTIMER_config.h"
+
+/* -----------------------      Function Definition     --------------------- */
+// Function for Initializing Wide Timer 0 Peripheral
+void WTIMER0_init(void){
+    // Enable the clock for peripherals PortC and Wide Timer 0
+    ROM_SysCtlPeripheralEnable(SYSCTL_PERIPH_GPIOC);
+    ROM_SysCtlPeripheralEnable(SYSCTL_PERIPH_WTIMER0);
+
+    // Configure the PC4 as WT0CCP0
+    ROM_GPIOPinTypeTimer(GPIO_PORTC_BASE, GPIO_PIN_4);
+    ROM_GPIOPinConfigure(GPIO_PC4_WT0CCP0);
+
+    // Configure the Timer A for edge time capture on both edges and the Timer B as a free running counter
+    ROM_TimerConfigure(WTIMER0_BASE, TIMER_CFG_SPLIT_PAIR | TIMER_CFG_A_CAP_TIME_UP | TIMER_CFG_B_PERIODIC_UP);
+    ROM_TimerControlEvent(WTIMER0_BASE, TIMER_A, TIMER_EVENT_BOTH_EDGES);
+    ROM_TimerLoadSet(WTIMER0_BASE, TIMER_BOTH, 0xFFFFFFFF);
+
+    // Enable the Interrupts for the edges captured by Timer A
+    ROM_IntEnable(INT_WTIMER0A);
+    WTIMER0_capture(true);
+}
+
+// Function for Enabling Wide Timer 0 Peripheral
+void WTIMER0_enable(void){
+    // Start both timers together so that they count in step
+    ROM_TimerEnable(WTIMER0_BASE, TIMER_BOTH);
+}
+
+// Function for switching the PhA edge capture interrupt on or off
+void WTIMER0_capture(bool bEnable){
+    if (bEnable){
+        // Drop an edge captured while the interrupt was off, its time is stale
+        ROM_TimerIntClear(WTIMER0_BASE, TIMER_CAPA_EVENT);
+        ROM_TimerIntEnable(WTIMER0_BASE, TIMER_CAPA_EVENT);
+    }
+    else
+        ROM_TimerIntDisable(WTIMER0_BASE, TIMER_CAPA_EVENT);
+}
@@ -0,0 +1,22 @@
+/*!
+ * @author      Yash Bansod
+ * @date        17th October 2026
+ *
+ * @brief       Header containing function prototypes for Wide Timer 0 configuration
+ * @file        WTIMER_config.h
+ */
+/* -----------------------          Include Files       --------------------- */
+#include "includes.h"
+#include "macros.h"
+#include "Int_handlers.h"
+#include "globalVariables.h"
+
+/* -----------------------      Function Prototypes     --------------------- */
+#ifndef WTIMER_CONFIG_H_
+#define WTIMER_CONFIG_H_
+
+void WTIMER0_init(void);                            // Function for Initializing Wide Timer 0 Peripheral
+void WTIMER0_enable(void);                          // Function for Enabling Wide Timer 0 Peripheral
+void WTIMER0_capture(bool bEnable);                 // Function for switching the PhA edge capture interrupt
+
+#endif /* WTIMER_CONFIG_H_ */
@@ -8,6 +8,13 @@
 /* -----------------------          Include Files       --------------------- */
 #include <stdint.h>                         // Library of Standard Integer Types
 #include <stdbool.h>                        // Library of Standard Boolean Types
+#include "PID_axes.h"                       // Multi-axis PID controller
+#include "TRAJ_profile.h"                   // Motion profile generator
+#include "PID_tune.h"                       // Relay feedback auto-tuner
+#include "PROTO_frame.h"                    // Framed binary command protocol
+#include "TELEM_stream.h"                   // Telemetry stream and UART0 transmitter
+#include "VEL_estimate.h"                   // M/T-method velocity estimator
+#include "POS_track.h"                      // 64 bit multi-turn position
 
 #ifndef GLOBALVARIABLES_H_
 #define GLOBALVARIABLES_H_
@@ -15,14 +22,26 @@
 /* -----------------------      Global Variables        --------------------- */
 static volatile uint32_t ui32Qei1Vel;               // Variable to store the velocity of QEI1
 static volatile uint32_t ui32Qei1Pos;               // Variable to store the position of QEI1
+static volatile int64_t i64Qei1Pos;                 // Variable to store the multi-turn position of QEI1
+static tPosTrack sQei1Track;                        // Extension of the QEI1 counter to 64 bits
 static volatile int32_t i32Qei1Dir;                 // Variable to store the direction of QEI1
 static volatile uint16_t ui16Qei1Rpm;               // Variable to store the RPM of QEI1
+static volatile float f32Qei1Rpm;                   // Variable to store the signed RPM of QEI1
+static tVelEstimate sVelEst;                        // Velocity estimator fed by the PhA edge capture
 
 static volatile int32_t i32DesPosDeg = 0;           // Desired Shaft position in Degrees
-static volatile int32_t i32DesPosTick;              // Desired Shaft position in ticks
-static volatile int32_t i32ErrorNew = 0;            // Error in ticks
-static volatile int32_t i32DiffError = 0;           // Difference of Error in ticks
-static volatile int32_t i32SumError = 0;            // Sum of Error in ticks
+static tPIDAxes sPIDAxes;                           // PID controller state (desired position, errors, control)
+static tTrajProfile sTraj;                          // Motion profile from the present to the desired position
+static tPIDTune sTune;                              // Relay feedback auto-tuner state
+
+static tProtoParser sProtoParser;                   // Parser of the bytes received by UART0
+static uint32_t ui32UartGap;                        // UART0_GAP_US in Wide Timer 0 counts
+static uint32_t ui32UartLast;                       // Wide Timer 0B time of the last bytes received by UART0
+static tProtoFrame sCmdQueue[CMD_QUEUE_LEN];       // Command frames waiting for CMD_service()
+static volatile uint32_t ui32CmdHead = 0;           // Frames queued by UART0IntHandler
+static volatile uint32_t ui32CmdTail = 0;           // Frames executed by CMD_service()
+static volatile uint32_t ui32CmdDropped = 0;        // Frames dropped because the queue was full
+static tTelemStream sTelem;                         // Telemetry records and bytes waiting for UART0 TX
 
 static uint32_t ui32Period_PWM1_0;                  // Variable to store PWM time period
 static volatile int16_t i16Adjust_PWM1_0 = 0;       // Variable to store Duty Cycle of Servo
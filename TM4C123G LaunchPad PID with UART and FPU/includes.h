@@ -15,17 +15,25 @@
 #include <stdlib.h>                         // Standard Library
 #include <string.h>                         // Library for String functions
 #include <inttypes.h>                       // Library for conversions to Integer types
+
+#ifdef HOST_SIM
+#include "HOST_stub.h"                      // Host stand-in for the DriverLib API (see other_codes/Host Tools)
+#else
 #include "inc/tm4c123gh6pm.h"               // Definitions for interrupt and register assignments on Tiva C
 #include "inc/hw_memmap.h"                  // Macros defining the memory map of the Tiva C Series device
 #include "inc/hw_types.h"                   // Defines common types and macros
+#include "inc/hw_pwm.h"                     // Defines and Macros for Pulse Width Modulation (PWM) ports
 #include "driverlib/sysctl.h"               // Defines and macros for System Control API of DriverLib
 #include "driverlib/interrupt.h"            // Defines and macros for NVIC Controller API of DriverLib
 #include "driverlib/gpio.h"                 // Defines and macros for GPIO API of DriverLib
 #include "driverlib/qei.h"                  // Prototypes for the Quadrature Encoder Driver
 #include "driverlib/pwm.h"                  // API function prototypes for PWM ports
 #include "driverlib/uart.h"                 // Defines and Macros for the UART
+#include "driverlib/timer.h"                // Prototypes for the General Purpose Timer
 #include "driverlib/fpu.h"                  // Prototypes for floating point manipulation routine
+#include "driverlib/eeprom.h"               // Prototypes for the EEPROM driver
 #include "driverlib/pin_map.h"              // Mapping of peripherals to pins for all parts
 #include "driverlib/rom.h"                  // Defines and macros for ROM API of driverLib
+#endif
 
 #endif /* INCLUDES_H_ */
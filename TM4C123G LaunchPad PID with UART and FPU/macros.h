@@ -16,7 +16,38 @@
 #define K_P             0.25                        // Macro for Error Multiplication factor
 #define K_I             0.002                       // Macro for SumError Multiplication factor
 #define K_D             0.015                       // Macro for Error Difference Multiplication factor
+#define PID_F32         0                           // Macro for PID arithmetic in single precision float (FPU)
+#define PID_Q15         1                           // Macro for PID arithmetic in Q15 fixed point
+#define PID_Q31         2                           // Macro for PID arithmetic in Q31 fixed point
+#define PID_ARITHMETIC  PID_F32                     // Macro to select the PID arithmetic (PID_F32, PID_Q15, PID_Q31)
+#define PID_DEADBAND    5                           // Macro for the Error (in ticks) below which the motor is stopped
+#define PID_MAX_AXES    8                           // Macro for the number of axes the PID controller can hold
+#define PID_AXES        1                           // Macro for the number of axes driven by this board
+#define PID_SCHED_POINTS 4                          // Macro for the breakpoints of the gain schedule
+#define PID_DIFF_SHIFT  6                           // Macro for the fractional bits of the Difference of Error
+#define OBS_OFF         0                           // Macro for the Difference of Error of two readings
+#define OBS_ALPHA_BETA  1                           // Macro for the Difference of Error from the alpha-beta observer
+#define OBS_KALMAN      2                           // Macro for the Difference of Error from the steady-state Kalman observer
+#define OBS_MODE        OBS_KALMAN                  // Macro to select the observer (OBS_OFF, OBS_ALPHA_BETA, OBS_KALMAN)
+#define OBS_AB_ALPHA    0.169771f                   // Macro for the alpha-beta position gain (PID_sim --obs-gains=0.005:0.0005)
+#define OBS_AB_BETA     0.015782f                   // Macro for the alpha-beta velocity gain
+#define OBS_KF_KX       0.213501f                   // Macro for the Kalman position gain (PID_sim --obs-gains=0.005:0.0005)
+#define OBS_KF_KV       0.025607f                   // Macro for the Kalman velocity gain
+#define OBS_KF_KA       0.00153607f                 // Macro for the Kalman acceleration gain
+#define TRAJ_VEL_MAX    4800                        // Macro for the profile velocity limit in ticks/s
+#define TRAJ_ACC_MAX    48000                       // Macro for the profile acceleration limit in ticks/s^2
+#define TRAJ_JERK_MAX   1920000                     // Macro for the profile jerk limit in ticks/s^3 (0 for trapezoidal)
+#define TUNE_RELAY      30                          // Macro for the auto-tune relay amplitude in % of duty
+#define TUNE_HYST       3                           // Macro for the auto-tune relay hysteresis in ticks
+#define TUNE_SKIP       2                           // Macro for the auto-tune cycles ignored at the start
+#define TUNE_CYCLES     4                           // Macro for the auto-tune cycles averaged
+#define TUNE_TIMEOUT    (4 << VEL_INT_FREQ)         // Macro for the auto-tune time limit in ticks (4 s)
+#define VEL_MT_LOW      8                           // Macro for the QEI1 count per tick up to which the PhA edge times give the velocity
+#define VEL_MT_HIGH     16                          // Macro for the QEI1 count per tick from which the count alone is used
+#define VEL_STOP_MS     1000                        // Macro for the time without a PhA edge after which the velocity reads 0
+#define CMD_QUEUE_LEN   4                           // Macro for the command frames queued for the main loop (power of 2)
+#define TELEM_RING      64                          // Macro for the telemetry records buffered for UART0 (power of 2)
 #define UART0_BAUDRATE  115200                      // Macro for UART0 Baud rate
-#define CENTER_POSITION 1073741823                  // Macro for Center Position of Motor Shaft
+#define UART0_GAP_US    2000                        // Macro for the idle time of UART0 in us that ends a frame in progress
 
 #endif /* MACROS_H_ */
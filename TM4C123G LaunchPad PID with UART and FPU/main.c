@@ -16,24 +16,59 @@
  *              can also be implemented.
  *              For controlling the desired position of Motor, Constants for Proportional
  *              and Integral controller, see "macros.h"
+ *              A new desired position is not applied as a step. The motion profile moves
+ *              the PID setpoint to it within TRAJ_VEL_MAX, TRAJ_ACC_MAX and TRAJ_JERK_MAX.
+ *              UART0 takes the framed binary commands of "PROTO_frame.h". UART0IntHandler
+ *              only parses the bytes and queues the complete frames; they are executed
+ *              and answered in order by CMD_service() in the main loop. Bytes received
+ *              after UART0_GAP_US of idle line drop a frame left open by noise.
+ *              PROTO_TUNE runs the relay feedback auto-tuner around the held position
+ *              (see "PID_tune.h"). The gains it finds are loaded by the main loop and can
+ *              be read with PROTO_GET_TUNE and PROTO_GET_GAINS. A gain outside
+ *              0 .. PID_GAIN_MAX is limited and answered with PROTO_STATUS_CLIP.
+ *              The gains are replaced by PROTO_SET_GAINS, or by a gain schedule on the
+ *              error or the RPM with PROTO_SET_SCHED, without stopping the loop (see
+ *              "PID_control.h"). PROTO_SAVE_PARAMS stores them in the EEPROM and they are
+ *              loaded at power up instead of K_P, K_I and K_D.
+ *              PROTO_TELEMETRY streams a record of the loop every N QEI1 ticks in
+ *              PROTO_TELEM_DATA frames (see "TELEM_stream.h"). Everything sent on UART0,
+ *              replies included, goes through the non-blocking TELEM_txFill().
+ *              PhA1 (PC5) has to be wired to PC4 as well. Wide Timer 0 captures its edges
+ *              so that the RPM is measured below one QEI1 count per tick (see
+ *              "VEL_estimate.h").
+ *              The QEI1 counter is extended to a signed 64 bit position every tick (see
+ *              "POS_track.h"), so the positions of PROTO_SET_POS and PROTO_GET_STATE are
+ *              multi-turn ticks from the power up position and survive the 32 bit wrap.
  * @file        main.c
  */
 /* -----------------------          Include Files       --------------------- */
+#include <math.h>                           // Library of Math functions
 #include "includes.h"
 #include "macros.h"
 #include "globalVariables.h"
 #include "Int_handlers.h"
 #include "QEI_config.h"
+#include "WTIMER_config.h"
 #include "PWM_config.h"
 #include "UART_config.h"
+#include "PID_axes.h"
+#include "PID_control.h"
+#include "TRAJ_profile.h"
+#include "PID_tune.h"
+#include "PROTO_frame.h"
+#include "TELEM_stream.h"
+#include "PARAM_store.h"
+#include "UNIT_convert.h"
+#include "VEL_estimate.h"
+#include "POS_track.h"
 
-/* -----------------------      Global Variables        --------------------- */
-
-char UARTinput[8];                          // Buffer to store input from UART
+#if PROTO_SCHED_POINTS != PID_SCHED_POINTS || PROTO_SCHED_LEN + 1 > PROTO_MAX_PAYLOAD
+#error "The gain schedule of PROTO_SET_SCHED does not match PID_SCHED_POINTS"
+#endif
 
 /* -----------------------      Function Prototypes     --------------------- */
 void PID_Update(void);                      // Function prototype for PID control
-void concat(char s1[], char s2[]);          // Function prototype for concatenation of strings
+void CMD_service(void);                     // Function prototype for executing a received command
 
 /* -----------------------          Main Program        --------------------- */
 int main(void) {
@@ -48,7 +83,26 @@ int main(void) {
     // Set the System clock to 80MHz and the PWM Module clock to 1.25 MHz
     ROM_SysCtlClockSet(SYSCTL_SYSDIV_2_5 |SYSCTL_USE_PLL |SYSCTL_OSC_MAIN |SYSCTL_XTAL_16MHZ);
 
-    i32DesPosTick = CENTER_POSITION + (i32DesPosDeg * QEI1_CPR / 3600);
+    // Load the PID gains stored in the EEPROM, if any
+    PARAM_load();
+
+    // Initialize the PID controller and load the desired position of the motor
+    PID_axesInit(&sPIDAxes, PID_AXES);
+    sPIDAxes.i64DesPos[0] = UNIT_DEG_TO_TICKS(i32DesPosDeg);
+
+    // Start the motion profile at rest at the desired position
+    TRAJ_init(&sTraj, sPIDAxes.i64DesPos[0]);
+    TRAJ_limits(&sTraj, TRAJ_VEL_MAX, TRAJ_ACC_MAX, TRAJ_JERK_MAX, 1 << VEL_INT_FREQ);
+
+    // Reset the velocity estimator for the QEI1 ticks and the Wide Timer 0 clock
+    VEL_init(&sVelEst, 1 << VEL_INT_FREQ, ROM_SysCtlClockGet());
+
+    // Reset the command parser and convert its idle time to Wide Timer 0 counts
+    PROTO_parserInit(&sProtoParser);
+    ui32UartGap = ROM_SysCtlClockGet() / 1000000 * UART0_GAP_US;
+
+    // Reset the telemetry stream, it is started by PROTO_TELEMETRY
+    TELEM_init(&sTelem);
 
     // Initialize the UART0 module
     UART0_init();
@@ -56,28 +110,36 @@ int main(void) {
     // Initialize the QEI1 module
     QEI1_init();
 
+    // Initialize the Wide Timer 0 module for the PhA edge capture
+    WTIMER0_init();
+
     // Initialize the PWM1 module for output from generator 0
     PWM1_0_init();
 
     // Enable the UART0 peripheral
     UART0_enable();
 
+    // Enable the Wide Timer 0 peripheral
+    WTIMER0_enable();
+
     // Enable the QEI1 peripheral
     QEI1_enable();
 
+    // Start the multi-turn position at 0 from the reading of the encoder. The globals of
+    // "globalVariables.h" are static, so this is done where QEI1IntHandler sees them.
+    ui32Qei1Pos = ROM_QEIPositionGet(QEI1_BASE);
+    POS_init(&sQei1Track, ui32Qei1Pos, 0);
+    i64Qei1Pos = 0;
+
     // Enable the PWM1 Generator0
     PWM1_0_enable();
 
-    uint8_t ui8WelcomeText[] = {"Enter Motor Position in Degrees (input will be divided by 10):\n\r"};
-    uint8_t limit = sizeof(ui8WelcomeText);
-    uint8_t iter;
-    for (iter = 0; iter<limit; iter++ ) ROM_UARTCharPut(UART0_BASE, ui8WelcomeText[iter]);
-
     // Master interrupt enable API for all interrupts
     ROM_IntMasterEnable();
 
     while (true){
-
+        // Execute the commands received over UART0
+        CMD_service();
     }
 }
 /* -----------------------      Function Definition     --------------------- */
@@ -87,104 +149,247 @@ void QEI1IntHandler(void){
     ROM_QEIIntClear(QEI1_BASE, ROM_QEIIntStatus(QEI1_BASE, true));
     // Calculate the number of quadrature ticks in "1 / VEL_INT_FREQ" time period
     ui32Qei1Vel = ROM_QEIVelocityGet(QEI1_BASE);
-    // Update the position reading of the encoder
+    // Update the position reading of the encoder and extend it to the multi-turn position
     ui32Qei1Pos = ROM_QEIPositionGet(QEI1_BASE);
+    i64Qei1Pos = POS_update(&sQei1Track, ui32Qei1Pos);
     // Update the direction reading of the encoder
     i32Qei1Dir = ROM_QEIDirectionGet(QEI1_BASE);
-    // Calculate the velocity in RPM
-    ui16Qei1Rpm = (ui32Qei1Vel << VEL_INT_FREQ) * 60 / QEI1_CPR;
+    // Estimate the velocity from the count and the PhA edge times, the capture is switched off at high speed
+    bool bCapture = sVelEst.bCapture;
+    f32Qei1Rpm = VEL_update(&sVelEst, ui32Qei1Vel, i32Qei1Dir, ROM_TimerValueGet(WTIMER0_BASE, TIMER_B));
+    if (sVelEst.bCapture != bCapture)
+        WTIMER0_capture(sVelEst.bCapture);
+    float f32AbsRpm = fabsf(f32Qei1Rpm);
+    ui16Qei1Rpm = (f32AbsRpm < 65535.0f) ? (uint16_t)(f32AbsRpm + 0.5f) : 65535;
+    // Advance the desired position along the motion profile
+    sPIDAxes.i64DesPos[0] = TRAJ_update(&sTraj);
     // Update the PID loop
     PID_Update();
+    // Send the telemetry and replies that fit in the UART0 TX FIFO
+    TELEM_txFill(&sTelem);
 }
 
 // ISR Definition for UART0 Interrupts
 void UART0IntHandler(void){
     // Clear the asserted UART interrupts
-    ROM_UARTIntClear(UART0_BASE, ROM_UARTIntStatus(UART0_BASE, true));
+    uint32_t ui32Status = ROM_UARTIntStatus(UART0_BASE, true);
+    ROM_UARTIntClear(UART0_BASE, ui32Status);
 
-    // While there is a character available at input
+    // Refill the TX FIFO once it has drained
+    if (ui32Status & UART_INT_TX)
+        TELEM_txFill(&sTelem);
+
+    // Bytes that come after the line was idle for UART0_GAP_US cannot belong to the frame in progress.
+    // A frame streams its bytes at least every 8 byte times (RX FIFO at 4/8) or ends in a receive timeout.
+    if (ROM_UARTCharsAvail(UART0_BASE)){
+        uint32_t ui32Now = ROM_TimerValueGet(WTIMER0_BASE, TIMER_B);
+        if (ui32Now - ui32UartLast > ui32UartGap)
+            PROTO_parserIdle(&sProtoParser);
+        ui32UartLast = ui32Now;
+    }
+
+    // Feed every received byte to the command parser
     while(ROM_UARTCharsAvail(UART0_BASE)){
-        // Echo the character back to the user
-        int32_t reprint = ROM_UARTCharGetNonBlocking(UART0_BASE);
-        char temp= (char)reprint;
-        ROM_UARTCharPutNonBlocking(UART0_BASE, reprint);
-        concat(UARTinput, &temp);
-        if (temp == '\r'){
-            i32DesPosDeg = strtoimax(UARTinput, NULL, 10);
-            i32DesPosTick = CENTER_POSITION + (i32DesPosDeg * QEI1_CPR / 3600);
-            UARTinput[0] = '\0';
-            ROM_UARTCharPutNonBlocking(UART0_BASE, '\n');
+        uint8_t ui8Byte = (uint8_t)ROM_UARTCharGetNonBlocking(UART0_BASE);
+        if (PROTO_parse(&sProtoParser, ui8Byte)){
+            // Queue the frame for CMD_service(), drop it if the queue is full
+            if (ui32CmdHead - ui32CmdTail >= CMD_QUEUE_LEN)
+                ui32CmdDropped++;
+            else {
+                sCmdQueue[ui32CmdHead & (CMD_QUEUE_LEN - 1)] = sProtoParser.sFrame;
+                ui32CmdHead++;
+            }
         }
     }
 }
 
+// ISR Definition for Wide Timer 0A Interrupts
+void WTIMER0AIntHandler(void){
+    // Clear the Interrupt that is generated
+    ROM_TimerIntClear(WTIMER0_BASE, TIMER_CAPA_EVENT);
+    // Record the time of the PhA edge for the velocity estimate
+    VEL_edge(&sVelEst, ROM_TimerValueGet(WTIMER0_BASE, TIMER_A));
+}
+
 // Function Definition for PID Control
 void PID_Update(void){
-    volatile float f32P_Control = 0;
-    volatile float f32I_Control = 0;
-    volatile float f32D_Control = 0;
-    int32_t i32ErrorOld = i32ErrorNew;
-
-    // Calculate the Error and SumError for PI control
-    i32ErrorNew = i32DesPosTick - ui32Qei1Pos;
-    f32P_Control = i32ErrorNew * K_P;
-
-    i32DiffError = (i32ErrorNew - i32ErrorOld);
-    f32D_Control = i32DiffError * K_D;
-
-    // Do not Use I_Control if P_Control gives >= 100% of Control signal
-    // Also Limit I_Control to contribute max 50% of Control signal
-    if (abs(f32P_Control) < 100){
-        i32SumError += i32ErrorNew;
-        f32I_Control = i32SumError * K_I;
-
-        if (f32I_Control > 50) {
-            i32SumError -= i32ErrorNew;
-            f32I_Control = 50;
-        }
-        else if (f32I_Control < -50) {
-            i32SumError -= i32ErrorNew;
-            f32I_Control = -50;
-        }
+    const int64_t pi64Pos[PID_AXES] = {i64Qei1Pos};
+    const int32_t pi32Rpm[PID_AXES] = {ui16Qei1Rpm};
+
+    // Update the Error, Sum of Error and Control signal of all the axes, each with its scheduled gains
+    PID_axesUpdate(&sPIDAxes, pi64Pos, pi32Rpm);
+    int16_t i16Control = sPIDAxes.i16Control[0];
+
+    // The relay of the auto-tuner drives the motor instead of the PID law while it runs
+    if (sTune.ui8State == TUNE_RUN){
+        i16Control = PID_tuneUpdate(&sTune, i64Qei1Pos);
+        sPIDAxes.i32SumError[0] = 0;
     }
 
-    if (abs(i32ErrorNew) <= 5){
+    if (sTune.ui8State != TUNE_RUN && abs(sPIDAxes.i32ErrorNew[0]) <= PID_DEADBAND){
         // Write the output value to the GPIO PortD to control the PD2 and PD3
         ROM_GPIOPinWrite(GPIO_PORTD_BASE, GPIO_PIN_2 | GPIO_PIN_3, 0x00);
-        i32SumError = 0;
+        i16Control = 0;
     }
     else {
-        // Adjust the PWM1_0 Duty Cycle according to P and I control.
-        i16Adjust_PWM1_0 = (int16_t)(f32P_Control + f32I_Control + f32D_Control);
-
-        if (i16Adjust_PWM1_0 < 0){
-            i16Adjust_PWM1_0 = abs(i16Adjust_PWM1_0);
+        // Adjust the PWM1_0 Duty Cycle according to P, I and D control.
+        if (i16Control < 0){
+            i16Adjust_PWM1_0 = -i16Control;
             // Write the output value to the GPIO PortD to control the PD2 and PD3
             ROM_GPIOPinWrite(GPIO_PORTD_BASE, GPIO_PIN_2 | GPIO_PIN_3, GPIO_PIN_3);
         }
-        else
+        else {
+            i16Adjust_PWM1_0 = i16Control;
             // Write the output value to the GPIO PortD to control the PD2 and PD3
             ROM_GPIOPinWrite(GPIO_PORTD_BASE, GPIO_PIN_2 | GPIO_PIN_3, GPIO_PIN_2);
-
-        // Limit the Control signal to 100% Duty Cycle.
-        if (i16Adjust_PWM1_0 > 100) i16Adjust_PWM1_0 = 100;
+        }
 
         // Update PWM Duty Cycle only if Duty Cycle has changed
         if (i16Adjust_PWM1_0 != i16AdjustOld_PWM1_0)
-            // Set the PWM duty cycle to a specified value
-            ROM_PWMPulseWidthSet(PWM1_BASE, PWM_OUT_0, i16Adjust_PWM1_0 * ui32Period_PWM1_0 / 100);
+            PWM1_0_update(i16Adjust_PWM1_0);
     }
 
     // Save the current calculated PWM Duty Cycle as old
     i16AdjustOld_PWM1_0 = i16Adjust_PWM1_0;
+
+    // Record the loop for the telemetry stream, the velocity count is signed by the direction
+    TELEM_sample(&sTelem, (int32_t)i64Qei1Pos, sPIDAxes.i32ErrorNew[0],
+                 sPIDAxes.i32DiffError[0], sPIDAxes.i32SumError[0], i16Control,
+                 (int32_t)ui32Qei1Vel * i32Qei1Dir);
 }
 
-// Function to concatenate strings
-void concat(char s1[], char s2[]) {
-    int i, j;
-    i = strlen(s1);
-    for (j = 0; s2[j] != '\0'; i++, j++) {
-        s1[i] = s2[j];
+// Function to execute and answer the oldest command frame queued by UART0IntHandler
+void CMD_service(void){
+    uint8_t pui8Reply[PROTO_MAX_PAYLOAD];
+    uint8_t pui8Frame[PROTO_MAX_FRAME];
+    uint8_t ui8Len = 1;
+    float f32Kp, f32Ki, f32Kd;
+    float pf32Sched[PID_SCHED_POINTS][3];
+    uint8_t ui8Source, ui8Shift;
+    uint32_t ui32Point;
+
+    // The gains found by the auto-tuner are loaded here, as only the main loop writes the gains
+    if (sTune.ui8State == TUNE_DONE && !sTune.bLoaded){
+        sTune.ui8Clipped = PID_gainsSet(sTune.f32Kp, sTune.f32Ki, sTune.f32Kd);
+        sTune.bLoaded = true;
+    }
+
+    if (ui32CmdHead == ui32CmdTail)
+        return;
+
+    const tProtoFrame *psCmd = &sCmdQueue[ui32CmdTail & (CMD_QUEUE_LEN - 1)];
+    const uint8_t *pui8Payload = psCmd->pui8Payload;
+
+    // Expected payload length of every command type, 0xFF for unknown types
+    static const uint8_t pui8CmdLen[] = {0xFF, 8, 12, 12, 0, 0, 0, 0, 2, PROTO_SCHED_LEN, 0, 0};
+    uint8_t ui8Type = psCmd->ui8Type;
+    uint8_t ui8Expect = (ui8Type < sizeof(pui8CmdLen)) ? pui8CmdLen[ui8Type] : 0xFF;
+
+    pui8Reply[0] = PROTO_STATUS_OK;
+    if (ui8Expect == 0xFF)
+        pui8Reply[0] = PROTO_STATUS_TYPE;
+    else if (psCmd->ui8Len != ui8Expect)
+        pui8Reply[0] = PROTO_STATUS_LEN;
+    else if (ui8Type == PROTO_SAVE_PARAMS){
+        // The EEPROM write takes milliseconds, so it runs with the interrupts enabled
+        if (!PARAM_save())
+            pui8Reply[0] = PROTO_STATUS_FAIL;
+    }
+    else {
+        // The state shared with QEI1IntHandler is accessed with the interrupts disabled
+        ROM_IntMasterDisable();
+        switch (ui8Type){
+        case PROTO_SET_POS:
+            TRAJ_target(&sTraj, (int64_t)PROTO_getU64(pui8Payload));
+            break;
+
+        case PROTO_SET_LIMITS:
+            // The jerk window cannot change length during a move
+            if (!sTraj.bDone)
+                pui8Reply[0] = PROTO_STATUS_BUSY;
+            else if (!TRAJ_limits(&sTraj, PROTO_getF32(pui8Payload), PROTO_getF32(pui8Payload + 4),
+                                  PROTO_getF32(pui8Payload + 8), 1 << VEL_INT_FREQ))
+                pui8Reply[0] = PROTO_STATUS_RANGE;
+            break;
+
+        case PROTO_SET_GAINS:
+            if (PID_gainsSet(PROTO_getF32(pui8Payload), PROTO_getF32(pui8Payload + 4), PROTO_getF32(pui8Payload + 8)))
+                pui8Reply[0] = PROTO_STATUS_CLIP;
+            break;
+
+        case PROTO_GET_STATE:
+            PROTO_putU64(pui8Reply + 1, (uint64_t)i64Qei1Pos);
+            PROTO_putU64(pui8Reply + 9, (uint64_t)sPIDAxes.i64DesPos[0]);
+            PROTO_putU16(pui8Reply + 17, (uint16_t)sPIDAxes.i16Control[0]);
+            PROTO_putU16(pui8Reply + 19, ui16Qei1Rpm);
+            pui8Reply[21] = (sTraj.bDone ? PROTO_FLAG_DONE : 0) | (sTune.ui8State == TUNE_RUN ? PROTO_FLAG_TUNING : 0);
+            ui8Len = 22;
+            break;
+
+        case PROTO_GET_GAINS:
+            PID_gainsGet(&f32Kp, &f32Ki, &f32Kd);
+            PROTO_putF32(pui8Reply + 1, f32Kp);
+            PROTO_putF32(pui8Reply + 5, f32Ki);
+            PROTO_putF32(pui8Reply + 9, f32Kd);
+            ui8Len = 13;
+            break;
+
+        case PROTO_TUNE:
+            // Run the relay experiment around the position that is held now
+            if (!sTraj.bDone)
+                pui8Reply[0] = PROTO_STATUS_BUSY;
+            else
+                PID_tuneStart(&sTune, sPIDAxes.i64DesPos[0]);
+            break;
+
+        case PROTO_GET_TUNE:
+            if (sTune.bLoaded && sTune.ui8Clipped)
+                pui8Reply[0] = PROTO_STATUS_CLIP;
+            pui8Reply[1] = sTune.ui8State;
+            PROTO_putF32(pui8Reply + 2, sTune.f32Ku);
+            PROTO_putF32(pui8Reply + 6, sTune.f32Pu);
+            ui8Len = 10;
+            break;
+
+        case PROTO_TELEMETRY:
+            TELEM_start(&sTelem, PROTO_getU16(pui8Payload));
+            break;
+
+        case PROTO_SET_SCHED:
+            for (ui32Point = 0; ui32Point < PID_SCHED_POINTS; ui32Point++){
+                pf32Sched[ui32Point][0] = PROTO_getF32(pui8Payload + 2 + 12 * ui32Point);
+                pf32Sched[ui32Point][1] = PROTO_getF32(pui8Payload + 6 + 12 * ui32Point);
+                pf32Sched[ui32Point][2] = PROTO_getF32(pui8Payload + 10 + 12 * ui32Point);
+            }
+            if (PID_scheduleSet(pui8Payload[0], pui8Payload[1], (const float (*)[3])pf32Sched))
+                pui8Reply[0] = PROTO_STATUS_CLIP;
+            break;
+
+        case PROTO_GET_SCHED:
+            PID_scheduleGet(&ui8Source, &ui8Shift, pf32Sched);
+            pui8Reply[1] = ui8Source;
+            pui8Reply[2] = ui8Shift;
+            for (ui32Point = 0; ui32Point < PID_SCHED_POINTS; ui32Point++){
+                PROTO_putF32(pui8Reply + 3 + 12 * ui32Point, pf32Sched[ui32Point][0]);
+                PROTO_putF32(pui8Reply + 7 + 12 * ui32Point, pf32Sched[ui32Point][1]);
+                PROTO_putF32(pui8Reply + 11 + 12 * ui32Point, pf32Sched[ui32Point][2]);
+            }
+            ui8Len = 1 + PROTO_SCHED_LEN;
+            break;
+        }
+        ROM_IntMasterEnable();
     }
-    s1[i] = '\0';
+    ui32CmdTail++;
+
+    // Answer with the type of the command and the reply flag. The reply waits until the
+    // previous one is taken by the transmitter. TELEM_txFill() also starts the transmission
+    // when the TX FIFO is empty, as the TX interrupt only comes when the FIFO level falls.
+    uint32_t ui32Len = PROTO_encode(ui8Type | PROTO_REPLY, pui8Reply, ui8Len, pui8Frame);
+    bool bQueued;
+    do {
+        ROM_IntMasterDisable();
+        bQueued = TELEM_reply(&sTelem, pui8Frame, ui32Len);
+        TELEM_txFill(&sTelem);
+        ROM_IntMasterEnable();
+    } while (!bQueued);
 }
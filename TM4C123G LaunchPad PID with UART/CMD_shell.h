@@ -0,0 +1,84 @@
+/*!
+ * @author      Yash Bansod
+ * @date        17th October 2026
+ *
+ * @brief       Header containing the command shell over the UART
+ * @details     CMD_input() takes the received characters one at a time from the UART
+ *              interrupt handler and only queues them, CMD_RX_SIZE at most. CMD_poll() in
+ *              the main loop edits the line with them, with the line discipline of
+ *              UARTgets(): the line ends at CR or LF, a LF right after a CR is dropped,
+ *              backspace rubs out the last character and the characters past the end of
+ *              the line buffer are ignored. Tab completes the command name, Ctrl-C drops
+ *              the line and the escape sequences of the arrow keys are swallowed. The
+ *              shell echoes through the write function given to CMD_init(), which takes
+ *              a new line as "\n" the way UARTwrite() does. Every write of the shell thus
+ *              comes from the main loop: the interrupt handler never waits for the UART,
+ *              and the echo never lands inside the other writes of the main loop, such
+ *              as the records of LOG_drain().
+ *              Once a line has ended, CMD_poll() in the main loop splits it in place,
+ *              the words being NUL terminated where they stand and ppcArgv[] pointing
+ *              into the line, so no character is copied. A word may be quoted to hold
+ *              spaces. The commands are the CMD_ENTRY("name", Cmd_function, "help")
+ *              lines of CMD_table.h, the table of the application, and "help", which
+ *              lists them. The first word is hashed as it is split and the hash picks
+ *              the only command it can be, found by a single string compare: the slot
+ *              table of CMD_hash.h maps the hash of each command to a slot of its own.
+ *              CMD_hash.h is written by other_codes/Host Tools/CMD_hash.c from
+ *              CMD_table.h and must be written again when the table changes; a table
+ *              of a different length does not compile, and CMD_init() falls back to
+ *              comparing every name if the hash of a renamed command misses its slot.
+ *              The characters received while a command runs wait in the queue, and a
+ *              character that finds it full is dropped.
+ * @file        CMD_shell.h
+ */
+/* -----------------------          Include Files       --------------------- */
+#include <stdint.h>                         // Library of Standard Integer Types
+#include <stdbool.h>                        // Library of Standard Boolean Types
+
+#ifndef CMD_SHELL_H_
+#define CMD_SHELL_H_
+
+/* -----------------------      Macro Definitions       --------------------- */
+#ifndef CMD_LINE_SIZE
+#define CMD_LINE_SIZE       64                      // Macro for the line buffer, with its NUL
+#endif
+#ifndef CMD_MAX_ARGS
+#define CMD_MAX_ARGS        8                       // Macro for the most words of a line
+#endif
+#ifndef CMD_RX_SIZE
+#define CMD_RX_SIZE         32                      // Macro for the characters queued for CMD_poll(), a power of 2
+#endif
+#ifndef CMD_PROMPT
+#define CMD_PROMPT          "> "                    // Macro for the prompt of the shell
+#endif
+
+// Return values of the commands and of CMD_run()
+#define CMD_OK              0                       // Macro for a command that ran
+#define CMD_ERR_UNKNOWN     (-1)                    // Macro for a first word that is no command
+#define CMD_ERR_ARGS        (-2)                    // Macro for a line of more than CMD_MAX_ARGS words
+#define CMD_ERR_USAGE       (-3)                    // Macro for a command given wrong arguments
+
+// Macros for the hash of the command names, FNV-1a from a seed, and its slot of 2^ui32Bits
+#define CMD_HASH_STEP(ui32Hash, cChar)  (((ui32Hash) ^ (uint8_t)(cChar)) * 16777619u)
+#define CMD_HASH_SLOT(ui32Hash, ui32Bits)   ((ui32Hash) >> (32 - (ui32Bits)))
+#define CMD_HASH_EMPTY      0xFF                    // Macro for a slot of no command
+
+/* -----------------------      Global Variables        --------------------- */
+typedef int32_t (*tCmdFunction)(uint32_t ui32Argc, char *ppcArgv[]);
+typedef int (*tCmdWrite)(const char *pcBuf, uint32_t ui32Len);
+
+typedef struct {
+    const char *pcName;                             // Name of the command, its first word
+    tCmdFunction pfnCmd;                            // Function running the command
+    const char *pcHelp;                             // Line listed by help
+} tCmdEntry;
+
+/* -----------------------      Function Prototypes     --------------------- */
+void CMD_init(tCmdWrite pfnWrite);                  // Shell writing to pfnWrite, prints the prompt
+bool CMD_input(char cChar);                         // Interrupt handler, queues a character, false if full
+bool CMD_poll(void);                                // Main loop, edits the line and runs it once it ends
+int32_t CMD_run(char *pcLine);                      // Splits a line in place and runs its command
+void CMD_puts(const char *pcStr);                   // Write a string to the shell
+void CMD_write(const char *pcBuf, uint32_t ui32Len);    // Write characters to the shell
+
+#endif /* CMD_SHELL_H_ */
@@ -0,0 +1,48 @@
+/*!
+ * @author      Yash Bansod
+ * @date        17th October 2026
+ *
+ * @brief       Header containing the number to text conversions of uartstdio
+ * @details     The decimal conversions do not divide: the number of digits is found by
+ *              comparing with the powers of 10 and the digits are written from the
+ *              last, two at a time, the quotient by 100 being a multiply by its
+ *              reciprocal 0x51EB851F and a shift by 37, exact for every 32 bit value,
+ *              and the remainder indexing a table of the 100 digit pairs. On the
+ *              Cortex-M4 the multiply is one UMULL, where UDIV takes up to 12 cycles.
+ *              Every function returns the number of characters written and writes no
+ *              terminating NUL, so the callers send only the characters produced; the
+ *              buffers must hold the FMT_x_MAX characters of the function.
+ *              FMT_q() writes a fixed-point value of ui32Frac fractional bits, a Q
+ *              format of the sensors, with ui32Places decimals rounded half away from
+ *              zero; a negative value keeps its sign when it rounds to 0, as printf()
+ *              does.
+ * @file        FMT_num.h
+ */
+/* -----------------------          Include Files       --------------------- */
+#include <stdint.h>                         // Library of Standard Integer Types
+#include <stdbool.h>                        // Library of Standard Boolean Types
+
+#ifndef FMT_NUM_H_
+#define FMT_NUM_H_
+
+/* -----------------------      Macro Definitions       --------------------- */
+#define FMT_U32_MAX         10                      // Macro for the longest output of FMT_u32()
+#define FMT_I32_MAX         11                      // Macro for the longest output of FMT_i32()
+#define FMT_X32_MAX         8                       // Macro for the longest output of FMT_x32()
+#define FMT_Q_PLACES_MAX    9                       // Macro for the most decimals of FMT_q()
+#define FMT_Q_MAX           (FMT_I32_MAX + 1 + FMT_Q_PLACES_MAX)
+
+// Macro for the quotient by 100 of a 32 bit value, without a divide
+#define FMT_DIV100(ui32Value)   ((uint32_t)(((uint64_t)(ui32Value) * 0x51EB851Fu) >> 37))
+
+/* -----------------------      Function Prototypes     --------------------- */
+uint32_t FMT_digits(uint32_t ui32Value);                                // Decimal digits of a value
+uint32_t FMT_u32(char *pcDst, uint32_t ui32Value);                      // Unsigned decimal
+uint32_t FMT_i32(char *pcDst, int32_t i32Value);                        // Signed decimal
+uint32_t FMT_x32(char *pcDst, uint32_t ui32Value);                      // Lower case hexadecimal
+uint32_t FMT_uq(char *pcDst, uint32_t ui32Value, uint32_t ui32Frac,
+                uint32_t ui32Places);                                   // Unsigned fixed-point
+uint32_t FMT_q(char *pcDst, int32_t i32Value, uint32_t ui32Frac,
+               uint32_t ui32Places);                                    // Signed fixed-point
+
+#endif /* FMT_NUM_H_ */
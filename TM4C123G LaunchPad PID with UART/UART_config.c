@@ -23,7 +23,8 @@ void UART0_init(void){
     // Configure the baud rate and data setup for the UART0
     ROM_UARTConfigSetExpClk(UART0_BASE, ROM_SysCtlClockGet(), UART0_BAUDRATE, UART_CONFIG_WLEN_8 | UART_CONFIG_STOP_ONE | UART_CONFIG_PAR_NONE );
 
-    // Configure and enable the interrupt for UART0
+    // Configure and enable the interrupt for UART0, the QEI1 interrupt of the PID loop preempting it
+    ROM_IntPrioritySet(INT_UART0, UART0_INT_PRIO);
     ROM_IntEnable(INT_UART0);
     ROM_UARTIntEnable(UART0_BASE, UART_INT_RX | UART_INT_RT);
 }
@@ -33,3 +34,14 @@ void UART0_enable(void){
     // Enable the UART0 peripheral
     ROM_UARTEnable(UART0_BASE);
 }
+
+// Function for Sending the output of the shell, a new line going out as CR LF
+int UART0_write(const char *pcBuf, uint32_t ui32Len){
+    uint32_t ui32Idx;
+
+    for (ui32Idx = 0; ui32Idx < ui32Len; ui32Idx++){
+        if (pcBuf[ui32Idx] == '\n') ROM_UARTCharPut(UART0_BASE, '\r');
+        ROM_UARTCharPut(UART0_BASE, pcBuf[ui32Idx]);
+    }
+    return ui32Len;
+}
@@ -17,5 +17,6 @@
 
 void UART0_init(void);                              // Function for Initializing UART0 Peripheral
 void UART0_enable(void);                            // Function for Enabling UART0 Peripheral
+int UART0_write(const char *pcBuf, uint32_t ui32Len);   // Function for Sending the output of the shell
 
 #endif /* UART_CONFIG_H_ */
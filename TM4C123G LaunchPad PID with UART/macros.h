@@ -17,6 +17,7 @@
 #define K_I             9                           // Macro for SumError Multiplication by 1/2^N
 #define K_D             6                           // Macro for Error Difference Multiplication by 1/2^N
 #define UART0_BAUDRATE  115200                      // Macro for UART0 Baud rate
+#define UART0_INT_PRIO  0x20                        // Macro for the UART0 interrupt priority, below QEI1 at 0
 #define CENTER_POSITION 1073741823                  // Macro for Center Position of Motor Shaft
 
 #endif /* MACROS_H_ */
@@ -7,6 +7,12 @@
  *              a PID Position control of an Encoded DC Motor. The Motor used is
  *              Faulhaber 12V(17W) Coreless motor, 64:1 Planetary gearbox, 120RPM,
  *              12 PPR Encoder. This gives 3072 CPR of quadrature.
+ *              The UART input goes to the command shell of CMD_shell.c: pos sets the
+ *              desired position in tenths of a degree, state prints the desired
+ *              position, the error and the duty cycle, and help lists the commands.
+ *              UART0IntHandler only queues the characters; the shell echoes them and
+ *              answers from the main loop, so a long listing never holds off the PID
+ *              update of QEI1IntHandler, whose interrupt also has the higher priority.
  *
  * @note        The tm4c123ghpm_startup_ccs.c contains the vector table for the
  *              microcontroller. It was modified to execute the specified ISR on
@@ -25,14 +31,15 @@
 #include "QEI_config.h"
 #include "PWM_config.h"
 #include "UART_config.h"
-
-/* -----------------------      Global Variables        --------------------- */
-
-char UARTinput[8];                          // Buffer to store input from UART
+#include "CMD_shell.h"
+#include "FMT_num.h"
+#include "UNIT_convert.h"
 
 /* -----------------------      Function Prototypes     --------------------- */
 void PID_Update(void);                      // Function prototype for PID control
-void concat(char s1[], char s2[]);          // Function prototype for concatenation of strings
+void PID_print(const char *pcLabel, int32_t i32Value);  // Function prototype for printing a value to the shell
+int32_t Cmd_pos(uint32_t ui32Argc, char *ppcArgv[]);    // Function prototype for the pos command
+int32_t Cmd_state(uint32_t ui32Argc, char *ppcArgv[]);  // Function prototype for the state command
 
 /* -----------------------          Main Program        --------------------- */
 int main(void) {
@@ -40,7 +47,7 @@ int main(void) {
     // Set the System clock to 80MHz and the PWM Module clock to 1.25 MHz
     ROM_SysCtlClockSet(SYSCTL_SYSDIV_2_5 |SYSCTL_USE_PLL |SYSCTL_OSC_MAIN |SYSCTL_XTAL_16MHZ);
 
-    i32DesPosTick = CENTER_POSITION + (i32DesPosDeg * QEI1_CPR / 3600);
+    i32DesPosTick = CENTER_POSITION + UNIT_DEG_TO_TICKS(i32DesPosDeg);
 
     // Initialize the UART0 module
     UART0_init();
@@ -60,16 +67,16 @@ int main(void) {
     // Enable the PWM1 Generator0
     PWM1_0_enable();
 
-    uint8_t ui8WelcomeText[] = {"Enter Motor Position in Degrees (input will be divided by 10):\n\r"};
-    uint8_t limit = sizeof(ui8WelcomeText);
-    uint8_t iter;
-    for (iter = 0; iter<limit; iter++ ) ROM_UARTCharPut(UART0_BASE, ui8WelcomeText[iter]);
+    uint8_t ui8WelcomeText[] = {"Enter pos and the Motor Position in Degrees (input will be divided by 10), help for the commands:\n"};
+    UART0_write((const char *)ui8WelcomeText, sizeof(ui8WelcomeText) - 1);
+    CMD_init(UART0_write);
 
     // Master interrupt enable API for all interrupts
     ROM_IntMasterEnable();
 
+    // Run the commands typed by the user
     while (true){
-
+        CMD_poll();
     }
 }
 /* -----------------------      Function Definition     --------------------- */
@@ -84,7 +91,7 @@ void QEI1IntHandler(void){
     // Update the direction reading of the encoder
     i32Qei1Dir = ROM_QEIDirectionGet(QEI1_BASE);
     // Calculate the velocity in RPM
-    ui16Qei1Rpm = (ui32Qei1Vel << VEL_INT_FREQ) * 60 / QEI1_CPR;
+    ui16Qei1Rpm = UNIT_VEL_TO_RPM(ui32Qei1Vel);
     // Update the PID loop
     PID_Update();
 }
@@ -96,17 +103,8 @@ void UART0IntHandler(void){
 
     // While there is a character available at input
     while(ROM_UARTCharsAvail(UART0_BASE)){
-        // Echo the character back to the user
-        int32_t reprint = ROM_UARTCharGetNonBlocking(UART0_BASE);
-        char temp= (char)reprint;
-        ROM_UARTCharPutNonBlocking(UART0_BASE, reprint);
-        concat(UARTinput, &temp);
-        if (temp == '\r'){
-            i32DesPosDeg = strtoimax(UARTinput, NULL, 10);
-            i32DesPosTick = CENTER_POSITION + (i32DesPosDeg * QEI1_CPR / 3600);
-            UARTinput[0] = '\0';
-            ROM_UARTCharPutNonBlocking(UART0_BASE, '\n');
-        }
+        // Queue the character for the shell, CMD_poll() echoes it back from the main loop
+        CMD_input(ROM_UARTCharGetNonBlocking(UART0_BASE));
     }
 }
 
@@ -174,12 +172,38 @@ void PID_Update(void){
     i16AdjustOld_PWM1_0 = i16Adjust_PWM1_0;
 }
 
-// Function to concatenate strings
-void concat(char s1[], char s2[]) {
-    int i, j;
-    i = strlen(s1);
-    for (j = 0; s2[j] != '\0'; i++, j++) {
-        s1[i] = s2[j];
-    }
-    s1[i] = '\0';
+// Function to print a label and a signed value to the shell
+void PID_print(const char *pcLabel, int32_t i32Value){
+    char pcNum[FMT_I32_MAX];
+
+    CMD_puts(pcLabel);
+    CMD_write(pcNum, FMT_i32(pcNum, i32Value));
+}
+
+// Function of the pos command, setting the desired position in tenths of a degree
+int32_t Cmd_pos(uint32_t ui32Argc, char *ppcArgv[]){
+    char *pcEnd;
+    intmax_t iDeg;
+
+    if (ui32Argc != 2) return CMD_ERR_USAGE;
+    iDeg = strtoimax(ppcArgv[1], &pcEnd, 10);
+    // Up to 100 turns either way, so that the ticks of the position do not overflow
+    if (pcEnd == ppcArgv[1] || *pcEnd || iDeg > UNIT_DEG_MAX || iDeg < -UNIT_DEG_MAX) return CMD_ERR_USAGE;
+
+    i32DesPosDeg = (int32_t)iDeg;
+    i32DesPosTick = CENTER_POSITION + UNIT_DEG_TO_TICKS(i32DesPosDeg);
+    PID_print("pos ", i32DesPosDeg);
+    CMD_puts(" (deg/10)\n");
+    return CMD_OK;
+}
+
+// Function of the state command, printing the desired position, the error and the duty cycle
+int32_t Cmd_state(uint32_t ui32Argc, char *ppcArgv[]){
+    (void)ppcArgv;
+    if (ui32Argc != 1) return CMD_ERR_USAGE;
+    PID_print("pos ", i32DesPosDeg);
+    PID_print(" (deg/10), error ", i32ErrorNew);
+    PID_print(" ticks, duty ", i16Adjust_PWM1_0);
+    CMD_puts(" %\n");
+    return CMD_OK;
 }
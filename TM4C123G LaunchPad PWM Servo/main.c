@@ -7,9 +7,12 @@
  *              varying the Duty Cycle of the PWM. The Duty Cycle can be increased by
  *              clicking the onboard switch SW2(PF0) or decreased by clicking SW1(PF4).
  *              The PWM module .
+ *              The switches are sampled by the SysTick and debounced (see "BTN_event.h"),
+ *              holding a switch moves the servo to its end and a double click of either
+ *              switch centers it. The events are handled in the main loop.
  * @note        The tm4c123ghpm_startup_ccs.c contains the vector table for the
  *              microcontroller. It was modified to execute the specified ISR on
- *              PortF Interrupts.
+ *              SysTick Interrupts.
  */
 /* -----------------------          Include Files       --------------------- */
 #include <stdint.h>                         // Library of Standard Integer Types
@@ -23,18 +26,28 @@
 #include "driverlib/pwm.h"                  // API function prototypes for PWM ports
 #include "driverlib/sysctl.h"               // Defines and macros for System Control API of DriverLib
 #include "driverlib/interrupt.h"            // Defines and macros for NVIC Controller API of DriverLib
+#include "driverlib/systick.h"              // Defines and macros for SysTick API of DriverLib
 #include "driverlib/gpio.h"                 // Defines and macros for GPIO API of DriverLib
 #include "driverlib/pin_map.h"              // Mapping of peripherals to pins for all parts
 #include "driverlib/rom.h"                  // Defines and macros for ROM API of driverLib
+#include "BTN_event.h"                      // Debounced button events
 
 #define PWM_FREQUENCY 50                    // Define a macro for the frequency of the PWM signal in Hz
+#define BUTTON_TICK_HZ 100                  // Define a macro for the SysTick rate sampling the switches in Hz
+#define BUTTON_SW1 4                        // Define a macro for the pin of SW1 (PF4) in the button events
+#define BUTTON_SW2 0                        // Define a macro for the pin of SW2 (PF0) in the button events
+#define BUTTON_PINS (GPIO_PIN_4 | GPIO_PIN_0)
+#define ADJUST_MIN 50                       // Define a macro for the smallest Duty Cycle of Servo
+#define ADJUST_MAX 100                      // Define a macro for the largest Duty Cycle of Servo
+#define ADJUST_CENTER 75                    // Define a macro for the Duty Cycle of the Servo at its center
 
 /* -----------------------      Global Variables        --------------------- */
 uint32_t ui32Period;                        // Variable to store PWM time period
-volatile uint8_t ui8Adjust = 75;            // Variable to store Duty Cycle of Servo
+uint8_t ui8Adjust = ADJUST_CENTER;          // Variable to store Duty Cycle of Servo
+tBtnPort sBtnPort;                          // Variable to store the debounced switches
 
 /* -----------------------      Function Prototypes     --------------------- */
-void PortFIntHandler(void);                 // Prototype for ISR of GPIO PortF
+void SysTickIntHandler(void);               // Prototype for ISR of SysTick
 
 /* -----------------------          Main Program        --------------------- */
 int main(void){
@@ -60,10 +73,11 @@ int main(void){
     ROM_GPIODirModeSet(GPIO_PORTF_BASE, GPIO_PIN_4|GPIO_PIN_0, GPIO_DIR_MODE_IN);
     ROM_GPIOPadConfigSet(GPIO_PORTF_BASE, GPIO_PIN_4 | GPIO_PIN_0, GPIO_STRENGTH_2MA, GPIO_PIN_TYPE_STD_WPU);
 
-    // Configure and enable the Interrupt for PF0 and PF4
-    ROM_IntEnable(INT_GPIOF);
-    ROM_GPIOIntTypeSet(GPIO_PORTF_BASE, GPIO_PIN_4 | GPIO_PIN_0, GPIO_FALLING_EDGE);
-    GPIOIntEnable(GPIO_PORTF_BASE, GPIO_INT_PIN_0 | GPIO_INT_PIN_4);
+    // Sample PF0 and PF4 on the SysTick Interrupt, both switches are Active Low
+    BTN_init(&sBtnPort, BUTTON_PINS, BUTTON_PINS, BUTTON_TICK_HZ);
+    ROM_SysTickPeriodSet(ROM_SysCtlClockGet() / BUTTON_TICK_HZ);
+    ROM_SysTickIntEnable();
+    ROM_SysTickEnable();
     // Master interrupt enable API for all interrupts
     ROM_IntMasterEnable();
 
@@ -82,28 +96,43 @@ int main(void){
     // Enable the PWM Generator
     ROM_PWMGenEnable(PWM1_BASE, PWM_GEN_0);
 
-    while (1);
-}
+    while (1){
+        uint8_t ui8Event;
 
-/* -----------------------      Function Definition     --------------------- */
-void PortFIntHandler(void){
-    // The ISR for GPIO PortF Interrupt Handling
-    GPIOIntClear(GPIO_PORTF_BASE , GPIO_INT_PIN_4 | GPIO_INT_PIN_0);
+        // Execute the switch events posted by SysTickIntHandler
+        while (BTN_get(&sBtnPort, &ui8Event)){
+            uint8_t ui8Type = BTN_TYPE(ui8Event);
 
-    // If SW1(PF4) is pressed then reduce the duty cycle
-    if(ROM_GPIOPinRead(GPIO_PORTF_BASE, GPIO_PIN_4 | GPIO_PIN_0)== GPIO_PIN_0){
-        ui8Adjust--;
-        if (ui8Adjust < 50){
-            ui8Adjust = 50;
-        }
-        ROM_PWMPulseWidthSet(PWM1_BASE, PWM_OUT_0, ui8Adjust * ui32Period / 1000);
-    }
-    // If SW2(PW0) is pressed then increase the duty cycle
-    if(ROM_GPIOPinRead(GPIO_PORTF_BASE, GPIO_PIN_4 | GPIO_PIN_0)== GPIO_PIN_4){
-        ui8Adjust++;
-        if (ui8Adjust > 100){
-            ui8Adjust = 100;
+            // A double click of either switch centers the servo
+            if (ui8Type == BTN_DOUBLE){
+                ui8Adjust = ADJUST_CENTER;
+            }
+            // If SW1(PF4) is pressed then reduce the duty cycle, if it is held then go to the smallest
+            else if (BTN_PIN(ui8Event) == BUTTON_SW1){
+                if (ui8Type == BTN_PRESS && ui8Adjust > ADJUST_MIN){
+                    ui8Adjust--;
+                }
+                else if (ui8Type == BTN_LONG){
+                    ui8Adjust = ADJUST_MIN;
+                }
+            }
+            // If SW2(PF0) is pressed then increase the duty cycle, if it is held then go to the largest
+            else if (BTN_PIN(ui8Event) == BUTTON_SW2){
+                if (ui8Type == BTN_PRESS && ui8Adjust < ADJUST_MAX){
+                    ui8Adjust++;
+                }
+                else if (ui8Type == BTN_LONG){
+                    ui8Adjust = ADJUST_MAX;
+                }
+            }
+            ROM_PWMPulseWidthSet(PWM1_BASE, PWM_OUT_0, ui8Adjust * ui32Period / 1000);
         }
-        ROM_PWMPulseWidthSet(PWM1_BASE, PWM_OUT_0, ui8Adjust * ui32Period / 1000);
     }
 }
+
+/* -----------------------      Function Definition     --------------------- */
+void SysTickIntHandler(void){
+    // The ISR for SysTick Interrupt Handling
+    // Sample SW1 and SW2, their events are handled by the main loop
+    BTN_sample(&sBtnPort, HWREG(GPIO_PORTF_BASE + GPIO_O_DATA + (BUTTON_PINS << 2)));
+}
@@ -0,0 +1,161 @@
+/*!
+ * @author      Yash Bansod
+ * @date        17th October 2026
+ *
+ * @brief       Source containing function definitions for the GP Timer PWM channels
+ * @file        TPWM_config.c
+ */
+/* -----------------------          Include Files       --------------------- */
+#include "TPWM_config.h"
+
+/* -----------------------      Macro Definitions       --------------------- */
+#define TPWM_IS_SOFT(psChannel)     ((psChannel)->ui32PinMux == TPWM_SOFT)  // Macro to check for a soft PWM channel
+#define TPWM_TIMEOUT(ui32Timer)     (((ui32Timer) == TIMER_A) ? TIMER_TIMA_TIMEOUT : TIMER_TIMB_TIMEOUT)
+#define TPWM_CFG(ui32Timer, bSoft)  (((ui32Timer) == TIMER_A) ?                                   \
+                                     ((bSoft) ? TIMER_CFG_A_PERIODIC : TIMER_CFG_A_PWM) :         \
+                                     ((bSoft) ? TIMER_CFG_B_PERIODIC : TIMER_CFG_B_PWM))
+
+/* -----------------------      Global Variables        --------------------- */
+// Onboard RGB LEDs, all on pins with a CCP
+static const tTpwmChannel psTpwmChannel[TPWM_CHANNELS] = {
+    // Red LED on PF1 (Timer0 B, T0CCP1)
+    {SYSCTL_PERIPH_TIMER0, TIMER0_BASE, TIMER_B, INT_TIMER0B,
+     SYSCTL_PERIPH_GPIOF, GPIO_PORTF_BASE, GPIO_PIN_1, GPIO_PF1_T0CCP1, TPWM_FREQUENCY},
+    // Blue LED on PF2 (Timer1 A, T1CCP0)
+    {SYSCTL_PERIPH_TIMER1, TIMER1_BASE, TIMER_A, INT_TIMER1A,
+     SYSCTL_PERIPH_GPIOF, GPIO_PORTF_BASE, GPIO_PIN_2, GPIO_PF2_T1CCP0, TPWM_FREQUENCY},
+#ifdef TPWM_GREEN_SOFT
+    // Green LED on PF3 through the soft PWM of Timer0 A, as for a pin without CCP
+    {SYSCTL_PERIPH_TIMER0, TIMER0_BASE, TIMER_A, INT_TIMER0A,
+     SYSCTL_PERIPH_GPIOF, GPIO_PORTF_BASE, GPIO_PIN_3, TPWM_SOFT, TPWM_FREQUENCY}
+#else
+    // Green LED on PF3 (Timer1 B, T1CCP1)
+    {SYSCTL_PERIPH_TIMER1, TIMER1_BASE, TIMER_B, INT_TIMER1B,
+     SYSCTL_PERIPH_GPIOF, GPIO_PORTF_BASE, GPIO_PIN_3, GPIO_PF3_T1CCP1, TPWM_FREQUENCY}
+#endif
+};
+
+static uint32_t ui32TpwmPeriod[TPWM_CHANNELS];      // Array to store the period of each channel in timer counts
+static uint16_t ui16TpwmDuty[TPWM_CHANNELS];        // Array to store the duty of each channel in %
+static volatile uint32_t ui32TpwmOn[TPWM_CHANNELS];     // Array to store the On time of the soft channels
+static volatile uint32_t ui32TpwmOff[TPWM_CHANNELS];    // Array to store the Off time of the soft channels
+static volatile bool bTpwmHigh[TPWM_CHANNELS];      // Array to store the pin state of the soft channels
+
+/* -----------------------      Function Definition     --------------------- */
+// Function for Initializing the channels of psTpwmChannel with their pins low
+void TPWM_init(void){
+    uint32_t ui32Clock = SysCtlClockGet();
+    uint8_t ui8Index, ui8Other;
+
+    for (ui8Index = 0; ui8Index < TPWM_CHANNELS; ui8Index++){
+        const tTpwmChannel *psChannel = &psTpwmChannel[ui8Index];
+
+        // Enable the clock for the timer and the port of the pin, the pin starts as a low GPIO
+        SysCtlPeripheralEnable(psChannel->ui32TimerPeriph);
+        SysCtlPeripheralEnable(psChannel->ui32GpioPeriph);
+        GPIOPinTypeGPIOOutput(psChannel->ui32GpioBase, psChannel->ui8GpioPin);
+        GPIOPinWrite(psChannel->ui32GpioBase, psChannel->ui8GpioPin, 0);
+        if (!TPWM_IS_SOFT(psChannel))
+            GPIOPinConfigure(psChannel->ui32PinMux);
+        ui16TpwmDuty[ui8Index] = 0;
+    }
+
+    for (ui8Index = 0; ui8Index < TPWM_CHANNELS; ui8Index++){
+        const tTpwmChannel *psChannel = &psTpwmChannel[ui8Index];
+        uint32_t ui32Config = TIMER_CFG_SPLIT_PAIR;
+        bool bFirst = true;
+
+        // Configure each timer once, with the modes of the channels on both of its halves
+        for (ui8Other = 0; ui8Other < TPWM_CHANNELS; ui8Other++){
+            if (psTpwmChannel[ui8Other].ui32TimerBase != psChannel->ui32TimerBase) continue;
+            if (ui8Other < ui8Index) bFirst = false;
+            ui32Config |= TPWM_CFG(psTpwmChannel[ui8Other].ui32Timer, TPWM_IS_SOFT(&psTpwmChannel[ui8Other]));
+        }
+        if (bFirst)
+            TimerConfigure(psChannel->ui32TimerBase, ui32Config);
+    }
+
+    for (ui8Index = 0; ui8Index < TPWM_CHANNELS; ui8Index++){
+        const tTpwmChannel *psChannel = &psTpwmChannel[ui8Index];
+        uint32_t ui32Period = ui32Clock / psChannel->ui32Frequency;
+        uint32_t ui32Prescale = (ui32Period - 1) >> 16;
+
+        if (TPWM_IS_SOFT(psChannel)){
+            // In periodic mode the prescaler divides the clock, the intervals count prescaled ticks
+            ui32TpwmPeriod[ui8Index] = ui32Period / (ui32Prescale + 1);
+            TimerPrescaleSet(psChannel->ui32TimerBase, psChannel->ui32Timer, ui32Prescale);
+            // A written interval is taken at the next timeout, the handler writes the one after the next
+            TimerUpdateMode(psChannel->ui32TimerBase, psChannel->ui32Timer, TIMER_UP_LOAD_TIMEOUT);
+            TimerIntEnable(psChannel->ui32TimerBase, TPWM_TIMEOUT(psChannel->ui32Timer));
+            IntEnable(psChannel->ui32Int);
+        } else{
+            // In PWM mode the prescaler holds bits 23:16 of the load and match values
+            ui32TpwmPeriod[ui8Index] = ui32Period;
+            TimerPrescaleSet(psChannel->ui32TimerBase, psChannel->ui32Timer, ui32Prescale);
+            TimerLoadSet(psChannel->ui32TimerBase, psChannel->ui32Timer, (ui32Period - 1) & 0xFFFF);
+        }
+    }
+}
+
+// Function for Setting the duty of a channel in %, 0 % and 100 % drive the pin as a GPIO
+void TPWM_set(uint8_t ui8Channel, uint16_t ui16Duty){
+    const tTpwmChannel *psChannel = &psTpwmChannel[ui8Channel];
+    uint32_t ui32Base = psChannel->ui32TimerBase, ui32Timer = psChannel->ui32Timer;
+    uint32_t ui32Period = ui32TpwmPeriod[ui8Channel];
+    bool bStopped = (ui16TpwmDuty[ui8Channel] == 0 || ui16TpwmDuty[ui8Channel] >= 100);
+
+    if (ui16Duty > 100) ui16Duty = 100;
+    ui16TpwmDuty[ui8Channel] = ui16Duty;
+
+    if (ui16Duty == 0 || ui16Duty == 100){
+        // Stop the timer half and take the pin back as a GPIO
+        TimerDisable(ui32Base, ui32Timer);
+        TimerIntClear(ui32Base, TPWM_TIMEOUT(ui32Timer));
+        if (!TPWM_IS_SOFT(psChannel))
+            GPIOPinTypeGPIOOutput(psChannel->ui32GpioBase, psChannel->ui8GpioPin);
+        GPIOPinWrite(psChannel->ui32GpioBase, psChannel->ui8GpioPin, ui16Duty ? psChannel->ui8GpioPin : 0);
+    } else if (!TPWM_IS_SOFT(psChannel)){
+        // The pin is high from the reload at Period - 1 down to the match value
+        uint32_t ui32Match = ui32Period - 1 - ui32Period * ui16Duty / 100;
+        if (bStopped)
+            TimerUpdateMode(ui32Base, ui32Timer, TIMER_UP_MATCH_IMMEDIATE);
+        TimerPrescaleMatchSet(ui32Base, ui32Timer, ui32Match >> 16);
+        TimerMatchSet(ui32Base, ui32Timer, ui32Match & 0xFFFF);
+        if (bStopped){
+            // A stopped timer half starts its first period at the new match
+            TimerUpdateMode(ui32Base, ui32Timer, TIMER_UP_MATCH_TIMEOUT);
+            GPIOPinTypeTimer(psChannel->ui32GpioBase, psChannel->ui8GpioPin);
+            TimerEnable(ui32Base, ui32Timer);
+        }
+    } else{
+        // The interrupt handler takes the new times at its next edges
+        ui32TpwmOn[ui8Channel] = ui32Period * ui16Duty / 100;
+        ui32TpwmOff[ui8Channel] = ui32Period - ui32TpwmOn[ui8Channel];
+        if (bStopped){
+            // Start with the On time in the counter and the Off time to be taken at its timeout
+            bTpwmHigh[ui8Channel] = true;
+            GPIOPinWrite(psChannel->ui32GpioBase, psChannel->ui8GpioPin, psChannel->ui8GpioPin);
+            TimerUpdateMode(ui32Base, ui32Timer, TIMER_UP_LOAD_IMMEDIATE);
+            TimerLoadSet(ui32Base, ui32Timer, ui32TpwmOn[ui8Channel] - 1);
+            TimerUpdateMode(ui32Base, ui32Timer, TIMER_UP_LOAD_TIMEOUT);
+            TimerEnable(ui32Base, ui32Timer);
+            TimerLoadSet(ui32Base, ui32Timer, ui32TpwmOff[ui8Channel] - 1);
+        }
+    }
+}
+
+// Function for the timeout interrupt of a soft PWM channel, to be called by the handler of its timer half
+void TPWM_softIntHandler(uint8_t ui8Channel){
+    const tTpwmChannel *psChannel = &psTpwmChannel[ui8Channel];
+    bool bHigh = !bTpwmHigh[ui8Channel];
+
+    TimerIntClear(psChannel->ui32TimerBase, TPWM_TIMEOUT(psChannel->ui32Timer));
+
+    // The pin follows the state kept here, it is not read back
+    bTpwmHigh[ui8Channel] = bHigh;
+    HWREG(psChannel->ui32GpioBase + GPIO_O_DATA + (psChannel->ui8GpioPin << 2)) = bHigh ? psChannel->ui8GpioPin : 0;
+
+    // The counter already runs the time of the new state, load the time of the state after it
+    TimerLoadSet(psChannel->ui32TimerBase, psChannel->ui32Timer,
+                 (bHigh ? ui32TpwmOff[ui8Channel] : ui32TpwmOn[ui8Channel]) - 1);
+}
@@ -0,0 +1,63 @@
+/*!
+ * @author      Yash Bansod
+ * @date        17th October 2026
+ *
+ * @brief       Header containing function prototypes for the GP Timer PWM channels
+ * @details     The channels are described by the const table psTpwmChannel of
+ *              TPWM_config.c, each on one half (A or B) of a 16/32 bit timer split in
+ *              two. A channel whose pin has a CCP (capture compare PWM) function runs
+ *              its timer half in the native PWM mode: the counter counts down from the
+ *              load value with the prescaler as its upper 8 bits, the pin goes high at
+ *              the reload and low at the match value, and no interrupt is taken. A new
+ *              match value is taken at the next timeout, so a duty update never cuts a
+ *              period short.
+ *              A channel of a pin without CCP (pin mux TPWM_SOFT) falls back to the
+ *              soft PWM: its timer half runs periodic and the handler of its interrupt
+ *              calls TPWM_softIntHandler() at every edge, which toggles the pin from the
+ *              state it keeps and writes the interval after the next one, taken by the
+ *              timer at its next timeout. This costs two interrupts per period and the
+ *              edges move with the interrupt latency.
+ *              At 0 % and 100 % the timer half is stopped and the pin driven as a GPIO.
+ * @file        TPWM_config.h
+ */
+/* -----------------------          Include Files       --------------------- */
+#include <stdint.h>                         // Library of Standard Integer Types
+#include <stdbool.h>                        // Library of Standard Boolean Types
+#include "inc/tm4c123gh6pm.h"               // Definitions for interrupt and register assignments on Tiva C
+#include "inc/hw_memmap.h"                  // Macros defining the memory map of the Tiva C Series device
+#include "inc/hw_types.h"                   // Defines common types and macros
+#include "inc/hw_gpio.h"                    // Defines Macros for GPIO hardware
+#include "driverlib/sysctl.h"               // Defines and macros for System Control API of DriverLib
+#include "driverlib/interrupt.h"            // Defines and macros for NVIC Controller API of DriverLib
+#include "driverlib/gpio.h"                 // Defines and macros for GPIO API of DriverLib
+#include "driverlib/pin_map.h"              // Mapping of peripherals to pins for all parts
+#include "driverlib/timer.h"                // Defines and macros for Timer API of driverLib
+
+ /* -----------------------      Function Prototypes     --------------------- */
+#ifndef TPWM_CONFIG_H_
+#define TPWM_CONFIG_H_
+
+#define TPWM_CHANNELS       3                       // Macro for the number of PWM channels
+#define TPWM_RED            0                       // Macro for the channel of the Red LED (PF1)
+#define TPWM_BLUE           1                       // Macro for the channel of the Blue LED (PF2)
+#define TPWM_GREEN          2                       // Macro for the channel of the Green LED (PF3)
+#define TPWM_FREQUENCY      1000                    // Macro for the PWM frequency of the LEDs in Hz
+#define TPWM_SOFT           0                       // Macro for the pin mux of a pin without CCP
+
+typedef struct {
+    uint32_t ui32TimerPeriph;                       // SYSCTL_PERIPH_TIMERn of the timer
+    uint32_t ui32TimerBase;                         // TIMERn_BASE of the timer
+    uint32_t ui32Timer;                             // TIMER_A or TIMER_B half of the timer
+    uint32_t ui32Int;                               // INT_TIMERnA or INT_TIMERnB of the half, for the soft PWM
+    uint32_t ui32GpioPeriph;                        // SYSCTL_PERIPH_GPIOx of the pin
+    uint32_t ui32GpioBase;                          // GPIO_PORTx_BASE of the pin
+    uint8_t ui8GpioPin;                             // GPIO_PIN_n of the pin
+    uint32_t ui32PinMux;                            // GPIO_Pxn_TnCCPm pin mux, TPWM_SOFT for a pin without CCP
+    uint32_t ui32Frequency;                         // PWM frequency in Hz
+} tTpwmChannel;
+
+ void TPWM_init(void);                              // Function for Initializing the channels at 0 %
+ void TPWM_set(uint8_t ui8Channel, uint16_t ui16Duty);  // Function for Setting the duty of a channel in %
+ void TPWM_softIntHandler(uint8_t ui8Channel);      // Function for the timer interrupt of a soft PWM channel
+
+#endif /* TPWM_CONFIG_H_ */
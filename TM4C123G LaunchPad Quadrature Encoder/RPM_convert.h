@@ -0,0 +1,37 @@
+/*!
+ * @author      Yash Bansod
+ * @date        17th October 2026
+ *
+ * @brief       Header containing the division-free RPM conversion of QEI1
+ * @details     RPM = Vel * VEL_INT_FREQ * 60 / QEI1_PPR is computed as (Vel * RPM_MUL) >> RPM_SHIFT
+ *              with RPM_MUL = ceil(VEL_INT_FREQ * 60 * 2^RPM_SHIFT / QEI1_PPR). With the excess
+ *              E = RPM_MUL * QEI1_PPR - VEL_INT_FREQ * 60 * 2^RPM_SHIFT it equals the division
+ *              for every Vel <= RPM_VEL_MAX as long as RPM_VEL_MAX * E < 2^RPM_SHIFT. The
+ *              product is taken in 64 bits, where Vel * VEL_INT_FREQ * 60 overflowed 32 bits
+ *              above 7158 counts per period. RPM_MUL takes 33 bits, so the product is a UMULL
+ *              and a multiply-add, still without a divide.
+ *              The conversion is checked against the division by "PID_sim --units".
+ * @file        RPM_convert.h
+ */
+/* -----------------------          Include Files       --------------------- */
+#include <stdint.h>                         // Library of Standard Integer Types
+
+#ifndef RPM_CONVERT_H_
+#define RPM_CONVERT_H_
+
+/* -----------------------      Macro Definitions       --------------------- */
+#define VEL_INT_FREQ    10000               // Macro to store the Interrupt frequency of QEI1
+#define QEI1_PPR        257125              // Macro to store the PPR of the QEI1
+
+#define RPM_NUM         (VEL_INT_FREQ * 60ULL)
+#define RPM_SHIFT       31
+#define RPM_MUL         ((RPM_NUM * (1ULL << RPM_SHIFT) + QEI1_PPR - 1) / QEI1_PPR)
+#define RPM_VEL_MAX     ((65536ULL * QEI1_PPR - 1) / RPM_NUM)      // Largest count below 65536 RPM
+#if RPM_VEL_MAX * (RPM_MUL * QEI1_PPR - RPM_NUM * (1ULL << RPM_SHIFT)) >= (1ULL << RPM_SHIFT)
+#error "The RPM conversion is not exact up to 65535 RPM, raise RPM_SHIFT"
+#endif
+
+// Macro to convert a QEI1 velocity count to RPM
+#define RPM_FROM_VEL(V) (((uint64_t)(V) * RPM_MUL) >> RPM_SHIFT)
+
+#endif /* RPM_CONVERT_H_ */
@@ -25,9 +25,7 @@
 #include "driverlib/qei.h"                  // Prototypes for the Quadrature Encoder Driver
 #include "driverlib/pin_map.h"              // Mapping of peripherals to pins for all parts
 #include "driverlib/rom.h"                  // Defines and macros for ROM API of driverLib
-
-#define VEL_INT_FREQ    10000               // Macro to store the Interrupt frequency of QEI1
-#define QEI1_PPR        257125              // Macro to store the PPR of the QEI1
+#include "RPM_convert.h"
 
 /* -----------------------      Global Variables        --------------------- */
 volatile uint32_t ui32Qei1Vel;              // Variable to store the velocity of QEI1
@@ -84,5 +82,5 @@ void QEI1IntHandler(void){
     // Update the direction reading of the encoder
     i32Qei1Dir = ROM_QEIDirectionGet(QEI1_BASE);
     // Calculate the velocity in RPM
-    ui16Qei1Rpm = ui32Qei1Vel * VEL_INT_FREQ * 60 / QEI1_PPR;
+    ui16Qei1Rpm = RPM_FROM_VEL(ui32Qei1Vel);
 }
@@ -0,0 +1,21 @@
+/*!
+ * @author      Yash Bansod
+ * @date        17th October 2026
+ *
+ * @brief       Dictionary of the deferred log formats of UART Stdio
+ * @details     One LOG_FORMAT(ID, "format") line per log call site of main.c. LOG_defer.h
+ *              turns the lines into the IDs sent in place of the formats, and the host
+ *              decoder (other_codes/Host Tools/LOG_decode.c), built with this same file,
+ *              turns them back into the formats. A record carries up to LOG_MAX_ARGS
+ *              words, one per conversion: %c %d %i %u %x %X %p take the word as
+ *              UARTprintf() does, %f %e %g take the bits of a float passed with
+ *              LOG_FLOAT(), %s is not allowed since the string stays on the target. Add
+ *              new lines at the end so that the IDs of the older ones, and logs already
+ *              recorded, keep their meaning. The file has no include guard on purpose.
+ * @file        LOG_formats.h
+ */
+LOG_FORMAT(LOG_BOOT,        "UART Stdio up, clock %u Hz, %u bit/s\n")
+LOG_FORMAT(LOG_RX,          "rx %c (0x%02x)\n")
+LOG_FORMAT(LOG_LED,         "LED off after %u ms\n")
+LOG_FORMAT(LOG_BLINK,       "blink %u ms, timer load %u\n")
+LOG_FORMAT(LOG_ON,          "log on, %u records dropped so far\n")
@@ -8,6 +8,16 @@
  *              displayed by the Blue Led which glows for 1ms on every UartRx.
  *              The code demonstrates the use of UARTprintf() API of uartstdio.h
  *              library for printing strings.
+ *              The input goes to the command shell of CMD_shell.c, which echoes it
+ *              and runs the commands of CMD_table.h from the main loop: help, blink,
+ *              clock, echo and log. UARTIntHandler only queues the characters, so the
+ *              main loop is the only writer of UART0 and no echo lands in a record.
+ *              The events of the program are logged with the deferred binary log of
+ *              LOG_defer.c, the formats of LOG_formats.h: the boot, each received
+ *              character, the Led going off and the blink setting. "log on" makes the
+ *              main loop send the records, through UARTwriteRaw() after the text of the
+ *              shell, for other_codes/Host Tools/LOG_decode -t to print; "log off"
+ *              keeps them queued, the ones that do not fit being counted.
  *
  * @note        The tm4c123ghpm_startup_ccs.c contains the vector table for the
  *              microcontroller. It was modified to execute the specified ISR on
@@ -16,6 +26,8 @@
 /* -----------------------          Include Files       --------------------- */
 #include <stdint.h>                         // Library of Standard Integer Types
 #include <stdbool.h>                        // Library of Standard Boolean Types
+#include <stdlib.h>                         // Library of Standard Datatype Conversions
+#include <string.h>                         // Library for String functions
 #include "inc/tm4c123gh6pm.h"               // Definitions for interrupt and register assignments on Tiva C
 #include "inc/hw_memmap.h"                  // Macros defining the memory map of the Tiva C Series device
 #include "inc/hw_types.h"                   // Defines common types and macros
@@ -29,15 +41,23 @@
 #include "driverlib/uart.h"                 // Defines and Macros for the UART
 #include "driverlib/rom.h"                  // Defines and macros for ROM API of driverLib
 #include "uartStdio/uartstdio.h"            // Prototypes for the UART console functions
+#include "uartStdio/CMD_shell.h"            // Command shell over the UART
+#include "uartStdio/LOG_defer.h"            // Deferred binary log over the UART
 
 #define UART0_BAUDRATE 115200               // Macro for UART0 Baud rate
 
 /* -----------------------      Global Variables        --------------------- */
 uint32_t ui32Period;                        // Variable to store the period to be inputed to Timer0
+volatile uint32_t ui32BlinkMs = 1;          // Variable to store the Led glow on every UartRx in ms, 0 for none
+bool bLogOn = false;                        // Variable to store if the main loop sends the log records
 
 /* -----------------------      Function Prototypes     --------------------- */
 void UARTIntHandler(void);                  // The prototype of the ISR for UART Interrupt
 void Timer0IntHandler(void);                // The prototype of the ISR for Timer0 Interrupt
+int32_t Cmd_blink(uint32_t ui32Argc, char *ppcArgv[]);  // The prototype of the blink command
+int32_t Cmd_clock(uint32_t ui32Argc, char *ppcArgv[]);  // The prototype of the clock command
+int32_t Cmd_echo(uint32_t ui32Argc, char *ppcArgv[]);   // The prototype of the echo command
+int32_t Cmd_log(uint32_t ui32Argc, char *ppcArgv[]);    // The prototype of the log command
 
 /* -----------------------          Main Program        --------------------- */
 int main(void){
@@ -48,6 +68,9 @@ int main(void){
     ROM_SysCtlPeripheralEnable(SYSCTL_PERIPH_GPIOF);
     ROM_SysCtlPeripheralEnable(SYSCTL_PERIPH_TIMER0);
 
+    // Empty the log ring before the interrupt handlers may log
+    LOG_init();
+
     // Master interrupt enable API for all interrupts
     ROM_IntMasterEnable();
 
@@ -79,9 +102,15 @@ int main(void){
 
     // Configure the UART0 for Standard Input Outputs
     UARTStdioConfig(0, UART0_BAUDRATE, ROM_SysCtlClockGet());
-    UARTprintf("Enter Text: \n");
-
-    while (1);
+    UARTprintf("UART Stdio shell, help lists the commands\n");
+    LOG2(LOG_BOOT, ROM_SysCtlClockGet(), UART0_BAUDRATE);
+    CMD_init(UARTwrite);
+
+    // Run the commands typed by the user and send the log records after their output
+    while (1){
+        CMD_poll();
+        if (bLogOn) LOG_drain(UARTwriteRaw);
+    }
 }
 
 /* -----------------------      Function Definition     --------------------- */
@@ -92,12 +121,16 @@ void UARTIntHandler(void){
 
     // While there is a character available at input
     while(ROM_UARTCharsAvail(UART0_BASE)){
-        // Echo the character back to the user
-        ROM_UARTCharPutNonBlocking(UART0_BASE, ROM_UARTCharGetNonBlocking(UART0_BASE));
-
-        // Blink the Led for approximately 1ms
-        ROM_GPIOPinWrite(GPIO_PORTF_BASE, GPIO_PIN_2, GPIO_PIN_2);
-        ROM_TimerEnable(TIMER0_BASE, TIMER_A);
+        // Queue the character for the shell, CMD_poll() echoes it back from the main loop
+        char cChar = (char)ROM_UARTCharGetNonBlocking(UART0_BASE);
+        CMD_input(cChar);
+        LOG2(LOG_RX, cChar, (uint8_t)cChar);
+
+        // Blink the Led for approximately ui32BlinkMs
+        if (ui32BlinkMs){
+            ROM_GPIOPinWrite(GPIO_PORTF_BASE, GPIO_PIN_2, GPIO_PIN_2);
+            ROM_TimerEnable(TIMER0_BASE, TIMER_A);
+        }
     }
 }
 
@@ -110,4 +143,51 @@ void Timer0IntHandler(void)
     ROM_GPIOPinWrite(GPIO_PORTF_BASE, GPIO_PIN_2, 0);
     // Disable the timer
     ROM_TimerDisable(TIMER0_BASE, TIMER_A);
+    LOG1(LOG_LED, ui32BlinkMs);
+}
+
+// Function of the blink command, setting the Led glow on every UartRx
+int32_t Cmd_blink(uint32_t ui32Argc, char *ppcArgv[]){
+    char *pcEnd;
+    uint32_t ui32Ms;
+
+    if (ui32Argc != 2) return CMD_ERR_USAGE;
+    ui32Ms = strtoul(ppcArgv[1], &pcEnd, 10);
+    if (pcEnd == ppcArgv[1] || *pcEnd || ui32Ms > 1000) return CMD_ERR_USAGE;
+
+    // Load the Timer with the new glow, the Led being off between characters
+    ui32BlinkMs = ui32Ms;
+    if (ui32Ms) ROM_TimerLoadSet(TIMER0_BASE, TIMER_A, ui32Period * ui32Ms - 1);
+    UARTprintf("blink %u ms\n", ui32Ms);
+    LOG2(LOG_BLINK, ui32Ms, ui32Ms ? ui32Period * ui32Ms - 1 : 0);
+    return CMD_OK;
+}
+
+// Function of the clock command, printing the system clock and the bit rate
+int32_t Cmd_clock(uint32_t ui32Argc, char *ppcArgv[]){
+    (void)ppcArgv;
+    if (ui32Argc != 1) return CMD_ERR_USAGE;
+    UARTprintf("clock %u Hz, %u bit/s\n", ROM_SysCtlClockGet(), UART0_BAUDRATE);
+    return CMD_OK;
+}
+
+// Function of the echo command, printing each word in brackets
+int32_t Cmd_echo(uint32_t ui32Argc, char *ppcArgv[]){
+    uint32_t ui32Idx;
+
+    for (ui32Idx = 1; ui32Idx < ui32Argc; ui32Idx++) UARTprintf("[%s] ", ppcArgv[ui32Idx]);
+    UARTprintf("\n");
+    return CMD_OK;
+}
+
+// Function of the log command, starting or stopping the records of the log in the output
+int32_t Cmd_log(uint32_t ui32Argc, char *ppcArgv[]){
+    if (ui32Argc != 2) return CMD_ERR_USAGE;
+    if (strcmp(ppcArgv[1], "on") == 0){
+        bLogOn = true;
+        LOG1(LOG_ON, LOG_dropped());
+    }
+    else if (strcmp(ppcArgv[1], "off") == 0) bLogOn = false;
+    else return CMD_ERR_USAGE;
+    return CMD_OK;
 }
@@ -0,0 +1,308 @@
+/*!
+ * @author      Yash Bansod
+ * @date        17th October 2026
+ *
+ * @brief       Source containing the command shell over the UART
+ * @details     The received characters are passed from CMD_input() in the interrupt
+ *              handler to CMD_poll() in the main loop through a ring of free running
+ *              counts, without masking the interrupts: the handler only writes the head
+ *              and the main loop only the tail. The line and every write of the shell
+ *              belong to the main loop.
+ * @file        CMD_shell.c
+ */
+/* -----------------------          Include Files       --------------------- */
+#include <string.h>                         // Library for String functions
+#include "CMD_shell.h"
+#include "CMD_hash.h"
+
+/* -----------------------      Macro Definitions       --------------------- */
+#define CMD_KEY_CTRL_C      0x03                    // Macro for the key dropping the line
+#define CMD_KEY_ESC         0x1B                    // Macro for the start of an escape sequence
+#define CMD_KEY_DEL         0x7F                    // Macro for the backspace of most terminals
+
+#if (CMD_RX_SIZE & (CMD_RX_SIZE - 1)) != 0
+#error CMD_RX_SIZE must be a power of 2
+#endif
+
+/* -----------------------      Function Prototypes     --------------------- */
+static int32_t CMD_help(uint32_t ui32Argc, char *ppcArgv[]);    // The help command
+
+// The prototypes of the commands of the application
+#define CMD_ENTRY(pcName, pfnCmd, pcHelp)   int32_t pfnCmd(uint32_t ui32Argc, char *ppcArgv[]);
+#include "CMD_table.h"
+#undef CMD_ENTRY
+
+/* -----------------------      Global Variables        --------------------- */
+// The commands, in the order CMD_hash.c numbers them
+static const tCmdEntry g_psCmdTable[] = {
+    {"help", CMD_help, "help: list the commands"},
+#define CMD_ENTRY(pcName, pfnCmd, pcHelp)   {pcName, pfnCmd, pcHelp},
+#include "CMD_table.h"
+#undef CMD_ENTRY
+};
+#define CMD_COUNT           (sizeof(g_psCmdTable) / sizeof(g_psCmdTable[0]))
+
+// A CMD_hash.h written for a table of another length does not compile
+typedef char tCmdHashCount[(CMD_COUNT == CMD_HASH_COUNT) ? 1 : -1];
+
+static const uint8_t g_pui8CmdSlots[1 << CMD_HASH_BITS] = CMD_HASH_SLOTS;   // Command of each hash slot
+
+static volatile char g_pcCmdRx[CMD_RX_SIZE];        // Characters received, waiting for CMD_poll()
+static volatile uint32_t g_ui32CmdRxHead;           // Characters queued, written by CMD_input()
+static volatile uint32_t g_ui32CmdRxTail;           // Characters taken, written by CMD_poll()
+static char g_pcCmdLine[CMD_LINE_SIZE];             // Line being typed
+static uint32_t g_ui32CmdLen;                       // Characters in the line
+static bool g_bCmdLastCR;                           // Last character was a CR
+static uint8_t g_ui8CmdEsc;                         // 1 after ESC, 2 in an escape sequence
+static bool g_bCmdLinear;                           // CMD_hash.h is stale, compare every name
+static const tCmdEntry *g_psCmdLast;                // Command of the last line run
+static tCmdWrite g_pfnCmdWrite;                     // Output of the shell
+
+/* -----------------------      Function Definition     --------------------- */
+// Function to write characters to the shell
+void CMD_write(const char *pcBuf, uint32_t ui32Len){
+    if (g_pfnCmdWrite && ui32Len) g_pfnCmdWrite(pcBuf, ui32Len);
+}
+
+// Function to write a string to the shell
+void CMD_puts(const char *pcStr){
+    CMD_write(pcStr, strlen(pcStr));
+}
+
+// Function to hash a command name
+static uint32_t CMD_hash(const char *pcName){
+    uint32_t ui32Hash = CMD_HASH_SEED;
+
+    while (*pcName) ui32Hash = CMD_HASH_STEP(ui32Hash, *pcName++);
+    return ui32Hash;
+}
+
+// Function to find the command of a name of hash ui32Hash, NULL if there is none
+static const tCmdEntry *CMD_find(const char *pcName, uint32_t ui32Hash){
+    uint32_t ui32Idx;
+
+    if (g_bCmdLinear){
+        for (ui32Idx = 0; ui32Idx < CMD_COUNT; ui32Idx++)
+            if (strcmp(pcName, g_psCmdTable[ui32Idx].pcName) == 0) return &g_psCmdTable[ui32Idx];
+        return 0;
+    }
+
+    // The slot of the hash holds the only command the name can be
+    ui32Idx = g_pui8CmdSlots[CMD_HASH_SLOT(ui32Hash, CMD_HASH_BITS)];
+    if (ui32Idx == CMD_HASH_EMPTY || strcmp(pcName, g_psCmdTable[ui32Idx].pcName) != 0) return 0;
+    return &g_psCmdTable[ui32Idx];
+}
+
+// Function to start the shell, writing to pfnWrite
+void CMD_init(tCmdWrite pfnWrite){
+    uint32_t ui32Idx;
+
+    g_pfnCmdWrite = pfnWrite;
+    g_ui32CmdLen = 0;
+    g_bCmdLastCR = false;
+    g_ui8CmdEsc = 0;
+    g_ui32CmdRxTail = g_ui32CmdRxHead;
+
+    // Every command must hash to its own slot, else CMD_hash.h was written for other names
+    g_bCmdLinear = false;
+    for (ui32Idx = 0; ui32Idx < CMD_COUNT; ui32Idx++){
+        if (g_pui8CmdSlots[CMD_HASH_SLOT(CMD_hash(g_psCmdTable[ui32Idx].pcName), CMD_HASH_BITS)] != ui32Idx)
+            g_bCmdLinear = true;
+    }
+
+    CMD_puts(CMD_PROMPT);
+}
+
+// Function to complete the command name being typed
+static void CMD_complete(void){
+    uint32_t ui32Idx, ui32Len = g_ui32CmdLen, ui32Matches = 0, ui32Common = 0, ui32Shared;
+    const char *pcFirst = 0, *pcName;
+
+    // Only the first word is a command name
+    if (memchr(g_pcCmdLine, ' ', ui32Len)) return;
+
+    // Count the commands starting with the line and the characters they all share
+    for (ui32Idx = 0; ui32Idx < CMD_COUNT; ui32Idx++){
+        pcName = g_psCmdTable[ui32Idx].pcName;
+        if (strncmp(pcName, g_pcCmdLine, ui32Len) != 0) continue;
+        if (ui32Matches++ == 0){
+            pcFirst = pcName;
+            ui32Common = strlen(pcName);
+        }
+        else{
+            for (ui32Shared = ui32Len; ui32Shared < ui32Common && pcName[ui32Shared] == pcFirst[ui32Shared]; ui32Shared++){
+            }
+            ui32Common = ui32Shared;
+        }
+    }
+    if (!ui32Matches){
+        CMD_write("\a", 1);
+        return;
+    }
+
+    // Type the shared characters, and a space after the only match
+    if (ui32Common > CMD_LINE_SIZE - 2) ui32Common = CMD_LINE_SIZE - 2;
+    if (ui32Common > ui32Len){
+        memcpy(g_pcCmdLine + ui32Len, pcFirst + ui32Len, ui32Common - ui32Len);
+        CMD_write(g_pcCmdLine + ui32Len, ui32Common - ui32Len);
+        g_ui32CmdLen = ui32Common;
+    }
+    if (ui32Matches == 1){
+        g_pcCmdLine[g_ui32CmdLen++] = ' ';
+        CMD_write(" ", 1);
+    }
+    else if (ui32Common == ui32Len){
+        // Nothing to add: list the matches and type the line again
+        CMD_write("\n", 1);
+        for (ui32Idx = 0; ui32Idx < CMD_COUNT; ui32Idx++){
+            pcName = g_psCmdTable[ui32Idx].pcName;
+            if (strncmp(pcName, g_pcCmdLine, ui32Len) != 0) continue;
+            CMD_puts(pcName);
+            CMD_write("  ", 2);
+        }
+        CMD_puts("\n" CMD_PROMPT);
+        CMD_write(g_pcCmdLine, g_ui32CmdLen);
+    }
+}
+
+// Function to queue a received character for CMD_poll(), returns false if the queue is full
+bool CMD_input(char cChar){
+    if ((uint32_t)(g_ui32CmdRxHead - g_ui32CmdRxTail) == CMD_RX_SIZE) return false;
+    g_pcCmdRx[g_ui32CmdRxHead & (CMD_RX_SIZE - 1)] = cChar;
+    g_ui32CmdRxHead++;
+    return true;
+}
+
+// Function to edit the line with a character and echo it, returns true once the line has ended
+static bool CMD_key(char cChar){
+    // Swallow the escape sequences of the arrow and function keys
+    if (g_ui8CmdEsc == 2){
+        if (cChar >= 0x40 && cChar <= 0x7E) g_ui8CmdEsc = 0;
+        return false;
+    }
+    if (g_ui8CmdEsc == 1){
+        g_ui8CmdEsc = (cChar == '[' || cChar == 'O') ? 2 : 0;
+        if (g_ui8CmdEsc) return false;
+    }
+
+    // A LF right after a CR ends no line of its own
+    if (cChar == '\n' && g_bCmdLastCR){
+        g_bCmdLastCR = false;
+        return false;
+    }
+    g_bCmdLastCR = (cChar == '\r');
+
+    switch (cChar){
+    case '\r':
+    case '\n':
+        g_pcCmdLine[g_ui32CmdLen] = 0;
+        CMD_write("\n", 1);
+        return true;
+    case '\b':
+    case CMD_KEY_DEL:
+        if (g_ui32CmdLen){
+            g_ui32CmdLen--;
+            CMD_write("\b \b", 3);
+        }
+        return false;
+    case '\t':
+        CMD_complete();
+        return false;
+    case CMD_KEY_CTRL_C:
+        g_ui32CmdLen = 0;
+        CMD_puts("^C\n" CMD_PROMPT);
+        return false;
+    case CMD_KEY_ESC:
+        g_ui8CmdEsc = 1;
+        return false;
+    default:
+        break;
+    }
+
+    // Store and echo the character while the line has space
+    if ((uint8_t)cChar >= ' ' && g_ui32CmdLen < CMD_LINE_SIZE - 1){
+        g_pcCmdLine[g_ui32CmdLen++] = cChar;
+        CMD_write(&cChar, 1);
+    }
+    return false;
+}
+
+// Function to split a line in place at the spaces and run its command, returns its status
+int32_t CMD_run(char *pcLine){
+    char *ppcArgv[CMD_MAX_ARGS + 1];
+    uint32_t ui32Argc = 0, ui32Hash = CMD_HASH_SEED;
+    char cEnd;
+
+    g_psCmdLast = 0;
+    while (1){
+        while (*pcLine == ' ') pcLine++;
+        if (!*pcLine) break;
+        if (ui32Argc == CMD_MAX_ARGS) return CMD_ERR_ARGS;
+
+        // A word ends at a space, or at its closing quote
+        cEnd = ' ';
+        if (*pcLine == '"'){
+            cEnd = '"';
+            pcLine++;
+        }
+        ppcArgv[ui32Argc] = pcLine;
+        if (ui32Argc == 0){
+            for (; *pcLine && *pcLine != cEnd; pcLine++) ui32Hash = CMD_HASH_STEP(ui32Hash, *pcLine);
+        }
+        else{
+            while (*pcLine && *pcLine != cEnd) pcLine++;
+        }
+        if (*pcLine) *pcLine++ = 0;
+        ui32Argc++;
+    }
+    ppcArgv[ui32Argc] = 0;
+    if (!ui32Argc) return CMD_OK;
+
+    g_psCmdLast = CMD_find(ppcArgv[0], ui32Hash);
+    if (!g_psCmdLast) return CMD_ERR_UNKNOWN;
+    return g_psCmdLast->pfnCmd(ui32Argc, ppcArgv);
+}
+
+// Function to edit the line with the characters received and run it once it ends, returns true if it ran
+bool CMD_poll(void){
+    bool bEnded = false;
+
+    // The characters after the end of the line wait for the next call
+    while (!bEnded && g_ui32CmdRxTail != g_ui32CmdRxHead){
+        bEnded = CMD_key(g_pcCmdRx[g_ui32CmdRxTail & (CMD_RX_SIZE - 1)]);
+        g_ui32CmdRxTail++;
+    }
+    if (!bEnded) return false;
+
+    switch (CMD_run(g_pcCmdLine)){
+    case CMD_ERR_UNKNOWN:
+        CMD_puts("unknown command, help lists them\n");
+        break;
+    case CMD_ERR_ARGS:
+        CMD_puts("too many words\n");
+        break;
+    case CMD_ERR_USAGE:
+        CMD_puts("usage: ");
+        CMD_puts(g_psCmdLast->pcHelp);
+        CMD_write("\n", 1);
+        break;
+    default:
+        break;
+    }
+    CMD_puts(CMD_PROMPT);
+    g_ui32CmdLen = 0;
+    return true;
+}
+
+// Function of the help command, listing the commands
+static int32_t CMD_help(uint32_t ui32Argc, char *ppcArgv[]){
+    uint32_t ui32Idx;
+
+    (void)ui32Argc;
+    (void)ppcArgv;
+    for (ui32Idx = 0; ui32Idx < CMD_COUNT; ui32Idx++){
+        CMD_puts(g_psCmdTable[ui32Idx].pcHelp);
+        CMD_write("\n", 1);
+    }
+    return CMD_OK;
+}
@@ -0,0 +1,133 @@
+/*!
+ * @author      Yash Bansod
+ * @date        17th October 2026
+ *
+ * @brief       Source containing the deferred binary log of uartstdio
+ * @details     The record is built on the stack and pushed in one RING_pushN(), so the
+ *              interrupts are only masked for the copy. The ring only ever holds whole
+ *              records, so LOG_drain() finds the length of the next one in its header.
+ * @file        LOG_defer.c
+ */
+/* -----------------------          Include Files       --------------------- */
+#include <string.h>                         // Library for String functions
+#ifdef HOST_SIM
+#include "HOST_uart.h"                      // Host stand-in for DriverLib
+#else
+#include "inc/hw_memmap.h"                  // Macros defining the memory map of the Tiva C Series device
+#include "inc/hw_types.h"                   // Defines common types and macros
+#include "driverlib/interrupt.h"            // Defines and macros for NVIC Controller API of DriverLib
+#include "driverlib/rom.h"                  // Defines and macros for ROM API of driverLib
+#include "driverlib/rom_map.h"              // Macros to call the ROM or the flash copy of DriverLib
+#endif
+#include "RING_spsc.h"
+#include "LOG_defer.h"
+
+#if (LOG_BUFFER_SIZE & (LOG_BUFFER_SIZE - 1)) != 0
+#error LOG_BUFFER_SIZE must be a power of 2
+#endif
+
+/* -----------------------      Global Variables        --------------------- */
+static uint8_t g_pui8LogBuffer[LOG_BUFFER_SIZE];    // Storage of the log ring
+static tRing g_sLog;                                // Records waiting for the UART
+static uint32_t g_ui32LogDropped;                   // Records dropped since LOG_init()
+static uint32_t g_ui32LogUnsent;                    // Dropped records not yet reported
+
+/* -----------------------      Function Definition     --------------------- */
+// Function to build a record, returns its length
+static uint32_t LOG_record(uint8_t *pui8Dst, uint32_t ui32Id, uint32_t ui32Args, const uint32_t *pui32Arg){
+    uint32_t ui32Header = (ui32Id & LOG_ID_MASK) | (ui32Args << LOG_ARGS_SHIFT);
+    uint32_t ui32Len = 3 + 4 * ui32Args, ui32Idx, ui32Word;
+    uint8_t ui8Sum;
+
+    pui8Dst[0] = LOG_SOF;
+    pui8Dst[1] = (uint8_t)ui32Header;
+    pui8Dst[2] = (uint8_t)(ui32Header >> 8);
+    for (ui32Idx = 0; ui32Idx < ui32Args; ui32Idx++){
+        ui32Word = pui32Arg[ui32Idx];
+        pui8Dst[3 + 4 * ui32Idx] = (uint8_t)ui32Word;
+        pui8Dst[4 + 4 * ui32Idx] = (uint8_t)(ui32Word >> 8);
+        pui8Dst[5 + 4 * ui32Idx] = (uint8_t)(ui32Word >> 16);
+        pui8Dst[6 + 4 * ui32Idx] = (uint8_t)(ui32Word >> 24);
+    }
+
+    // The check covers the bytes after the SOF
+    ui8Sum = 0;
+    for (ui32Idx = 1; ui32Idx < ui32Len; ui32Idx++)
+        ui8Sum += pui8Dst[ui32Idx];
+    pui8Dst[ui32Len] = (uint8_t)~ui8Sum;
+    return ui32Len + 1;
+}
+
+// Function to empty the log ring
+void LOG_init(void){
+    RING_init(&g_sLog, g_pui8LogBuffer, LOG_BUFFER_SIZE);
+    g_ui32LogDropped = 0;
+    g_ui32LogUnsent = 0;
+}
+
+// Function to queue a record of ui32Args words, returns false when it is dropped
+bool LOG_write(uint32_t ui32Id, uint32_t ui32Args, uint32_t ui32A, uint32_t ui32B, uint32_t ui32C, uint32_t ui32D){
+    uint8_t pui8Record[LOG_MAX_RECORD], pui8Lost[LOG_OVERHEAD + 4];
+    uint32_t pui32Arg[LOG_MAX_ARGS], ui32Len, ui32LostLen = 0;
+    bool bMasked, bDone = false;
+
+    pui32Arg[0] = ui32A;
+    pui32Arg[1] = ui32B;
+    pui32Arg[2] = ui32C;
+    pui32Arg[3] = ui32D;
+    if (ui32Args > LOG_MAX_ARGS) ui32Args = LOG_MAX_ARGS;
+    ui32Len = LOG_record(pui8Record, ui32Id, ui32Args, pui32Arg);
+
+    bMasked = MAP_IntMasterDisable();
+
+    // Report the records dropped before this one when both fit
+    if (g_ui32LogUnsent)
+        ui32LostLen = LOG_record(pui8Lost, LOG_DROPPED, 1, &g_ui32LogUnsent);
+    if (RING_FREE(&g_sLog) >= ui32LostLen + ui32Len){
+        if (ui32LostLen){
+            RING_pushN(&g_sLog, pui8Lost, ui32LostLen);
+            g_ui32LogUnsent = 0;
+        }
+        RING_pushN(&g_sLog, pui8Record, ui32Len);
+        bDone = true;
+    } else{
+        g_ui32LogDropped++;
+        g_ui32LogUnsent++;
+    }
+
+    if (!bMasked) MAP_IntMasterEnable();
+    return bDone;
+}
+
+// Function to pass the queued records to pfnWrite, one whole record per call, until it takes none
+uint32_t LOG_drain(tLogWrite pfnWrite){
+    uint8_t pui8Record[LOG_MAX_RECORD];
+    uint32_t ui32Moved = 0, ui32Len, ui32Idx;
+
+    while (!RING_EMPTY(&g_sLog)){
+        // The number of words is in the top 4 bits of the high header byte, read after the head
+        RING_BARRIER();
+        ui32Len = LOG_OVERHEAD + 4 * (RING_AT(&g_sLog, 2) >> 4);
+        for (ui32Idx = 0; ui32Idx < ui32Len; ui32Idx++)
+            pui8Record[ui32Idx] = RING_AT(&g_sLog, ui32Idx);
+
+        // The record stays queued when the write function has no space for it
+        if (pfnWrite(pui8Record, ui32Len) != (int)ui32Len) break;
+        RING_skip(&g_sLog, ui32Len);
+        ui32Moved += ui32Len;
+    }
+    return ui32Moved;
+}
+
+// Function to get the records dropped since LOG_init()
+uint32_t LOG_dropped(void){
+    return g_ui32LogDropped;
+}
+
+// Function to get the bits of a float argument
+uint32_t LOG_floatBits(float f32Value){
+    uint32_t ui32Bits;
+
+    memcpy(&ui32Bits, &f32Value, sizeof(ui32Bits));
+    return ui32Bits;
+}
@@ -0,0 +1,75 @@
+/*!
+ * @author      Yash Bansod
+ * @date        17th October 2026
+ *
+ * @brief       Header containing the deferred binary log of uartstdio
+ * @details     A log call sends the ID of its format and its argument words instead of
+ *              the text UARTprintf() would format. The IDs are given at build time by
+ *              the LOG_FORMAT() lines of LOG_formats.h, the dictionary of the application,
+ *              and the host decoder rebuilds the text with the same file. A record is
+ *                  LOG_SOF | HDR_LO | HDR_HI | ARG[N] | CHECK
+ *              where HDR is the ID in its low 12 bits and N in its top 4 bits, each ARG
+ *              is a little endian word and CHECK is the complement of the sum of the
+ *              header and argument bytes, so a decoder joining the stream at any byte
+ *              finds the records again. The records wait in a ring (RING_spsc) and
+ *              LOG_drain() hands them, one whole record per call, to a write function
+ *              such as UARTwriteRaw() of uartstdio, so that they go out in order with
+ *              the text of UARTprintf() and UARTwrite() instead of past it. The write
+ *              function takes all the bytes of a record or none of them.
+ *              LOG_write() masks the interrupts while it pushes a record, so that the
+ *              main loop and the interrupt handlers may all log; LOG_drain() must only
+ *              be called from one context. A record that does not fit is dropped and
+ *              counted, and the count goes out as a LOG_DROPPED record once there is
+ *              space again.
+ * @file        LOG_defer.h
+ */
+/* -----------------------          Include Files       --------------------- */
+#include <stdint.h>                         // Library of Standard Integer Types
+#include <stdbool.h>                        // Library of Standard Boolean Types
+
+#ifndef LOG_DEFER_H_
+#define LOG_DEFER_H_
+
+/* -----------------------      Macro Definitions       --------------------- */
+#define LOG_SOF             0xD5                    // Macro for the Start Of Record byte
+#define LOG_MAX_ARGS        4                       // Macro for the most argument words of a record
+#define LOG_OVERHEAD        4                       // Macro for the bytes of a record besides the arguments
+#define LOG_MAX_RECORD      (LOG_OVERHEAD + 4 * LOG_MAX_ARGS)
+#define LOG_ID_MASK         0x0FFF                  // Macro for the ID bits of the header
+#define LOG_ARGS_SHIFT      12                      // Macro for the position of N in the header
+#ifndef LOG_BUFFER_SIZE
+#define LOG_BUFFER_SIZE     512                     // Macro for the bytes of the log ring, a power of 2
+#endif
+#define LOG_DROPPED_FORMAT  "%u log records dropped\n"
+
+// Macros for the log call sites, the arguments being converted to words
+#define LOG0(eId)                   LOG_write(eId, 0, 0, 0, 0, 0)
+#define LOG1(eId, a)                LOG_write(eId, 1, (uint32_t)(a), 0, 0, 0)
+#define LOG2(eId, a, b)             LOG_write(eId, 2, (uint32_t)(a), (uint32_t)(b), 0, 0)
+#define LOG3(eId, a, b, c)          LOG_write(eId, 3, (uint32_t)(a), (uint32_t)(b), (uint32_t)(c), 0)
+#define LOG4(eId, a, b, c, d)       LOG_write(eId, 4, (uint32_t)(a), (uint32_t)(b), (uint32_t)(c), (uint32_t)(d))
+
+// Macro for a float argument of %f, %e or %g, sent as its bits
+#define LOG_FLOAT(f32Value)         LOG_floatBits(f32Value)
+
+/* -----------------------      Global Variables        --------------------- */
+typedef int (*tLogWrite)(const uint8_t *pui8Buf, uint32_t ui32Len);
+
+// The IDs, LOG_DROPPED first and then one per line of LOG_formats.h
+#define LOG_FORMAT(eId, pcFormat)   eId,
+typedef enum {
+    LOG_DROPPED,
+#include "LOG_formats.h"
+    LOG_IDS
+} tLogId;
+#undef LOG_FORMAT
+
+/* -----------------------      Function Prototypes     --------------------- */
+void LOG_init(void);                                                    // Empty the log ring
+bool LOG_write(uint32_t ui32Id, uint32_t ui32Args, uint32_t ui32A,
+               uint32_t ui32B, uint32_t ui32C, uint32_t ui32D);         // Queue a record, false when dropped
+uint32_t LOG_drain(tLogWrite pfnWrite);                                 // Pass the records to pfnWrite, returns the bytes taken
+uint32_t LOG_dropped(void);                                             // Records dropped since LOG_init()
+uint32_t LOG_floatBits(float f32Value);                                 // Bits of a float argument
+
+#endif /* LOG_DEFER_H_ */
@@ -0,0 +1,105 @@
+/*!
+ * @author      Yash Bansod
+ * @date        17th October 2026
+ *
+ * @brief       Source containing the single producer, single consumer byte ring of uartstdio
+ * @details     Each side reads the count of the other side once per call and copies
+ *              its bytes in at most two pieces, up to the end of the storage and from
+ *              its start, before publishing its own count.
+ * @file        RING_spsc.c
+ */
+/* -----------------------          Include Files       --------------------- */
+#include <string.h>                         // Library for String functions
+#include "RING_spsc.h"
+
+/* -----------------------      Function Definition     --------------------- */
+// Function to set up an empty ring on a storage of ui32Size bytes, a power of 2
+void RING_init(tRing *psRing, uint8_t *pui8Buf, uint32_t ui32Size){
+    psRing->pui8Buf = pui8Buf;
+    psRing->ui32Mask = ui32Size - 1;
+    psRing->ui32Head = 0;
+    psRing->ui32Tail = 0;
+}
+
+// Function to push one byte, returns false when the ring is full
+bool RING_push(tRing *psRing, uint8_t ui8Byte){
+    uint32_t ui32Head = psRing->ui32Head;
+
+    if (ui32Head - psRing->ui32Tail > psRing->ui32Mask) return false;
+    psRing->pui8Buf[ui32Head & psRing->ui32Mask] = ui8Byte;
+    RING_BARRIER();
+    psRing->ui32Head = ui32Head + 1;
+    return true;
+}
+
+// Function to push the bytes that fit, returns their count
+uint32_t RING_pushN(tRing *psRing, const uint8_t *pui8Src, uint32_t ui32Len){
+    uint32_t ui32Head = psRing->ui32Head;
+    uint32_t ui32Free = psRing->ui32Mask + 1 - (ui32Head - psRing->ui32Tail);
+    uint32_t ui32Index = ui32Head & psRing->ui32Mask, ui32First;
+
+    if (ui32Len > ui32Free) ui32Len = ui32Free;
+    if (ui32Len == 0) return 0;
+
+    // Up to the end of the storage, then the rest from its start
+    ui32First = psRing->ui32Mask + 1 - ui32Index;
+    if (ui32First > ui32Len) ui32First = ui32Len;
+    memcpy(&psRing->pui8Buf[ui32Index], pui8Src, ui32First);
+    memcpy(psRing->pui8Buf, pui8Src + ui32First, ui32Len - ui32First);
+
+    RING_BARRIER();
+    psRing->ui32Head = ui32Head + ui32Len;
+    return ui32Len;
+}
+
+// Function to pop one byte, returns false when the ring is empty
+bool RING_pop(tRing *psRing, uint8_t *pui8Byte){
+    uint32_t ui32Tail = psRing->ui32Tail;
+
+    if (psRing->ui32Head == ui32Tail) return false;
+    RING_BARRIER();
+    *pui8Byte = psRing->pui8Buf[ui32Tail & psRing->ui32Mask];
+    RING_BARRIER();
+    psRing->ui32Tail = ui32Tail + 1;
+    return true;
+}
+
+// Function to pop up to ui32Len bytes, returns their count
+uint32_t RING_popN(tRing *psRing, uint8_t *pui8Dst, uint32_t ui32Len){
+    uint32_t ui32Tail = psRing->ui32Tail;
+    uint32_t ui32Used = psRing->ui32Head - ui32Tail;
+    uint32_t ui32Index = ui32Tail & psRing->ui32Mask, ui32First;
+
+    if (ui32Len > ui32Used) ui32Len = ui32Used;
+    if (ui32Len == 0) return 0;
+    RING_BARRIER();
+
+    // Up to the end of the storage, then the rest from its start
+    ui32First = psRing->ui32Mask + 1 - ui32Index;
+    if (ui32First > ui32Len) ui32First = ui32Len;
+    memcpy(pui8Dst, &psRing->pui8Buf[ui32Index], ui32First);
+    memcpy(pui8Dst + ui32First, psRing->pui8Buf, ui32Len - ui32First);
+
+    RING_BARRIER();
+    psRing->ui32Tail = ui32Tail + ui32Len;
+    return ui32Len;
+}
+
+// Function to get the oldest bytes up to the end of the storage, returns their count
+uint32_t RING_span(tRing *psRing, uint8_t **ppui8Seg){
+    uint32_t ui32Tail = psRing->ui32Tail;
+    uint32_t ui32Used = psRing->ui32Head - ui32Tail;
+    uint32_t ui32Index = ui32Tail & psRing->ui32Mask;
+
+    // A span stops at the end of the storage, the rest is the next span
+    RING_BARRIER();
+    *ppui8Seg = &psRing->pui8Buf[ui32Index];
+    if (ui32Used > psRing->ui32Mask + 1 - ui32Index) ui32Used = psRing->ui32Mask + 1 - ui32Index;
+    return ui32Used;
+}
+
+// Function to release ui32Len bytes of a span once they have been read in place
+void RING_skip(tRing *psRing, uint32_t ui32Len){
+    RING_BARRIER();
+    psRing->ui32Tail += ui32Len;
+}
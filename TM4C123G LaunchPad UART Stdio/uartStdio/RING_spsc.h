@@ -0,0 +1,63 @@
+/*!
+ * @author      Yash Bansod
+ * @date        17th October 2026
+ *
+ * @brief       Header containing the single producer, single consumer byte ring of uartstdio
+ * @details     The head and the tail are free running counts of the bytes pushed and
+ *              popped: the bytes held are head - tail, correct across the wrap of the
+ *              counts, and a byte is stored at its count masked by the size, a power of
+ *              2. Only the producer writes the head and only the consumer writes the
+ *              tail, so a ring shared by an interrupt and the main loop needs no lock
+ *              as long as each side has a single context. RING_BARRIER() orders the
+ *              bytes before the count that publishes them and after the count read;
+ *              it is a dmb with the TI compiler and an acquire-release fence with GCC,
+ *              which also holds on a host running the two sides in threads.
+ *              RING_span() and RING_skip() let the consumer hand the oldest bytes to a
+ *              reader such as the uDMA without a copy: the bytes stay held, and their
+ *              storage is not reused, until the consumer releases them.
+ * @file        RING_spsc.h
+ */
+/* -----------------------          Include Files       --------------------- */
+#include <stdint.h>                         // Library of Standard Integer Types
+#include <stdbool.h>                        // Library of Standard Boolean Types
+
+#ifndef RING_SPSC_H_
+#define RING_SPSC_H_
+
+/* -----------------------      Macro Definitions       --------------------- */
+#ifndef RING_BARRIER
+#if defined(__GNUC__) && !defined(__TI_COMPILER_VERSION__)
+#define RING_BARRIER()      __atomic_thread_fence(__ATOMIC_ACQ_REL)
+#else
+#define RING_BARRIER()      __asm("    dmb")
+#endif
+#endif
+
+// Macros for the state of a ring, the counts being read once
+#define RING_SIZE(psRing)   ((psRing)->ui32Mask + 1)
+#define RING_USED(psRing)   ((uint32_t)((psRing)->ui32Head - (psRing)->ui32Tail))
+#define RING_FREE(psRing)   (RING_SIZE(psRing) - RING_USED(psRing))
+#define RING_EMPTY(psRing)  ((psRing)->ui32Head == (psRing)->ui32Tail)
+#define RING_FULL(psRing)   (RING_USED(psRing) == RING_SIZE(psRing))
+
+// Macro for the byte ui32Index bytes after the oldest one, for the consumer
+#define RING_AT(psRing, ui32Index)  ((psRing)->pui8Buf[((psRing)->ui32Tail + (ui32Index)) & (psRing)->ui32Mask])
+
+/* -----------------------      Global Variables        --------------------- */
+typedef struct {
+    uint8_t *pui8Buf;                               // Storage of the bytes
+    uint32_t ui32Mask;                              // Size of the storage - 1
+    volatile uint32_t ui32Head;                     // Bytes pushed, written by the producer
+    volatile uint32_t ui32Tail;                     // Bytes popped, written by the consumer
+} tRing;
+
+/* -----------------------      Function Prototypes     --------------------- */
+void RING_init(tRing *psRing, uint8_t *pui8Buf, uint32_t ui32Size);    // Empty ring on a power of 2 storage
+bool RING_push(tRing *psRing, uint8_t ui8Byte);                         // Producer, one byte
+uint32_t RING_pushN(tRing *psRing, const uint8_t *pui8Src, uint32_t ui32Len);   // Producer, bytes that fit
+bool RING_pop(tRing *psRing, uint8_t *pui8Byte);                        // Consumer, one byte
+uint32_t RING_popN(tRing *psRing, uint8_t *pui8Dst, uint32_t ui32Len);  // Consumer, bytes held
+uint32_t RING_span(tRing *psRing, uint8_t **ppui8Seg);                  // Consumer, bytes contiguous in place
+void RING_skip(tRing *psRing, uint32_t ui32Len);                        // Consumer, release bytes read in place
+
+#endif /* RING_SPSC_H_ */
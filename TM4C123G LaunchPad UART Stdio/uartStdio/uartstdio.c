@@ -25,6 +25,12 @@
 #include <stdbool.h>
 #include <stdint.h>
 #include <stdarg.h>
+#ifdef HOST_SIM
+//
+// Build on a host, see other_codes/Host Tools/HOST_uart.h.
+//
+#include "HOST_uart.h"
+#else
 #include "inc/hw_ints.h"
 #include "inc/hw_memmap.h"
 #include "inc/hw_types.h"
@@ -35,7 +41,16 @@
 #include "driverlib/rom_map.h"
 #include "driverlib/sysctl.h"
 #include "driverlib/uart.h"
-#include "utils/uartstdio.h"
+#include "driverlib/udma.h"
+#endif
+
+//
+// The header next to this file, not utils/uartstdio.h of TivaWare, as only it
+// sizes the ring buffers and the uDMA transfers.
+//
+#include "uartstdio.h"
+#include "RING_spsc.h"
+#include "FMT_num.h"
 
 //*****************************************************************************
 //
@@ -50,6 +65,10 @@
 // pointers to control them.
 //
 //*****************************************************************************
+#if defined(UART_DMA) && !defined(UART_BUFFERED)
+#error UART_DMA requires UART_BUFFERED
+#endif
+
 #ifdef UART_BUFFERED
 
 //*****************************************************************************
@@ -65,57 +84,84 @@ static bool g_bDisableEcho;
 
 //*****************************************************************************
 //
-// Output ring buffer.  Buffer is full if g_ui32UARTTxReadIndex is one ahead of
-// g_ui32UARTTxWriteIndex.  Buffer is empty if the two indices are the same.
+// The ring buffers are indexed by masking free running counts, so their sizes
+// must be powers of 2.
+//
+//*****************************************************************************
+#if (UART_TX_BUFFER_SIZE & (UART_TX_BUFFER_SIZE - 1)) != 0
+#error UART_TX_BUFFER_SIZE must be a power of 2
+#endif
+#if (UART_RX_BUFFER_SIZE & (UART_RX_BUFFER_SIZE - 1)) != 0
+#error UART_RX_BUFFER_SIZE must be a power of 2
+#endif
+#if (UART_ECHO_BUFFER_SIZE & (UART_ECHO_BUFFER_SIZE - 1)) != 0
+#error UART_ECHO_BUFFER_SIZE must be a power of 2
+#endif
+
+//*****************************************************************************
+//
+// Output ring buffer.  UARTwrite() is its only producer and the interrupt
+// handler its only consumer, so neither side masks interrupts to update it.
+// Calling UARTwrite() from an interrupt handler would make a second producer.
 //
 //*****************************************************************************
 static unsigned char g_pcUARTTxBuffer[UART_TX_BUFFER_SIZE];
-static volatile uint32_t g_ui32UARTTxWriteIndex = 0;
-static volatile uint32_t g_ui32UARTTxReadIndex = 0;
+static tRing g_sUARTTx;
+
+//*****************************************************************************
+//
+// Echo ring buffer.  The characters echoed by the interrupt handler are
+// queued here instead of in the output ring buffer, which the handler would
+// otherwise write at the same time as UARTwrite(), and are sent ahead of it.
+//
+//*****************************************************************************
+static unsigned char g_pcUARTEchoBuffer[UART_ECHO_BUFFER_SIZE];
+static tRing g_sUARTEcho;
 
 //*****************************************************************************
 //
-// Input ring buffer.  Buffer is full if g_ui32UARTTxReadIndex is one ahead of
-// g_ui32UARTTxWriteIndex.  Buffer is empty if the two indices are the same.
+// Input ring buffer.  The interrupt handler is its only producer and
+// UARTgets(), UARTgetc() and UARTFlushRx() its only consumers.
 //
 //*****************************************************************************
 static unsigned char g_pcUARTRxBuffer[UART_RX_BUFFER_SIZE];
-static volatile uint32_t g_ui32UARTRxWriteIndex = 0;
-static volatile uint32_t g_ui32UARTRxReadIndex = 0;
+static tRing g_sUARTRx;
+
+//*****************************************************************************
+//
+// Set by the interrupt handler when it finds nothing left to transmit and
+// turns off the transmit interrupt, so that UARTwrite() knows it has to pend
+// the interrupt to start the transmitter again.
+//
+//*****************************************************************************
+static volatile bool g_bUARTTxIdle = true;
 
 //*****************************************************************************
 //
-// Macros to determine number of free and used bytes in the transmit buffer.
+// The number of entries of the transmit FIFO and the entries known to be free
+// when the transmit interrupt is raised at the 1/8 FIFO level.
 //
 //*****************************************************************************
-#define TX_BUFFER_USED          (GetBufferCount(&g_ui32UARTTxReadIndex,  \
-                                                &g_ui32UARTTxWriteIndex, \
-                                                UART_TX_BUFFER_SIZE))
-#define TX_BUFFER_FREE          (UART_TX_BUFFER_SIZE - TX_BUFFER_USED)
-#define TX_BUFFER_EMPTY         (IsBufferEmpty(&g_ui32UARTTxReadIndex,   \
-                                               &g_ui32UARTTxWriteIndex))
-#define TX_BUFFER_FULL          (IsBufferFull(&g_ui32UARTTxReadIndex,  \
-                                              &g_ui32UARTTxWriteIndex, \
-                                              UART_TX_BUFFER_SIZE))
-#define ADVANCE_TX_BUFFER_INDEX(Index) \
-                                (Index) = ((Index) + 1) % UART_TX_BUFFER_SIZE
+#define UART_TX_FIFO_SIZE       16
+#define UART_TX_FIFO_FREE       14
+#endif
+
+#ifdef UART_DMA
+#if (UART_DMA_SEGMENT_SIZE < 1) || (UART_DMA_SEGMENT_SIZE > 1024)
+#error UART_DMA_SEGMENT_SIZE must be between 1 and 1024
+#endif
 
 //*****************************************************************************
 //
-// Macros to determine number of free and used bytes in the receive buffer.
+// The uDMA channel of the transmitter, the ring its current transfer reads
+// and the length of that transfer, 0 when no transfer has been started since
+// the last completion was handled.  Only the interrupt handler, and
+// UARTFlushTx() with interrupts off, touch them.
 //
 //*****************************************************************************
-#define RX_BUFFER_USED          (GetBufferCount(&g_ui32UARTRxReadIndex,  \
-                                                &g_ui32UARTRxWriteIndex, \
-                                                UART_RX_BUFFER_SIZE))
-#define RX_BUFFER_FREE          (UART_RX_BUFFER_SIZE - RX_BUFFER_USED)
-#define RX_BUFFER_EMPTY         (IsBufferEmpty(&g_ui32UARTRxReadIndex,   \
-                                               &g_ui32UARTRxWriteIndex))
-#define RX_BUFFER_FULL          (IsBufferFull(&g_ui32UARTRxReadIndex,  \
-                                              &g_ui32UARTRxWriteIndex, \
-                                              UART_RX_BUFFER_SIZE))
-#define ADVANCE_RX_BUFFER_INDEX(Index) \
-                                (Index) = ((Index) + 1) % UART_RX_BUFFER_SIZE
+static uint32_t g_ui32UARTDMAChannel;
+static tRing *g_psUARTDMARing;
+static uint32_t g_ui32UARTDMALen;
 #endif
 
 //*****************************************************************************
@@ -127,11 +173,10 @@ static uint32_t g_ui32Base = 0;
 
 //*****************************************************************************
 //
-// A mapping from an integer between 0 and 15 to its ASCII character
-// equivalent.
+// The number of decimals printed by \%q when the format does not give it.
 //
 //*****************************************************************************
-static const char * const g_pcHex = "0123456789abcdef";
+#define UART_Q_PLACES           3
 
 //*****************************************************************************
 //
@@ -162,147 +207,192 @@ static const uint32_t g_ui32UARTInt[3] =
 static uint32_t g_ui32PortNum;
 #endif
 
+#ifdef UART_DMA
 //*****************************************************************************
 //
-// The list of UART peripherals.
+// The list of uDMA channel assignments of the UART transmitters.  UART0 and
+// UART1 have their transmitters on the default assignment of channels 9 and
+// 23, UART2 needs channel 1 assigned to it.
 //
 //*****************************************************************************
-static const uint32_t g_ui32UARTPeriph[3] =
+static const uint32_t g_ui32UARTDMATx[3] =
 {
-    SYSCTL_PERIPH_UART0, SYSCTL_PERIPH_UART1, SYSCTL_PERIPH_UART2
+    UDMA_CH9_UART0TX, UDMA_CH23_UART1TX, UDMA_CH1_UART2TX
 };
+#endif
 
 //*****************************************************************************
 //
-//! Determines whether the ring buffer whose pointers and size are provided
-//! is full or not.
-//!
-//! \param pui32Read points to the read index for the buffer.
-//! \param pui32Write points to the write index for the buffer.
-//! \param ui32Size is the size of the buffer in bytes.
-//!
-//! This function is used to determine whether or not a given ring buffer is
-//! full.  The structure of the code is specifically to ensure that we do not
-//! see warnings from the compiler related to the order of volatile accesses
-//! being undefined.
-//!
-//! \return Returns \b true if the buffer is full or \b false otherwise.
+// The list of UART peripherals.
 //
 //*****************************************************************************
-#ifdef UART_BUFFERED
-static bool
-IsBufferFull(volatile uint32_t *pui32Read,
-             volatile uint32_t *pui32Write, uint32_t ui32Size)
+static const uint32_t g_ui32UARTPeriph[3] =
 {
-    uint32_t ui32Write;
-    uint32_t ui32Read;
-
-    ui32Write = *pui32Write;
-    ui32Read = *pui32Read;
-
-    return((((ui32Write + 1) % ui32Size) == ui32Read) ? true : false);
-}
-#endif
+    SYSCTL_PERIPH_UART0, SYSCTL_PERIPH_UART1, SYSCTL_PERIPH_UART2
+};
 
 //*****************************************************************************
 //
-//! Determines whether the ring buffer whose pointers and size are provided
-//! is empty or not.
-//!
-//! \param pui32Read points to the read index for the buffer.
-//! \param pui32Write points to the write index for the buffer.
-//!
-//! This function is used to determine whether or not a given ring buffer is
-//! empty.  The structure of the code is specifically to ensure that we do not
-//! see warnings from the compiler related to the order of volatile accesses
-//! being undefined.
-//!
-//! \return Returns \b true if the buffer is empty or \b false otherwise.
+// Take as many bytes from the echo and transmit buffers as there is space
+// for and move them into the UART transmit FIFO.  This is only called by the
+// interrupt handler, the consumer of both buffers.  ui32Free is the number of
+// FIFO entries known to be free, which are filled in one pass from a bulk
+// read of the buffers before the FIFO is topped up a byte at a time.
 //
 //*****************************************************************************
-#ifdef UART_BUFFERED
-static bool
-IsBufferEmpty(volatile uint32_t *pui32Read,
-              volatile uint32_t *pui32Write)
+#if defined(UART_BUFFERED) && !defined(UART_DMA)
+static void
+UARTPrimeTransmit(uint32_t ui32Base, uint32_t ui32Free)
 {
-    uint32_t ui32Write;
-    uint32_t ui32Read;
+    uint8_t pui8Fifo[UART_TX_FIFO_SIZE];
+    uint32_t ui32Idx, ui32Count;
+    uint8_t ui8Char;
+
+    //
+    // An empty FIFO has all its entries free.
+    //
+    if(HWREG(ui32Base + UART_O_FR) & UART_FR_TXFE)
+    {
+        ui32Free = UART_TX_FIFO_SIZE;
+    }
 
-    ui32Write = *pui32Write;
-    ui32Read = *pui32Read;
+    //
+    // Echoed characters go first, then the transmit buffer.
+    //
+    ui32Count = RING_popN(&g_sUARTEcho, pui8Fifo, ui32Free);
+    ui32Count += RING_popN(&g_sUARTTx, pui8Fifo + ui32Count,
+                           ui32Free - ui32Count);
+    for(ui32Idx = 0; ui32Idx < ui32Count; ui32Idx++)
+    {
+        HWREG(ui32Base + UART_O_DR) = pui8Fifo[ui32Idx];
+    }
+
+    //
+    // Fill any space left, so that data left in the buffers always has the
+    // FIFO above its interrupt level to raise the next transmit interrupt.
+    //
+    while(MAP_UARTSpaceAvail(ui32Base))
+    {
+        if(!RING_pop(&g_sUARTEcho, &ui8Char) &&
+           !RING_pop(&g_sUARTTx, &ui8Char))
+        {
+            break;
+        }
+        MAP_UARTCharPutNonBlocking(ui32Base, ui8Char);
+    }
 
-    return((ui32Write == ui32Read) ? true : false);
+    //
+    // Turn the transmit interrupt off when there is nothing left to send and
+    // tell UARTwrite() that it has to start the transmitter again.
+    //
+    if(RING_EMPTY(&g_sUARTEcho) && RING_EMPTY(&g_sUARTTx))
+    {
+        MAP_UARTIntDisable(ui32Base, UART_INT_TX);
+        g_bUARTTxIdle = true;
+    }
+    else
+    {
+        //
+        // The FIFO is full here.  A transmit interrupt latched while it was
+        // masked is stale and would have the next call take 14 free entries,
+        // so clear it before unmasking.
+        //
+        if(g_bUARTTxIdle)
+        {
+            MAP_UARTIntClear(ui32Base, UART_INT_TX);
+        }
+        g_bUARTTxIdle = false;
+        MAP_UARTIntEnable(ui32Base, UART_INT_TX);
+    }
 }
 #endif
 
 //*****************************************************************************
 //
-//! Determines the number of bytes of data contained in a ring buffer.
-//!
-//! \param pui32Read points to the read index for the buffer.
-//! \param pui32Write points to the write index for the buffer.
-//! \param ui32Size is the size of the buffer in bytes.
-//!
-//! This function is used to determine how many bytes of data a given ring
-//! buffer currently contains.  The structure of the code is specifically to
-//! ensure that we do not see warnings from the compiler related to the order
-//! of volatile accesses being undefined.
-//!
-//! \return Returns the number of bytes of data currently in the buffer.
+// Hand the next contiguous run of the echo or transmit buffer to the uDMA
+// transmit channel.  This is only called by the interrupt handler, which the
+// completion of a transfer raises, so a transfer that has finished releases
+// its bytes to UARTwrite() here and the next one is chained to it.  The bytes
+// of a transfer stay in the buffer while the channel reads them.  A run stops
+// at the end of the buffer storage, so data that wraps around it goes out in
+// two transfers.
 //
 //*****************************************************************************
-#ifdef UART_BUFFERED
-static uint32_t
-GetBufferCount(volatile uint32_t *pui32Read,
-               volatile uint32_t *pui32Write, uint32_t ui32Size)
+#ifdef UART_DMA
+static void
+UARTDMATransmit(uint32_t ui32Base)
 {
-    uint32_t ui32Write;
-    uint32_t ui32Read;
+    uint8_t *pui8Seg;
+    uint32_t ui32Len;
+
+    //
+    // Leave a transfer that is still running, its completion calls again.
+    //
+    if(g_ui32UARTDMALen != 0)
+    {
+        if(MAP_uDMAChannelIsEnabled(g_ui32UARTDMAChannel))
+        {
+            return;
+        }
+        RING_skip(g_psUARTDMARing, g_ui32UARTDMALen);
+        g_ui32UARTDMALen = 0;
+    }
 
-    ui32Write = *pui32Write;
-    ui32Read = *pui32Read;
+    //
+    // Echoed characters go first, then the transmit buffer.
+    //
+    g_psUARTDMARing = &g_sUARTEcho;
+    ui32Len = RING_span(&g_sUARTEcho, &pui8Seg);
+    if(ui32Len == 0)
+    {
+        g_psUARTDMARing = &g_sUARTTx;
+        ui32Len = RING_span(&g_sUARTTx, &pui8Seg);
+    }
+
+    //
+    // Tell UARTwrite() that it has to start the transmitter again when there
+    // is nothing left to send.
+    //
+    if(ui32Len == 0)
+    {
+        g_bUARTTxIdle = true;
+        return;
+    }
+    if(ui32Len > UART_DMA_SEGMENT_SIZE)
+    {
+        ui32Len = UART_DMA_SEGMENT_SIZE;
+    }
 
-    return((ui32Write >= ui32Read) ? (ui32Write - ui32Read) :
-           (ui32Size - (ui32Read - ui32Write)));
+    //
+    // Start a basic transfer of the run into the data register.
+    //
+    g_ui32UARTDMALen = ui32Len;
+    g_bUARTTxIdle = false;
+    MAP_uDMAChannelTransferSet(g_ui32UARTDMAChannel | UDMA_PRI_SELECT,
+                               UDMA_MODE_BASIC, pui8Seg,
+                               (void *)(uintptr_t)(ui32Base + UART_O_DR),
+                               ui32Len);
+    MAP_uDMAChannelEnable(g_ui32UARTDMAChannel);
 }
 #endif
 
 //*****************************************************************************
 //
-// Take as many bytes from the transmit buffer as we have space for and move
-// them into the UART transmit FIFO.
+// Queue characters to be echoed by the interrupt handler, translating LF into
+// a CRLF pair as UARTwrite() does.  Characters that do not fit are dropped.
 //
 //*****************************************************************************
 #ifdef UART_BUFFERED
 static void
-UARTPrimeTransmit(uint32_t ui32Base)
+UARTEchoWrite(const char *pcBuf, uint32_t ui32Len)
 {
-    //
-    // Do we have any data to transmit?
-    //
-    if(!TX_BUFFER_EMPTY)
+    while(ui32Len--)
     {
-        //
-        // Disable the UART interrupt.  If we don't do this there is a race
-        // condition which can cause the read index to be corrupted.
-        //
-        MAP_IntDisable(g_ui32UARTInt[g_ui32PortNum]);
-
-        //
-        // Yes - take some characters out of the transmit buffer and feed
-        // them to the UART transmit FIFO.
-        //
-        while(MAP_UARTSpaceAvail(ui32Base) && !TX_BUFFER_EMPTY)
+        if((*pcBuf == '\n') && !RING_push(&g_sUARTEcho, '\r'))
         {
-            MAP_UARTCharPutNonBlocking(ui32Base,
-                                      g_pcUARTTxBuffer[g_ui32UARTTxReadIndex]);
-            ADVANCE_TX_BUFFER_INDEX(g_ui32UARTTxReadIndex);
+            return;
         }
-
-        //
-        // Reenable the UART interrupt.
-        //
-        MAP_IntEnable(g_ui32UARTInt[g_ui32PortNum]);
+        RING_push(&g_sUARTEcho, (uint8_t)*pcBuf++);
     }
 }
 #endif
@@ -372,17 +462,46 @@ UARTStdioConfig(uint32_t ui32PortNum, uint32_t ui32Baud, uint32_t ui32SrcClock)
                              UART_CONFIG_WLEN_8));
 
 #ifdef UART_BUFFERED
+#ifdef UART_DMA
+    //
+    // Set the UART to request a burst of 4 characters whenever the TX FIFO
+    // is half empty and to interrupt when any character is received.
+    //
+    MAP_UARTFIFOLevelSet(g_ui32Base, UART_FIFO_TX4_8, UART_FIFO_RX1_8);
+
+    //
+    // Set up the transmit channel for basic transfers of bytes into the data
+    // register, as the uDMA example of lab13 of the Workshop does.  The uDMA
+    // controller must already be enabled with its control table set.
+    //
+    ASSERT(MAP_uDMAControlBaseGet() != 0);
+    MAP_uDMAChannelAssign(g_ui32UARTDMATx[ui32PortNum]);
+    g_ui32UARTDMAChannel = g_ui32UARTDMATx[ui32PortNum] & 0xFF;
+    g_ui32UARTDMALen = 0;
+    MAP_uDMAChannelAttributeDisable(g_ui32UARTDMAChannel,
+                                    UDMA_ATTR_ALTSELECT |
+                                    UDMA_ATTR_HIGH_PRIORITY |
+                                    UDMA_ATTR_REQMASK);
+    MAP_uDMAChannelAttributeEnable(g_ui32UARTDMAChannel, UDMA_ATTR_USEBURST);
+    MAP_uDMAChannelControlSet(g_ui32UARTDMAChannel | UDMA_PRI_SELECT,
+                              UDMA_SIZE_8 | UDMA_SRC_INC_8 |
+                              UDMA_DST_INC_NONE | UDMA_ARB_4);
+    MAP_UARTDMAEnable(g_ui32Base, UART_DMA_TX);
+#else
     //
     // Set the UART to interrupt whenever the TX FIFO is almost empty or
     // when any character is received.
     //
     MAP_UARTFIFOLevelSet(g_ui32Base, UART_FIFO_TX1_8, UART_FIFO_RX1_8);
+#endif
 
     //
-    // Flush both the buffers.
+    // Set up all the buffers empty.
     //
-    UARTFlushRx();
-    UARTFlushTx(true);
+    RING_init(&g_sUARTTx, g_pcUARTTxBuffer, UART_TX_BUFFER_SIZE);
+    RING_init(&g_sUARTEcho, g_pcUARTEchoBuffer, UART_ECHO_BUFFER_SIZE);
+    RING_init(&g_sUARTRx, g_pcUARTRxBuffer, UART_RX_BUFFER_SIZE);
+    g_bUARTTxIdle = true;
 
     //
     // Remember which interrupt we are dealing with.
@@ -393,7 +512,8 @@ UARTStdioConfig(uint32_t ui32PortNum, uint32_t ui32Baud, uint32_t ui32SrcClock)
     // We are configured for buffered output so enable the master interrupt
     // for this UART and the receive interrupts.  We don't actually enable the
     // transmit interrupt in the UART itself until some data has been placed
-    // in the transmit buffer.
+    // in the transmit buffer.  With UART_DMA it is never enabled, the uDMA
+    // completion raising the interrupt of the UART instead.
     //
     MAP_UARTIntDisable(g_ui32Base, 0xFFFFFFFF);
     MAP_UARTIntEnable(g_ui32Base, UART_INT_RX | UART_INT_RT);
@@ -436,7 +556,7 @@ int
 UARTwrite(const char *pcBuf, uint32_t ui32Len)
 {
 #ifdef UART_BUFFERED
-    unsigned int uIdx;
+    uint32_t uIdx, ui32Run, ui32Count;
 
     //
     // Check for valid arguments.
@@ -445,55 +565,57 @@ UARTwrite(const char *pcBuf, uint32_t ui32Len)
     ASSERT(g_ui32Base != 0);
 
     //
-    // Send the characters
+    // Send the characters, a run up to the next \n at a time.
     //
-    for(uIdx = 0; uIdx < ui32Len; uIdx++)
+    for(uIdx = 0; uIdx < ui32Len; )
     {
+        for(ui32Run = 0; (uIdx + ui32Run < ui32Len) &&
+                         (pcBuf[uIdx + ui32Run] != '\n'); ui32Run++)
+        {
+        }
+
+        //
+        // Copy the run into the transmit buffer, stopping where it is full.
+        //
+        ui32Count = RING_pushN(&g_sUARTTx, (const uint8_t *)pcBuf + uIdx,
+                               ui32Run);
+        uIdx += ui32Count;
+        if(ui32Count != ui32Run)
+        {
+            //
+            // Buffer is full - discard remaining characters and return.
+            //
+            break;
+        }
+
         //
         // If the character to the UART is \n, then add a \r before it so that
         // \n is translated to \n\r in the output.
         //
-        if(pcBuf[uIdx] == '\n')
+        if(uIdx < ui32Len)
         {
-            if(!TX_BUFFER_FULL)
-            {
-                g_pcUARTTxBuffer[g_ui32UARTTxWriteIndex] = '\r';
-                ADVANCE_TX_BUFFER_INDEX(g_ui32UARTTxWriteIndex);
-            }
-            else
+            if(RING_FREE(&g_sUARTTx) < 2)
             {
                 //
                 // Buffer is full - discard remaining characters and return.
                 //
                 break;
             }
-        }
-
-        //
-        // Send the character to the UART output.
-        //
-        if(!TX_BUFFER_FULL)
-        {
-            g_pcUARTTxBuffer[g_ui32UARTTxWriteIndex] = pcBuf[uIdx];
-            ADVANCE_TX_BUFFER_INDEX(g_ui32UARTTxWriteIndex);
-        }
-        else
-        {
-            //
-            // Buffer is full - discard remaining characters and return.
-            //
-            break;
+            RING_pushN(&g_sUARTTx, (const uint8_t *)"\r\n", 2);
+            uIdx++;
         }
     }
 
     //
-    // If we have anything in the buffer, make sure that the UART is set
-    // up to transmit it.
+    // If the interrupt handler found the buffer empty and stopped, pend its
+    // interrupt to start the transmitter again.  The handler cannot be
+    // interrupted between its last read of the buffer and setting the flag,
+    // so data written before the flag is read is always sent.  Only the
+    // handler writes the flag.
     //
-    if(!TX_BUFFER_EMPTY)
+    if(g_bUARTTxIdle && !RING_EMPTY(&g_sUARTTx))
     {
-        UARTPrimeTransmit(g_ui32Base);
-        MAP_UARTIntEnable(g_ui32Base, UART_INT_TX);
+        MAP_IntPendSet(g_ui32UARTInt[g_ui32PortNum]);
     }
 
     //
@@ -536,6 +658,72 @@ UARTwrite(const char *pcBuf, uint32_t ui32Len)
 #endif
 }
 
+//*****************************************************************************
+//
+//! Writes a buffer of bytes to the UART output as they are.
+//!
+//! \param pui8Buf points to the bytes to transmit.
+//! \param ui32Len is the number of bytes to transmit.
+//!
+//! This function sends binary data, such as the records of LOG_defer.c, down
+//! the same path as UARTwrite() but without the translation of LF to CRLF and
+//! without stopping at a null byte.
+//!
+//! In non-buffered mode, this function is blocking and will not return until
+//! all the bytes have been written to the output FIFO.  In buffered mode, the
+//! bytes are written to the UART transmit buffer only if they all fit, so a
+//! record is never split, and the call returns immediately.
+//!
+//! \return Returns the count of bytes written, 0 in buffered mode if the
+//! transmit buffer lacks space for all of them.
+//
+//*****************************************************************************
+int
+UARTwriteRaw(const uint8_t *pui8Buf, uint32_t ui32Len)
+{
+#ifndef UART_BUFFERED
+    uint32_t ui32Idx;
+
+#endif
+    //
+    // Check for valid UART base address, and valid arguments.
+    //
+    ASSERT(g_ui32Base != 0);
+    ASSERT(pui8Buf != 0);
+
+#ifdef UART_BUFFERED
+    //
+    // Copy the bytes into the transmit buffer, all of them or none.
+    //
+    if(RING_FREE(&g_sUARTTx) < ui32Len)
+    {
+        return(0);
+    }
+    RING_pushN(&g_sUARTTx, pui8Buf, ui32Len);
+
+    //
+    // Start the transmitter again as UARTwrite() does.
+    //
+    if(g_bUARTTxIdle && !RING_EMPTY(&g_sUARTTx))
+    {
+        MAP_IntPendSet(g_ui32UARTInt[g_ui32PortNum]);
+    }
+#else
+    //
+    // Send the bytes to the UART output.
+    //
+    for(ui32Idx = 0; ui32Idx < ui32Len; ui32Idx++)
+    {
+        MAP_UARTCharPut(g_ui32Base, pui8Buf[ui32Idx]);
+    }
+#endif
+
+    //
+    // Return the number of bytes written.
+    //
+    return(ui32Len);
+}
+
 //*****************************************************************************
 //
 //! A simple UART based get string function, with some line processing.
@@ -593,10 +781,8 @@ UARTgets(char *pcBuf, uint32_t ui32Len)
         //
         // Read the next character from the receive buffer.
         //
-        if(!RX_BUFFER_EMPTY)
+        if(RING_pop(&g_sUARTRx, (uint8_t *)&cChar))
         {
-            cChar = g_pcUARTRxBuffer[g_ui32UARTRxReadIndex];
-            ADVANCE_RX_BUFFER_INDEX(g_ui32UARTRxReadIndex);
 
             //
             // See if a newline or escape character was received.
@@ -791,7 +977,7 @@ UARTgetc(void)
     //
     // Wait for a character to be received.
     //
-    while(RX_BUFFER_EMPTY)
+    while(!RING_pop(&g_sUARTRx, &cChar))
     {
         //
         // Block waiting for a character to be received (if the buffer is
@@ -799,12 +985,6 @@ UARTgetc(void)
         //
     }
 
-    //
-    // Read a character from the buffer.
-    //
-    cChar = g_pcUARTRxBuffer[g_ui32UARTRxReadIndex];
-    ADVANCE_RX_BUFFER_INDEX(g_ui32UARTRxReadIndex);
-
     //
     // Return the character to the caller.
     //
@@ -839,15 +1019,19 @@ UARTgetc(void)
 //! - \%X to print a hexadecimal value using lower case letters (not upper case
 //! letters as would typically be used)
 //! - \%p to print a pointer as a hexadecimal value
+//! - \%q to print a signed fixed-point value, taking the value and then the
+//! number of its fractional bits from the arguments
 //! - \%\% to print out a \% character
 //!
-//! For \%s, \%d, \%i, \%u, \%p, \%x, and \%X, an optional number may reside
-//! between the \% and the format character, which specifies the minimum number
-//! of characters to use for that value; if preceded by a 0 then the extra
-//! characters will be filled with zeros instead of spaces.  For example,
+//! For \%s, \%d, \%i, \%u, \%p, \%q, \%x, and \%X, an optional number may
+//! reside between the \% and the format character, which specifies the minimum
+//! number of characters to use for that value; if preceded by a 0 then the
+//! extra characters will be filled with zeros instead of spaces.  For example,
 //! ``\%8d'' will use eight characters to print the decimal value with spaces
 //! added to reach eight; ``\%08d'' will use eight characters as well but will
-//! add zeroes instead of spaces.
+//! add zeroes instead of spaces.  For \%q, a '.' followed by a number gives the
+//! decimals, rounded half away from zero (3 by default), so that
+//! ``\%.2q'' prints a Q16 value of 0x00018000 passed with 16 as 1.50.
 //!
 //! The type of the arguments in the variable arguments list must match the
 //! requirements of the format string.  For example, if an integer was passed
@@ -860,7 +1044,8 @@ void
 UARTvprintf(const char *pcString, va_list vaArgP)
 {
     uint32_t ui32Idx, ui32Value, ui32Pos, ui32Count, ui32Base, ui32Neg;
-    char *pcStr, pcBuf[16], cFill;
+    uint32_t ui32Places, ui32Frac;
+    char *pcStr, pcBuf[16], pcNum[FMT_Q_MAX], cFill;
 
     //
     // Check the arguments.
@@ -907,6 +1092,7 @@ UARTvprintf(const char *pcString, va_list vaArgP)
             //
             ui32Count = 0;
             cFill = ' ';
+            ui32Places = UART_Q_PLACES;
 
             //
             // It may be necessary to get back here to process more characters.
@@ -955,6 +1141,26 @@ again:
                     goto again;
                 }
 
+                //
+                // Handle the decimals of %q.
+                //
+                case '.':
+                {
+                    //
+                    // Get the number following the '.'.
+                    //
+                    for(ui32Places = 0;
+                        (*pcString >= '0') && (*pcString <= '9'); pcString++)
+                    {
+                        ui32Places = (ui32Places * 10) + (*pcString - '0');
+                    }
+
+                    //
+                    // Get the next character.
+                    //
+                    goto again;
+                }
+
                 //
                 // Handle the %c command.
                 //
@@ -1100,6 +1306,40 @@ again:
                     goto convert;
                 }
 
+                //
+                // Handle the %q command.
+                //
+                case 'q':
+                {
+                    //
+                    // Get the value and the number of its fractional bits
+                    // from the varargs.
+                    //
+                    ui32Value = va_arg(vaArgP, uint32_t);
+                    ui32Frac = va_arg(vaArgP, uint32_t);
+
+                    //
+                    // Reset the buffer position.
+                    //
+                    ui32Pos = 0;
+
+                    //
+                    // If the value is negative, make it positive and indicate
+                    // that a minus sign is needed.
+                    //
+                    ui32Neg = ((int32_t)ui32Value < 0) ? 1 : 0;
+                    if(ui32Neg)
+                    {
+                        ui32Value = 0 - ui32Value;
+                    }
+
+                    //
+                    // Convert the value to ASCII and pad it.
+                    //
+                    ui32Idx = FMT_uq(pcNum, ui32Value, ui32Frac, ui32Places);
+                    goto pad;
+                }
+
                 //
                 // Handle the %x and %X commands.  Note that they are treated
                 // identically; in other words, %X will use lower case letters
@@ -1132,25 +1372,27 @@ again:
                     ui32Neg = 0;
 
                     //
-                    // Determine the number of digits in the string version of
-                    // the value.
+                    // Convert the value into its digits.  The decimal
+                    // conversion multiplies by a reciprocal instead of
+                    // dividing once per digit.
                     //
 convert:
-                    for(ui32Idx = 1;
-                        (((ui32Idx * ui32Base) <= ui32Value) &&
-                         (((ui32Idx * ui32Base) / ui32Base) == ui32Idx));
-                        ui32Idx *= ui32Base, ui32Count--)
+                    if(ui32Base == 10)
                     {
+                        ui32Idx = FMT_u32(pcNum, ui32Value);
+                    }
+                    else
+                    {
+                        ui32Idx = FMT_x32(pcNum, ui32Value);
                     }
 
                     //
-                    // If the value is negative, reduce the count of padding
-                    // characters needed.
+                    // Determine the number of padding characters needed
+                    // besides the digits and the minus sign.
                     //
-                    if(ui32Neg)
-                    {
-                        ui32Count--;
-                    }
+pad:
+                    ui32Count = (ui32Count > (ui32Idx + ui32Neg)) ?
+                                (ui32Count - ui32Idx - ui32Neg) : 0;
 
                     //
                     // If the value is negative and the value is padded with
@@ -1174,9 +1416,9 @@ convert:
                     // Provide additional padding at the beginning of the
                     // string conversion if needed.
                     //
-                    if((ui32Count > 1) && (ui32Count < 16))
+                    if(ui32Count < 15)
                     {
-                        for(ui32Count--; ui32Count; ui32Count--)
+                        for(; ui32Count; ui32Count--)
                         {
                             pcBuf[ui32Pos++] = cFill;
                         }
@@ -1195,18 +1437,13 @@ convert:
                     }
 
                     //
-                    // Convert the value into a string.
+                    // Write the padding and sign, then the digits.
                     //
-                    for(; ui32Idx; ui32Idx /= ui32Base)
+                    if(ui32Pos)
                     {
-                        pcBuf[ui32Pos++] =
-                            g_pcHex[(ui32Value / ui32Idx) % ui32Base];
+                        UARTwrite(pcBuf, ui32Pos);
                     }
-
-                    //
-                    // Write the string.
-                    //
-                    UARTwrite(pcBuf, ui32Pos);
+                    UARTwrite(pcNum, ui32Idx);
 
                     //
                     // This command has been handled.
@@ -1271,15 +1508,19 @@ convert:
 //! - \%X to print a hexadecimal value using lower case letters (not upper case
 //! letters as would typically be used)
 //! - \%p to print a pointer as a hexadecimal value
+//! - \%q to print a signed fixed-point value, taking the value and then the
+//! number of its fractional bits from the arguments
 //! - \%\% to print out a \% character
 //!
-//! For \%s, \%d, \%i, \%u, \%p, \%x, and \%X, an optional number may reside
-//! between the \% and the format character, which specifies the minimum number
-//! of characters to use for that value; if preceded by a 0 then the extra
-//! characters will be filled with zeros instead of spaces.  For example,
+//! For \%s, \%d, \%i, \%u, \%p, \%q, \%x, and \%X, an optional number may
+//! reside between the \% and the format character, which specifies the minimum
+//! number of characters to use for that value; if preceded by a 0 then the
+//! extra characters will be filled with zeros instead of spaces.  For example,
 //! ``\%8d'' will use eight characters to print the decimal value with spaces
 //! added to reach eight; ``\%08d'' will use eight characters as well but will
-//! add zeroes instead of spaces.
+//! add zeroes instead of spaces.  For \%q, a '.' followed by a number gives the
+//! decimals, rounded half away from zero (3 by default), so that
+//! ``\%.2q'' prints a Q16 value of 0x00018000 passed with 16 as 1.50.
 //!
 //! The type of the arguments after \e pcString must match the requirements of
 //! the format string.  For example, if an integer was passed where a string
@@ -1321,7 +1562,7 @@ UARTprintf(const char *pcString, ...)
 int
 UARTRxBytesAvail(void)
 {
-    return(RX_BUFFER_USED);
+    return(RING_USED(&g_sUARTRx));
 }
 #endif
 
@@ -1340,7 +1581,7 @@ UARTRxBytesAvail(void)
 int
 UARTTxBytesFree(void)
 {
-    return(TX_BUFFER_FREE);
+    return(RING_FREE(&g_sUARTTx));
 }
 #endif
 
@@ -1369,33 +1610,24 @@ UARTPeek(unsigned char ucChar)
 {
     int iCount;
     int iAvail;
-    uint32_t ui32ReadIndex;
 
     //
     // How many characters are there in the receive buffer?
     //
-    iAvail = (int)RX_BUFFER_USED;
-    ui32ReadIndex = g_ui32UARTRxReadIndex;
+    iAvail = (int)RING_USED(&g_sUARTRx);
 
     //
     // Check all the unread characters looking for the one passed.
     //
     for(iCount = 0; iCount < iAvail; iCount++)
     {
-        if(g_pcUARTRxBuffer[ui32ReadIndex] == ucChar)
+        if(RING_AT(&g_sUARTRx, iCount) == ucChar)
         {
             //
             // We found it so return the index
             //
             return(iCount);
         }
-        else
-        {
-            //
-            // This one didn't match so move on to the next character.
-            //
-            ADVANCE_RX_BUFFER_INDEX(ui32ReadIndex);
-        }
     }
 
     //
@@ -1421,27 +1653,11 @@ UARTPeek(unsigned char ucChar)
 void
 UARTFlushRx(void)
 {
-    uint32_t ui32Int;
-
-    //
-    // Temporarily turn off interrupts.
-    //
-    ui32Int = MAP_IntMasterDisable();
-
     //
-    // Flush the receive buffer.
+    // Flush the receive buffer.  The caller is its consumer, so it does so
+    // by catching up with the interrupt handler without turning it off.
     //
-    g_ui32UARTRxReadIndex = 0;
-    g_ui32UARTRxWriteIndex = 0;
-
-    //
-    // If interrupts were enabled when we turned them off, turn them
-    // back on again.
-    //
-    if(!ui32Int)
-    {
-        MAP_IntMasterEnable();
-    }
+    g_sUARTRx.ui32Tail = g_sUARTRx.ui32Head;
 }
 #endif
 
@@ -1479,10 +1695,22 @@ UARTFlushTx(bool bDiscard)
         ui32Int = MAP_IntMasterDisable();
 
         //
-        // Flush the transmit buffer.
+        // Flush the transmit buffer.  Its consumer is the interrupt handler,
+        // so this is done with interrupts off.
+        //
+#ifdef UART_DMA
+        //
+        // Stop the transfer reading the buffer first, the interrupt handler
+        // then finds nothing to release and starts with what is left.
         //
-        g_ui32UARTTxReadIndex = 0;
-        g_ui32UARTTxWriteIndex = 0;
+        if((g_ui32UARTDMALen != 0) && (g_psUARTDMARing == &g_sUARTTx))
+        {
+            MAP_uDMAChannelDisable(g_ui32UARTDMAChannel);
+            g_ui32UARTDMALen = 0;
+            MAP_IntPendSet(g_ui32UARTInt[g_ui32PortNum]);
+        }
+#endif
+        g_sUARTTx.ui32Tail = g_sUARTTx.ui32Head;
 
         //
         // If interrupts were enabled when we turned them off, turn them
@@ -1498,7 +1726,7 @@ UARTFlushTx(bool bDiscard)
         //
         // Wait for all remaining data to be transmitted before returning.
         //
-        while(!TX_BUFFER_EMPTY)
+        while(!RING_EMPTY(&g_sUARTTx))
         {
         }
     }
@@ -1540,7 +1768,9 @@ UARTEchoSet(bool bEnable)
 //! This function handles interrupts from the UART.  It will copy data from the
 //! transmit buffer to the UART transmit FIFO if space is available, and it
 //! will copy data from the UART receive FIFO to the receive buffer if data is
-//! available.
+//! available.  When built with \b UART_DMA, the completion of a uDMA transmit
+//! transfer raises this interrupt too and the handler chains the next
+//! transfer from the transmit buffer instead of filling the FIFO itself.
 //!
 //! \return None.
 //
@@ -1560,25 +1790,6 @@ UARTStdioIntHandler(void)
     ui32Ints = MAP_UARTIntStatus(g_ui32Base, true);
     MAP_UARTIntClear(g_ui32Base, ui32Ints);
 
-    //
-    // Are we being interrupted because the TX FIFO has space available?
-    //
-    if(ui32Ints & UART_INT_TX)
-    {
-        //
-        // Move as many bytes as we can into the transmit FIFO.
-        //
-        UARTPrimeTransmit(g_ui32Base);
-
-        //
-        // If the output buffer is empty, turn off the transmit interrupt.
-        //
-        if(TX_BUFFER_EMPTY)
-        {
-            MAP_UARTIntDisable(g_ui32Base, UART_INT_TX);
-        }
-    }
-
     //
     // Are we being interrupted due to a received character?
     //
@@ -1612,25 +1823,21 @@ UARTStdioIntHandler(void)
                     // If there are any characters already in the buffer, then
                     // delete the last.
                     //
-                    if(!RX_BUFFER_EMPTY)
+                    if(!RING_EMPTY(&g_sUARTRx))
                     {
                         //
                         // Rub out the previous character on the users
                         // terminal.
                         //
-                        UARTwrite("\b \b", 3);
+                        UARTEchoWrite("\b \b", 3);
 
                         //
                         // Decrement the number of characters in the buffer.
+                        // This takes back a character already published to
+                        // the consumer, so UARTgets() or UARTgetc() may have
+                        // read it already, as with the former buffer.
                         //
-                        if(g_ui32UARTRxWriteIndex == 0)
-                        {
-                            g_ui32UARTRxWriteIndex = UART_RX_BUFFER_SIZE - 1;
-                        }
-                        else
-                        {
-                            g_ui32UARTRxWriteIndex--;
-                        }
+                        g_sUARTRx.ui32Head--;
                     }
 
                     //
@@ -1674,7 +1881,7 @@ UARTStdioIntHandler(void)
                     // receives both CR and LF.
                     //
                     cChar = '\r';
-                    UARTwrite("\n", 1);
+                    UARTEchoWrite("\n", 1);
                 }
             }
 
@@ -1682,33 +1889,36 @@ UARTStdioIntHandler(void)
             // If there is space in the receive buffer, put the character
             // there, otherwise throw it away.
             //
-            if(!RX_BUFFER_FULL)
+            if(RING_push(&g_sUARTRx, (uint8_t)(i32Char & 0xFF)))
             {
                 //
-                // Store the new character in the receive buffer
-                //
-                g_pcUARTRxBuffer[g_ui32UARTRxWriteIndex] =
-                    (unsigned char)(i32Char & 0xFF);
-                ADVANCE_RX_BUFFER_INDEX(g_ui32UARTRxWriteIndex);
-
-                //
-                // If echo is enabled, write the character to the transmit
+                // If echo is enabled, write the character to the echo
                 // buffer so that the user gets some immediate feedback.
                 //
                 if(!g_bDisableEcho)
                 {
-                    UARTwrite((const char *)&cChar, 1);
+                    UARTEchoWrite((const char *)&cChar, 1);
                 }
             }
         }
-
-        //
-        // If we wrote anything to the transmit buffer, make sure it actually
-        // gets transmitted.
-        //
-        UARTPrimeTransmit(g_ui32Base);
-        MAP_UARTIntEnable(g_ui32Base, UART_INT_TX);
     }
+
+#ifdef UART_DMA
+    //
+    // Chain the next transfer when the last one has completed.  This also
+    // runs when UARTwrite() pends the interrupt to restart an idle
+    // transmitter and sends anything echoed above.
+    //
+    UARTDMATransmit(g_ui32Base);
+#else
+    //
+    // Move as many bytes as we can into the transmit FIFO.  This also runs
+    // when UARTwrite() pends the interrupt to restart an idle transmitter and
+    // sends anything echoed above.
+    //
+    UARTPrimeTransmit(g_ui32Base,
+                      (ui32Ints & UART_INT_TX) ? UART_TX_FIFO_FREE : 0);
+#endif
 }
 #endif
 
@@ -41,7 +41,8 @@ extern "C"
 //*****************************************************************************
 //
 // If built for buffered operation, the following labels define the sizes of
-// the transmit and receive buffers respectively.
+// the transmit, receive and echo buffers respectively.  The sizes must be
+// powers of 2.
 //
 //*****************************************************************************
 #ifdef UART_BUFFERED
@@ -51,6 +52,28 @@ extern "C"
 #ifndef UART_TX_BUFFER_SIZE
 #define UART_TX_BUFFER_SIZE     1024
 #endif
+#ifndef UART_ECHO_BUFFER_SIZE
+#define UART_ECHO_BUFFER_SIZE   32
+#endif
+#endif
+
+//*****************************************************************************
+//
+// If built for buffered operation with UART_DMA also defined, the transmit
+// and echo buffers are read in place by the uDMA transmit channel of the UART
+// instead of being copied into the FIFO by the interrupt handler.  The
+// application must enable the uDMA controller and set its control table
+// before calling UARTStdioConfig().  UART_DMA_SEGMENT_SIZE is the largest
+// transfer handed to the channel, which bounds how long echoed characters
+// wait behind the output (1024 at most).  The echo buffer must hold what is
+// typed while a transfer runs: 64 keeps a paste at 1/8 of the line rate
+// within the default echo buffer, where 128 already drops characters.
+//
+//*****************************************************************************
+#if defined(UART_BUFFERED) && defined(UART_DMA)
+#ifndef UART_DMA_SEGMENT_SIZE
+#define UART_DMA_SEGMENT_SIZE   64
+#endif
 #endif
 
 //*****************************************************************************
@@ -65,6 +88,7 @@ extern unsigned char UARTgetc(void);
 extern void UARTprintf(const char *pcString, ...);
 extern void UARTvprintf(const char *pcString, va_list vaArgP);
 extern int UARTwrite(const char *pcBuf, uint32_t ui32Len);
+extern int UARTwriteRaw(const uint8_t *pui8Buf, uint32_t ui32Len);
 #ifdef UART_BUFFERED
 extern int UARTPeek(unsigned char ucChar);
 extern void UARTFlushTx(bool bDiscard);
@@ -0,0 +1,18 @@
+/*!
+ * @brief       Perfect hash of the commands of CMD_table.h
+ * @details     Written by other_codes/Host Tools/CMD_hash.c from CMD_table.h, do
+ *              not edit. The commands, in the order of their numbers:
+ *              help blink echo
+ * @file        CMD_hash.h
+ */
+#ifndef CMD_HASH_H_
+#define CMD_HASH_H_
+
+#define CMD_HASH_SEED       0x00000001u             // Macro for the first value of the hash
+#define CMD_HASH_BITS       2                       // Macro for the 2^N slots of the hash
+#define CMD_HASH_COUNT      3                       // Macro for the number of commands
+
+// Macro for the command of each slot
+#define CMD_HASH_SLOTS      {CMD_HASH_EMPTY, 0, 2, 1}
+
+#endif /* CMD_HASH_H_ */
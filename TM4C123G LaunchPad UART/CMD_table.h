@@ -0,0 +1,16 @@
+/*!
+ * @author      Yash Bansod
+ * @date        17th October 2026
+ *
+ * @brief       Command table of the shell of UART
+ * @details     One CMD_ENTRY("name", Cmd_function, "help line") line per command, the
+ *              function being defined by the application as
+ *                  int32_t Cmd_function(uint32_t ui32Argc, char *ppcArgv[])
+ *              and the help line starting with the usage, which the shell also prints
+ *              when the command returns CMD_ERR_USAGE. CMD_shell.c adds help in front.
+ *              Write CMD_hash.h again with other_codes/Host Tools/CMD_hash.c after
+ *              changing the names. The file has no include guard on purpose.
+ * @file        CMD_table.h
+ */
+CMD_ENTRY("blink",  Cmd_blink,  "blink <ms>: flash the blue LED for ms on each character, 0 to 1000")
+CMD_ENTRY("echo",   Cmd_echo,   "echo [words]: print the words, a quoted word may hold spaces")
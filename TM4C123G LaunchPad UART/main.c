@@ -6,6 +6,9 @@
  * @details     The program reads the input from a user on the serial monitor
  *              (terminal) and echoes it back to the user. Serial Activity is
  *              displayed by the Blue Led which glows for 1ms on every UartRx.
+ *              The input goes to the command shell of CMD_shell.c, which echoes it
+ *              and runs the commands of CMD_table.h from the main loop: help, blink
+ *              and echo.
  *
  * @note        The tm4c123ghpm_startup_ccs.c contains the vector table for the
  *              microcontroller. It was modified to execute the specified ISR on
@@ -14,6 +17,7 @@
 /* -----------------------          Include Files       --------------------- */
 #include <stdint.h>                         // Library of Standard Integer Types
 #include <stdbool.h>                        // Library of Standard Boolean Types
+#include <stdlib.h>                         // Library of Standard Datatype Conversions
 #include "inc/tm4c123gh6pm.h"               // Definitions for interrupt and register assignments on Tiva C
 #include "inc/hw_memmap.h"                  // Macros defining the memory map of the Tiva C Series device
 #include "inc/hw_types.h"                   // Defines common types and macros
@@ -26,15 +30,20 @@
 #include "driverlib/pin_map.h"              // Mapping of peripherals to pins for all parts
 #include "driverlib/uart.h"                 // Defines and Macros for the UART
 #include "driverlib/rom.h"                  // Defines and macros for ROM API of driverLib
+#include "CMD_shell.h"                      // Command shell over the UART
 
 #define UART0_BAUDRATE  115200              // Macro for UART0 Baud rate
 
 /* -----------------------      Global Variables        --------------------- */
 uint32_t ui32Period;                    // Variable to store the period to be inputed to Timer0
+volatile uint32_t ui32BlinkMs = 1;      // Variable to store the Led glow on every UartRx in ms, 0 for none
 
 /* -----------------------      Function Prototypes     --------------------- */
 void UARTIntHandler(void);              // The prototype of the ISR for UART Interrupt
 void Timer0IntHandler(void);            // The prototype of the ISR for Timer0 Interrupt
+int UART0_write(const char *pcBuf, uint32_t ui32Len);   // The prototype of the output of the shell
+int32_t Cmd_blink(uint32_t ui32Argc, char *ppcArgv[]);  // The prototype of the blink command
+int32_t Cmd_echo(uint32_t ui32Argc, char *ppcArgv[]);   // The prototype of the echo command
 
 /* -----------------------          Main Program        --------------------- */
 int main(void){
@@ -74,12 +83,13 @@ int main(void){
     ui32Period = ROM_SysCtlClockGet() / 1000;
     ROM_TimerLoadSet(TIMER0_BASE, TIMER_A, ui32Period - 1);
 
-    uint8_t ui8WelcomeText[] = {"\fEnter Text: \n\r"};
+    uint8_t ui8WelcomeText[] = {"\fUART shell, help lists the commands\n"};
 
-    uint8_t iter;
-    for (iter = 0; iter<sizeof(ui8WelcomeText); iter++ ) ROM_UARTCharPutNonBlocking(UART0_BASE, ui8WelcomeText[iter]);
+    UART0_write((const char *)ui8WelcomeText, sizeof(ui8WelcomeText) - 1);
+    CMD_init(UART0_write);
 
-    while (1);
+    // Run the commands typed by the user
+    while (1) CMD_poll();
 }
 
 /* -----------------------      Function Definition     --------------------- */
@@ -90,12 +100,14 @@ void UARTIntHandler(void){
 
     // While there is a character available at input
     while(ROM_UARTCharsAvail(UART0_BASE)){
-        // Echo the character back to the user
-        ROM_UARTCharPutNonBlocking(UART0_BASE, ROM_UARTCharGetNonBlocking(UART0_BASE));
-
-        // Blink the Led for approximately 1ms
-        ROM_GPIOPinWrite(GPIO_PORTF_BASE, GPIO_PIN_2, GPIO_PIN_2);
-        ROM_TimerEnable(TIMER0_BASE, TIMER_A);
+        // Queue the character for the shell, CMD_poll() echoes it back from the main loop
+        CMD_input(ROM_UARTCharGetNonBlocking(UART0_BASE));
+
+        // Blink the Led for approximately ui32BlinkMs
+        if (ui32BlinkMs){
+            ROM_GPIOPinWrite(GPIO_PORTF_BASE, GPIO_PIN_2, GPIO_PIN_2);
+            ROM_TimerEnable(TIMER0_BASE, TIMER_A);
+        }
     }
 }
 
@@ -109,3 +121,45 @@ void Timer0IntHandler(void)
     // Disable the timer
     ROM_TimerDisable(TIMER0_BASE, TIMER_A);
 }
+
+// Function to send the output of the shell, a new line going out as CR LF
+int UART0_write(const char *pcBuf, uint32_t ui32Len){
+    uint32_t ui32Idx;
+
+    for (ui32Idx = 0; ui32Idx < ui32Len; ui32Idx++){
+        if (pcBuf[ui32Idx] == '\n') ROM_UARTCharPut(UART0_BASE, '\r');
+        ROM_UARTCharPut(UART0_BASE, pcBuf[ui32Idx]);
+    }
+    return ui32Len;
+}
+
+// Function of the blink command, setting the Led glow on every UartRx
+int32_t Cmd_blink(uint32_t ui32Argc, char *ppcArgv[]){
+    char *pcEnd;
+    uint32_t ui32Ms;
+
+    if (ui32Argc != 2) return CMD_ERR_USAGE;
+    ui32Ms = strtoul(ppcArgv[1], &pcEnd, 10);
+    if (pcEnd == ppcArgv[1] || *pcEnd || ui32Ms > 1000) return CMD_ERR_USAGE;
+
+    // Load the Timer with the new glow, the Led being off between characters
+    ui32BlinkMs = ui32Ms;
+    if (ui32Ms) ROM_TimerLoadSet(TIMER0_BASE, TIMER_A, ui32Period * ui32Ms - 1);
+    CMD_puts("blink ");
+    CMD_puts(ppcArgv[1]);
+    CMD_puts(" ms\n");
+    return CMD_OK;
+}
+
+// Function of the echo command, printing each word in brackets
+int32_t Cmd_echo(uint32_t ui32Argc, char *ppcArgv[]){
+    uint32_t ui32Idx;
+
+    for (ui32Idx = 1; ui32Idx < ui32Argc; ui32Idx++){
+        CMD_puts("[");
+        CMD_puts(ppcArgv[ui32Idx]);
+        CMD_puts("] ");
+    }
+    CMD_puts("\n");
+    return CMD_OK;
+}
@@ -0,0 +1,16 @@
+/*!
+ * @author      Yash Bansod
+ * @date        17th October 2026
+ *
+ * @brief       Command table of the shell of Ultrasonic HC-SR04
+ * @details     One CMD_ENTRY("name", Cmd_function, "help line") line per command, the
+ *              function being defined by the application as
+ *                  int32_t Cmd_function(uint32_t ui32Argc, char *ppcArgv[])
+ *              and the help line starting with the usage, which the shell also prints
+ *              when the command returns CMD_ERR_USAGE. CMD_shell.c adds help in front.
+ *              Write CMD_hash.h again with other_codes/Host Tools/CMD_hash.c after
+ *              changing the names. The file has no include guard on purpose.
+ * @file        CMD_table.h
+ */
+CMD_ENTRY("dist",   Cmd_dist,   "dist: print the last distance of the obstacle in cm")
+CMD_ENTRY("stream", Cmd_stream, "stream on|off: print every distance measured, or stop")
@@ -0,0 +1,118 @@
+/*!
+ * @author      Yash Bansod
+ * @date        17th October 2026
+ *
+ * @brief       Source containing the number to text conversions of uartstdio
+ * @details     FMT_uq() rounds the fraction with one 64 bit multiply: the fractional
+ *              bits times 10^ui32Places, plus half of the last place, shifted down by
+ *              ui32Frac, is below 2^61 for every input. A carry out of the decimals
+ *              goes into the integer part.
+ * @file        FMT_num.c
+ */
+/* -----------------------          Include Files       --------------------- */
+#include "FMT_num.h"
+
+/* -----------------------      Global Variables        --------------------- */
+static const char g_pcFmtPairs[200] = {
+    '0','0','0','1','0','2','0','3','0','4','0','5','0','6','0','7','0','8','0','9',
+    '1','0','1','1','1','2','1','3','1','4','1','5','1','6','1','7','1','8','1','9',
+    '2','0','2','1','2','2','2','3','2','4','2','5','2','6','2','7','2','8','2','9',
+    '3','0','3','1','3','2','3','3','3','4','3','5','3','6','3','7','3','8','3','9',
+    '4','0','4','1','4','2','4','3','4','4','4','5','4','6','4','7','4','8','4','9',
+    '5','0','5','1','5','2','5','3','5','4','5','5','5','6','5','7','5','8','5','9',
+    '6','0','6','1','6','2','6','3','6','4','6','5','6','6','6','7','6','8','6','9',
+    '7','0','7','1','7','2','7','3','7','4','7','5','7','6','7','7','7','8','7','9',
+    '8','0','8','1','8','2','8','3','8','4','8','5','8','6','8','7','8','8','8','9',
+    '9','0','9','1','9','2','9','3','9','4','9','5','9','6','9','7','9','8','9','9'
+};
+
+static const uint32_t g_pui32FmtPow10[10] = {
+    1u, 10u, 100u, 1000u, 10000u, 100000u, 1000000u, 10000000u, 100000000u, 1000000000u
+};
+
+/* -----------------------      Function Definition     --------------------- */
+// Function to get the number of decimal digits of a value, 1 for 0
+uint32_t FMT_digits(uint32_t ui32Value){
+    if (ui32Value < 100000u){
+        if (ui32Value < 100u) return (ui32Value < 10u) ? 1 : 2;
+        if (ui32Value < 10000u) return (ui32Value < 1000u) ? 3 : 4;
+        return 5;
+    }
+    if (ui32Value < 10000000u) return (ui32Value < 1000000u) ? 6 : 7;
+    if (ui32Value < 1000000000u) return (ui32Value < 100000000u) ? 8 : 9;
+    return 10;
+}
+
+// Function to write ui32Len digits of a value, the last first, zeros filling the front
+static void FMT_digitsAt(char *pcDst, uint32_t ui32Value, uint32_t ui32Len){
+    uint32_t ui32Quot, ui32Pair;
+
+    while (ui32Len >= 2){
+        ui32Quot = FMT_DIV100(ui32Value);
+        ui32Pair = (ui32Value - ui32Quot * 100u) * 2u;
+        pcDst[--ui32Len] = g_pcFmtPairs[ui32Pair + 1];
+        pcDst[--ui32Len] = g_pcFmtPairs[ui32Pair];
+        ui32Value = ui32Quot;
+    }
+    if (ui32Len) pcDst[0] = (char)('0' + ui32Value);
+}
+
+// Function to write a value in decimal, returns the number of characters
+uint32_t FMT_u32(char *pcDst, uint32_t ui32Value){
+    uint32_t ui32Len = FMT_digits(ui32Value);
+
+    FMT_digitsAt(pcDst, ui32Value, ui32Len);
+    return ui32Len;
+}
+
+// Function to write a signed value in decimal, returns the number of characters
+uint32_t FMT_i32(char *pcDst, int32_t i32Value){
+    if (i32Value >= 0) return FMT_u32(pcDst, (uint32_t)i32Value);
+    *pcDst = '-';
+    return 1 + FMT_u32(pcDst + 1, 0u - (uint32_t)i32Value);
+}
+
+// Function to write a value in lower case hexadecimal, returns the number of characters
+uint32_t FMT_x32(char *pcDst, uint32_t ui32Value){
+    static const char pcHex[16] = {'0','1','2','3','4','5','6','7','8','9','a','b','c','d','e','f'};
+    uint32_t ui32Len = 1, ui32Idx;
+
+    while (ui32Len < 8 && (ui32Value >> (4 * ui32Len))) ui32Len++;
+    for (ui32Idx = ui32Len; ui32Idx; ui32Idx--, ui32Value >>= 4)
+        pcDst[ui32Idx - 1] = pcHex[ui32Value & 0xF];
+    return ui32Len;
+}
+
+// Function to write a value of ui32Frac fractional bits with ui32Places decimals, returns the number of characters
+uint32_t FMT_uq(char *pcDst, uint32_t ui32Value, uint32_t ui32Frac, uint32_t ui32Places){
+    uint32_t ui32Int, ui32Dec, ui32Len;
+    uint64_t ui64Scaled;
+
+    if (ui32Frac > 31) ui32Frac = 31;
+    if (ui32Places > FMT_Q_PLACES_MAX) ui32Places = FMT_Q_PLACES_MAX;
+    ui32Int = ui32Value >> ui32Frac;
+
+    // Decimals of the fractional bits, rounded at the last place
+    ui64Scaled = (uint64_t)(ui32Value & ((1u << ui32Frac) - 1)) * g_pui32FmtPow10[ui32Places];
+    if (ui32Frac) ui64Scaled += (uint64_t)1 << (ui32Frac - 1);
+    ui32Dec = (uint32_t)(ui64Scaled >> ui32Frac);
+    if (ui32Dec == g_pui32FmtPow10[ui32Places]){
+        ui32Dec = 0;
+        ui32Int++;                                  // Cannot wrap, the integer part is below 2^32 - 1
+    }
+
+    ui32Len = FMT_u32(pcDst, ui32Int);
+    if (ui32Places){
+        pcDst[ui32Len++] = '.';
+        FMT_digitsAt(pcDst + ui32Len, ui32Dec, ui32Places);
+        ui32Len += ui32Places;
+    }
+    return ui32Len;
+}
+
+// Function to write a signed value of ui32Frac fractional bits with ui32Places decimals, returns the number of characters
+uint32_t FMT_q(char *pcDst, int32_t i32Value, uint32_t ui32Frac, uint32_t ui32Places){
+    if (i32Value >= 0) return FMT_uq(pcDst, (uint32_t)i32Value, ui32Frac, ui32Places);
+    *pcDst = '-';
+    return 1 + FMT_uq(pcDst + 1, 0u - (uint32_t)i32Value, ui32Frac, ui32Places);
+}
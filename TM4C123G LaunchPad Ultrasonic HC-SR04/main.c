@@ -5,15 +5,19 @@
  * @brief       Ultrasonin HC-SR04
  * @details     This is a sample code for HC-SR04. The code calculates the distance
  *              of an obstacle from the HC-SR04 sensor and publishes the data over
- *              the UART channel.
+ *              the UART channel. The distance is converted by FMT_u32() of FMT_num.c,
+ *              which returns its length, so only its digits are sent.
+ *              The UART input goes to the command shell of CMD_shell.c: dist prints
+ *              the last distance, stream on|off starts or stops the distances sent
+ *              after each measurement, and help lists the commands.
  * @note        The tm4c123ghpm_startup_ccs.c contains the vector table for the
  *              microcontroller. It was modified to execute the specified ISR on
- *              Timer0A and PortA Interrupts.
+ *              Timer0A, PortA and UART0 Interrupts.
  */
 /* -----------------------          Include Files       --------------------- */
 #include <stdint.h>                         // Library of Standard Integer Types
 #include <stdbool.h>                        // Library of Standard Boolean Types
-#include <stdlib.h>                         // Library of Standard Datatype Conversions
+#include <string.h>                         // Library for String functions
 #include "inc/tm4c123gh6pm.h"               // Definitions for interrupt and register assignments on Tiva C
 #include "inc/hw_memmap.h"                  // Macros defining the memory map of the Tiva C Series device
 #include "inc/hw_types.h"                   // Defines common types and macros
@@ -27,6 +31,8 @@
 #include "driverlib/pin_map.h"              // Mapping of peripherals to pins for all parts
 #include "driverlib/uart.h"                 // Defines and Macros for the UART
 #include "driverlib/rom.h"                  // Defines and macros for ROM API of driverLib
+#include "FMT_num.h"                        // Number to text conversions
+#include "CMD_shell.h"                      // Command shell over the UART
 
 #define UART0_BAUDRATE  115200              // Macro for UART0 Baud rate
 
@@ -34,12 +40,18 @@
 volatile bool boolTrigCondition = 1;        // Variable to control the Trigger Pin Switching
 volatile uint32_t ui32EchoDuration = 0;     // Variable to store duration for which Echo Pin is high
 volatile uint32_t ui32ObstacleDist = 0;     // Variable to store distance of the Obstacle
+volatile bool boolStream = 1;               // Variable to control the Transmission of every distance
 
 uint8_t ui8WelcomeText[] = {"\n\rDistance: "};
+char chShellText[] = {"HC-SR04 shell, help lists the commands, stream off stops the distances\n"};
 
 /* -----------------------      Function Prototypes     --------------------- */
 void Timer0IntHandler(void);                // The prototype of the ISR for Timer0 Interrupt
 void PortAIntHandler(void);                 // Prototype for ISR of GPIO PortA
+void UARTIntHandler(void);                  // The prototype of the ISR for UART Interrupt
+int UART0_write(const char *pcBuf, uint32_t ui32Len);   // The prototype of the output of the shell
+int32_t Cmd_dist(uint32_t ui32Argc, char *ppcArgv[]);   // The prototype of the dist command
+int32_t Cmd_stream(uint32_t ui32Argc, char *ppcArgv[]); // The prototype of the stream command
 
 /* -----------------------          Main Program        --------------------- */
 int main(void){
@@ -61,6 +73,9 @@ int main(void){
     ROM_UARTConfigSetExpClk(UART0_BASE, ROM_SysCtlClockGet(), UART0_BAUDRATE, UART_CONFIG_WLEN_8 | UART_CONFIG_STOP_ONE | UART_CONFIG_PAR_NONE );
     // Enable the UART0
     ROM_UARTEnable(UART0_BASE);
+    // Configure and enable the interrupt for UART0
+    ROM_IntEnable(INT_UART0);
+    ROM_UARTIntEnable(UART0_BASE, UART_INT_RX | UART_INT_RT);
 
     // Set the PA3 port as Output. Trigger Pin
     ROM_GPIOPinTypeGPIOOutput(GPIO_PORTA_BASE, GPIO_PIN_3);
@@ -85,10 +100,18 @@ int main(void){
     // Transmit a New Page Character to the Terminal
     ROM_UARTCharPutNonBlocking(UART0_BASE, '\f');
 
+    UART0_write(chShellText, sizeof(chShellText) - 1);
+
     uint8_t iter;
-    for (iter = 0; iter<sizeof(ui8WelcomeText); iter++ ) ROM_UARTCharPut(UART0_BASE, ui8WelcomeText[iter]);
+    for (iter = 0; iter<sizeof(ui8WelcomeText) - 1; iter++ ) ROM_UARTCharPut(UART0_BASE, ui8WelcomeText[iter]);
+
+    // Start the shell, which prints its prompt
+    CMD_init(UART0_write);
 
     while (1){
+        // Run the commands typed by the user
+        CMD_poll();
+
         if (boolTrigCondition){
             // Load the Timer with value for generating a  delay of 10 uS.
             ROM_TimerLoadSet(TIMER0_BASE, TIMER_A, (ROM_SysCtlClockGet() / 100000) -1);
@@ -132,16 +155,62 @@ void PortAIntHandler(void){
         // Convert the Timer Duration to Distance Value according to Ultrasonic's formula
         ui32ObstacleDist = ui32EchoDuration / 4640;
         // Convert the Distance Value from Integer to Array of Characters
-        char chArrayDistance[8];
-        ltoa(ui32ObstacleDist, chArrayDistance);
+        char chArrayDistance[FMT_U32_MAX];
+        uint32_t ui32DistanceLen = FMT_u32(chArrayDistance, ui32ObstacleDist);
 
-        // Transmit the distance reading to the terminal
+        // Transmit the distance reading to the terminal, unless stopped by the stream command
         uint8_t iter;
-        for (iter = 0; iter<sizeof(chArrayDistance); iter++ ) ROM_UARTCharPut(UART0_BASE, chArrayDistance[iter]);
-        for (iter = 0; iter<sizeof(ui8WelcomeText); iter++ ) ROM_UARTCharPut(UART0_BASE, ui8WelcomeText[iter]);
+        if (boolStream){
+            for (iter = 0; iter<ui32DistanceLen; iter++ ) ROM_UARTCharPut(UART0_BASE, chArrayDistance[iter]);
+            for (iter = 0; iter<sizeof(ui8WelcomeText) - 1; iter++ ) ROM_UARTCharPut(UART0_BASE, ui8WelcomeText[iter]);
+        }
 
         // Enable condition for Trigger Pulse
         boolTrigCondition = 1;
     }
 
 }
+
+void UARTIntHandler(void){
+    // ISR for UART interrupt handling
+    // Clear the asserted UART interrupts
+    ROM_UARTIntClear(UART0_BASE, ROM_UARTIntStatus(UART0_BASE, true));
+
+    // While there is a character available at input
+    while(ROM_UARTCharsAvail(UART0_BASE)){
+        // Queue the character for the shell, CMD_poll() echoes it back from the main loop
+        CMD_input(ROM_UARTCharGetNonBlocking(UART0_BASE));
+    }
+}
+
+// Function to send the output of the shell, a new line going out as CR LF
+int UART0_write(const char *pcBuf, uint32_t ui32Len){
+    uint32_t ui32Idx;
+
+    for (ui32Idx = 0; ui32Idx < ui32Len; ui32Idx++){
+        if (pcBuf[ui32Idx] == '\n') ROM_UARTCharPut(UART0_BASE, '\r');
+        ROM_UARTCharPut(UART0_BASE, pcBuf[ui32Idx]);
+    }
+    return ui32Len;
+}
+
+// Function of the dist command, printing the last distance of the obstacle
+int32_t Cmd_dist(uint32_t ui32Argc, char *ppcArgv[]){
+    char chArrayDistance[FMT_U32_MAX];
+
+    (void)ppcArgv;
+    if (ui32Argc != 1) return CMD_ERR_USAGE;
+    CMD_puts("distance ");
+    CMD_write(chArrayDistance, FMT_u32(chArrayDistance, ui32ObstacleDist));
+    CMD_puts(" cm\n");
+    return CMD_OK;
+}
+
+// Function of the stream command, starting or stopping the distances sent after each measurement
+int32_t Cmd_stream(uint32_t ui32Argc, char *ppcArgv[]){
+    if (ui32Argc != 2) return CMD_ERR_USAGE;
+    if (strcmp(ppcArgv[1], "on") == 0) boolStream = 1;
+    else if (strcmp(ppcArgv[1], "off") == 0) boolStream = 0;
+    else return CMD_ERR_USAGE;
+    return CMD_OK;
+}
@@ -0,0 +1,228 @@
+/*!
+ * @author      Yash Bansod
+ * @date        17th October 2026
+ *
+ * @brief       Host test of the debounced button events against synthetic bounce waveforms
+ * @details     The program builds the waveform of an active low switch pressed -n times
+ *              with random short and long presses and short and long gaps, adds contact
+ *              bounce at every edge (random chatter for the bounce time of the row) and
+ *              glitches (pulses of -g ms at a rate of -r per s), samples it at the tick
+ *              rate as the firmware does and feeds BTN_event.c with the samples.
+ *              The events are compared with the ones of the clean presses: a press and a
+ *              release for every press, a long press for every press held over BTN_LONG_MS
+ *              and a double press for every short press that follows a short press by
+ *              less than BTN_DOUBLE_MS. The times are kept clear of the thresholds, so
+ *              every missing, extra or late event is an error. A glitch only gets
+ *              through when it is sampled on enough ticks in a row to fill the debounce
+ *              counter, which -g 0.5 -r 2 makes happen now and then at 50 and 100 Hz.
+ *              The press counts of the former falling edge interrupt (one count per falling
+ *              edge of the raw waveform) are given for comparison.
+ *              Rows: tick rates of 50 Hz (Humper Robot Rev2 Timer0), 100 Hz (SysTick of
+ *              the other projects) and 200 and 1000 Hz against the bounce time; the exit
+ *              code is 1 if a firmware tick rate gets an error with bounce up to 10 ms.
+ *
+ * @note        Build and run from this folder:
+ *              gcc -O2 -Wall -Wextra -I"../TM4C123G LaunchPad Humper Robot Rev2" BTN_bounce.c
+ *                  "../TM4C123G LaunchPad Humper Robot Rev2/BTN_event.c" -o BTN_bounce
+ *              ./BTN_bounce
+ *              ./BTN_bounce -n 1000 -s 7
+ * @file        BTN_bounce.c
+ */
+/* -----------------------          Include Files       --------------------- */
+#include <stdio.h>                          // Library for Standard I/O
+#include <stdlib.h>                         // Standard Library
+#include <string.h>                         // Library for String functions
+#include <unistd.h>                         // Library for getopt
+#include "BTN_event.h"
+
+/* -----------------------      Macro Definitions       --------------------- */
+#define SIM_RES_US          50                      // Macro for the time step of the waveform in us
+#define SIM_PIN             4                       // Macro for the pin of the switch (SW1, PF4)
+#define SIM_EVENTS_MAX      8192                    // Macro for the most events of a run
+#define SIM_US(f64Ms)       ((uint32_t)((f64Ms) * 1000.0))
+
+/* -----------------------      Global Variables        --------------------- */
+typedef struct {
+    uint32_t ui32Start;                             // Time of the press in us
+    uint32_t ui32End;                               // Time of the release in us
+} tSimPress;
+
+typedef struct {
+    uint8_t ui8Type;                                // BTN_x event type
+    uint32_t ui32Time;                              // Time of the event in us
+} tSimEvent;
+
+static uint32_t g_ui32Presses = 200;                // Presses per run
+static double g_f64GlitchMs = 0.2;                  // Width of a glitch in ms
+static double g_f64GlitchRate = 0.5;                // Glitches per s
+static uint32_t g_ui32Seed = 1;                     // Seed of the waveforms
+
+static tSimPress g_psPress[SIM_EVENTS_MAX];
+static tSimEvent g_psExpect[SIM_EVENTS_MAX], g_psGot[SIM_EVENTS_MAX];
+static uint8_t *g_pui8Wave;                         // Pin level per time step, 1 when pressed
+static uint32_t g_ui32Steps;
+
+/* -----------------------      Function Definition     --------------------- */
+// Function to get a random number in [0, 1)
+static double SIM_rand(void){
+    return rand() / (RAND_MAX + 1.0);
+}
+
+// Function to get a random time in us between two times in ms
+static uint32_t SIM_randUs(double f64MinMs, double f64MaxMs){
+    return SIM_US(f64MinMs + (f64MaxMs - f64MinMs) * SIM_rand());
+}
+
+// Function to build the presses, the clean events and the waveform with bounce and glitches
+static uint32_t SIM_build(double f64BounceMs){
+    uint32_t ui32Time = SIM_US(500), ui32Press, ui32Expect = 0, ui32Step;
+    bool bPrevShort = false;
+
+    for (ui32Press = 0; ui32Press < g_ui32Presses; ui32Press++){
+        // Short or long press, short gap (double press) or long gap, clear of the thresholds
+        bool bLong = SIM_rand() < 0.25;
+        bool bQuick = SIM_rand() < 0.4;
+        uint32_t ui32Gap = bQuick ? SIM_randUs(120 + f64BounceMs, BTN_DOUBLE_MS * 0.6)
+                                  : SIM_randUs(BTN_DOUBLE_MS * 1.8, BTN_DOUBLE_MS * 3.0);
+        uint32_t ui32Hold = bLong ? SIM_randUs(BTN_LONG_MS * 1.4, BTN_LONG_MS * 2.5)
+                                  : SIM_randUs(80 + f64BounceMs, BTN_LONG_MS * 0.5);
+
+        if (ui32Press) ui32Time += ui32Gap;
+        g_psPress[ui32Press].ui32Start = ui32Time;
+        g_psPress[ui32Press].ui32End = ui32Time + ui32Hold;
+
+        bool bDouble = ui32Press && bQuick && bPrevShort;
+        g_psExpect[ui32Expect++] = (tSimEvent){BTN_PRESS, ui32Time};
+        if (bDouble)
+            g_psExpect[ui32Expect++] = (tSimEvent){BTN_DOUBLE, ui32Time};
+        if (bLong)
+            g_psExpect[ui32Expect++] = (tSimEvent){BTN_LONG, ui32Time + SIM_US(BTN_LONG_MS)};
+        g_psExpect[ui32Expect++] = (tSimEvent){BTN_RELEASE, ui32Time + ui32Hold};
+
+        // The release of a long or a double press does not arm the next one
+        bPrevShort = !bLong && !bDouble;
+        ui32Time += ui32Hold;
+    }
+
+    g_ui32Steps = (ui32Time + SIM_US(BTN_LONG_MS * 3)) / SIM_RES_US;
+    g_pui8Wave = realloc(g_pui8Wave, g_ui32Steps);
+    memset(g_pui8Wave, 0, g_ui32Steps);
+
+    for (ui32Press = 0; ui32Press < g_ui32Presses; ui32Press++){
+        uint32_t ui32Start = g_psPress[ui32Press].ui32Start / SIM_RES_US;
+        uint32_t ui32End = g_psPress[ui32Press].ui32End / SIM_RES_US;
+        uint32_t ui32Bounce = SIM_US(f64BounceMs) / SIM_RES_US;
+
+        memset(g_pui8Wave + ui32Start, 1, ui32End - ui32Start);
+        // Chatter after each edge, the contact makes more often as the bounce ends
+        for (ui32Step = 0; ui32Step < ui32Bounce; ui32Step++){
+            double f64Settle = (double)ui32Step / ui32Bounce;
+            if (SIM_rand() < 0.5 * (1.0 - f64Settle)) g_pui8Wave[ui32Start + ui32Step] ^= 1;
+            if (SIM_rand() < 0.5 * (1.0 - f64Settle)) g_pui8Wave[ui32End + ui32Step] ^= 1;
+        }
+    }
+
+    // Glitches of either level in the stable parts
+    if (g_f64GlitchRate > 0){
+        uint32_t ui32Width = SIM_US(g_f64GlitchMs) / SIM_RES_US;
+        double f64PerStep = g_f64GlitchRate * SIM_RES_US / 1e6;
+        for (ui32Step = 0; ui32Step + ui32Width < g_ui32Steps; ui32Step++)
+            if (SIM_rand() < f64PerStep){
+                uint32_t ui32Index;
+                uint8_t ui8Level = g_pui8Wave[ui32Step] ^ 1;
+                for (ui32Index = 0; ui32Index < ui32Width; ui32Index++)
+                    g_pui8Wave[ui32Step + ui32Index] = ui8Level;
+            }
+    }
+    return ui32Expect;
+}
+
+// Function to sample the waveform at the tick rate and check the events, returns the errors
+static uint32_t SIM_run(uint32_t ui32TickHz, double f64BounceMs, uint32_t *pui32EdgeCount, double *pf64LatencyMs){
+    uint32_t ui32Expect = SIM_build(f64BounceMs), ui32Got = 0, ui32Errors = 0;
+    uint32_t ui32TickSteps = 1000000 / ui32TickHz / SIM_RES_US;
+    uint32_t ui32Step, ui32Index;
+    double f64Latency = 0;
+    tBtnPort sBtn;
+    uint8_t ui8Event;
+
+    // The former interrupt counted every falling edge of the pin
+    *pui32EdgeCount = 0;
+    for (ui32Step = 1; ui32Step < g_ui32Steps; ui32Step++)
+        if (g_pui8Wave[ui32Step] && !g_pui8Wave[ui32Step - 1]) (*pui32EdgeCount)++;
+
+    // Tick at a random phase of the waveform
+    BTN_init(&sBtn, 1u << SIM_PIN, 1u << SIM_PIN, ui32TickHz);
+    for (ui32Step = rand() % ui32TickSteps; ui32Step < g_ui32Steps; ui32Step += ui32TickSteps){
+        BTN_sample(&sBtn, g_pui8Wave[ui32Step] ? 0 : (1u << SIM_PIN));
+        while (BTN_get(&sBtn, &ui8Event)){
+            if (BTN_PIN(ui8Event) != SIM_PIN || ui32Got >= SIM_EVENTS_MAX){
+                ui32Errors++;
+                continue;
+            }
+            g_psGot[ui32Got++] = (tSimEvent){BTN_TYPE(ui8Event), ui32Step * SIM_RES_US};
+        }
+    }
+    if (!BTN_IDLE(&sBtn) || sBtn.ui32Dropped) ui32Errors++;
+
+    // Match the events in time order: an event matches when it has the type of the clean one and comes
+    // after it by at most the debounce, two ticks and the bounce, else the earlier of the two is an error
+    double f64Max = (sBtn.ui8DebounceTicks + 2) * 1e6 / ui32TickHz + f64BounceMs * 1000.0;
+    uint32_t ui32Exp = 0;
+    ui32Index = 0;
+    while (ui32Exp < ui32Expect || ui32Index < ui32Got){
+        const tSimEvent *psExp = &g_psExpect[ui32Exp], *psGot = &g_psGot[ui32Index];
+        if (ui32Exp < ui32Expect && ui32Index < ui32Got && psGot->ui8Type == psExp->ui8Type &&
+            psGot->ui32Time >= psExp->ui32Time && psGot->ui32Time <= psExp->ui32Time + f64Max){
+            if (psGot->ui8Type == BTN_PRESS && (psGot->ui32Time - psExp->ui32Time) / 1000.0 > f64Latency)
+                f64Latency = (psGot->ui32Time - psExp->ui32Time) / 1000.0;
+            ui32Exp++;
+            ui32Index++;
+        } else if (ui32Index >= ui32Got || (ui32Exp < ui32Expect && psExp->ui32Time <= psGot->ui32Time))
+            ui32Exp++, ui32Errors++;
+        else
+            ui32Index++, ui32Errors++;
+    }
+    *pf64LatencyMs = f64Latency;
+    return ui32Errors;
+}
+
+/* -----------------------          Main Program        --------------------- */
+int main(int argc, char *argv[]){
+    static const uint32_t pui32TickHz[] = {50, 100, 200, 1000};
+    static const double pf64BounceMs[] = {0, 1, 3, 5, 10, 15};
+    uint32_t ui32Tick, ui32Bounce, ui32Edges, ui32Errors;
+    bool bFail = false;
+    double f64Latency;
+    int iOpt;
+
+    while ((iOpt = getopt(argc, argv, "n:g:r:s:")) != -1){
+        switch (iOpt){
+        case 'n': g_ui32Presses = (uint32_t)strtoul(optarg, NULL, 0); break;
+        case 'g': g_f64GlitchMs = atof(optarg); break;
+        case 'r': g_f64GlitchRate = atof(optarg); break;
+        case 's': g_ui32Seed = (uint32_t)strtoul(optarg, NULL, 0); break;
+        default:
+            printf("usage: %s [-n presses] [-g glitch ms] [-r glitches per s] [-s seed]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (g_ui32Presses == 0 || 4 * g_ui32Presses > SIM_EVENTS_MAX || g_f64GlitchMs < 0 || g_f64GlitchRate < 0){
+        printf("bad option\n");
+        return 1;
+    }
+    srand(g_ui32Seed);
+
+    printf("tick_hz,bounce_ms,presses,edge_isr_presses,event_errors,max_press_latency_ms\n");
+    for (ui32Tick = 0; ui32Tick < sizeof(pui32TickHz) / sizeof(pui32TickHz[0]); ui32Tick++)
+        for (ui32Bounce = 0; ui32Bounce < sizeof(pf64BounceMs) / sizeof(pf64BounceMs[0]); ui32Bounce++){
+            ui32Errors = SIM_run(pui32TickHz[ui32Tick], pf64BounceMs[ui32Bounce], &ui32Edges, &f64Latency);
+            printf("%u,%.0f,%u,%u,%u,%.1f\n", pui32TickHz[ui32Tick], pf64BounceMs[ui32Bounce], g_ui32Presses,
+                   ui32Edges, ui32Errors, f64Latency);
+            if (ui32Errors && pui32TickHz[ui32Tick] <= 100 && pf64BounceMs[ui32Bounce] <= 10)
+                bFail = true;
+        }
+    free(g_pui8Wave);
+    printf(bFail ? "FAIL\n" : "ok\n");
+    return bFail ? 1 : 0;
+}
@@ -0,0 +1,174 @@
+/*!
+ * @author      Yash Bansod
+ * @date        17th October 2026
+ *
+ * @brief       Host generator of the perfect hash of the commands of the UART command shell
+ * @details     The program reads the CMD_ENTRY("name", ...) lines of the CMD_table.h of a
+ *              project, puts "help" first as CMD_shell.c does, and searches the fewest
+ *              slots, a power of 2, and the first seed for which the hash of every name,
+ *              CMD_HASH_STEP() and CMD_HASH_SLOT() of CMD_shell.h, falls in a slot of its
+ *              own. It writes CMD_hash.h with the seed, the number of slot bits, the
+ *              number of commands and the command of each slot, to stdout or to -o.
+ *              Run it again whenever CMD_table.h changes.
+ *
+ * @note        Build and run from this folder:
+ *              gcc -O2 -Wall -Wextra -I"../../TM4C123G LaunchPad UART Stdio/uartStdio" CMD_hash.c -o CMD_hash
+ *              ./CMD_hash -o "../../TM4C123G LaunchPad UART/CMD_hash.h" "../../TM4C123G LaunchPad UART/CMD_table.h"
+ * @file        CMD_hash.c
+ */
+/* -----------------------          Include Files       --------------------- */
+#include <stdio.h>                          // Library for Standard I/O
+#include <stdlib.h>                         // Standard Library
+#include <string.h>                         // Library for String functions
+#include <unistd.h>                         // Library for getopt
+#include "CMD_shell.h"
+
+/* -----------------------      Macro Definitions       --------------------- */
+#define HASH_MAX_CMDS       64                      // Macro for the most commands of a table
+#define HASH_MAX_NAME       32                      // Macro for the longest command name
+#define HASH_EXTRA_BITS     3                       // Macro for the slot bits tried above the fewest
+#define HASH_SEEDS          (1u << 24)              // Macro for the seeds tried per number of slots
+
+/* -----------------------      Global Variables        --------------------- */
+static char g_ppcNames[HASH_MAX_CMDS][HASH_MAX_NAME];   // Names of the commands
+static uint32_t g_ui32Count;                        // Number of commands
+
+/* -----------------------      Function Definition     --------------------- */
+// Function to add a command name, returns 1 on error
+static int HASH_add(const char *pcName, uint32_t ui32Len){
+    uint32_t ui32Idx;
+
+    if (ui32Len == 0 || ui32Len >= HASH_MAX_NAME || g_ui32Count == HASH_MAX_CMDS){
+        fprintf(stderr, "command %.*s: empty, too long or too many\n", (int)ui32Len, pcName);
+        return 1;
+    }
+    for (ui32Idx = 0; ui32Idx < g_ui32Count; ui32Idx++){
+        if (strlen(g_ppcNames[ui32Idx]) == ui32Len && memcmp(g_ppcNames[ui32Idx], pcName, ui32Len) == 0){
+            fprintf(stderr, "command %.*s given twice\n", (int)ui32Len, pcName);
+            return 1;
+        }
+    }
+    memcpy(g_ppcNames[g_ui32Count], pcName, ui32Len);
+    g_ppcNames[g_ui32Count++][ui32Len] = 0;
+    return 0;
+}
+
+// Function to read the names of the CMD_ENTRY() lines of a table, returns 1 on error
+static int HASH_read(const char *pcPath){
+    char pcLine[512], *pcStart, *pcEnd;
+    FILE *psFile = fopen(pcPath, "r");
+
+    if (!psFile){
+        perror(pcPath);
+        return 1;
+    }
+    if (HASH_add("help", 4)) return 1;
+    while (fgets(pcLine, sizeof(pcLine), psFile)){
+        pcStart = pcLine + strspn(pcLine, " \t");
+        if (strncmp(pcStart, "CMD_ENTRY(", 10) != 0) continue;
+        pcStart = strchr(pcStart, '"');
+        pcEnd = pcStart ? strchr(pcStart + 1, '"') : NULL;
+        if (!pcEnd){
+            fprintf(stderr, "%s: no quoted name in %s", pcPath, pcLine);
+            fclose(psFile);
+            return 1;
+        }
+        if (HASH_add(pcStart + 1, (uint32_t)(pcEnd - pcStart - 1))){
+            fclose(psFile);
+            return 1;
+        }
+    }
+    fclose(psFile);
+    return 0;
+}
+
+// Function to hash a name from a seed
+static uint32_t HASH_name(const char *pcName, uint32_t ui32Seed){
+    uint32_t ui32Hash = ui32Seed;
+
+    while (*pcName) ui32Hash = CMD_HASH_STEP(ui32Hash, *pcName++);
+    return ui32Hash;
+}
+
+// Function to fill the slots of a seed, returns 1 if every command has a slot of its own
+static int HASH_try(uint32_t ui32Seed, uint32_t ui32Bits, uint8_t *pui8Slots){
+    uint32_t ui32Idx, ui32Slot;
+
+    memset(pui8Slots, CMD_HASH_EMPTY, 1u << ui32Bits);
+    for (ui32Idx = 0; ui32Idx < g_ui32Count; ui32Idx++){
+        ui32Slot = CMD_HASH_SLOT(HASH_name(g_ppcNames[ui32Idx], ui32Seed), ui32Bits);
+        if (pui8Slots[ui32Slot] != CMD_HASH_EMPTY) return 0;
+        pui8Slots[ui32Slot] = (uint8_t)ui32Idx;
+    }
+    return 1;
+}
+
+/* -----------------------          Main Program        --------------------- */
+int main(int argc, char *argv[]){
+    uint8_t pui8Slots[1u << 10];
+    uint32_t ui32Bits, ui32Fewest = 1, ui32Seed, ui32Idx;
+    const char *pcOut = NULL;
+    FILE *psOut = stdout;
+    int iOpt;
+
+    while ((iOpt = getopt(argc, argv, "o:")) != -1){
+        switch (iOpt){
+        case 'o': pcOut = optarg; break;
+        default:
+            fprintf(stderr, "usage: %s [-o CMD_hash.h] CMD_table.h\n", argv[0]);
+            return 1;
+        }
+    }
+    if (optind != argc - 1){
+        fprintf(stderr, "usage: %s [-o CMD_hash.h] CMD_table.h\n", argv[0]);
+        return 1;
+    }
+    if (HASH_read(argv[optind])) return 1;
+
+    // The fewest slots first, then the first seed that separates every name
+    while ((1u << ui32Fewest) < g_ui32Count) ui32Fewest++;
+    for (ui32Bits = ui32Fewest; ui32Bits <= ui32Fewest + HASH_EXTRA_BITS; ui32Bits++){
+        for (ui32Seed = 0; ui32Seed < HASH_SEEDS; ui32Seed++)
+            if (HASH_try(ui32Seed, ui32Bits, pui8Slots)) break;
+        if (ui32Seed < HASH_SEEDS) break;
+    }
+    if (ui32Bits > ui32Fewest + HASH_EXTRA_BITS){
+        fprintf(stderr, "no perfect hash found for %u commands\n", g_ui32Count);
+        return 1;
+    }
+
+    if (pcOut && !(psOut = fopen(pcOut, "w"))){
+        perror(pcOut);
+        return 1;
+    }
+    fprintf(psOut, "/*!\n"
+                   " * @brief       Perfect hash of the commands of CMD_table.h\n"
+                   " * @details     Written by other_codes/Host Tools/CMD_hash.c from CMD_table.h, do\n"
+                   " *              not edit. The commands, in the order of their numbers:\n"
+                   " *             ");
+    for (ui32Idx = 0; ui32Idx < g_ui32Count; ui32Idx++) fprintf(psOut, " %s", g_ppcNames[ui32Idx]);
+    fprintf(psOut, "\n"
+                   " * @file        CMD_hash.h\n"
+                   " */\n"
+                   "#ifndef CMD_HASH_H_\n"
+                   "#define CMD_HASH_H_\n"
+                   "\n"
+                   "#define CMD_HASH_SEED       0x%08Xu             // Macro for the first value of the hash\n"
+                   "#define CMD_HASH_BITS       %-24u// Macro for the 2^N slots of the hash\n"
+                   "#define CMD_HASH_COUNT      %-24u// Macro for the number of commands\n"
+                   "\n"
+                   "// Macro for the command of each slot\n"
+                   "#define CMD_HASH_SLOTS      {",
+            ui32Seed, ui32Bits, g_ui32Count);
+    for (ui32Idx = 0; ui32Idx < (1u << ui32Bits); ui32Idx++){
+        if (ui32Idx) fprintf(psOut, ", ");
+        if (pui8Slots[ui32Idx] == CMD_HASH_EMPTY) fprintf(psOut, "CMD_HASH_EMPTY");
+        else fprintf(psOut, "%u", pui8Slots[ui32Idx]);
+    }
+    fprintf(psOut, "}\n"
+                   "\n"
+                   "#endif /* CMD_HASH_H_ */\n");
+    if (pcOut) fclose(psOut);
+    fprintf(stderr, "%u commands in %u slots, seed 0x%08X\n", g_ui32Count, 1u << ui32Bits, ui32Seed);
+    return 0;
+}
@@ -0,0 +1,395 @@
+/*!
+ * @author      Yash Bansod
+ * @date        17th October 2026
+ *
+ * @brief       Host harness of the UART command shell with a pseudo-terminal stand-in
+ * @details     The program compiles CMD_shell.c with the CMD_table.h and CMD_hash.h of
+ *              the UART Stdio project, its commands replaced by stubs recording their
+ *              words, and types a script into CMD_input() one key at a time, as the
+ *              UART interrupt handler does, calling CMD_poll() after each key as the
+ *              main loop does. The output of the shell is drawn on a terminal stand-in
+ *              that moves its cursor on backspace, so the line on the screen is the one
+ *              the user sees. Each script line is typed and ended by a CR; in it \t is
+ *              Tab, \b backspace, \d DEL, \c Ctrl-C, \e ESC, \n a LF and \\ a backslash.
+ *              A line may end with "#=> expected", the expected result being
+ *                  name argc [word|word...]    the command run, its word count and words
+ *                  unknown, words or usage     the error printed by the shell
+ *                  none                        nothing run, for an empty line
+ *              and the exit code is 1 on any mismatch. Without a script file the
+ *              built-in one below checks the line discipline, the quoting, the
+ *              completion and the errors. For each line run, the dispatch latency is
+ *              the time of CMD_run() on the line as it stands on the screen, splitting
+ *              it in place, hashing and comparing its name and calling an empty stub,
+ *              and the time of finding its name alone, with the hash and the slots of
+ *              CMD_hash.h and one strcmp(), set against a strcmp() scan of the names in
+ *              table order, which grows with the table where the hash does not.
+ *              -v prints the screen, -i runs the shell on the terminal in raw mode,
+ *              Ctrl-D leaving it.
+ *
+ * @note        Build and run from this folder:
+ *              gcc -O2 -Wall -Wextra -I"../../TM4C123G LaunchPad UART Stdio"
+ *                  -I"../../TM4C123G LaunchPad UART Stdio/uartStdio" CMD_pty.c
+ *                  "../../TM4C123G LaunchPad UART Stdio/uartStdio/CMD_shell.c" -o CMD_pty
+ *              ./CMD_pty
+ *              ./CMD_pty -v script.txt
+ * @file        CMD_pty.c
+ */
+/* -----------------------          Include Files       --------------------- */
+#include <stdio.h>                          // Library for Standard I/O
+#include <stdlib.h>                         // Standard Library
+#include <string.h>                         // Library for String functions
+#include <unistd.h>                         // Library for getopt
+#include <termios.h>                        // Library for the raw mode of the terminal
+#include <time.h>                           // Library for clock_gettime
+#include "CMD_shell.h"
+#include "CMD_hash.h"
+
+/* -----------------------      Macro Definitions       --------------------- */
+#define PTY_COLUMNS         128                     // Macro for the columns of the screen
+#define PTY_RECORD          256                     // Macro for the words recorded of a command
+#define PTY_RUNS            200000                  // Macro for the runs of a line timed
+#define PTY_ROUNDS          3                       // Macro for the rounds of runs, the best one kept
+#define PTY_LATENCIES       64                      // Macro for the lines timed
+
+/* -----------------------      Global Variables        --------------------- */
+// The names in table order, for the lookups timed
+static const uint8_t g_pui8PtySlots[1 << CMD_HASH_BITS] = CMD_HASH_SLOTS;
+static const char *g_ppcPtyNames[] = {
+    "help",
+#define CMD_ENTRY(pcName, pfnCmd, pcHelp)   pcName,
+#include "CMD_table.h"
+#undef CMD_ENTRY
+};
+#define PTY_NAMES           (sizeof(g_ppcPtyNames) / sizeof(g_ppcPtyNames[0]))
+
+static char g_pcPtyScreen[PTY_COLUMNS + 1];         // Line under the cursor of the screen
+static uint32_t g_ui32PtyCursor;                    // Column of the cursor
+static uint32_t g_ui32PtyEnd;                       // Columns written on the line
+static char g_pcPtyOutput[4096];                    // Output of the shell for the current line
+static uint32_t g_ui32PtyOutput;                    // Characters in g_pcPtyOutput
+static bool g_bPtyVerbose;                          // Print the screen
+static bool g_bPtyRaw;                              // Write the output to the real terminal
+static bool g_bPtyQuiet;                            // Stubs record nothing, for the timing
+static char g_pcPtyRun[PTY_RECORD];                 // Record of the last command run
+static uint32_t g_ui32PtyErrors;                    // Mismatches found
+
+static struct {
+    char pcLine[PTY_COLUMNS];                       // Line as it stood on the screen
+    double f64Run, f64Hash, f64Scan;                // ns of CMD_run(), the hash and the strcmp() scan
+} g_psPtyTime[PTY_LATENCIES];
+static uint32_t g_ui32PtyTimes;                     // Lines timed
+
+// The script run without a file
+static const char *g_pcPtyScript =
+    "help #=> help 1\n"
+    "echo one \"two words\" three #=> echo 4 one|two words|three\n"
+    "   echo    spaced   #=> echo 2 spaced\n"
+    "echo \"\" #=> echo 2 \n"
+    "ec\\t x #=> echo 2 x\n"
+    "\\t #=> none\n"
+    "c\\t #=> clock 1\n"
+    "bl\\t 20 #=> blink 2 20\n"
+    "blinkx\\b 5 #=> blink 2 5\n"
+    "blink 5x\\d\\d7 #=> blink 2 7\n"
+    "blink #=> usage\n"
+    "blink 2000 #=> usage\n"
+    "clock now #=> usage\n"
+    "clocks #=> unknown\n"
+    "lo\\t on #=> log 2 on\n"
+    "log maybe #=> usage\n"
+    "hel #=> unknown\n"
+    "xyz\\t #=> unknown\n"
+    "echo 1 2 3 4 5 6 7 #=> echo 8 1|2|3|4|5|6|7\n"
+    "echo 1 2 3 4 5 6 7 8 #=> words\n"
+    "echo gone\\c #=> none\n"
+    "\\e[Aecho arrow\\e[D #=> echo 2 arrow\n"
+    "echo crlf\\n #=> echo 2 crlf\n"
+    "#=> none\n";
+
+/* -----------------------      Function Definition     --------------------- */
+// Function to get the time in s
+static double PTY_now(void){
+    struct timespec sTime;
+
+    clock_gettime(CLOCK_MONOTONIC, &sTime);
+    return sTime.tv_sec + sTime.tv_nsec * 1e-9;
+}
+
+// Function to draw the output of the shell on the screen, the write function of CMD_init()
+static int PTY_write(const char *pcBuf, uint32_t ui32Len){
+    uint32_t ui32Idx;
+    char cChar;
+
+    if (g_bPtyQuiet) return (int)ui32Len;
+    for (ui32Idx = 0; ui32Idx < ui32Len; ui32Idx++){
+        cChar = pcBuf[ui32Idx];
+        if (g_bPtyRaw){
+            if (cChar == '\n') putchar('\r');
+            putchar(cChar);
+            continue;
+        }
+        if (g_ui32PtyOutput < sizeof(g_pcPtyOutput) - 1) g_pcPtyOutput[g_ui32PtyOutput++] = cChar;
+        if (cChar == '\n'){
+            g_pcPtyScreen[g_ui32PtyEnd] = 0;
+            if (g_bPtyVerbose) printf("  | %s\n", g_pcPtyScreen);
+            g_ui32PtyCursor = g_ui32PtyEnd = 0;
+        }
+        else if (cChar == '\b'){
+            if (g_ui32PtyCursor) g_ui32PtyCursor--;
+        }
+        else if ((uint8_t)cChar >= ' ' && g_ui32PtyCursor < PTY_COLUMNS){
+            g_pcPtyScreen[g_ui32PtyCursor++] = cChar;
+            if (g_ui32PtyCursor > g_ui32PtyEnd) g_ui32PtyEnd = g_ui32PtyCursor;
+        }
+    }
+    if (g_bPtyRaw) fflush(stdout);
+    return (int)ui32Len;
+}
+
+// Function to record a command run, its name, word count and words
+static int32_t PTY_record(uint32_t ui32Argc, char *ppcArgv[]){
+    uint32_t ui32Idx, ui32Pos;
+
+    if (g_bPtyQuiet) return CMD_OK;
+    ui32Pos = (uint32_t)snprintf(g_pcPtyRun, sizeof(g_pcPtyRun), "%s %u ", ppcArgv[0], ui32Argc);
+    for (ui32Idx = 1; ui32Idx < ui32Argc && ui32Pos < sizeof(g_pcPtyRun); ui32Idx++)
+        ui32Pos += (uint32_t)snprintf(g_pcPtyRun + ui32Pos, sizeof(g_pcPtyRun) - ui32Pos, "%s%s",
+                                      ui32Idx > 1 ? "|" : "", ppcArgv[ui32Idx]);
+    return CMD_OK;
+}
+
+// Function of the stub of the blink command, which takes one number up to 1000
+int32_t Cmd_blink(uint32_t ui32Argc, char *ppcArgv[]){
+    char *pcEnd;
+
+    if (ui32Argc != 2 || strtoul(ppcArgv[1], &pcEnd, 10) > 1000 || pcEnd == ppcArgv[1] || *pcEnd)
+        return CMD_ERR_USAGE;
+    return PTY_record(ui32Argc, ppcArgv);
+}
+
+// Function of the stub of the clock command, which takes no word
+int32_t Cmd_clock(uint32_t ui32Argc, char *ppcArgv[]){
+    if (ui32Argc != 1) return CMD_ERR_USAGE;
+    return PTY_record(ui32Argc, ppcArgv);
+}
+
+// Function of the stub of the log command, which takes on or off
+int32_t Cmd_log(uint32_t ui32Argc, char *ppcArgv[]){
+    if (ui32Argc != 2 || (strcmp(ppcArgv[1], "on") != 0 && strcmp(ppcArgv[1], "off") != 0))
+        return CMD_ERR_USAGE;
+    return PTY_record(ui32Argc, ppcArgv);
+}
+
+// Function of the stub of the echo command
+int32_t Cmd_echo(uint32_t ui32Argc, char *ppcArgv[]){
+    uint32_t ui32Idx;
+
+    if (!g_bPtyQuiet){
+        for (ui32Idx = 1; ui32Idx < ui32Argc; ui32Idx++){
+            CMD_write("[", 1);
+            CMD_puts(ppcArgv[ui32Idx]);
+            CMD_write("] ", 2);
+        }
+        CMD_write("\n", 1);
+    }
+    return PTY_record(ui32Argc, ppcArgv);
+}
+
+// Function to time CMD_run() on a line and the strcmp() scan of its first word
+static void PTY_time(const char *pcLine){
+    static volatile uint32_t ui32Sink;
+    char pcRun[CMD_LINE_SIZE], pcName[CMD_LINE_SIZE];
+    const char *volatile pcProbe = pcName;          // Read each run, so that the scan is not hoisted
+    const char *pcChar;
+    uint32_t ui32Round, ui32Run, ui32Idx, ui32Hash, ui32Len = strlen(pcLine) + 1;
+    double f64Start, f64Copy, pf64Best[3] = {1e9, 1e9, 1e9};
+
+    if (g_ui32PtyTimes == PTY_LATENCIES || ui32Len > CMD_LINE_SIZE) return;
+    sscanf(pcLine, "%s", pcName);
+    g_bPtyQuiet = true;
+
+    // The best of a few rounds, the others being taken by the scheduler or the caches
+    for (ui32Round = 0; ui32Round < PTY_ROUNDS; ui32Round++){
+        // The copy of the line before each run, to take off the time of the runs
+        f64Start = PTY_now();
+        for (ui32Run = 0; ui32Run < PTY_RUNS; ui32Run++){
+            memcpy(pcRun, pcLine, ui32Len);
+            ui32Sink += (uint8_t)pcRun[ui32Run % ui32Len];
+        }
+        f64Copy = PTY_now() - f64Start;
+
+        f64Start = PTY_now();
+        for (ui32Run = 0; ui32Run < PTY_RUNS; ui32Run++){
+            memcpy(pcRun, pcLine, ui32Len);
+            ui32Sink += (uint32_t)CMD_run(pcRun);
+        }
+        f64Start = PTY_now() - f64Start - f64Copy;
+        if (f64Start < pf64Best[0]) pf64Best[0] = f64Start;
+
+        f64Start = PTY_now();
+        for (ui32Run = 0; ui32Run < PTY_RUNS; ui32Run++){
+            ui32Hash = CMD_HASH_SEED;
+            for (pcChar = pcProbe; *pcChar; pcChar++) ui32Hash = CMD_HASH_STEP(ui32Hash, *pcChar);
+            ui32Idx = g_pui8PtySlots[CMD_HASH_SLOT(ui32Hash, CMD_HASH_BITS)];
+            ui32Sink += ui32Idx != CMD_HASH_EMPTY && strcmp(pcProbe, g_ppcPtyNames[ui32Idx]) == 0;
+        }
+        f64Start = PTY_now() - f64Start;
+        if (f64Start < pf64Best[1]) pf64Best[1] = f64Start;
+
+        f64Start = PTY_now();
+        for (ui32Run = 0; ui32Run < PTY_RUNS; ui32Run++){
+            for (ui32Idx = 0; ui32Idx < PTY_NAMES && strcmp(pcProbe, g_ppcPtyNames[ui32Idx]); ui32Idx++){
+            }
+            ui32Sink += ui32Idx;
+        }
+        f64Start = PTY_now() - f64Start;
+        if (f64Start < pf64Best[2]) pf64Best[2] = f64Start;
+    }
+
+    g_bPtyQuiet = false;
+    strcpy(g_psPtyTime[g_ui32PtyTimes].pcLine, pcLine);
+    g_psPtyTime[g_ui32PtyTimes].f64Run = pf64Best[0] * 1e9 / PTY_RUNS;
+    g_psPtyTime[g_ui32PtyTimes].f64Hash = pf64Best[1] * 1e9 / PTY_RUNS;
+    g_psPtyTime[g_ui32PtyTimes++].f64Scan = pf64Best[2] * 1e9 / PTY_RUNS;
+}
+
+// Function to type a key, running the line it ends
+static void PTY_key(char cKey){
+    CMD_input(cKey);
+    CMD_poll();
+}
+
+// Function to type a script line and check its result
+static void PTY_line(char *pcLine, uint32_t ui32Number){
+    char pcGot[PTY_RECORD], pcTyped[PTY_COLUMNS + 1], *pcExpect = strstr(pcLine, "#=>");
+    uint32_t ui32Prompt = strlen(CMD_PROMPT), ui32Len;
+    bool bLF = false;
+
+    // The keys end before the spaces ahead of the expected result
+    if (pcExpect){
+        ui32Len = (uint32_t)(pcExpect - pcLine);
+        while (ui32Len && pcLine[ui32Len - 1] == ' ') ui32Len--;
+        pcLine[ui32Len] = 0;
+        pcExpect += 3;
+        pcExpect += strspn(pcExpect, " ");
+    }
+    if (g_bPtyVerbose) printf("%3u: %s\n", ui32Number, pcLine);
+
+    // Type the keys, up to a LF
+    g_pcPtyRun[0] = 0;
+    g_ui32PtyOutput = 0;
+    while (*pcLine && !bLF){
+        if (*pcLine != '\\' || !pcLine[1]){
+            PTY_key(*pcLine++);
+            continue;
+        }
+        switch (pcLine[1]){
+        case 't': PTY_key('\t'); break;
+        case 'b': PTY_key('\b'); break;
+        case 'd': PTY_key(0x7F); break;
+        case 'c': PTY_key(0x03); break;
+        case 'e': PTY_key(0x1B); break;
+        case 'n': bLF = true; break;
+        default: PTY_key(pcLine[1]); break;
+        }
+        pcLine += 2;
+    }
+
+    // The line on the screen is the one CMD_run() gets once CR, and a LF, end it
+    g_pcPtyScreen[g_ui32PtyEnd] = 0;
+    snprintf(pcTyped, sizeof(pcTyped), "%s", g_ui32PtyEnd >= ui32Prompt ? g_pcPtyScreen + ui32Prompt : "");
+    PTY_key('\r');
+    if (bLF) PTY_key('\n');
+    g_pcPtyOutput[g_ui32PtyOutput] = 0;
+
+    // The result: the command recorded, or the error printed
+    if (strstr(g_pcPtyOutput, "\nhelp: ")) strcpy(pcGot, "help 1");
+    else if (g_pcPtyRun[0]) snprintf(pcGot, sizeof(pcGot), "%s", g_pcPtyRun);
+    else if (strstr(g_pcPtyOutput, "unknown command")) strcpy(pcGot, "unknown");
+    else if (strstr(g_pcPtyOutput, "too many words")) strcpy(pcGot, "words");
+    else if (strstr(g_pcPtyOutput, "usage:")) strcpy(pcGot, "usage");
+    else strcpy(pcGot, "none");
+    if (strcmp(pcGot, "none") != 0 && strcmp(pcGot, "unknown") != 0) PTY_time(pcTyped);
+
+    // A record ends with the space after the word count when there is no word
+    if (pcExpect){
+        ui32Len = strlen(pcGot);
+        if (ui32Len && pcGot[ui32Len - 1] == ' ') pcGot[ui32Len - 1] = 0;
+        ui32Len = strlen(pcExpect);
+        while (ui32Len && pcExpect[ui32Len - 1] == ' ') pcExpect[--ui32Len] = 0;
+        if (strcmp(pcGot, pcExpect) != 0){
+            printf("line %u: got \"%s\", want \"%s\"\n", ui32Number, pcGot, pcExpect);
+            g_ui32PtyErrors++;
+        }
+    }
+}
+
+// Function to run the shell on the terminal until Ctrl-D
+static int PTY_interactive(void){
+    struct termios sSaved, sRaw;
+    int iChar;
+
+    if (tcgetattr(0, &sSaved) != 0){
+        perror("tcgetattr");
+        return 1;
+    }
+    sRaw = sSaved;
+    cfmakeraw(&sRaw);
+    tcsetattr(0, TCSANOW, &sRaw);
+    g_bPtyRaw = true;
+    PTY_write("Ctrl-D leaves\n", 14);
+    CMD_init(PTY_write);
+    while ((iChar = getchar()) != EOF && iChar != 0x04) PTY_key((char)iChar);
+    tcsetattr(0, TCSANOW, &sSaved);
+    putchar('\n');
+    return 0;
+}
+
+/* -----------------------          Main Program        --------------------- */
+int main(int argc, char *argv[]){
+    char pcLine[512];
+    const char *pcScript = g_pcPtyScript, *pcNext;
+    uint32_t ui32Number = 0, ui32Idx, ui32Len;
+    FILE *psFile = NULL;
+    int iOpt;
+
+    while ((iOpt = getopt(argc, argv, "vi")) != -1){
+        switch (iOpt){
+        case 'v': g_bPtyVerbose = true; break;
+        case 'i': return PTY_interactive();
+        default:
+            fprintf(stderr, "usage: %s [-v] [-i] [script]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (optind < argc && !(psFile = fopen(argv[optind], "r"))){
+        perror(argv[optind]);
+        return 1;
+    }
+
+    CMD_init(PTY_write);
+    while (1){
+        if (psFile){
+            if (!fgets(pcLine, sizeof(pcLine), psFile)) break;
+        }
+        else{
+            if (!*pcScript) break;
+            pcNext = strchr(pcScript, '\n');
+            ui32Len = pcNext ? (uint32_t)(pcNext - pcScript) : strlen(pcScript);
+            memcpy(pcLine, pcScript, ui32Len);
+            pcLine[ui32Len] = 0;
+            pcScript += ui32Len + (pcNext != NULL);
+        }
+        ui32Len = strlen(pcLine);
+        while (ui32Len && (pcLine[ui32Len - 1] == '\n' || pcLine[ui32Len - 1] == '\r')) pcLine[--ui32Len] = 0;
+        PTY_line(pcLine, ++ui32Number);
+    }
+    if (psFile) fclose(psFile);
+
+    printf("%u lines, %u mismatches\n", ui32Number, g_ui32PtyErrors);
+    printf("%-36s %10s %12s %12s\n", "line run, ns", "CMD_run", "hash lookup", "strcmp scan");
+    for (ui32Idx = 0; ui32Idx < g_ui32PtyTimes; ui32Idx++)
+        printf("%-36s %10.1f %12.1f %12.1f\n", g_psPtyTime[ui32Idx].pcLine, g_psPtyTime[ui32Idx].f64Run,
+               g_psPtyTime[ui32Idx].f64Hash, g_psPtyTime[ui32Idx].f64Scan);
+    return g_ui32PtyErrors ? 1 : 0;
+}
@@ -0,0 +1,401 @@
+/*!
+ * @author      Yash Bansod
+ * @date        17th October 2026
+ *
+ * @brief       Host equivalence test and benchmark of the number conversions of uartstdio (UART Stdio)
+ * @details     The exhaustive test runs every 32 bit value through FMT_num.c and checks
+ *              the characters and the returned length of
+ *              FMT_u32()   against a decimal counter incremented along with the value,
+ *              FMT_i32()   against the same counter for the positive values and a
+ *                          counter decremented from 2^31 for the negative ones,
+ *              FMT_x32()   against a hexadecimal counter,
+ *              FMT_uq()    in Q16 with 3 decimals, against a counter of the integer part
+ *                          and a table of the 65536 fractions rounded half away from 0.
+ *              The counters only add or take 1, so they share no code or arithmetic
+ *              with the conversions. A random test then checks FMT_i32() and FMT_q()
+ *              for every number of fractional bits and decimals against snprintf(),
+ *              the ties of the rounding (where snprintf() rounds to even) against
+ *              exact integer arithmetic, and the \%d, \%u, \%x and \%q output of
+ *              UARTprintf() of the unbuffered uartstdio.c, for widths of 0 to 20 with
+ *              space and zero fill, against the former divide-per-digit conversion of
+ *              UARTvprintf(). The benchmark times the former conversion, FMT_u32() and
+ *              snprintf() on uniform 32 bit values and on values below 10000.
+ *              The exit code is 1 on any mismatch. -q skips the exhaustive test.
+ *
+ * @note        Build and run from this folder:
+ *              gcc -O2 -Wall -Wextra -DHOST_SIM -I. -I"../../TM4C123G LaunchPad UART Stdio/uartStdio"
+ *                  FMT_check.c "../../TM4C123G LaunchPad UART Stdio/uartStdio/FMT_num.c"
+ *                  "../../TM4C123G LaunchPad UART Stdio/uartStdio/uartstdio.c" -o FMT_check
+ *              ./FMT_check
+ *              ./FMT_check -q -n 10000000
+ * @file        FMT_check.c
+ */
+/* -----------------------          Include Files       --------------------- */
+#include <stdio.h>                          // Library for Standard I/O
+#include <stdlib.h>                         // Standard Library
+#include <string.h>                         // Library for String functions
+#include <unistd.h>                         // Library for getopt
+#include <time.h>                           // Library for clock_gettime
+#include "HOST_uart.h"
+#include "uartstdio.h"
+#include "FMT_num.h"
+
+/* -----------------------      Macro Definitions       --------------------- */
+#define CHECK_DIGITS        10                      // Macro for the digits of a decimal counter
+#define CHECK_OUT_MAX       128                     // Macro for the longest UARTprintf() output checked
+#define CHECK_REPORT        10                      // Macro for the mismatches printed per test
+#define BENCH_VALUES        4096                    // Macro for the values of a benchmark round
+
+/* -----------------------      Global Variables        --------------------- */
+typedef struct {
+    char pcDigit[CHECK_DIGITS];                     // Digits, right aligned
+    uint32_t ui32Start;                             // Index of the first digit
+} tCounter;
+
+static char g_pcOut[CHECK_OUT_MAX];                 // Output of UARTprintf()
+static uint32_t g_ui32Out;                          // Characters in g_pcOut
+static uint64_t g_ui64Errors;                       // Mismatches found
+static uint32_t g_ui32Samples = 2000000;            // Values of the random test
+static uint32_t g_ui32Seed = 1;                     // State of the random values
+
+/* -----------------------      Function Definition     --------------------- */
+// Function of the UART of HOST_uart.h, collecting the output of UARTprintf()
+void HOST_uartPut(unsigned char ucData){
+    if (g_ui32Out < CHECK_OUT_MAX) g_pcOut[g_ui32Out++] = (char)ucData;
+}
+
+// Function of the UART of HOST_uart.h, nothing is received
+int32_t HOST_uartGet(void){
+    return '\r';
+}
+
+// Function to get the time in s
+static double CHECK_now(void){
+    struct timespec sTime;
+
+    clock_gettime(CLOCK_MONOTONIC, &sTime);
+    return sTime.tv_sec + sTime.tv_nsec * 1e-9;
+}
+
+// Function to get a random 32 bit value
+static uint32_t CHECK_rand(void){
+    g_ui32Seed ^= g_ui32Seed << 13;
+    g_ui32Seed ^= g_ui32Seed >> 17;
+    g_ui32Seed ^= g_ui32Seed << 5;
+    return g_ui32Seed;
+}
+
+// Function to count a mismatch, printing the first ones of a test
+static void CHECK_fail(const char *pcTest, uint32_t ui32Value, const char *pcGot, uint32_t ui32Got,
+                       const char *pcWant, uint32_t ui32Want){
+    static const char *pcLast;
+    static uint32_t ui32Shown;
+
+    g_ui64Errors++;
+    if (pcTest != pcLast){
+        pcLast = pcTest;
+        ui32Shown = 0;
+    }
+    if (ui32Shown++ < CHECK_REPORT)
+        printf("  %s 0x%08x: got \"%.*s\" (%u), want \"%.*s\" (%u)\n", pcTest, ui32Value,
+               (int)ui32Got, pcGot, ui32Got, (int)ui32Want, pcWant, ui32Want);
+}
+
+// Function to compare an output with the expected one
+static void CHECK_same(const char *pcTest, uint32_t ui32Value, const char *pcGot, uint32_t ui32Got,
+                       const char *pcWant, uint32_t ui32Want){
+    if (ui32Got != ui32Want || memcmp(pcGot, pcWant, ui32Want) != 0)
+        CHECK_fail(pcTest, ui32Value, pcGot, ui32Got, pcWant, ui32Want);
+}
+
+// Function to set a counter to a value
+static void CHECK_counterSet(tCounter *psCnt, uint32_t ui32Value){
+    uint32_t ui32Idx = CHECK_DIGITS;
+
+    memset(psCnt->pcDigit, '0', CHECK_DIGITS);
+    do{
+        psCnt->pcDigit[--ui32Idx] = (char)('0' + ui32Value % 10);
+        ui32Value /= 10;
+    } while (ui32Value);
+    psCnt->ui32Start = ui32Idx;
+}
+
+// Function to add 1 to a counter
+static void CHECK_counterUp(tCounter *psCnt){
+    uint32_t ui32Idx = CHECK_DIGITS - 1;
+
+    while (psCnt->pcDigit[ui32Idx] == '9' && ui32Idx){
+        psCnt->pcDigit[ui32Idx--] = '0';
+    }
+    psCnt->pcDigit[ui32Idx]++;
+    if (ui32Idx < psCnt->ui32Start) psCnt->ui32Start = ui32Idx;
+}
+
+// Function to take 1 from a counter above 0
+static void CHECK_counterDown(tCounter *psCnt){
+    uint32_t ui32Idx = CHECK_DIGITS - 1;
+
+    while (psCnt->pcDigit[ui32Idx] == '0'){
+        psCnt->pcDigit[ui32Idx--] = '9';
+    }
+    psCnt->pcDigit[ui32Idx]--;
+    if (psCnt->pcDigit[psCnt->ui32Start] == '0' && psCnt->ui32Start < CHECK_DIGITS - 1) psCnt->ui32Start++;
+}
+
+// Function to add 1 to a hexadecimal counter of 8 digits, returns the index of its first digit
+static uint32_t CHECK_hexUp(char *pcHex, uint32_t ui32Start){
+    uint32_t ui32Idx = 7;
+
+    while (pcHex[ui32Idx] == 'f' && ui32Idx){
+        pcHex[ui32Idx--] = '0';
+    }
+    pcHex[ui32Idx] = (pcHex[ui32Idx] == '9') ? 'a' : (char)(pcHex[ui32Idx] + 1);
+    return ui32Idx < ui32Start ? ui32Idx : ui32Start;
+}
+
+// Function to run every 32 bit value through the conversions
+static void CHECK_exhaustive(void){
+    static char pcFrac[65536][3];
+    static uint8_t pui8Carry[65536];
+    tCounter sUp, sNeg, sInt, sIntNext;
+    char pcGot[FMT_Q_MAX], pcWant[FMT_Q_MAX + 2], pcHex[8];
+    uint32_t ui32Value = 0, ui32Len, ui32HexStart = 7, ui32Frac, ui32Dec;
+    uint64_t ui64Errors = g_ui64Errors;
+    double f64Start = CHECK_now();
+
+    // The 3 decimals of each Q16 fraction, rounded half away from zero
+    for (ui32Frac = 0; ui32Frac < 65536; ui32Frac++){
+        ui32Dec = (ui32Frac * 1000u + 32768u) >> 16;
+        pui8Carry[ui32Frac] = ui32Dec == 1000;
+        if (ui32Dec == 1000) ui32Dec = 0;
+        pcFrac[ui32Frac][0] = (char)('0' + ui32Dec / 100);
+        pcFrac[ui32Frac][1] = (char)('0' + ui32Dec / 10 % 10);
+        pcFrac[ui32Frac][2] = (char)('0' + ui32Dec % 10);
+    }
+
+    CHECK_counterSet(&sUp, 0);
+    CHECK_counterSet(&sNeg, 0x80000000u);
+    CHECK_counterSet(&sInt, 0);
+    CHECK_counterSet(&sIntNext, 1);
+    memset(pcHex, '0', sizeof(pcHex));
+
+    do{
+        // Unsigned decimal
+        ui32Len = FMT_u32(pcGot, ui32Value);
+        CHECK_same("FMT_u32", ui32Value, pcGot, ui32Len, sUp.pcDigit + sUp.ui32Start, CHECK_DIGITS - sUp.ui32Start);
+
+        // Signed decimal
+        ui32Len = FMT_i32(pcGot, (int32_t)ui32Value);
+        if (ui32Value < 0x80000000u)
+            CHECK_same("FMT_i32", ui32Value, pcGot, ui32Len, sUp.pcDigit + sUp.ui32Start, CHECK_DIGITS - sUp.ui32Start);
+        else{
+            pcWant[0] = '-';
+            memcpy(pcWant + 1, sNeg.pcDigit + sNeg.ui32Start, CHECK_DIGITS - sNeg.ui32Start);
+            CHECK_same("FMT_i32", ui32Value, pcGot, ui32Len, pcWant, 1 + CHECK_DIGITS - sNeg.ui32Start);
+            CHECK_counterDown(&sNeg);
+        }
+
+        // Hexadecimal
+        ui32Len = FMT_x32(pcGot, ui32Value);
+        CHECK_same("FMT_x32", ui32Value, pcGot, ui32Len, pcHex + ui32HexStart, 8 - ui32HexStart);
+
+        // Q16 with 3 decimals
+        {
+            const tCounter *psInt = pui8Carry[ui32Value & 0xFFFF] ? &sIntNext : &sInt;
+            uint32_t ui32IntLen = CHECK_DIGITS - psInt->ui32Start;
+
+            memcpy(pcWant, psInt->pcDigit + psInt->ui32Start, ui32IntLen);
+            pcWant[ui32IntLen] = '.';
+            memcpy(pcWant + ui32IntLen + 1, pcFrac[ui32Value & 0xFFFF], 3);
+            ui32Len = FMT_uq(pcGot, ui32Value, 16, 3);
+            CHECK_same("FMT_uq Q16.3", ui32Value, pcGot, ui32Len, pcWant, ui32IntLen + 4);
+        }
+
+        // Step the counters with the value
+        CHECK_counterUp(&sUp);
+        ui32HexStart = CHECK_hexUp(pcHex, ui32HexStart);
+        if ((ui32Value & 0xFFFF) == 0xFFFF){
+            CHECK_counterUp(&sInt);
+            CHECK_counterUp(&sIntNext);
+        }
+        if ((ui32Value & 0x0FFFFFFF) == 0x0FFFFFFF){
+            printf("\r  exhaustive %3u%%", (unsigned)((ui32Value >> 28) + 1) * 100 / 16);
+            fflush(stdout);
+        }
+    } while (++ui32Value != 0);
+
+    printf("\rexhaustive: 2^32 values of FMT_u32, FMT_i32, FMT_x32 and FMT_uq Q16.3, %llu mismatches, %.0f s\n",
+           (unsigned long long)(g_ui64Errors - ui64Errors), CHECK_now() - f64Start);
+}
+
+// Function to write a value the way the former UARTvprintf() did, dividing once per digit
+static uint32_t CHECK_former(char *pcDst, uint32_t ui32Value, uint32_t ui32Base, uint32_t ui32Neg,
+                             uint32_t ui32Count, char cFill){
+    static const char *pcHex = "0123456789abcdef";
+    uint32_t ui32Idx, ui32Pos = 0;
+
+    for (ui32Idx = 1; (((ui32Idx * ui32Base) <= ui32Value) && (((ui32Idx * ui32Base) / ui32Base) == ui32Idx));
+         ui32Idx *= ui32Base, ui32Count--){
+    }
+    if (ui32Neg) ui32Count--;
+    if (ui32Neg && (cFill == '0')){
+        pcDst[ui32Pos++] = '-';
+        ui32Neg = 0;
+    }
+    if ((ui32Count > 1) && (ui32Count < 16))
+        for (ui32Count--; ui32Count; ui32Count--) pcDst[ui32Pos++] = cFill;
+    if (ui32Neg) pcDst[ui32Pos++] = '-';
+    for (; ui32Idx; ui32Idx /= ui32Base) pcDst[ui32Pos++] = pcHex[(ui32Value / ui32Idx) % ui32Base];
+    return ui32Pos;
+}
+
+// Function to get a random value with its number of digits spread evenly
+static uint32_t CHECK_randSpread(void){
+    uint32_t ui32Value = CHECK_rand();
+
+    return ui32Value >> (CHECK_rand() % 32);
+}
+
+// Function to check the conversions on random values against snprintf() and the former UARTvprintf()
+static void CHECK_random(void){
+    static const uint32_t pui32Pow10[10] = {1u, 10u, 100u, 1000u, 10000u, 100000u, 1000000u,
+                                            10000000u, 100000000u, 1000000000u};
+    char pcGot[FMT_Q_MAX], pcWant[64], pcFormat[16];
+    uint32_t ui32N, ui32Value, ui32Len, ui32Want, ui32Frac, ui32Places, ui32Width, ui32Ties = 0;
+    uint64_t ui64Errors = g_ui64Errors;
+    int32_t i32Value;
+
+    for (ui32N = 0; ui32N < g_ui32Samples; ui32N++){
+        ui32Value = CHECK_randSpread();
+        if (CHECK_rand() & 1) ui32Value = 0u - ui32Value;
+        i32Value = (int32_t)ui32Value;
+
+        // Signed decimal against snprintf()
+        ui32Len = FMT_i32(pcGot, i32Value);
+        ui32Want = (uint32_t)snprintf(pcWant, sizeof(pcWant), "%d", i32Value);
+        CHECK_same("FMT_i32 snprintf", ui32Value, pcGot, ui32Len, pcWant, ui32Want);
+
+        // Fixed-point against snprintf(), which is exact for a value of up to 31 fractional bits
+        ui32Frac = CHECK_rand() % 32;
+        ui32Places = CHECK_rand() % (FMT_Q_PLACES_MAX + 1);
+        ui32Len = FMT_q(pcGot, i32Value, ui32Frac, ui32Places);
+        {
+            uint32_t ui32Mag = i32Value < 0 ? 0u - ui32Value : ui32Value;
+            unsigned __int128 u128Scaled = (unsigned __int128)(ui32Mag & ((1ull << ui32Frac) - 1)) * pui32Pow10[ui32Places];
+
+            if (ui32Frac && (u128Scaled & ((1ull << ui32Frac) - 1)) == (1ull << (ui32Frac - 1))){
+                // A tie: exact integer arithmetic, half away from zero
+                uint64_t ui64Round = (uint64_t)(((unsigned __int128)ui32Mag * pui32Pow10[ui32Places] +
+                                                 (1ull << (ui32Frac - 1))) >> ui32Frac);
+                ui32Ties++;
+                ui32Want = (uint32_t)snprintf(pcWant, sizeof(pcWant), "%s%llu", i32Value < 0 ? "-" : "",
+                                              (unsigned long long)(ui64Round / pui32Pow10[ui32Places]));
+                if (ui32Places)
+                    ui32Want += (uint32_t)snprintf(pcWant + ui32Want, sizeof(pcWant) - ui32Want, ".%0*llu",
+                                                   (int)ui32Places, (unsigned long long)(ui64Round % pui32Pow10[ui32Places]));
+            } else
+                ui32Want = (uint32_t)snprintf(pcWant, sizeof(pcWant), "%.*f", (int)ui32Places,
+                                              (double)i32Value / (double)(1ull << ui32Frac));
+        }
+        CHECK_same("FMT_q snprintf", ui32Value, pcGot, ui32Len, pcWant, ui32Want);
+
+        // UARTprintf() against the former conversion, space and zero fill
+        ui32Width = CHECK_rand() % 21;
+        snprintf(pcFormat, sizeof(pcFormat), "%%%s%ud", (CHECK_rand() & 1) ? "0" : "", ui32Width);
+        g_ui32Out = 0;
+        UARTprintf(pcFormat, i32Value);
+        ui32Want = CHECK_former(pcWant, i32Value < 0 ? 0u - ui32Value : ui32Value, 10, i32Value < 0,
+                                ui32Width, pcFormat[1] == '0' ? '0' : ' ');
+        CHECK_same("UARTprintf %d", ui32Value, g_pcOut, g_ui32Out, pcWant, ui32Want);
+
+        pcFormat[strlen(pcFormat) - 1] = 'u';
+        g_ui32Out = 0;
+        UARTprintf(pcFormat, ui32Value);
+        ui32Want = CHECK_former(pcWant, ui32Value, 10, 0, ui32Width, pcFormat[1] == '0' ? '0' : ' ');
+        CHECK_same("UARTprintf %u", ui32Value, g_pcOut, g_ui32Out, pcWant, ui32Want);
+
+        pcFormat[strlen(pcFormat) - 1] = 'x';
+        g_ui32Out = 0;
+        UARTprintf(pcFormat, ui32Value);
+        ui32Want = CHECK_former(pcWant, ui32Value, 16, 0, ui32Width, pcFormat[1] == '0' ? '0' : ' ');
+        CHECK_same("UARTprintf %x", ui32Value, g_pcOut, g_ui32Out, pcWant, ui32Want);
+
+        // %q is FMT_q() with the padding of %d
+        snprintf(pcFormat, sizeof(pcFormat), "%%%s%u.%uq", (CHECK_rand() & 1) ? "0" : "", ui32Width, ui32Places);
+        g_ui32Out = 0;
+        UARTprintf(pcFormat, i32Value, ui32Frac);
+        {
+            uint32_t ui32Sign = pcGot[0] == '-', ui32Pad = ui32Width > ui32Len ? ui32Width - ui32Len : 0;
+
+            ui32Want = 0;
+            if (ui32Sign && pcFormat[1] == '0') pcWant[ui32Want++] = '-';
+            if (ui32Pad < 15)
+                while (ui32Pad--) pcWant[ui32Want++] = pcFormat[1] == '0' ? '0' : ' ';
+            if (ui32Sign && pcFormat[1] != '0') pcWant[ui32Want++] = '-';
+            memcpy(pcWant + ui32Want, pcGot + ui32Sign, ui32Len - ui32Sign);
+            ui32Want += ui32Len - ui32Sign;
+        }
+        CHECK_same("UARTprintf %q", ui32Value, g_pcOut, g_ui32Out, pcWant, ui32Want);
+    }
+    printf("random: %u values of FMT_i32, FMT_q (%u ties) and UARTprintf %%d %%u %%x %%q, %llu mismatches\n",
+           g_ui32Samples, ui32Ties, (unsigned long long)(g_ui64Errors - ui64Errors));
+}
+
+// Function to time the conversions of a set of values
+static void CHECK_bench(const char *pcSet, const uint32_t *pui32Value){
+    static volatile uint32_t ui32Sink;
+    char pcBuf[32];
+    uint32_t ui32Round, ui32Idx, ui32Rounds = 2000;
+    double f64Start, pf64Ns[3];
+
+    f64Start = CHECK_now();
+    for (ui32Round = 0; ui32Round < ui32Rounds; ui32Round++)
+        for (ui32Idx = 0; ui32Idx < BENCH_VALUES; ui32Idx++)
+            ui32Sink += CHECK_former(pcBuf, pui32Value[ui32Idx], 10, 0, 0, ' ') + pcBuf[0];
+    pf64Ns[0] = (CHECK_now() - f64Start) * 1e9 / ((double)ui32Rounds * BENCH_VALUES);
+
+    f64Start = CHECK_now();
+    for (ui32Round = 0; ui32Round < ui32Rounds; ui32Round++)
+        for (ui32Idx = 0; ui32Idx < BENCH_VALUES; ui32Idx++)
+            ui32Sink += FMT_u32(pcBuf, pui32Value[ui32Idx]) + pcBuf[0];
+    pf64Ns[1] = (CHECK_now() - f64Start) * 1e9 / ((double)ui32Rounds * BENCH_VALUES);
+
+    f64Start = CHECK_now();
+    for (ui32Round = 0; ui32Round < ui32Rounds / 10; ui32Round++)
+        for (ui32Idx = 0; ui32Idx < BENCH_VALUES; ui32Idx++)
+            ui32Sink += snprintf(pcBuf, sizeof(pcBuf), "%u", pui32Value[ui32Idx]) + pcBuf[0];
+    pf64Ns[2] = (CHECK_now() - f64Start) * 1e9 / ((double)ui32Rounds / 10 * BENCH_VALUES);
+
+    printf("%-16s %12.1f %12.1f %12.1f %9.1fx\n", pcSet, pf64Ns[0], pf64Ns[1], pf64Ns[2], pf64Ns[0] / pf64Ns[1]);
+}
+
+/* -----------------------          Main Program        --------------------- */
+int main(int argc, char *argv[]){
+    static uint32_t pui32Uniform[BENCH_VALUES], pui32Small[BENCH_VALUES];
+    bool bQuick = false;
+    uint32_t ui32Idx;
+    int iOpt;
+
+    while ((iOpt = getopt(argc, argv, "qn:")) != -1){
+        switch (iOpt){
+        case 'q': bQuick = true; break;
+        case 'n': g_ui32Samples = strtoul(optarg, NULL, 0); break;
+        default:
+            fprintf(stderr, "usage: %s [-q] [-n random values]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    UARTStdioConfig(0, 115200, 80000000);
+    if (!bQuick) CHECK_exhaustive();
+    CHECK_random();
+
+    for (ui32Idx = 0; ui32Idx < BENCH_VALUES; ui32Idx++){
+        pui32Uniform[ui32Idx] = CHECK_rand();
+        pui32Small[ui32Idx] = CHECK_rand() % 10000;
+    }
+    printf("%-16s %12s %12s %12s %10s\n", "ns per value", "former", "FMT_u32", "snprintf", "gain");
+    CHECK_bench("uniform 32 bit", pui32Uniform);
+    CHECK_bench("below 10000", pui32Small);
+    return g_ui64Errors ? 1 : 0;
+}
@@ -0,0 +1,301 @@
+/*!
+ * @author      Yash Bansod
+ * @date        17th October 2026
+ *
+ * @brief       Host compiler, player and uploader of the Humper Robot Rev2 gait tables
+ * @details     A gait is written as text, one statement per line, '#' starts a comment:
+ *                  loop N                      loop back to frame N after the last frame
+ *                  frame TICKS P0 P1 P2 P3     move in TICKS ticks to the pulse widths P
+ *              in the leg order of i16ServoDuty and the per mille unit of the firmware,
+ *              e.g. the built-in trot:
+ *                  loop 0
+ *                  frame 15  70 60 60  70
+ *                  frame 15 100 90 90 100
+ *              "compile" checks the text with GAIT_check() of the firmware and prints the
+ *              table in hex, or writes it to a binary file.
+ *              "play" runs GAIT_seq.c and SERVO_motion.c of the firmware tick by tick as
+ *              Timer0IntHandler does and prints a CSV row per tick: the gait frame, the
+ *              pose of the sequencer and the pulse width commanded by the motion engine.
+ *              A second gait can be started at a tick with a blend. The summary on stderr
+ *              gives the cycles played and the error between the commanded pulse widths
+ *              and the pose, i.e. how much of the gait the velocity and acceleration
+ *              limits of the legs cut off.
+ *              With a serial port (or "-" to print the frame in hex) the commands of
+ *              PROTO_frame.h are sent and their replies decoded: "load" uploads a gait to
+ *              a slot (0 and 1 hold the built-in trot and toggle at power up), "walk"
+ *              plays a slot at a speed in % with a blend in ticks, "stop" ends the gait at
+ *              the end of its cycle ("now" at once), "state" reads the sequencer.
+ *
+ * @note        Build and run from this folder:
+ *              gcc -O2 -Wall -Wextra -I"../TM4C123G LaunchPad Humper Robot Rev2" GAIT_tool.c
+ *                  "../TM4C123G LaunchPad Humper Robot Rev2/GAIT_seq.c"
+ *                  "../TM4C123G LaunchPad Humper Robot Rev2/SERVO_motion.c"
+ *                  "../TM4C123G LaunchPad Humper Robot Rev2/PROTO_frame.c" -o GAIT_tool -lm
+ *              ./GAIT_tool compile trot.txt trot.bin
+ *              ./GAIT_tool play trot.txt 150 200 toggle.txt 100 25 > trot.csv
+ *              ./GAIT_tool /dev/ttyACM0 load 2 trot.txt
+ *              ./GAIT_tool /dev/ttyACM0 walk 2 120 25
+ *              ./GAIT_tool /dev/ttyACM0 stop | stop now | state
+ * @file        GAIT_tool.c
+ */
+/* -----------------------          Include Files       --------------------- */
+#include <stdio.h>                          // Library for Standard I/O
+#include <stdlib.h>                         // Standard Library
+#include <string.h>                         // Library for String functions
+#include <math.h>                           // Library for sqrt
+#include <fcntl.h>                          // Library for opening the serial port
+#include <termios.h>                        // Library for the serial port settings
+#include <unistd.h>                         // Library for read and write
+#include <poll.h>                           // Library for the reply timeout
+#include "macros.h"
+#include "GAIT_seq.h"
+#include "SERVO_motion.h"
+#include "PROTO_frame.h"
+
+/* -----------------------      Macro Definitions       --------------------- */
+#define TOOL_TIMEOUT_MS     500                     // Macro for the time to wait for a reply
+#define TOOL_LINE_MAX       256                     // Macro for the longest line of a gait text
+
+// Pose the firmware starts at, the second duty cycle of each leg of i16ServoDuty
+static const int16_t pi16StartPose[GAIT_LEGS] = {70, 90, 60, 100};
+
+/* -----------------------      Function Definition     --------------------- */
+// Function to compile a gait text into a table, returns its length or 0 on an error
+static uint32_t TOOL_compile(const char *pcFile, uint8_t *pui8Table){
+    char pcLine[TOOL_LINE_MAX];
+    uint32_t ui32Line = 0;
+    uint8_t ui8Frames = 0;
+    FILE *psFile = fopen(pcFile, "r");
+
+    if (psFile == NULL){
+        perror(pcFile);
+        return 0;
+    }
+    memset(pui8Table, 0, GAIT_TABLE_MAX);
+    pui8Table[GAIT_O_LEGS] = GAIT_LEGS;
+
+    while (fgets(pcLine, sizeof(pcLine), psFile)){
+        char *pcHash = strchr(pcLine, '#');
+        char pcWord[16];
+        int piValue[1 + GAIT_LEGS];
+        int iUsed = 0, iCount = 0, iOffset;
+        char *pcCursor;
+
+        ui32Line++;
+        if (pcHash) *pcHash = '\0';
+        if (sscanf(pcLine, "%15s%n", pcWord, &iUsed) != 1)
+            continue;
+        pcCursor = pcLine + iUsed;
+        while (iCount < 1 + GAIT_LEGS && sscanf(pcCursor, "%d%n", &piValue[iCount], &iOffset) == 1){
+            pcCursor += iOffset;
+            iCount++;
+        }
+
+        if (strcmp(pcWord, "loop") == 0 && iCount == 1 && piValue[0] >= 0 && piValue[0] < GAIT_FRAMES_MAX){
+            pui8Table[GAIT_O_FLAGS] |= GAIT_LOOP;
+            pui8Table[GAIT_O_LOOP] = (uint8_t)piValue[0];
+        } else if (strcmp(pcWord, "frame") == 0 && iCount == 1 + GAIT_LEGS && ui8Frames < GAIT_FRAMES_MAX){
+            int iField;
+            for (iField = 0; iField < 1 + GAIT_LEGS; iField++){
+                if (piValue[iField] < 0 || piValue[iField] > 255) break;
+                pui8Table[GAIT_HEADER + ui8Frames * GAIT_FRAME_BYTES + iField] = (uint8_t)piValue[iField];
+            }
+            if (iField < 1 + GAIT_LEGS){
+                fprintf(stderr, "%s:%u: value out of range\n", pcFile, ui32Line);
+                fclose(psFile);
+                return 0;
+            }
+            ui8Frames++;
+        } else{
+            fprintf(stderr, "%s:%u: expected \"loop N\" or \"frame TICKS P0 .. P%u\" (at most %u frames)\n",
+                    pcFile, ui32Line, GAIT_LEGS - 1, GAIT_FRAMES_MAX);
+            fclose(psFile);
+            return 0;
+        }
+    }
+    fclose(psFile);
+
+    pui8Table[GAIT_O_FRAMES] = ui8Frames;
+    if (!GAIT_check(pui8Table, GAIT_TABLE_LEN(ui8Frames))){
+        fprintf(stderr, "%s: rejected by GAIT_check: 1 .. %u frames, 1 .. 255 ticks, pulses %u .. %u, "
+                "loop frame below the frames\n", pcFile, GAIT_FRAMES_MAX, GAIT_PULSE_MIN, GAIT_PULSE_MAX);
+        return 0;
+    }
+    return GAIT_TABLE_LEN(ui8Frames);
+}
+
+// Function to play one or two gaits through the sequencer and the motion engine
+static int TOOL_play(int argc, char *argv[]){
+    uint8_t pui8Table[2][GAIT_TABLE_MAX];
+    uint32_t ui32Speed = (argc > 1) ? (uint32_t)strtoul(argv[1], NULL, 0) : 100;
+    uint32_t ui32Ticks = (argc > 2) ? (uint32_t)strtoul(argv[2], NULL, 0) : 200;
+    uint32_t ui32Switch = (argc > 4) ? (uint32_t)strtoul(argv[4], NULL, 0) : 0;
+    uint32_t ui32Blend = (argc > 5) ? (uint32_t)strtoul(argv[5], NULL, 0) : 0;
+    int16_t pi16Pose[GAIT_LEGS], pi16Pulse[GAIT_LEGS];
+    double f64Sum = 0, f64Max = 0;
+    uint32_t ui32Tick, ui32Samples = 0;
+    tServoMotion sMotion;
+    tGaitSeq sSeq;
+    uint8_t ui8Leg;
+
+    if (TOOL_compile(argv[0], pui8Table[0]) == 0 || (argc > 3 && TOOL_compile(argv[3], pui8Table[1]) == 0))
+        return 1;
+
+    SERVO_init(&sMotion, pi16StartPose, SERVO_VEL_MAX, SERVO_ACCEL, SERVO_TICK_HZ, SERVO_SETTLE_TICKS);
+    GAIT_init(&sSeq, pi16StartPose);
+    GAIT_play(&sSeq, pui8Table[0], (uint16_t)ui32Speed, 0);
+
+    printf("tick,gait,frame");
+    for (ui8Leg = 0; ui8Leg < GAIT_LEGS; ui8Leg++) printf(",pose%u", ui8Leg);
+    for (ui8Leg = 0; ui8Leg < GAIT_LEGS; ui8Leg++) printf(",pulse%u", ui8Leg);
+    printf("\n");
+
+    for (ui32Tick = 1; ui32Tick <= ui32Ticks; ui32Tick++){
+        if (argc > 3 && ui32Tick == ui32Switch)
+            GAIT_play(&sSeq, pui8Table[1], (uint16_t)ui32Speed, (uint16_t)ui32Blend);
+
+        // The order of Timer0IntHandler
+        bool bPlaying = GAIT_tick(&sSeq, pi16Pose);
+        if (bPlaying)
+            SERVO_moveTo(&sMotion, pi16Pose);
+        SERVO_tick(&sMotion, pi16Pulse);
+
+        printf("%u,%d,%u", ui32Tick, sSeq.sNew.pui8Table == pui8Table[1] ? 1 : 0, sSeq.sNew.ui8Frame);
+        for (ui8Leg = 0; ui8Leg < GAIT_LEGS; ui8Leg++) printf(",%d", pi16Pose[ui8Leg]);
+        for (ui8Leg = 0; ui8Leg < GAIT_LEGS; ui8Leg++) printf(",%d", pi16Pulse[ui8Leg]);
+        printf("\n");
+
+        if (bPlaying)
+            for (ui8Leg = 0; ui8Leg < GAIT_LEGS; ui8Leg++){
+                double f64Err = fabs((double)pi16Pulse[ui8Leg] - pi16Pose[ui8Leg]);
+                f64Sum += f64Err * f64Err;
+                f64Max = (f64Err > f64Max) ? f64Err : f64Max;
+                ui32Samples++;
+            }
+    }
+    fprintf(stderr, "cycles %u, tracking error rms %.2f max %.0f (per mille), %s\n", sSeq.sNew.ui32Cycles,
+            ui32Samples ? sqrt(f64Sum / ui32Samples) : 0.0, f64Max, GAIT_PLAYING(&sSeq) ? "playing" : "stopped");
+    return 0;
+}
+
+// Function to open the serial port in raw mode at 115200 baud
+static int TOOL_open(const char *pcPort){
+    struct termios sTio;
+    int iFd = open(pcPort, O_RDWR | O_NOCTTY);
+
+    if (iFd < 0 || tcgetattr(iFd, &sTio) != 0){
+        perror(pcPort);
+        return -1;
+    }
+    cfmakeraw(&sTio);
+    cfsetispeed(&sTio, B115200);
+    cfsetospeed(&sTio, B115200);
+    sTio.c_cflag |= CLOCAL | CREAD;
+    tcsetattr(iFd, TCSANOW, &sTio);
+    tcflush(iFd, TCIOFLUSH);
+    return iFd;
+}
+
+// Function to wait for the reply of a command type, the range frames and motor status bytes are skipped
+static bool TOOL_reply(int iFd, uint8_t ui8Type, tProtoFrame *psReply){
+    struct pollfd sPoll = {iFd, POLLIN, 0};
+    tProtoParser sParser;
+    uint8_t ui8Byte;
+
+    PROTO_parserInit(&sParser);
+    while (poll(&sPoll, 1, TOOL_TIMEOUT_MS) > 0 && read(iFd, &ui8Byte, 1) == 1){
+        if (PROTO_parse(&sParser, ui8Byte) && sParser.sFrame.ui8Type == (ui8Type | PROTO_REPLY)){
+            *psReply = sParser.sFrame;
+            return true;
+        }
+    }
+    fprintf(stderr, "no reply\n");
+    return false;
+}
+
+/* -----------------------          Main Program        --------------------- */
+int main(int argc, char *argv[]){
+    static const char *pcStatus[] = {"ok", "bad length", "bad type", "slot busy", "bad slot or table"};
+    uint8_t pui8Payload[PROTO_MAX_PAYLOAD];
+    uint8_t pui8Frame[PROTO_MAX_FRAME];
+    uint8_t ui8Type, ui8Len = 0;
+    uint32_t ui32Len, ui32Index;
+    tProtoFrame sReply;
+    int iFd = -1;
+
+    if (argc >= 3 && strcmp(argv[1], "compile") == 0){
+        uint8_t pui8Table[GAIT_TABLE_MAX];
+        FILE *psOut;
+
+        if ((ui32Len = TOOL_compile(argv[2], pui8Table)) == 0)
+            return 1;
+        if (argc < 4){
+            for (ui32Index = 0; ui32Index < ui32Len; ui32Index++)
+                printf("%02X%s", pui8Table[ui32Index], (ui32Index + 1 < ui32Len) ? " " : "\n");
+            return 0;
+        }
+        if ((psOut = fopen(argv[3], "wb")) == NULL || fwrite(pui8Table, 1, ui32Len, psOut) != ui32Len){
+            perror(argv[3]);
+            return 1;
+        }
+        fclose(psOut);
+        return 0;
+    }
+    if (argc >= 3 && strcmp(argv[1], "play") == 0)
+        return TOOL_play(argc - 2, argv + 2);
+
+    if (argc >= 5 && strcmp(argv[2], "load") == 0){
+        ui8Type = PROTO_GAIT_LOAD;
+        pui8Payload[0] = (uint8_t)strtoul(argv[3], NULL, 0);
+        if ((ui32Len = TOOL_compile(argv[4], pui8Payload + 1)) == 0)
+            return 1;
+        ui8Len = (uint8_t)(1 + ui32Len);
+    } else if (argc >= 5 && strcmp(argv[2], "walk") == 0){
+        ui8Type = PROTO_GAIT_PLAY;
+        pui8Payload[0] = (uint8_t)strtoul(argv[3], NULL, 0);
+        PROTO_putU16(pui8Payload + 1, (uint16_t)strtoul(argv[4], NULL, 0));
+        PROTO_putU16(pui8Payload + 3, (uint16_t)((argc > 5) ? strtoul(argv[5], NULL, 0) : 0));
+        ui8Len = 5;
+    } else if (argc >= 3 && strcmp(argv[2], "stop") == 0){
+        ui8Type = PROTO_GAIT_STOP;
+        pui8Payload[0] = (argc > 3 && strcmp(argv[3], "now") == 0) ? 1 : 0;
+        ui8Len = 1;
+    } else if (argc >= 3 && strcmp(argv[2], "state") == 0){
+        ui8Type = PROTO_GET_STATE;
+    } else{
+        printf("usage: %s compile GAIT.txt [GAIT.bin]\n"
+               "       %s play GAIT.txt [speed %%] [ticks] [GAIT2.txt switch_tick blend_ticks]\n"
+               "       %s PORT|- load SLOT GAIT.txt | walk SLOT SPEED [BLEND] | stop [now] | state\n",
+               argv[0], argv[0], argv[0]);
+        return 1;
+    }
+
+    ui32Len = PROTO_encode(ui8Type, pui8Payload, ui8Len, pui8Frame);
+    if (strcmp(argv[1], "-") == 0){
+        for (ui32Index = 0; ui32Index < ui32Len; ui32Index++)
+            printf("%02X%s", pui8Frame[ui32Index], (ui32Index + 1 < ui32Len) ? " " : "\n");
+        return 0;
+    }
+    if ((iFd = TOOL_open(argv[1])) < 0)
+        return 1;
+    if (write(iFd, pui8Frame, ui32Len) != (ssize_t)ui32Len){
+        perror("write");
+        return 1;
+    }
+    if (!TOOL_reply(iFd, ui8Type, &sReply))
+        return 1;
+    close(iFd);
+
+    printf("%s\n", (sReply.ui8Len && sReply.pui8Payload[0] < 5) ? pcStatus[sReply.pui8Payload[0]] : "bad reply");
+    if (ui8Type == PROTO_GET_STATE && sReply.ui8Len >= 9 + 2 * GAIT_LEGS && sReply.pui8Payload[0] == PROTO_STATUS_OK){
+        const uint8_t *pui8State = sReply.pui8Payload;
+        printf("idle %u, playing %u, slot %d, frame %u, cycles %u, echo change %d, pulses",
+               (pui8State[1] & PROTO_FLAG_IDLE) != 0, (pui8State[1] & PROTO_FLAG_PLAYING) != 0,
+               pui8State[2] == 0xFF ? -1 : pui8State[2], pui8State[3], PROTO_getU32(pui8State + 4),
+               (int8_t)pui8State[8]);
+        for (ui32Index = 0; ui32Index < GAIT_LEGS; ui32Index++)
+            printf(" %d", (int16_t)PROTO_getU16(pui8State + 9 + 2 * ui32Index));
+        printf("\n");
+    }
+    return (sReply.ui8Len && sReply.pui8Payload[0] == PROTO_STATUS_OK) ? 0 : 1;
+}
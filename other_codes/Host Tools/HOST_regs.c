@@ -0,0 +1,302 @@
+/*!
+ * @author      Yash Bansod
+ * @date        17th October 2026
+ *
+ * @brief       Source containing the host register-level stand-in for the DriverLib API
+ * @file        HOST_regs.c
+ */
+/* -----------------------          Include Files       --------------------- */
+#include <string.h>                         // Library for String functions
+#include "HOST_regs.h"
+
+/* -----------------------      Macro Definitions       --------------------- */
+#define HOST_RCC_USEPWMDIV      0x00100000          // RCC, the PWM clock is divided
+#define HOST_GEN_INDEX(ui32Gen) (((ui32Gen) >> 6) - 1)  // Generator of PWM_GEN_n or PWM_OUT_n
+
+/* -----------------------      Global Variables        --------------------- */
+tHostRegs g_sRegs;                                  // Register state shared with the host program
+
+typedef struct {
+    uint8_t ui8Port;                                // Index of the port, A = 0
+    uint8_t ui8Pin;                                 // Pin number
+    uint8_t ui8Func;                                // PCTL function
+    uint8_t ui8Module;                              // PWM module of the signal
+    uint8_t ui8Out;                                 // PWM output of the signal
+} tHostPinMux;
+
+// PWM signals of the pins of ports B and E (TM4C123GH6PM data sheet, table 23-5)
+static const tHostPinMux psHostPinMux[] = {
+    {1, 4, 4, 0, 2}, {1, 5, 4, 0, 3}, {1, 6, 4, 0, 0}, {1, 7, 4, 0, 1},
+    {4, 4, 4, 0, 4}, {4, 4, 5, 1, 2}, {4, 5, 4, 0, 5}, {4, 5, 5, 1, 3}
+};
+
+/* -----------------------      Function Definition     --------------------- */
+// Function to reset all the registers
+void HOST_regsReset(void){
+    memset(&g_sRegs, 0, sizeof(g_sRegs));
+}
+
+// Function to get the index of a GPIO port base, -1 if unknown
+int32_t HOST_portIndex(uint32_t ui32Port){
+    switch (ui32Port){
+    case GPIO_PORTA_BASE: return 0;
+    case GPIO_PORTB_BASE: return 1;
+    case GPIO_PORTC_BASE: return 2;
+    case GPIO_PORTD_BASE: return 3;
+    case GPIO_PORTE_BASE: return 4;
+    case GPIO_PORTF_BASE: return 5;
+    default: return -1;
+    }
+}
+
+// Function to get the index of a PWM module base, -1 if unknown
+int32_t HOST_pwmIndex(uint32_t ui32Base){
+    if (ui32Base == PWM0_BASE) return 0;
+    if (ui32Base == PWM1_BASE) return 1;
+    return -1;
+}
+
+// Function to get the generator addressed by a base and a PWM_GEN_n or PWM_OUT_n, NULL on an ASSERT
+static tHostPwmGen *HOST_gen(uint32_t ui32Base, uint32_t ui32GenOrOut){
+    int32_t i32Module = HOST_pwmIndex(ui32Base);
+    uint32_t ui32Gen = HOST_GEN_INDEX(ui32GenOrOut);
+
+    g_sRegs.ui32Calls++;
+    if (i32Module < 0 || ui32Gen >= HOST_PWM_GENS){
+        g_sRegs.ui32Asserts++;
+        return NULL;
+    }
+    return &g_sRegs.psPwm[i32Module].psGen[ui32Gen];
+}
+
+// Function to get the register behind an address of HWREG, a generator register as written
+volatile uint32_t *HOST_hwreg(uint32_t ui32Addr){
+    static uint32_t ui32Other;
+    tHostPwmGen *psGen;
+
+    if (HOST_pwmIndex(ui32Addr & ~0xFFFu) < 0 || (ui32Addr & 0xFC0) < PWM_GEN_0 || (ui32Addr & 0xFC0) > PWM_GEN_3){
+        g_sRegs.ui32Asserts++;
+        return &ui32Other;
+    }
+    psGen = &g_sRegs.psPwm[HOST_pwmIndex(ui32Addr & ~0xFFFu)].psGen[HOST_GEN_INDEX(ui32Addr & 0xFC0)];
+
+    switch (ui32Addr & 0x3F){
+    case PWM_O_X_CTL:   return &psGen->ui32Ctl;
+    case PWM_O_X_LOAD:  return &psGen->ui32LoadNext;
+    case PWM_O_X_COUNT: return &psGen->ui32Count;
+    case PWM_O_X_CMPA:  return &psGen->pui32CmpNext[0];
+    case PWM_O_X_CMPB:  return &psGen->pui32CmpNext[1];
+    default:
+        g_sRegs.ui32Asserts++;
+        return &ui32Other;
+    }
+}
+
+// Function to get the clock of the PWM generators
+uint32_t HOST_pwmClockHz(void){
+    if (!(g_sRegs.ui32Rcc & HOST_RCC_USEPWMDIV))
+        return HOST_SYSCLK_HZ;
+    return HOST_SYSCLK_HZ / (2u << ((g_sRegs.ui32Rcc >> 17) & 0x07));
+}
+
+// Function to get the PWM signal driving a pin, HOST_PWM_SIGNAL(module, output) or -1
+int32_t HOST_pinSignal(uint32_t ui32Port, uint8_t ui8Pin){
+    int32_t i32Port = HOST_portIndex(ui32Port);
+    uint32_t ui32Index;
+
+    if (i32Port < 0 || ui8Pin > 7 || !(g_sRegs.pui32Afsel[i32Port] & (1u << ui8Pin)) ||
+        !(g_sRegs.pui32Den[i32Port] & (1u << ui8Pin)))
+        return -1;
+
+    for (ui32Index = 0; ui32Index < sizeof(psHostPinMux) / sizeof(psHostPinMux[0]); ui32Index++){
+        const tHostPinMux *psMux = &psHostPinMux[ui32Index];
+        if (psMux->ui8Port == i32Port && psMux->ui8Pin == ui8Pin &&
+            ((g_sRegs.pui32Pctl[i32Port] >> (4 * ui8Pin)) & 0x0F) == psMux->ui8Func)
+            return HOST_PWM_SIGNAL(psMux->ui8Module, psMux->ui8Out);
+    }
+    return -1;
+}
+
+// Function to take the written LOAD and CMPx of a generator in use at its zero count
+static void HOST_genZero(tHostPwmModule *psModule, uint32_t ui32Gen){
+    tHostPwmGen *psGen = &psModule->psGen[ui32Gen];
+    bool bSync = (psModule->ui32Ctl >> ui32Gen) & 1;
+    bool bChanged = false;
+
+    if (!(psGen->ui32Ctl & HOST_PWM_X_CTL_LOADUPD) || bSync){
+        bChanged |= psGen->ui32Load != psGen->ui32LoadNext;
+        psGen->ui32Load = psGen->ui32LoadNext;
+    }
+    if (!(psGen->ui32Ctl & HOST_PWM_X_CTL_CMPAUPD) || bSync){
+        bChanged |= psGen->pui32Cmp[0] != psGen->pui32CmpNext[0];
+        psGen->pui32Cmp[0] = psGen->pui32CmpNext[0];
+    }
+    if (!(psGen->ui32Ctl & HOST_PWM_X_CTL_CMPBUPD) || bSync){
+        bChanged |= psGen->pui32Cmp[1] != psGen->pui32CmpNext[1];
+        psGen->pui32Cmp[1] = psGen->pui32CmpNext[1];
+    }
+    // GLOBALSYNCn reads 1 until the update is done
+    psModule->ui32Ctl &= ~(1u << ui32Gen);
+
+    if (bChanged){
+        psGen->ui32Updates++;
+        psGen->ui64Updated = g_sRegs.ui64Clock;
+    }
+}
+
+// Function to clock the enabled generators, the outputs go high at LOAD and low at CMPx
+void HOST_pwmRun(uint32_t ui32Clocks){
+    uint32_t ui32Module, ui32Gen, ui32Out;
+
+    while (ui32Clocks--){
+        for (ui32Module = 0; ui32Module < HOST_PWM_MODULES; ui32Module++){
+            tHostPwmModule *psModule = &g_sRegs.psPwm[ui32Module];
+
+            for (ui32Gen = 0; ui32Gen < HOST_PWM_GENS; ui32Gen++){
+                tHostPwmGen *psGen = &psModule->psGen[ui32Gen];
+
+                if (!(psGen->ui32Ctl & HOST_PWM_X_CTL_ENABLE))
+                    continue;
+
+                if (psGen->ui32Count == 0){
+                    HOST_genZero(psModule, ui32Gen);
+                    psGen->ui32Count = psGen->ui32Load;
+                    psGen->pui32High[0] = psGen->pui32HighRun[0];
+                    psGen->pui32High[1] = psGen->pui32HighRun[1];
+                    psGen->pui32HighRun[0] = 0;
+                    psGen->pui32HighRun[1] = 0;
+                    psGen->ui32Periods++;
+                }
+                else{
+                    psGen->ui32Count--;
+                }
+
+                for (ui32Out = 0; ui32Out < 2; ui32Out++)
+                    if ((psModule->ui32Enable & (1u << (ui32Gen * 2 + ui32Out))) &&
+                        psGen->ui32Count > psGen->pui32Cmp[ui32Out])
+                        psGen->pui32HighRun[ui32Out]++;
+            }
+        }
+        g_sRegs.ui64Clock++;
+    }
+}
+
+// System control
+uint32_t ROM_SysCtlClockGet(void){
+    g_sRegs.ui32Calls++;
+    return HOST_SYSCLK_HZ;
+}
+void ROM_SysCtlPWMClockSet(uint32_t ui32Config){
+    g_sRegs.ui32Calls++;
+    g_sRegs.ui32Rcc = (g_sRegs.ui32Rcc & ~0x001E0000) | (ui32Config & 0x001E0000);
+}
+void ROM_SysCtlPeripheralEnable(uint32_t ui32Peripheral){
+    g_sRegs.ui32Calls++;
+    if ((ui32Peripheral & 0xFFFFFF00) == 0xF0000800)
+        g_sRegs.ui32RcgcGpio |= 1u << (ui32Peripheral & 0xFF);
+    else if ((ui32Peripheral & 0xFFFFFF00) == 0xF0004000)
+        g_sRegs.ui32RcgcPwm |= 1u << (ui32Peripheral & 0xFF);
+    else
+        g_sRegs.ui32Asserts++;
+}
+
+// GPIO
+void ROM_GPIOPinConfigure(uint32_t ui32PinConfig){
+    uint32_t ui32Port = (ui32PinConfig >> 16) & 0xFF;
+    uint32_t ui32Shift = (ui32PinConfig >> 8) & 0xFF;
+
+    g_sRegs.ui32Calls++;
+    if (ui32Port >= HOST_GPIO_PORTS || ui32Shift > 28){
+        g_sRegs.ui32Asserts++;
+        return;
+    }
+    g_sRegs.pui32Pctl[ui32Port] = (g_sRegs.pui32Pctl[ui32Port] & ~(0x0Fu << ui32Shift)) |
+                                  ((ui32PinConfig & 0x0F) << ui32Shift);
+}
+void ROM_GPIOPinTypePWM(uint32_t ui32Port, uint8_t ui8Pins){
+    int32_t i32Port = HOST_portIndex(ui32Port);
+
+    g_sRegs.ui32Calls++;
+    if (i32Port < 0 || !(g_sRegs.ui32RcgcGpio & (1u << i32Port))){
+        g_sRegs.ui32Asserts++;
+        return;
+    }
+    g_sRegs.pui32Afsel[i32Port] |= ui8Pins;
+    g_sRegs.pui32Den[i32Port] |= ui8Pins;
+}
+
+// PWM
+void ROM_PWMGenConfigure(uint32_t ui32Base, uint32_t ui32Gen, uint32_t ui32Config){
+    tHostPwmGen *psGen = HOST_gen(ui32Base, ui32Gen);
+    if (psGen)
+        psGen->ui32Ctl = (psGen->ui32Ctl & HOST_PWM_X_CTL_ENABLE) | (ui32Config & ~HOST_PWM_X_CTL_ENABLE);
+}
+void ROM_PWMGenPeriodSet(uint32_t ui32Base, uint32_t ui32Gen, uint32_t ui32Period){
+    tHostPwmGen *psGen = HOST_gen(ui32Base, ui32Gen);
+    if (!psGen)
+        return;
+    if (psGen->ui32Ctl & HOST_PWM_X_CTL_MODE)
+        psGen->ui32LoadNext = ui32Period / 2;
+    else
+        psGen->ui32LoadNext = ui32Period - 1;
+    if (ui32Period < 2 || psGen->ui32LoadNext > 0xFFFF)
+        g_sRegs.ui32Asserts++;
+}
+void ROM_PWMGenEnable(uint32_t ui32Base, uint32_t ui32Gen){
+    tHostPwmGen *psGen = HOST_gen(ui32Base, ui32Gen);
+    if (psGen)
+        psGen->ui32Ctl |= HOST_PWM_X_CTL_ENABLE;
+}
+void ROM_PWMGenDisable(uint32_t ui32Base, uint32_t ui32Gen){
+    tHostPwmGen *psGen = HOST_gen(ui32Base, ui32Gen);
+    if (psGen)
+        psGen->ui32Ctl &= ~HOST_PWM_X_CTL_ENABLE;
+}
+void ROM_PWMPulseWidthSet(uint32_t ui32Base, uint32_t ui32PWMOut, uint32_t ui32Width){
+    tHostPwmGen *psGen = HOST_gen(ui32Base, ui32PWMOut);
+    if (!psGen)
+        return;
+    if (psGen->ui32Ctl & HOST_PWM_X_CTL_MODE)
+        ui32Width /= 2;
+    if (ui32Width >= psGen->ui32LoadNext)
+        g_sRegs.ui32Asserts++;
+    psGen->pui32CmpNext[ui32PWMOut & 1] = (psGen->ui32LoadNext - ui32Width) & 0xFFFF;
+}
+void ROM_PWMOutputState(uint32_t ui32Base, uint32_t ui32PWMOutBits, bool bEnable){
+    int32_t i32Module = HOST_pwmIndex(ui32Base);
+
+    g_sRegs.ui32Calls++;
+    if (i32Module < 0 || ui32PWMOutBits > 0xFF){
+        g_sRegs.ui32Asserts++;
+        return;
+    }
+    if (bEnable)
+        g_sRegs.psPwm[i32Module].ui32Enable |= ui32PWMOutBits;
+    else
+        g_sRegs.psPwm[i32Module].ui32Enable &= ~ui32PWMOutBits;
+}
+void ROM_PWMSyncUpdate(uint32_t ui32Base, uint32_t ui32GenBits){
+    int32_t i32Module = HOST_pwmIndex(ui32Base);
+
+    g_sRegs.ui32Calls++;
+    if (i32Module < 0 || ui32GenBits > 0x0F){
+        g_sRegs.ui32Asserts++;
+        return;
+    }
+    g_sRegs.psPwm[i32Module].ui32Ctl |= ui32GenBits;
+}
+void ROM_PWMSyncTimeBase(uint32_t ui32Base, uint32_t ui32GenBits){
+    int32_t i32Module = HOST_pwmIndex(ui32Base);
+    uint32_t ui32Gen;
+
+    g_sRegs.ui32Calls++;
+    if (i32Module < 0 || ui32GenBits > 0x0F){
+        g_sRegs.ui32Asserts++;
+        return;
+    }
+    // The counters restart together, from a zero count
+    for (ui32Gen = 0; ui32Gen < HOST_PWM_GENS; ui32Gen++)
+        if (ui32GenBits & (1u << ui32Gen))
+            g_sRegs.psPwm[i32Module].psGen[ui32Gen].ui32Count = 0;
+    g_sRegs.psPwm[i32Module].ui32Syncs++;
+}
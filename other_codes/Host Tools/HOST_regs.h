@@ -0,0 +1,183 @@
+/*!
+ * @author      Yash Bansod
+ * @date        17th October 2026
+ *
+ * @brief       Host register-level stand-in for the DriverLib API of Humper Robot Rev2
+ * @details     Replaces the TivaWare headers when the PWM driver of Humper Robot Rev2
+ *              is compiled on a Linux host with HOST_SIM defined. Unlike HOST_stub.h
+ *              the calls write a model of the registers they touch: the PWM and GPIO
+ *              clock gates and the PWM divider of SysCtl, AFSEL and PCTL of the GPIO
+ *              ports and, per PWM module, PWMCTL, PWMSYNC, PWMENABLE and the CTL, LOAD,
+ *              COUNT, CMPA and CMPB registers of each generator, which HWREG reaches
+ *              too.
+ *              LOAD and CMPx keep the written value apart from the value in use. In
+ *              the default mode the written values take effect when the counter next
+ *              reaches zero; with PWM_GEN_MODE_SYNC they wait in addition for the
+ *              GLOBALSYNC bit set by PWMSyncUpdate. HOST_pwmRun() clocks the enabled
+ *              generators in count down mode and measures the high time of each
+ *              output over its last complete period.
+ *              The values of the constants are those of TivaWare, the calls compute
+ *              the register values the way DriverLib does (a read of LOAD returns the
+ *              written value) and the failed ASSERTs of DriverLib are counted in
+ *              ui32Asserts.
+ * @file        HOST_regs.h
+ */
+/* -----------------------          Include Files       --------------------- */
+#include <stdint.h>                         // Library of Standard Integer Types
+#include <stdbool.h>                        // Library of Standard Boolean Types
+
+#ifndef HOST_REGS_H_
+#define HOST_REGS_H_
+
+/* -----------------------      Macro Definitions       --------------------- */
+#define HOST_SYSCLK_HZ          80000000            // System clock set by ROM_SysCtlClockSet
+#define HOST_GPIO_PORTS         6                   // GPIO ports A to F
+#define HOST_PWM_MODULES        2                   // PWM0 and PWM1
+#define HOST_PWM_GENS           4                   // Generators of a PWM module
+
+// Peripheral base addresses
+#define GPIO_PORTA_BASE         0x40004000
+#define GPIO_PORTB_BASE         0x40005000
+#define GPIO_PORTC_BASE         0x40006000
+#define GPIO_PORTD_BASE         0x40007000
+#define GPIO_PORTE_BASE         0x40024000
+#define GPIO_PORTF_BASE         0x40025000
+#define PWM0_BASE               0x40028000
+#define PWM1_BASE               0x40029000
+
+// GPIO pins and pin mux
+#define GPIO_PIN_0              0x00000001
+#define GPIO_PIN_1              0x00000002
+#define GPIO_PIN_2              0x00000004
+#define GPIO_PIN_3              0x00000008
+#define GPIO_PIN_4              0x00000010
+#define GPIO_PIN_5              0x00000020
+#define GPIO_PIN_6              0x00000040
+#define GPIO_PIN_7              0x00000080
+#define GPIO_PB4_M0PWM2         0x00011004
+#define GPIO_PB5_M0PWM3         0x00011404
+#define GPIO_PB6_M0PWM0         0x00011804
+#define GPIO_PB7_M0PWM1         0x00011C04
+#define GPIO_PE4_M0PWM4         0x00041004
+#define GPIO_PE4_M1PWM2         0x00041005
+#define GPIO_PE5_M0PWM5         0x00041404
+#define GPIO_PE5_M1PWM3         0x00041405
+
+// System control
+#define SYSCTL_PWMDIV_64        0x001A0000
+#define SYSCTL_PERIPH_GPIOA     0xF0000800
+#define SYSCTL_PERIPH_GPIOB     0xF0000801
+#define SYSCTL_PERIPH_GPIOC     0xF0000802
+#define SYSCTL_PERIPH_GPIOD     0xF0000803
+#define SYSCTL_PERIPH_GPIOE     0xF0000804
+#define SYSCTL_PERIPH_GPIOF     0xF0000805
+#define SYSCTL_PERIPH_PWM0      0xF0004000
+#define SYSCTL_PERIPH_PWM1      0xF0004001
+
+// PWM
+#define PWM_GEN_0               0x00000040
+#define PWM_GEN_1               0x00000080
+#define PWM_GEN_2               0x000000C0
+#define PWM_GEN_3               0x00000100
+#define PWM_GEN_0_BIT           0x00000001
+#define PWM_GEN_1_BIT           0x00000002
+#define PWM_GEN_2_BIT           0x00000004
+#define PWM_GEN_3_BIT           0x00000008
+#define PWM_OUT_0               0x00000040
+#define PWM_OUT_1               0x00000041
+#define PWM_OUT_2               0x00000080
+#define PWM_OUT_3               0x00000081
+#define PWM_OUT_4               0x000000C0
+#define PWM_OUT_5               0x000000C1
+#define PWM_OUT_6               0x00000100
+#define PWM_OUT_7               0x00000101
+#define PWM_OUT_0_BIT           0x00000001
+#define PWM_OUT_1_BIT           0x00000002
+#define PWM_OUT_2_BIT           0x00000004
+#define PWM_OUT_3_BIT           0x00000008
+#define PWM_OUT_4_BIT           0x00000010
+#define PWM_OUT_5_BIT           0x00000020
+#define PWM_OUT_6_BIT           0x00000040
+#define PWM_OUT_7_BIT           0x00000080
+#define PWM_GEN_MODE_DOWN       0x00000000
+#define PWM_GEN_MODE_UP_DOWN    0x00000002
+#define PWM_GEN_MODE_SYNC       0x00000038
+#define PWM_GEN_MODE_NO_SYNC    0x00000000
+#define PWM_O_X_CTL             0x00000000
+#define PWM_O_X_LOAD            0x00000010
+#define PWM_O_X_COUNT           0x00000014
+#define PWM_O_X_CMPA            0x00000018
+#define PWM_O_X_CMPB            0x0000001C
+
+// Register access, the generator registers of the PWM modules are modelled
+#define HWREG(x)                (*HOST_hwreg((uint32_t)(x)))
+
+// Register fields
+#define HOST_PWM_X_CTL_ENABLE   0x00000001          // PWMnCTL counter enable
+#define HOST_PWM_X_CTL_MODE     0x00000002          // PWMnCTL count up/down
+#define HOST_PWM_X_CTL_LOADUPD  0x00000008          // PWMnCTL LOAD waits for a global sync
+#define HOST_PWM_X_CTL_CMPAUPD  0x00000010          // PWMnCTL CMPA waits for a global sync
+#define HOST_PWM_X_CTL_CMPBUPD  0x00000020          // PWMnCTL CMPB waits for a global sync
+#define HOST_PWM_SIGNAL(ui8Module, ui8Out)  ((int32_t)((ui8Module) * 8 + (ui8Out)))  // PWM signal of a pin
+
+/* -----------------------      Global Variables        --------------------- */
+typedef struct {
+    uint32_t ui32Ctl;                               // PWMnCTL
+    uint32_t ui32Load;                              // PWMnLOAD in use
+    uint32_t ui32LoadNext;                          // PWMnLOAD as written
+    uint32_t pui32Cmp[2];                           // PWMnCMPA and PWMnCMPB in use
+    uint32_t pui32CmpNext[2];                       // PWMnCMPA and PWMnCMPB as written
+    uint32_t ui32Count;                             // PWMnCOUNT
+    uint32_t ui32Updates;                           // Zero counts that took written values in use
+    uint64_t ui64Updated;                           // PWM clock of the last of them
+    uint32_t pui32High[2];                          // High clocks of outputs A and B in the last period
+    uint32_t pui32HighRun[2];                       // High clocks of outputs A and B in this period
+    uint32_t ui32Periods;                           // Complete periods counted
+} tHostPwmGen;
+
+typedef struct {
+    uint32_t ui32Ctl;                               // PWMCTL, GLOBALSYNCn pending
+    uint32_t ui32Enable;                            // PWMENABLE
+    uint32_t ui32Syncs;                             // Writes to PWMSYNC
+    tHostPwmGen psGen[HOST_PWM_GENS];               // Generators 0 to 3
+} tHostPwmModule;
+
+typedef struct {
+    uint32_t ui32Rcc;                               // RCC, USEPWMDIV and PWMDIV
+    uint32_t ui32RcgcGpio;                          // RCGCGPIO
+    uint32_t ui32RcgcPwm;                           // RCGCPWM
+    uint32_t pui32Afsel[HOST_GPIO_PORTS];           // GPIOAFSEL of ports A to F
+    uint32_t pui32Den[HOST_GPIO_PORTS];             // GPIODEN of ports A to F
+    uint32_t pui32Pctl[HOST_GPIO_PORTS];            // GPIOPCTL of ports A to F
+    tHostPwmModule psPwm[HOST_PWM_MODULES];         // PWM0 and PWM1
+    uint64_t ui64Clock;                             // PWM clocks run so far
+    uint32_t ui32Calls;                             // DriverLib calls made so far
+    uint32_t ui32Asserts;                           // DriverLib ASSERTs that failed so far
+} tHostRegs;
+
+extern tHostRegs g_sRegs;                           // Register state shared with the host program
+
+/* -----------------------      Function Prototypes     --------------------- */
+void HOST_regsReset(void);                          // Reset all the registers
+uint32_t HOST_pwmClockHz(void);                     // Clock of the PWM generators
+void HOST_pwmRun(uint32_t ui32Clocks);              // Clock the enabled generators
+int32_t HOST_pinSignal(uint32_t ui32Port, uint8_t ui8Pin);  // PWM signal driving a pin, -1 if none
+int32_t HOST_portIndex(uint32_t ui32Port);          // Index of a GPIO port base, -1 if unknown
+int32_t HOST_pwmIndex(uint32_t ui32Base);           // Index of a PWM module base, -1 if unknown
+volatile uint32_t *HOST_hwreg(uint32_t ui32Addr);   // Register behind an address of HWREG
+
+uint32_t ROM_SysCtlClockGet(void);
+void ROM_SysCtlPWMClockSet(uint32_t ui32Config);
+void ROM_SysCtlPeripheralEnable(uint32_t ui32Peripheral);
+void ROM_GPIOPinConfigure(uint32_t ui32PinConfig);
+void ROM_GPIOPinTypePWM(uint32_t ui32Port, uint8_t ui8Pins);
+void ROM_PWMGenConfigure(uint32_t ui32Base, uint32_t ui32Gen, uint32_t ui32Config);
+void ROM_PWMGenPeriodSet(uint32_t ui32Base, uint32_t ui32Gen, uint32_t ui32Period);
+void ROM_PWMGenEnable(uint32_t ui32Base, uint32_t ui32Gen);
+void ROM_PWMGenDisable(uint32_t ui32Base, uint32_t ui32Gen);
+void ROM_PWMPulseWidthSet(uint32_t ui32Base, uint32_t ui32PWMOut, uint32_t ui32Width);
+void ROM_PWMOutputState(uint32_t ui32Base, uint32_t ui32PWMOutBits, bool bEnable);
+void ROM_PWMSyncUpdate(uint32_t ui32Base, uint32_t ui32GenBits);
+void ROM_PWMSyncTimeBase(uint32_t ui32Base, uint32_t ui32GenBits);
+
+#endif /* HOST_REGS_H_ */
@@ -0,0 +1,209 @@
+/*!
+ * @author      Yash Bansod
+ * @date        17th October 2026
+ *
+ * @brief       Source containing the host stand-in for the DriverLib API
+ * @file        HOST_stub.c
+ */
+/* -----------------------          Include Files       --------------------- */
+#include <string.h>                         // Library for String functions
+#include "HOST_stub.h"
+
+/* -----------------------      Global Variables        --------------------- */
+tHostPeriph g_sHost;                                // Peripheral state shared with the simulator
+uint32_t g_pui32HostEeprom[HOST_EEPROM_WORDS];      // EEPROM contents, not cleared with g_sHost
+
+/* -----------------------      Function Definition     --------------------- */
+// Function to load the encoder count seen by QEI1
+void HOST_qeiCount(int64_t i64Count, uint32_t ui32Vel){
+    uint32_t ui32Pos = g_sHost.ui32QeiPosOffset + (uint32_t)i64Count;
+
+    // The direction bit follows the last change of the position counter
+    if (ui32Pos != g_sHost.ui32QeiPos)
+        g_sHost.i32QeiDir = ((int32_t)(ui32Pos - g_sHost.ui32QeiPos) > 0) ? 1 : -1;
+    g_sHost.ui32QeiPos = ui32Pos;
+    g_sHost.ui32QeiVel = ui32Vel;
+}
+
+// Function to queue bytes to be received by UART0, raise UART0IntHandler afterwards
+void HOST_uartFeed(const uint8_t *pui8Rx, uint32_t ui32Len){
+    g_sHost.pui8UartRx = pui8Rx;
+    g_sHost.ui32UartRxLen = ui32Len;
+}
+
+// Function to get the register behind an address of HWREG, a write to the PWM1 Output0 compare is counted
+volatile uint32_t *HOST_hwreg(uint32_t ui32Addr){
+    static uint32_t ui32Other;
+
+    if (ui32Addr == PWM1_BASE + PWM_GEN_0 + PWM_O_X_CMPA){
+        g_sHost.ui32PwmWrites++;
+        return &g_sHost.ui32PwmCmp;
+    }
+    return &ui32Other;
+}
+
+// Function to shift bytes out of the UART0 TX FIFO, UART_INT_TX is raised when it falls to 1/8
+void HOST_uartTxDrain(uint32_t ui32Bytes){
+    uint32_t ui32Old = g_sHost.ui32UartTxFifo;
+    g_sHost.ui32UartTxFifo = (ui32Bytes < ui32Old) ? ui32Old - ui32Bytes : 0;
+    if (ui32Old > HOST_UART_TX_LEVEL && g_sHost.ui32UartTxFifo <= HOST_UART_TX_LEVEL)
+        g_sHost.ui32UartInt |= UART_INT_TX;
+}
+
+// Function to capture an edge at ui32Time in Wide Timer 0A, raise WTIMER0AIntHandler if it returns true
+bool HOST_timerCapture(uint32_t ui32Time){
+    g_sHost.ui32TimerCapture = ui32Time;
+    return (g_sHost.ui32TimerIntMask & TIMER_CAPA_EVENT) != 0;
+}
+
+// System control and NVIC
+void ROM_FPULazyStackingEnable(void){ g_sHost.ui32Calls++; }
+void ROM_FPUEnable(void){ g_sHost.ui32Calls++; }
+void ROM_SysCtlClockSet(uint32_t ui32Config){ (void)ui32Config; g_sHost.ui32Calls++; }
+uint32_t ROM_SysCtlClockGet(void){ g_sHost.ui32Calls++; return HOST_SYSCLK_HZ; }
+void ROM_SysCtlPWMClockSet(uint32_t ui32Config){ (void)ui32Config; g_sHost.ui32Calls++; }
+void ROM_SysCtlPeripheralEnable(uint32_t ui32Peripheral){ (void)ui32Peripheral; g_sHost.ui32Calls++; }
+void ROM_IntEnable(uint32_t ui32Interrupt){ (void)ui32Interrupt; g_sHost.ui32Calls++; }
+void ROM_IntMasterEnable(void){ g_sHost.ui32Calls++; }
+void ROM_IntMasterDisable(void){ g_sHost.ui32Calls++; }
+
+// GPIO
+void ROM_GPIOPinConfigure(uint32_t ui32PinConfig){ (void)ui32PinConfig; g_sHost.ui32Calls++; }
+void ROM_GPIOPinTypePWM(uint32_t ui32Port, uint8_t ui8Pins){ (void)ui32Port; (void)ui8Pins; g_sHost.ui32Calls++; }
+void ROM_GPIOPinTypeQEI(uint32_t ui32Port, uint8_t ui8Pins){ (void)ui32Port; (void)ui8Pins; g_sHost.ui32Calls++; }
+void ROM_GPIOPinTypeUART(uint32_t ui32Port, uint8_t ui8Pins){ (void)ui32Port; (void)ui8Pins; g_sHost.ui32Calls++; }
+void ROM_GPIOPinTypeTimer(uint32_t ui32Port, uint8_t ui8Pins){ (void)ui32Port; (void)ui8Pins; g_sHost.ui32Calls++; }
+void ROM_GPIOPinTypeGPIOOutput(uint32_t ui32Port, uint8_t ui8Pins){ (void)ui32Port; (void)ui8Pins; g_sHost.ui32Calls++; }
+
+void ROM_GPIOPinWrite(uint32_t ui32Port, uint8_t ui8Pins, uint8_t ui8Val){
+    g_sHost.ui32Calls++;
+    g_sHost.ui32GpioWrites++;
+    // Only the motor direction pins on PortD are modelled
+    if (ui32Port == GPIO_PORTD_BASE)
+        g_sHost.ui32GpioD = (g_sHost.ui32GpioD & ~ui8Pins) | (ui8Val & ui8Pins);
+}
+
+// QEI
+void ROM_QEIConfigure(uint32_t ui32Base, uint32_t ui32Config, uint32_t ui32MaxPosition){
+    (void)ui32Base; (void)ui32Config; (void)ui32MaxPosition; g_sHost.ui32Calls++;
+}
+void ROM_QEIVelocityConfigure(uint32_t ui32Base, uint32_t ui32PreDiv, uint32_t ui32Period){
+    (void)ui32Base; (void)ui32PreDiv; (void)ui32Period; g_sHost.ui32Calls++;
+}
+void ROM_QEIVelocityEnable(uint32_t ui32Base){ (void)ui32Base; g_sHost.ui32Calls++; }
+void ROM_QEIEnable(uint32_t ui32Base){ (void)ui32Base; g_sHost.ui32Calls++; }
+void ROM_QEIIntEnable(uint32_t ui32Base, uint32_t ui32IntFlags){ (void)ui32Base; (void)ui32IntFlags; g_sHost.ui32Calls++; }
+void ROM_QEIIntClear(uint32_t ui32Base, uint32_t ui32IntFlags){ (void)ui32Base; (void)ui32IntFlags; g_sHost.ui32Calls++; }
+uint32_t ROM_QEIIntStatus(uint32_t ui32Base, bool bMasked){ (void)ui32Base; (void)bMasked; g_sHost.ui32Calls++; return QEI_INTTIMER; }
+uint32_t ROM_QEIVelocityGet(uint32_t ui32Base){ (void)ui32Base; g_sHost.ui32Calls++; return g_sHost.ui32QeiVel; }
+int32_t ROM_QEIDirectionGet(uint32_t ui32Base){ (void)ui32Base; g_sHost.ui32Calls++; return g_sHost.i32QeiDir; }
+uint32_t ROM_QEIPositionGet(uint32_t ui32Base){ (void)ui32Base; g_sHost.ui32Calls++; return g_sHost.ui32QeiPos; }
+void QEIIntRegister(uint32_t ui32Base, void (*pfnHandler)(void)){ (void)ui32Base; (void)pfnHandler; g_sHost.ui32Calls++; }
+
+void ROM_QEIPositionSet(uint32_t ui32Base, uint32_t ui32Position){
+    (void)ui32Base;
+    g_sHost.ui32Calls++;
+    // Re-base the counter so that the current shaft position reads as ui32Position
+    g_sHost.ui32QeiPosOffset += ui32Position - g_sHost.ui32QeiPos;
+    g_sHost.ui32QeiPos = ui32Position;
+}
+
+// PWM
+void ROM_PWMGenConfigure(uint32_t ui32Base, uint32_t ui32Gen, uint32_t ui32Config){
+    (void)ui32Base; (void)ui32Gen; (void)ui32Config; g_sHost.ui32Calls++;
+}
+void ROM_PWMGenPeriodSet(uint32_t ui32Base, uint32_t ui32Gen, uint32_t ui32Period){
+    (void)ui32Base; (void)ui32Gen; g_sHost.ui32Calls++;
+    g_sHost.ui32PwmPeriod = ui32Period;
+}
+void ROM_PWMGenEnable(uint32_t ui32Base, uint32_t ui32Gen){ (void)ui32Base; (void)ui32Gen; g_sHost.ui32Calls++; }
+void ROM_PWMOutputState(uint32_t ui32Base, uint32_t ui32PWMOutBits, bool bEnable){
+    (void)ui32Base; (void)ui32PWMOutBits; (void)bEnable; g_sHost.ui32Calls++;
+}
+void ROM_PWMPulseWidthSet(uint32_t ui32Base, uint32_t ui32PWMOut, uint32_t ui32Width){
+    (void)ui32Base; (void)ui32PWMOut;
+    g_sHost.ui32Calls++;
+    g_sHost.ui32PwmWrites++;
+    // Count down mode, the generator reloads with the period - 1 (a 16 bit register)
+    g_sHost.ui32PwmCmp = (g_sHost.ui32PwmPeriod - 1 - ui32Width) & 0xFFFF;
+}
+
+// Timer
+void ROM_TimerConfigure(uint32_t ui32Base, uint32_t ui32Config){ (void)ui32Base; (void)ui32Config; g_sHost.ui32Calls++; }
+void ROM_TimerControlEvent(uint32_t ui32Base, uint32_t ui32Timer, uint32_t ui32Event){
+    (void)ui32Base; (void)ui32Timer; (void)ui32Event; g_sHost.ui32Calls++;
+}
+void ROM_TimerLoadSet(uint32_t ui32Base, uint32_t ui32Timer, uint32_t ui32Value){
+    (void)ui32Base; (void)ui32Timer; (void)ui32Value; g_sHost.ui32Calls++;
+}
+void ROM_TimerEnable(uint32_t ui32Base, uint32_t ui32Timer){ (void)ui32Base; (void)ui32Timer; g_sHost.ui32Calls++; }
+void ROM_TimerIntEnable(uint32_t ui32Base, uint32_t ui32IntFlags){ (void)ui32Base; g_sHost.ui32TimerIntMask |= ui32IntFlags; g_sHost.ui32Calls++; }
+void ROM_TimerIntDisable(uint32_t ui32Base, uint32_t ui32IntFlags){ (void)ui32Base; g_sHost.ui32TimerIntMask &= ~ui32IntFlags; g_sHost.ui32Calls++; }
+void ROM_TimerIntClear(uint32_t ui32Base, uint32_t ui32IntFlags){ (void)ui32Base; (void)ui32IntFlags; g_sHost.ui32Calls++; }
+// Timer A returns the captured edge time and Timer B the time now
+uint32_t ROM_TimerValueGet(uint32_t ui32Base, uint32_t ui32Timer){
+    (void)ui32Base; g_sHost.ui32Calls++;
+    return (ui32Timer == TIMER_A) ? g_sHost.ui32TimerCapture : g_sHost.ui32TimerNow;
+}
+
+// EEPROM (ui32Address and ui32Count are in bytes and multiples of 4)
+uint32_t EEPROMInit(void){ g_sHost.ui32Calls++; return EEPROM_INIT_OK; }
+void ROM_EEPROMRead(uint32_t *pui32Data, uint32_t ui32Address, uint32_t ui32Count){
+    g_sHost.ui32Calls++;
+    if (ui32Address + ui32Count <= sizeof(g_pui32HostEeprom))
+        memcpy(pui32Data, (uint8_t *)g_pui32HostEeprom + ui32Address, ui32Count);
+}
+uint32_t ROM_EEPROMProgram(uint32_t *pui32Data, uint32_t ui32Address, uint32_t ui32Count){
+    g_sHost.ui32Calls++;
+    if (ui32Address + ui32Count > sizeof(g_pui32HostEeprom))
+        return 1;
+    memcpy((uint8_t *)g_pui32HostEeprom + ui32Address, pui32Data, ui32Count);
+    return 0;
+}
+
+// UART (the received bytes come from HOST_uartFeed, the transmitted ones are kept in pcUartTx
+// and queued in a TX FIFO that only HOST_uartTxDrain empties)
+void ROM_UARTConfigSetExpClk(uint32_t ui32Base, uint32_t ui32UARTClk, uint32_t ui32Baud, uint32_t ui32Config){
+    (void)ui32Base; (void)ui32UARTClk; (void)ui32Baud; (void)ui32Config; g_sHost.ui32Calls++;
+}
+void ROM_UARTEnable(uint32_t ui32Base){ (void)ui32Base; g_sHost.ui32Calls++; }
+void ROM_UARTFIFOLevelSet(uint32_t ui32Base, uint32_t ui32TxLevel, uint32_t ui32RxLevel){
+    (void)ui32Base; (void)ui32TxLevel; (void)ui32RxLevel; g_sHost.ui32Calls++;
+}
+void ROM_UARTIntEnable(uint32_t ui32Base, uint32_t ui32IntFlags){ (void)ui32Base; (void)ui32IntFlags; g_sHost.ui32Calls++; }
+void ROM_UARTIntClear(uint32_t ui32Base, uint32_t ui32IntFlags){ (void)ui32Base; g_sHost.ui32UartInt &= ~ui32IntFlags; g_sHost.ui32Calls++; }
+uint32_t ROM_UARTIntStatus(uint32_t ui32Base, bool bMasked){ (void)ui32Base; (void)bMasked; g_sHost.ui32Calls++; return g_sHost.ui32UartInt; }
+bool ROM_UARTCharsAvail(uint32_t ui32Base){
+    (void)ui32Base; g_sHost.ui32Calls++;
+    return g_sHost.ui32UartRxLen != 0;
+}
+int32_t ROM_UARTCharGetNonBlocking(uint32_t ui32Base){
+    (void)ui32Base; g_sHost.ui32Calls++;
+    if (g_sHost.ui32UartRxLen == 0)
+        return -1;
+    g_sHost.ui32UartRxLen--;
+    return *g_sHost.pui8UartRx++;
+}
+bool ROM_UARTSpaceAvail(uint32_t ui32Base){
+    (void)ui32Base; g_sHost.ui32Calls++;
+    return g_sHost.ui32UartTxFifo < HOST_UART_FIFO;
+}
+bool ROM_UARTCharPutNonBlocking(uint32_t ui32Base, unsigned char ucData){
+    if (g_sHost.ui32UartTxFifo >= HOST_UART_FIFO)
+        return false;
+    ROM_UARTCharPut(ui32Base, ucData);
+    return true;
+}
+// Nothing drains the FIFO while the firmware waits, so a blocking put never waits
+void ROM_UARTCharPut(uint32_t ui32Base, unsigned char ucData){
+    (void)ui32Base; g_sHost.ui32Calls++;
+    if (g_sHost.ui32UartTxFifo < HOST_UART_FIFO)
+        g_sHost.ui32UartTxFifo++;
+    g_sHost.ui32UartTxBytes++;
+    if (g_sHost.pfnUartTx)
+        g_sHost.pfnUartTx(ucData);
+    if (g_sHost.ui32UartTxLen < sizeof(g_sHost.pcUartTx) - 1){
+        g_sHost.pcUartTx[g_sHost.ui32UartTxLen++] = (char)ucData;
+        g_sHost.pcUartTx[g_sHost.ui32UartTxLen] = '\0';
+    }
+}
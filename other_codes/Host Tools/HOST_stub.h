@@ -0,0 +1,212 @@
+/*!
+ * @author      Yash Bansod
+ * @date        17th October 2026
+ *
+ * @brief       Host stand-in for the DriverLib API
+ * @details     Replaces the TivaWare headers when the firmware sources are compiled
+ *              on a Linux host with HOST_SIM defined. Only the calls and macros used
+ *              by the simulated projects are provided. The peripherals are backed by
+ *              plain variables that the simulator reads and writes, and every call
+ *              made by the firmware is counted so that the work done per interrupt
+ *              can be reported.
+ * @file        HOST_stub.h
+ */
+/* -----------------------          Include Files       --------------------- */
+#include <stdint.h>                         // Library of Standard Integer Types
+#include <stdbool.h>                        // Library of Standard Boolean Types
+
+#ifndef HOST_STUB_H_
+#define HOST_STUB_H_
+
+/* -----------------------      Macro Definitions       --------------------- */
+#define HOST_SYSCLK_HZ          80000000            // System clock set by ROM_SysCtlClockSet
+
+// Peripheral base addresses
+#define GPIO_PORTA_BASE         0x40004000
+#define GPIO_PORTC_BASE         0x40006000
+#define GPIO_PORTD_BASE         0x40007000
+#define GPIO_PORTF_BASE         0x40025000
+#define UART0_BASE              0x4000C000
+#define QEI1_BASE               0x4002D000
+#define PWM1_BASE               0x40029000
+#define WTIMER0_BASE            0x40036000
+
+// GPIO pins and pin mux
+#define GPIO_PIN_0              0x00000001
+#define GPIO_PIN_1              0x00000002
+#define GPIO_PIN_2              0x00000004
+#define GPIO_PIN_3              0x00000008
+#define GPIO_PIN_4              0x00000010
+#define GPIO_PIN_5              0x00000020
+#define GPIO_PIN_6              0x00000040
+#define GPIO_PIN_7              0x00000080
+#define GPIO_PA0_U0RX           0x00000001
+#define GPIO_PA1_U0TX           0x00000401
+#define GPIO_PC4_WT0CCP0        0x00021007
+#define GPIO_PC5_PHA1           0x00021406
+#define GPIO_PC6_PHB1           0x00021806
+#define GPIO_PD0_M1PWM0         0x00030005
+
+// System control
+#define SYSCTL_SYSDIV_2_5       0xC1000000
+#define SYSCTL_USE_PLL          0x00000000
+#define SYSCTL_OSC_MAIN         0x00000000
+#define SYSCTL_XTAL_16MHZ       0x00000540
+#define SYSCTL_PWMDIV_64        0x001A0000
+#define SYSCTL_PERIPH_GPIOA     0xF0000800
+#define SYSCTL_PERIPH_GPIOC     0xF0000802
+#define SYSCTL_PERIPH_GPIOD     0xF0000803
+#define SYSCTL_PERIPH_GPIOF     0xF0000805
+#define SYSCTL_PERIPH_PWM1      0xF0004001
+#define SYSCTL_PERIPH_QEI1      0xF0004401
+#define SYSCTL_PERIPH_UART0     0xF0001800
+#define SYSCTL_PERIPH_EEPROM0   0xF0005800
+#define SYSCTL_PERIPH_WTIMER0   0xF0005C00
+
+// Interrupts
+#define INT_UART0               21
+#define INT_WTIMER0A            110
+
+// QEI
+#define QEI_CONFIG_CAPTURE_A_B  0x00000008
+#define QEI_CONFIG_QUADRATURE   0x00000000
+#define QEI_VELDIV_1            0x00000000
+#define QEI_INTTIMER            0x00000002
+
+// PWM
+#define PWM_GEN_0               0x00000040
+#define PWM_OUT_0               0x00000040
+#define PWM_OUT_0_BIT           0x00000001
+#define PWM_GEN_MODE_DOWN       0x00000000
+#define PWM_O_X_LOAD            0x00000010
+#define PWM_O_X_CMPA            0x00000018
+#define PWM_O_X_CMPB            0x0000001C
+
+// Register access, only the compare register of PWM1 Output0 is modelled
+#define HWREG(x)                (*HOST_hwreg((uint32_t)(x)))
+
+// Timer
+#define TIMER_A                 0x000000FF
+#define TIMER_B                 0x0000FF00
+#define TIMER_BOTH              0x0000FFFF
+#define TIMER_CFG_SPLIT_PAIR    0x04000000
+#define TIMER_CFG_A_CAP_TIME_UP 0x00001017
+#define TIMER_CFG_B_PERIODIC_UP 0x00002200
+#define TIMER_EVENT_BOTH_EDGES  0x0000000C
+#define TIMER_CAPA_EVENT        0x00000004
+
+// UART
+#define UART_CONFIG_WLEN_8      0x00000060
+#define UART_CONFIG_STOP_ONE    0x00000000
+#define UART_CONFIG_PAR_NONE    0x00000000
+#define UART_INT_RX             0x010
+#define UART_INT_TX             0x020
+#define UART_INT_RT             0x040
+#define UART_FIFO_TX1_8         0x00000000
+#define UART_FIFO_RX4_8         0x00000010
+#define HOST_UART_FIFO          16                  // Depth of the UART0 TX FIFO
+#define HOST_UART_TX_LEVEL      2                   // TX FIFO level that raises UART_INT_TX (1/8)
+
+// EEPROM
+#define EEPROM_INIT_OK          0
+#define HOST_EEPROM_WORDS       512                 // Size of the EEPROM in words (2 KB)
+
+/* -----------------------      Global Variables        --------------------- */
+// Peripheral state shared between the stand-in and the simulator
+typedef struct {
+    uint32_t ui32QeiPos;                            // Value returned by ROM_QEIPositionGet
+    uint32_t ui32QeiVel;                            // Value returned by ROM_QEIVelocityGet
+    int32_t i32QeiDir;                              // Value returned by ROM_QEIDirectionGet
+    uint32_t ui32QeiPosOffset;                      // Offset loaded by ROM_QEIPositionSet
+    uint32_t ui32PwmPeriod;                         // Period loaded in PWM1 Generator0
+    uint32_t ui32PwmCmp;                            // Compare value of PWM1 Output0, high from LOAD down to it
+    uint32_t ui32GpioD;                             // Output levels of the GPIO PortD pins
+    uint32_t ui32Calls;                             // Number of DriverLib calls made so far
+    uint32_t ui32PwmWrites;                         // Number of PWM compare value updates so far
+    uint32_t ui32GpioWrites;                        // Number of GPIO writes so far
+    const uint8_t *pui8UartRx;                      // Bytes still to be received by UART0
+    uint32_t ui32UartRxLen;                         // Number of bytes at pui8UartRx
+    char pcUartTx[512];                             // Characters sent by UART0 (the first 511)
+    uint32_t ui32UartTxLen;                         // Number of characters in pcUartTx
+    uint32_t ui32UartTxFifo;                        // Bytes in the UART0 TX FIFO
+    uint32_t ui32UartTxBytes;                       // Bytes sent by UART0 in total
+    uint32_t ui32UartInt;                           // Pending UART0 interrupts
+    void (*pfnUartTx)(uint8_t ui8Byte);             // Called with every byte sent by UART0, if set
+    uint32_t ui32TimerNow;                          // Value of Wide Timer 0B (time now)
+    uint32_t ui32TimerCapture;                      // Time of the last edge captured by Wide Timer 0A
+    uint32_t ui32TimerIntMask;                      // Interrupts enabled in Wide Timer 0
+} tHostPeriph;
+
+extern tHostPeriph g_sHost;
+extern uint32_t g_pui32HostEeprom[HOST_EEPROM_WORDS];  // EEPROM contents, not cleared with g_sHost
+
+/* -----------------------      Function Prototypes     --------------------- */
+void HOST_qeiCount(int64_t i64Count, uint32_t ui32Vel);    // Load the encoder count seen by QEI1
+void HOST_uartFeed(const uint8_t *pui8Rx, uint32_t ui32Len);  // Queue bytes to be received by UART0
+void HOST_uartTxDrain(uint32_t ui32Bytes);          // Shift bytes out of the UART0 TX FIFO
+volatile uint32_t *HOST_hwreg(uint32_t ui32Addr);   // Register behind an address of HWREG
+bool HOST_timerCapture(uint32_t ui32Time);          // Capture an edge in Wide Timer 0A, true if it interrupts
+
+void ROM_FPULazyStackingEnable(void);
+void ROM_FPUEnable(void);
+void ROM_SysCtlClockSet(uint32_t ui32Config);
+uint32_t ROM_SysCtlClockGet(void);
+void ROM_SysCtlPWMClockSet(uint32_t ui32Config);
+void ROM_SysCtlPeripheralEnable(uint32_t ui32Peripheral);
+void ROM_IntEnable(uint32_t ui32Interrupt);
+void ROM_IntMasterEnable(void);
+void ROM_IntMasterDisable(void);
+
+void ROM_GPIOPinConfigure(uint32_t ui32PinConfig);
+void ROM_GPIOPinTypePWM(uint32_t ui32Port, uint8_t ui8Pins);
+void ROM_GPIOPinTypeQEI(uint32_t ui32Port, uint8_t ui8Pins);
+void ROM_GPIOPinTypeUART(uint32_t ui32Port, uint8_t ui8Pins);
+void ROM_GPIOPinTypeTimer(uint32_t ui32Port, uint8_t ui8Pins);
+void ROM_GPIOPinTypeGPIOOutput(uint32_t ui32Port, uint8_t ui8Pins);
+void ROM_GPIOPinWrite(uint32_t ui32Port, uint8_t ui8Pins, uint8_t ui8Val);
+
+void ROM_QEIConfigure(uint32_t ui32Base, uint32_t ui32Config, uint32_t ui32MaxPosition);
+void ROM_QEIVelocityConfigure(uint32_t ui32Base, uint32_t ui32PreDiv, uint32_t ui32Period);
+void ROM_QEIVelocityEnable(uint32_t ui32Base);
+void ROM_QEIEnable(uint32_t ui32Base);
+void ROM_QEIIntEnable(uint32_t ui32Base, uint32_t ui32IntFlags);
+void ROM_QEIIntClear(uint32_t ui32Base, uint32_t ui32IntFlags);
+uint32_t ROM_QEIIntStatus(uint32_t ui32Base, bool bMasked);
+void ROM_QEIPositionSet(uint32_t ui32Base, uint32_t ui32Position);
+uint32_t ROM_QEIPositionGet(uint32_t ui32Base);
+uint32_t ROM_QEIVelocityGet(uint32_t ui32Base);
+int32_t ROM_QEIDirectionGet(uint32_t ui32Base);
+void QEIIntRegister(uint32_t ui32Base, void (*pfnHandler)(void));
+
+void ROM_PWMGenConfigure(uint32_t ui32Base, uint32_t ui32Gen, uint32_t ui32Config);
+void ROM_PWMGenPeriodSet(uint32_t ui32Base, uint32_t ui32Gen, uint32_t ui32Period);
+void ROM_PWMGenEnable(uint32_t ui32Base, uint32_t ui32Gen);
+void ROM_PWMPulseWidthSet(uint32_t ui32Base, uint32_t ui32PWMOut, uint32_t ui32Width);
+void ROM_PWMOutputState(uint32_t ui32Base, uint32_t ui32PWMOutBits, bool bEnable);
+
+void ROM_TimerConfigure(uint32_t ui32Base, uint32_t ui32Config);
+void ROM_TimerControlEvent(uint32_t ui32Base, uint32_t ui32Timer, uint32_t ui32Event);
+void ROM_TimerLoadSet(uint32_t ui32Base, uint32_t ui32Timer, uint32_t ui32Value);
+void ROM_TimerEnable(uint32_t ui32Base, uint32_t ui32Timer);
+void ROM_TimerIntEnable(uint32_t ui32Base, uint32_t ui32IntFlags);
+void ROM_TimerIntDisable(uint32_t ui32Base, uint32_t ui32IntFlags);
+void ROM_TimerIntClear(uint32_t ui32Base, uint32_t ui32IntFlags);
+uint32_t ROM_TimerValueGet(uint32_t ui32Base, uint32_t ui32Timer);
+
+uint32_t EEPROMInit(void);
+void ROM_EEPROMRead(uint32_t *pui32Data, uint32_t ui32Address, uint32_t ui32Count);
+uint32_t ROM_EEPROMProgram(uint32_t *pui32Data, uint32_t ui32Address, uint32_t ui32Count);
+
+void ROM_UARTConfigSetExpClk(uint32_t ui32Base, uint32_t ui32UARTClk, uint32_t ui32Baud, uint32_t ui32Config);
+void ROM_UARTEnable(uint32_t ui32Base);
+void ROM_UARTFIFOLevelSet(uint32_t ui32Base, uint32_t ui32TxLevel, uint32_t ui32RxLevel);
+void ROM_UARTIntEnable(uint32_t ui32Base, uint32_t ui32IntFlags);
+void ROM_UARTIntClear(uint32_t ui32Base, uint32_t ui32IntFlags);
+uint32_t ROM_UARTIntStatus(uint32_t ui32Base, bool bMasked);
+bool ROM_UARTCharsAvail(uint32_t ui32Base);
+bool ROM_UARTSpaceAvail(uint32_t ui32Base);
+int32_t ROM_UARTCharGetNonBlocking(uint32_t ui32Base);
+bool ROM_UARTCharPutNonBlocking(uint32_t ui32Base, unsigned char ucData);
+void ROM_UARTCharPut(uint32_t ui32Base, unsigned char ucData);
+
+#endif /* HOST_STUB_H_ */
@@ -0,0 +1,167 @@
+/*!
+ * @author      Yash Bansod
+ * @date        17th October 2026
+ *
+ * @brief       Source containing the host register model of the UART of the buffered uartstdio
+ * @file        HOST_uart.c
+ */
+/* -----------------------          Include Files       --------------------- */
+#include <string.h>                         // Library for String functions
+#include "HOST_uart.h"
+
+/* -----------------------      Global Variables        --------------------- */
+tHostUart g_sHostUart;                              // Register state shared with the host program
+
+/* -----------------------      Function Prototypes     --------------------- */
+void UARTStdioIntHandler(void);                     // The ISR of the buffered uartstdio
+
+/* -----------------------      Function Definition     --------------------- */
+// Function to reset the model, with the processor taking interrupts
+void HOST_uartReset(void){
+    memset(&g_sHostUart, 0, sizeof(g_sHostUart));
+    g_sHostUart.ui32TxLevel = 2;
+    g_sHostUart.bMaster = true;
+}
+
+// Function to get the register reached by HWREG, the data register taking the next transmit entry
+volatile uint32_t *HOST_uartReg(uint32_t ui32Addr){
+    switch (ui32Addr & 0xFFF){
+    case UART_O_DR:
+        if (g_sHostUart.ui32TxCount == HOST_UART_FIFO){
+            g_sHostUart.ui32Errors++;
+            return &g_sHostUart.ui32Overrun;
+        }
+        return &g_sHostUart.pui32TxFifo[(g_sHostUart.ui32TxHead + g_sHostUart.ui32TxCount++) % HOST_UART_FIFO];
+    case UART_O_FR:
+        g_sHostUart.ui32Fr = (g_sHostUart.ui32TxCount == 0 ? UART_FR_TXFE : 0) |
+                             (g_sHostUart.ui32TxCount == HOST_UART_FIFO ? UART_FR_TXFF : 0) |
+                             (g_sHostUart.ui32RxCount == 0 ? UART_FR_RXFE : 0) |
+                             (g_sHostUart.ui32RxCount == HOST_UART_FIFO ? UART_FR_RXFF : 0);
+        return &g_sHostUart.ui32Fr;
+    default:
+        g_sHostUart.ui32Errors++;
+        return &g_sHostUart.ui32Overrun;
+    }
+}
+
+// Function to set the master interrupt enable, returns true if the interrupts were off
+bool HOST_uartMaster(bool bEnable){
+    bool bWasOff = !g_sHostUart.bMaster;
+
+    g_sHostUart.bMaster = bEnable;
+    return bWasOff;
+}
+
+// Function to write a byte into the transmit FIFO, returns false if it is full
+bool HOST_uartWrite(uint32_t ui32Base, uint8_t ui8Byte){
+    if (g_sHostUart.ui32TxCount == HOST_UART_FIFO) return false;
+    *HOST_uartReg(ui32Base + UART_O_DR) = ui8Byte;
+    return true;
+}
+
+// Function to read the oldest byte of the receive FIFO, with the empty flag if there is none
+int32_t HOST_uartRead(void){
+    uint8_t ui8Byte;
+
+    if (g_sHostUart.ui32RxCount == 0){
+        g_sHostUart.ui32Errors++;
+        return 0x100;
+    }
+    ui8Byte = g_sHostUart.pui8RxFifo[g_sHostUart.ui32RxHead];
+    g_sHostUart.ui32RxHead = (g_sHostUart.ui32RxHead + 1) % HOST_UART_FIFO;
+    g_sHostUart.ui32RxCount--;
+    return ui8Byte;
+}
+
+// Function to set up a uDMA transfer into the data register
+void HOST_uartDmaSet(uint32_t ui32Ch, uint32_t ui32Mode, void *pvSrc, void *pvDst, uint32_t ui32Len){
+    (void)ui32Ch;
+
+    // A running channel, another mode or destination, or a length the controller cannot count is a misuse
+    if (g_sHostUart.bDmaOn || ui32Mode != UDMA_MODE_BASIC || (uintptr_t)pvDst != UART0_BASE + UART_O_DR ||
+        ui32Len == 0 || ui32Len > HOST_UART_DMA_MAX){
+        g_sHostUart.ui32Errors++;
+        return;
+    }
+    g_sHostUart.pui8DmaSrc = (const uint8_t *)pvSrc;
+    g_sHostUart.ui32DmaLeft = ui32Len;
+    g_sHostUart.ui64DmaSets++;
+    if (ui32Len > g_sHostUart.ui32DmaMax) g_sHostUart.ui32DmaMax = ui32Len;
+}
+
+// Function of the uDMA channel, moving a burst when the transmit FIFO asks for one
+static void HOST_uartDma(void){
+    uint32_t ui32Burst;
+
+    if (!g_sHostUart.bDmaTx || !g_sHostUart.bDmaOn) return;
+    if (g_sHostUart.ui32DmaLeft && g_sHostUart.ui32TxCount <= g_sHostUart.ui32TxLevel){
+        ui32Burst = g_sHostUart.ui32DmaLeft < HOST_UART_BURST ? g_sHostUart.ui32DmaLeft : HOST_UART_BURST;
+        g_sHostUart.ui32DmaLeft -= ui32Burst;
+        while (ui32Burst--) HOST_uartWrite(UART0_BASE, *g_sHostUart.pui8DmaSrc++);
+    }
+
+    // The completion stops the channel and raises the interrupt of the UART
+    if (g_sHostUart.ui32DmaLeft == 0){
+        g_sHostUart.bDmaOn = false;
+        g_sHostUart.bPend = true;
+    }
+}
+
+// Function to receive a byte into the receive FIFO, returns false if the FIFO was full
+bool HOST_uartFeed(uint8_t ui8Byte){
+    if (g_sHostUart.ui32RxCount == HOST_UART_FIFO){
+        g_sHostUart.ui32RxLost++;
+        return false;
+    }
+    g_sHostUart.pui8RxFifo[(g_sHostUart.ui32RxHead + g_sHostUart.ui32RxCount++) % HOST_UART_FIFO] = ui8Byte;
+    g_sHostUart.ui32RxQuiet = 0;
+    g_sHostUart.ui64Received++;
+
+    // The receive interrupt at the 1/8 level of UART_FIFO_RX1_8
+    if (g_sHostUart.ui32RxCount >= 2) g_sHostUart.ui32Ris |= UART_INT_RX;
+    return true;
+}
+
+// Function to call the ISR while its interrupt is raised
+static void HOST_uartDispatch(void){
+    uint32_t ui32Nested = 0;
+
+    while (g_sHostUart.bMaster && g_sHostUart.bIntEnabled &&
+           (g_sHostUart.bPend || (g_sHostUart.ui32Ris & g_sHostUart.ui32Im))){
+        // A raised interrupt the handler does not clear would never let the main loop run
+        if (++ui32Nested > 100){
+            g_sHostUart.ui32Errors++;
+            return;
+        }
+        g_sHostUart.bPend = false;
+        g_sHostUart.ui64Ints++;
+        UARTStdioIntHandler();
+    }
+}
+
+// Function to run the line for a number of byte times, sending a byte of the transmit FIFO in each
+void HOST_uartRun(uint32_t ui32Bytes){
+    uint8_t ui8Byte;
+
+    HOST_uartDispatch();
+    while (ui32Bytes--){
+        if (g_sHostUart.ui32TxCount){
+            ui8Byte = (uint8_t)g_sHostUart.pui32TxFifo[g_sHostUart.ui32TxHead];
+            g_sHostUart.ui32TxHead = (g_sHostUart.ui32TxHead + 1) % HOST_UART_FIFO;
+            g_sHostUart.ui32TxCount--;
+            g_sHostUart.ui64Sent++;
+            HOST_uartPut(ui8Byte);
+
+            // The transmit interrupt as the FIFO drops to its level
+            if (g_sHostUart.ui32TxCount == g_sHostUart.ui32TxLevel) g_sHostUart.ui32Ris |= UART_INT_TX;
+        }
+
+        HOST_uartDma();
+
+        // The receive timeout once the line has been quiet with bytes in the FIFO
+        if (g_sHostUart.ui32RxCount && ++g_sHostUart.ui32RxQuiet == HOST_UART_TIMEOUT)
+            g_sHostUart.ui32Ris |= UART_INT_RT;
+
+        HOST_uartDispatch();
+    }
+}
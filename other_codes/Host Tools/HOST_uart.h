@@ -0,0 +1,179 @@
+/*!
+ * @author      Yash Bansod
+ * @date        17th October 2026
+ *
+ * @brief       Host stand-in for the DriverLib API of uartstdio (UART Stdio)
+ * @details     Replaces the TivaWare headers when uartstdio.c and LOG_defer.c are compiled
+ *              on a Linux host with HOST_SIM defined. The calls that configure the UART
+ *              do nothing. The tool that includes this header defines HOST_uartPut(),
+ *              which takes every byte the line sends.
+ *              In the unbuffered mode of uartstdio the tool also defines HOST_uartGet()
+ *              for UARTgets(). The UART FIFO never fills, so the time a target spends
+ *              waiting for the line is not counted.
+ *              With UART_BUFFERED the calls and HWREG reach the register model of
+ *              HOST_uart.c instead: the 16 entry transmit and receive FIFOs of the UART,
+ *              its raw and masked interrupts, the pending bit of its NVIC interrupt and
+ *              the master interrupt enable. HWREG of the data register takes the next
+ *              entry of the transmit FIFO, uartstdio only writing it. With UART_DMA the
+ *              model adds the uDMA transmit channel of the UART: a basic transfer moves
+ *              a burst of up to 4 bytes whenever the FIFO is at or below its level, and
+ *              its completion disables the channel and pends the UART interrupt, as on
+ *              the TM4C123. HOST_uartRun() sends and receives a byte time at a time and
+ *              calls UARTStdioIntHandler() whenever the interrupt is raised; the handler
+ *              thus only runs between two calls of the tool, whose races RING_stress
+ *              covers.
+ * @file        HOST_uart.h
+ */
+/* -----------------------          Include Files       --------------------- */
+#include <stdint.h>                         // Library of Standard Integer Types
+#include <stdbool.h>                        // Library of Standard Boolean Types
+
+#ifndef HOST_UART_H_
+#define HOST_UART_H_
+
+/* -----------------------      Macro Definitions       --------------------- */
+// Peripheral base addresses, interrupts and clock gates of the UARTs
+#define UART0_BASE              0x4000C000
+#define UART1_BASE              0x4000D000
+#define UART2_BASE              0x4000E000
+#define INT_UART0               21
+#define INT_UART1               22
+#define INT_UART2               49
+#define SYSCTL_PERIPH_UART0     0xF0001800
+#define SYSCTL_PERIPH_UART1     0xF0001801
+#define SYSCTL_PERIPH_UART2     0xF0001802
+
+// UART
+#define UART_CONFIG_WLEN_8      0x00000060
+#define UART_CONFIG_STOP_ONE    0x00000000
+#define UART_CONFIG_PAR_NONE    0x00000000
+#define UART_O_DR               0x00000000
+#define UART_O_FR               0x00000018
+#define UART_FR_TXFE            0x00000080
+#define UART_FR_RXFF            0x00000040
+#define UART_FR_TXFF            0x00000020
+#define UART_FR_RXFE            0x00000010
+#define UART_INT_RT             0x040
+#define UART_INT_TX             0x020
+#define UART_INT_RX             0x010
+#define UART_FIFO_TX1_8         0x00000000
+#define UART_FIFO_TX4_8         0x00000002
+#define UART_FIFO_RX1_8         0x00000000
+#define UART_DMA_TX             0x00000002
+
+// uDMA
+#define UDMA_CH9_UART0TX        0x00000009
+#define UDMA_CH23_UART1TX       0x00000017
+#define UDMA_CH1_UART2TX        0x00010001
+#define UDMA_PRI_SELECT         0x00000000
+#define UDMA_MODE_BASIC         0x00000001
+#define UDMA_ATTR_USEBURST      0x00000001
+#define UDMA_ATTR_ALTSELECT     0x00000002
+#define UDMA_ATTR_HIGH_PRIORITY 0x00000004
+#define UDMA_ATTR_REQMASK       0x00000008
+#define UDMA_SIZE_8             0x00000000
+#define UDMA_SRC_INC_8          0x00000000
+#define UDMA_DST_INC_NONE       0xC0000000
+#define UDMA_ARB_4              0x00008000
+
+#define HOST_UART_FIFO          16                  // Entries of each FIFO of the UART
+#define HOST_UART_TIMEOUT       4                   // Byte times of a quiet line before UART_INT_RT
+#define HOST_UART_BURST         4                   // Bytes of a uDMA burst, UDMA_ARB_4
+#define HOST_UART_DMA_MAX       1024                // Longest basic uDMA transfer
+
+#ifdef UART_BUFFERED
+// DriverLib checks its arguments, the failed ASSERTs are counted in ui32Asserts
+#define ASSERT(bExpr)           do { if (!(bExpr)) g_sHostUart.ui32Asserts++; } while (0)
+#else
+#define ASSERT(bExpr)
+#endif
+
+// The configuration calls have no effect on the host
+#define MAP_SysCtlPeripheralPresent(ui32Peripheral)     ((void)(ui32Peripheral), true)
+#define MAP_SysCtlPeripheralEnable(ui32Peripheral)      ((void)(ui32Peripheral))
+#define MAP_UARTConfigSetExpClk(ui32Base, ui32Clock, ui32Baud, ui32Config)  \
+                                ((void)(ui32Base), (void)(ui32Clock), (void)(ui32Baud), (void)(ui32Config))
+#define MAP_UARTEnable(ui32Base)                        ((void)(ui32Base))
+
+#ifdef UART_BUFFERED
+// The interrupt and data calls reach the register model of HOST_uart.c
+#define HWREG(ui32Addr)                                 (*HOST_uartReg(ui32Addr))
+#define MAP_IntMasterDisable()                          HOST_uartMaster(false)
+#define MAP_IntMasterEnable()                           HOST_uartMaster(true)
+#define MAP_IntEnable(ui32Int)                          ((void)(ui32Int), g_sHostUart.bIntEnabled = true)
+#define MAP_IntPendSet(ui32Int)                         ((void)(ui32Int), g_sHostUart.bPend = true)
+#define MAP_UARTFIFOLevelSet(ui32Base, ui32Tx, ui32Rx)  ((void)(ui32Base), g_sHostUart.ui32TxLevel = \
+                                ((ui32Tx) == UART_FIFO_TX4_8 ? 8 : 2), (void)(ui32Rx))
+#define MAP_UARTIntEnable(ui32Base, ui32Flags)          ((void)(ui32Base), g_sHostUart.ui32Im |= (ui32Flags))
+#define MAP_UARTIntDisable(ui32Base, ui32Flags)         ((void)(ui32Base), g_sHostUart.ui32Im &= ~(ui32Flags))
+#define MAP_UARTIntStatus(ui32Base, bMasked)            ((void)(ui32Base), \
+                                (bMasked) ? (g_sHostUart.ui32Ris & g_sHostUart.ui32Im) : g_sHostUart.ui32Ris)
+#define MAP_UARTIntClear(ui32Base, ui32Flags)           ((void)(ui32Base), g_sHostUart.ui32Ris &= ~(ui32Flags))
+#define MAP_UARTSpaceAvail(ui32Base)                    ((void)(ui32Base), g_sHostUart.ui32TxCount < HOST_UART_FIFO)
+#define MAP_UARTCharPutNonBlocking(ui32Base, ucData)    HOST_uartWrite((ui32Base), (ucData))
+#define MAP_UARTCharsAvail(ui32Base)                    ((void)(ui32Base), g_sHostUart.ui32RxCount != 0)
+#define MAP_UARTCharGetNonBlocking(ui32Base)            ((void)(ui32Base), HOST_uartRead())
+#define MAP_UARTDMAEnable(ui32Base, ui32Flags)          ((void)(ui32Base), g_sHostUart.bDmaTx = ((ui32Flags) & UART_DMA_TX) != 0)
+
+// The uDMA channel of the transmitter, the model checking that it writes the data register
+#define MAP_uDMAControlBaseGet()                        ((void *)&g_sHostUart)
+#define MAP_uDMAChannelAssign(ui32Mapping)              ((void)(ui32Mapping))
+#define MAP_uDMAChannelAttributeEnable(ui32Ch, ui32Attr)    ((void)(ui32Ch), g_sHostUart.ui32DmaAttr |= (ui32Attr))
+#define MAP_uDMAChannelAttributeDisable(ui32Ch, ui32Attr)   ((void)(ui32Ch), g_sHostUart.ui32DmaAttr &= ~(ui32Attr))
+#define MAP_uDMAChannelControlSet(ui32Ch, ui32Control)  ((void)(ui32Ch), (void)(ui32Control))
+#define MAP_uDMAChannelTransferSet(ui32Ch, ui32Mode, pvSrc, pvDst, ui32Len) \
+                                HOST_uartDmaSet((ui32Ch), (ui32Mode), (pvSrc), (pvDst), (ui32Len))
+#define MAP_uDMAChannelEnable(ui32Ch)                   ((void)(ui32Ch), g_sHostUart.bDmaOn = true)
+#define MAP_uDMAChannelDisable(ui32Ch)                  ((void)(ui32Ch), g_sHostUart.bDmaOn = false)
+#define MAP_uDMAChannelIsEnabled(ui32Ch)                ((void)(ui32Ch), g_sHostUart.bDmaOn)
+#else
+#define MAP_IntMasterDisable()                          false
+#define MAP_IntMasterEnable()                           false
+
+// The UART data calls go to the tool
+#define MAP_UARTCharPut(ui32Base, ucData)               ((void)(ui32Base), HOST_uartPut(ucData))
+#define MAP_UARTCharGet(ui32Base)                       ((void)(ui32Base), HOST_uartGet())
+#endif
+
+/* -----------------------      Global Variables        --------------------- */
+typedef struct {
+    uint32_t pui32TxFifo[HOST_UART_FIFO];           // Transmit FIFO
+    uint32_t ui32TxHead, ui32TxCount;               // Oldest entry and entries of the transmit FIFO
+    uint8_t pui8RxFifo[HOST_UART_FIFO];             // Receive FIFO
+    uint32_t ui32RxHead, ui32RxCount;               // Oldest entry and entries of the receive FIFO
+    uint32_t ui32RxQuiet;                           // Byte times since the last byte received
+    uint32_t ui32TxLevel;                           // Transmit FIFO entries raising UART_INT_TX or a burst
+    uint32_t ui32Ris, ui32Im;                       // Raw interrupts and interrupt mask
+    uint32_t ui32Fr;                                // Flags of the last HWREG read of UART_O_FR
+    uint32_t ui32Overrun;                           // Entry written by HWREG to a full transmit FIFO
+    bool bPend;                                     // Interrupt pending in the NVIC
+    bool bIntEnabled;                               // Interrupt enabled in the NVIC
+    bool bMaster;                                   // Interrupts enabled by the processor
+    bool bDmaTx;                                    // Transmit FIFO requests the uDMA
+    bool bDmaOn;                                    // uDMA transmit channel enabled
+    uint32_t ui32DmaAttr;                           // Attributes of the uDMA channel
+    const uint8_t *pui8DmaSrc;                      // Next byte of the uDMA transfer
+    uint32_t ui32DmaLeft;                           // Bytes left in the uDMA transfer
+    uint64_t ui64Sent, ui64Received;                // Bytes through the line
+    uint64_t ui64Ints;                              // Calls of UARTStdioIntHandler()
+    uint64_t ui64DmaSets;                           // uDMA transfers started
+    uint32_t ui32DmaMax;                            // Longest uDMA transfer
+    uint32_t ui32Asserts;                           // Failed ASSERTs of DriverLib
+    uint32_t ui32Errors;                            // Misuses of the registers the model found
+    uint32_t ui32RxLost;                            // Bytes received into a full receive FIFO
+} tHostUart;
+
+extern tHostUart g_sHostUart;                       // Register model of HOST_uart.c
+
+/* -----------------------      Function Prototypes     --------------------- */
+void HOST_uartPut(unsigned char ucData);            // Byte sent by the UART
+int32_t HOST_uartGet(void);                         // Byte received by the UART, unbuffered
+void HOST_uartReset(void);                          // Model after reset, interrupts enabled
+volatile uint32_t *HOST_uartReg(uint32_t ui32Addr); // Register reached by HWREG
+bool HOST_uartMaster(bool bEnable);                 // Master interrupt enable, returns true if it was off
+bool HOST_uartWrite(uint32_t ui32Base, uint8_t ui8Byte);   // Byte into the transmit FIFO, false if full
+int32_t HOST_uartRead(void);                        // Oldest byte of the receive FIFO
+void HOST_uartDmaSet(uint32_t ui32Ch, uint32_t ui32Mode, void *pvSrc, void *pvDst, uint32_t ui32Len);  // uDMA transfer
+bool HOST_uartFeed(uint8_t ui8Byte);                // Byte arriving at the receive FIFO, false if lost
+void HOST_uartRun(uint32_t ui32Bytes);              // Byte times of the line and the interrupts they raise
+#endif /* HOST_UART_H_ */
@@ -0,0 +1,267 @@
+/*!
+ * @author      Yash Bansod
+ * @date        17th October 2026
+ *
+ * @brief       Host stand-in of the sleeping main loop of LED Button Control
+ * @details     The program builds the waveform of SW1 and SW2 pressed -n times, alone or
+ *              together, with holds of 80 ms to 1.5 s, gaps of 80 ms to 3 s and contact
+ *              bounce of -b ms at every edge, and replays it through BTN_event.c and
+ *              LED_wake.c of the firmware as main.c runs them: the SysTick samples the
+ *              switches every 10 ms until LED_TICK_DONE() stops it, then the low level of
+ *              a pressed switch wakes the core, is sampled at once and restarts the
+ *              SysTick for a full period. Every wake runs the main loop once.
+ *              The LEDs are checked at the end of every part of the waveform that holds
+ *              a combination of the switches (or none) long enough to be debounced, so a
+ *              press missed while the SysTick is stopped is an error.
+ *              The counts are set against the former main loop, which polled the pins in
+ *              a loop of -c cycles, and against a SysTick that never stops. The wake
+ *              statistics are fed with a cycle count of the time at 80 MHz plus the
+ *              modelled cycles of a wake: -u cycles to the LED update and -a cycles awake
+ *              (estimates, measure them on the target with sLedStats). The exit code is 1
+ *              if a check fails.
+ *
+ * @note        Build and run from this folder:
+ *              gcc -O2 -Wall -Wextra -I"../../TM4C123G LaunchPad LED Button Control" LED_sleep.c
+ *                  "../../TM4C123G LaunchPad LED Button Control/LED_wake.c"
+ *                  "../../TM4C123G LaunchPad LED Button Control/BTN_event.c" -o LED_sleep
+ *              ./LED_sleep
+ *              ./LED_sleep -n 1000 -b 10 -s 3
+ * @file        LED_sleep.c
+ */
+/* -----------------------          Include Files       --------------------- */
+#include <stdio.h>                          // Library for Standard I/O
+#include <stdlib.h>                         // Standard Library
+#include <string.h>                         // Library for String functions
+#include <unistd.h>                         // Library for getopt
+#include "LED_wake.h"
+
+/* -----------------------      Macro Definitions       --------------------- */
+#define SIM_CPU_HZ          80000000u               // Macro for the system clock of the target
+#define SIM_RES_US          50                      // Macro for the time step of the waveform in us
+#define SIM_TICK_HZ         100                     // Macro for the SysTick rate of main.c
+#define SIM_TICK_STEPS      (1000000 / SIM_TICK_HZ / SIM_RES_US)
+#define SIM_STABLE_MS       60                      // Macro for the hold of a combination that must reach the LEDs
+#define SIM_CHECKS_MAX      8192                    // Macro for the most checks of a run
+#define SIM_STEPS(f64Ms)    ((uint32_t)((f64Ms) * 1000.0 / SIM_RES_US))
+
+/* -----------------------      Global Variables        --------------------- */
+typedef struct {
+    uint32_t ui32Step;                              // Time step of the check
+    uint8_t ui8Leds;                                // LEDs expected
+} tSimCheck;
+
+typedef struct {
+    tBtnPort sBtn;                                  // Switches, as sBtnPort of main.c
+    tLedStats sStats;                               // Wake statistics, as sLedStats of main.c
+    bool bTicking;                                  // SysTick running, as boolTicking of main.c
+    bool bStop;                                     // SysTick allowed to stop
+    uint8_t ui8Leds;                                // LEDs written
+    uint32_t ui32NextTick;                          // Time step of the next SysTick
+    uint32_t ui32TickWakes;                         // Wakes by the SysTick
+} tSimCore;
+
+static uint32_t g_ui32Presses = 200;                // Combinations pressed per run
+static double g_f64BounceMs = 5.0;                  // Bounce after every edge in ms
+static uint32_t g_ui32Seed = 1;                     // Seed of the waveform
+static uint32_t g_ui32PollCycles = 40;              // Cycles of an iteration of the former polling loop
+static uint32_t g_ui32UpdateCycles = 150;           // Cycles from a wake to the LED update
+static uint32_t g_ui32ActiveCycles = 400;           // Cycles awake per wake
+
+static tSimCheck g_psCheck[SIM_CHECKS_MAX];
+static uint32_t g_ui32Checks;
+static uint8_t *g_pui8Wave;                         // PortF switch pins per time step, low when pressed
+static uint32_t g_ui32Steps;
+
+/* -----------------------      Function Definition     --------------------- */
+// Function to get a random number in [0, 1)
+static double SIM_rand(void){
+    return rand() / (RAND_MAX + 1.0);
+}
+
+// Function to get a random time in steps between two times in ms
+static uint32_t SIM_randSteps(double f64MinMs, double f64MaxMs){
+    return SIM_STEPS(f64MinMs + (f64MaxMs - f64MinMs) * SIM_rand());
+}
+
+// Function to press a switch from one step to another, with chatter after both edges
+static void SIM_press(uint8_t ui8Pin, uint32_t ui32Start, uint32_t ui32End){
+    uint32_t ui32Step, ui32Edge, ui32Bounce = SIM_STEPS(g_f64BounceMs);
+
+    for (ui32Step = ui32Start; ui32Step < ui32End; ui32Step++)
+        g_pui8Wave[ui32Step] &= ~ui8Pin;
+
+    // Chatter: pulses of the former level of 0.05 to 0.5 ms while the contact settles
+    for (ui32Edge = 0; ui32Edge < 2; ui32Edge++){
+        uint32_t ui32From = ui32Edge ? ui32End : ui32Start;
+
+        for (ui32Step = ui32From + SIM_randSteps(0, 0.5); ui32Step < ui32From + ui32Bounce; ){
+            uint32_t ui32Len = SIM_randSteps(0.05, 0.5) + 1;
+
+            for ( ; ui32Len && ui32Step < ui32From + ui32Bounce; ui32Len--, ui32Step++)
+                g_pui8Wave[ui32Step] ^= ui8Pin;
+            ui32Step += SIM_randSteps(0.05, 0.5) + 1;
+        }
+    }
+}
+
+// Function to add a check of the LEDs at the end of a stable part of the waveform
+static void SIM_check(uint32_t ui32Start, uint32_t ui32End, uint8_t ui8Leds){
+    if (ui32End < ui32Start + SIM_STEPS(SIM_STABLE_MS + g_f64BounceMs) || g_ui32Checks == SIM_CHECKS_MAX)
+        return;
+    g_psCheck[g_ui32Checks].ui32Step = ui32End - 1;
+    g_psCheck[g_ui32Checks].ui8Leds = ui8Leds;
+    g_ui32Checks++;
+}
+
+// Function to build the waveform of the combinations and their checks
+static void SIM_build(void){
+    uint32_t ui32Step = SIM_STEPS(500), ui32Press;
+
+    g_ui32Steps = SIM_STEPS(500) + g_ui32Presses * SIM_STEPS(5000 + 2 * g_f64BounceMs) + SIM_STEPS(1000);
+    g_pui8Wave = malloc(g_ui32Steps);
+    memset(g_pui8Wave, LED_SWITCHES, g_ui32Steps);
+    g_ui32Checks = 0;
+
+    for (ui32Press = 0; ui32Press < g_ui32Presses; ui32Press++){
+        uint32_t ui32Combo = (uint32_t)(SIM_rand() * 3), ui32End;
+
+        if (ui32Combo < 2){
+            // One switch alone
+            uint8_t ui8Pin = ui32Combo ? LED_SW2 : LED_SW1;
+
+            ui32End = ui32Step + SIM_randSteps(80, 1500);
+            SIM_press(ui8Pin, ui32Step, ui32End);
+            SIM_check(ui32Step, ui32End, LED_COLOUR(ui8Pin));
+        } else{
+            // Both switches, pressed and released up to 60 ms apart in either order
+            uint32_t ui32Press1 = ui32Step, ui32Press2 = ui32Step + SIM_randSteps(0, 60);
+            uint32_t ui32Release1 = ui32Press2 + SIM_randSteps(80, 1500), ui32Release2 = ui32Release1 + SIM_randSteps(0, 60);
+            uint8_t ui8First = SIM_rand() < 0.5 ? LED_SW1 : LED_SW2;
+            bool bFirstOut = SIM_rand() < 0.5;      // The switch pressed first is released first
+
+            SIM_press(ui8First, ui32Press1, bFirstOut ? ui32Release1 : ui32Release2);
+            SIM_press(LED_SWITCHES ^ ui8First, ui32Press2, bFirstOut ? ui32Release2 : ui32Release1);
+            SIM_check(ui32Press2, ui32Release1, LED_RED);
+            ui32End = ui32Release2;
+        }
+        // The gap after the release, long enough for every bounce to end
+        ui32Step = ui32End + SIM_STEPS(g_f64BounceMs) + SIM_randSteps(80, 3000);
+        SIM_check(ui32End, ui32Step, LED_WHITE);
+    }
+    g_ui32Steps = ui32Step + SIM_STEPS(1000);
+}
+
+// Function to get the cycle counter at a time step plus some cycles of the wake
+static uint32_t SIM_cycles(uint32_t ui32Step, uint32_t ui32Cycles){
+    return (uint32_t)((uint64_t)ui32Step * (SIM_CPU_HZ / 1000000 * SIM_RES_US) + ui32Cycles);
+}
+
+// Function to run the main loop of main.c once after a wake
+static void SIM_main(tSimCore *psCore, uint32_t ui32Step, bool bSwitch){
+    uint8_t ui8Leds;
+
+    LED_statsWake(&psCore->sStats, SIM_cycles(ui32Step, 0), bSwitch);
+    if (LED_service(&psCore->sBtn, &ui8Leds)){
+        psCore->ui8Leds = ui8Leds;
+        LED_statsUpdate(&psCore->sStats, SIM_cycles(ui32Step, g_ui32UpdateCycles));
+    }
+    if (psCore->bStop && psCore->bTicking && LED_TICK_DONE(&psCore->sBtn))
+        psCore->bTicking = false;
+    LED_statsSleep(&psCore->sStats, SIM_cycles(ui32Step, g_ui32ActiveCycles));
+}
+
+// Function to replay the waveform, returns the failed checks
+static uint32_t SIM_run(tSimCore *psCore, bool bStop){
+    uint32_t ui32Step, ui32Check = 0, ui32Failed = 0;
+
+    BTN_init(&psCore->sBtn, LED_SWITCHES, LED_SWITCHES, SIM_TICK_HZ);
+    LED_statsInit(&psCore->sStats, 0);
+    psCore->bTicking = true;
+    psCore->bStop = bStop;
+    psCore->ui8Leds = LED_WHITE;
+    psCore->ui32NextTick = SIM_TICK_STEPS;
+    psCore->ui32TickWakes = 0;
+
+    for (ui32Step = 0; ui32Step < g_ui32Steps; ui32Step++){
+        uint8_t ui8Pins = g_pui8Wave[ui32Step];
+
+        if (!psCore->bTicking){
+            // PortFIntHandler: a low level samples the switches and restarts the SysTick
+            if ((ui8Pins & LED_SWITCHES) != LED_SWITCHES){
+                BTN_sample(&psCore->sBtn, ui8Pins);
+                psCore->bTicking = true;
+                psCore->ui32NextTick = ui32Step + SIM_TICK_STEPS;
+                SIM_main(psCore, ui32Step, true);
+            }
+        } else if (ui32Step == psCore->ui32NextTick){
+            // SysTickIntHandler
+            BTN_sample(&psCore->sBtn, ui8Pins);
+            psCore->ui32NextTick += SIM_TICK_STEPS;
+            psCore->ui32TickWakes++;
+            SIM_main(psCore, ui32Step, false);
+        }
+
+        while (ui32Check < g_ui32Checks && g_psCheck[ui32Check].ui32Step == ui32Step){
+            if (psCore->ui8Leds != g_psCheck[ui32Check].ui8Leds){
+                if (ui32Failed < 10)
+                    printf("# %s: LEDs 0x%02X at %.2f ms, expected 0x%02X\n", bStop ? "sleep" : "tick",
+                           psCore->ui8Leds, ui32Step * SIM_RES_US / 1000.0, g_psCheck[ui32Check].ui8Leds);
+                ui32Failed++;
+            }
+            ui32Check++;
+        }
+    }
+    return ui32Failed;
+}
+
+// Function to print the options
+static void SIM_usage(const char *pcName){
+    fprintf(stderr, "usage: %s [-n presses] [-b bounce ms] [-s seed] [-c poll cycles] [-u update cycles]"
+            " [-a active cycles]\n", pcName);
+}
+
+/* -----------------------          Main Program        --------------------- */
+int main(int argc, char *argv[]){
+    static tSimCore sSleep, sTick;
+    uint32_t ui32Failed;
+    double f64Seconds, f64Polls, f64Active;
+    int iOpt;
+
+    while ((iOpt = getopt(argc, argv, "n:b:s:c:u:a:")) != -1){
+        switch (iOpt){
+        case 'n': g_ui32Presses = (uint32_t)strtoul(optarg, NULL, 0); break;
+        case 'b': g_f64BounceMs = atof(optarg); break;
+        case 's': g_ui32Seed = (uint32_t)strtoul(optarg, NULL, 0); break;
+        case 'c': g_ui32PollCycles = (uint32_t)strtoul(optarg, NULL, 0); break;
+        case 'u': g_ui32UpdateCycles = (uint32_t)strtoul(optarg, NULL, 0); break;
+        case 'a': g_ui32ActiveCycles = (uint32_t)strtoul(optarg, NULL, 0); break;
+        default: SIM_usage(argv[0]); return 2;
+        }
+    }
+    if (g_ui32Presses == 0 || g_ui32PollCycles == 0 || g_ui32ActiveCycles < g_ui32UpdateCycles){
+        SIM_usage(argv[0]);
+        return 2;
+    }
+
+    srand(g_ui32Seed);
+    SIM_build();
+    ui32Failed = SIM_run(&sSleep, true) + SIM_run(&sTick, false);
+
+    f64Seconds = g_ui32Steps * (SIM_RES_US / 1e6);
+    f64Polls = f64Seconds * SIM_CPU_HZ / g_ui32PollCycles;
+    f64Active = (double)sSleep.sStats.ui64Active;
+    printf("waveform            %.1f s, %u presses, bounce %.1f ms, %u checks\n",
+           f64Seconds, g_ui32Presses, g_f64BounceMs, g_ui32Checks);
+    printf("polling loop        %.0f iterations (%u cycles each)\n", f64Polls, g_ui32PollCycles);
+    printf("SysTick never off   %u wakes, %u LED updates\n", sTick.sStats.ui32Wakes, sTick.sStats.ui32Updates);
+    printf("sleeping main loop  %u wakes (%u by a switch, %u by the SysTick), %u LED updates\n",
+           sSleep.sStats.ui32Wakes, sSleep.sStats.ui32SwitchWakes, sSleep.ui32TickWakes, sSleep.sStats.ui32Updates);
+    printf("iterations avoided  %.0f (%.5f %% of the polling iterations still run)\n",
+           f64Polls - sSleep.sStats.ui32Wakes, 100.0 * sSleep.sStats.ui32Wakes / f64Polls);
+    printf("awake               %.0f cycles, %.5f %% of the time, wake latency up to %u cycles\n",
+           f64Active, 100.0 * f64Active / (f64Seconds * SIM_CPU_HZ), sSleep.sStats.ui32LatencyMax);
+    printf("%s (%u failed checks)\n", ui32Failed ? "FAIL" : "ok", ui32Failed);
+
+    free(g_pui8Wave);
+    return ui32Failed ? 1 : 0;
+}
@@ -0,0 +1,184 @@
+/*!
+ * @author      Yash Bansod
+ * @date        17th October 2026
+ *
+ * @brief       Host benchmark of the deferred binary log of uartstdio against UARTprintf()
+ * @details     The program compiles uartstdio.c in its unbuffered mode, LOG_defer.c,
+ *              RING_spsc.c and FMT_num.c of the UART Stdio project against HOST_uart.h
+ *              and sends the same mix of events, the formats of LOG_formats.h with the
+ *              arguments of a user typing, once through UARTprintf() and once through the
+ *              LOGn() macros and LOG_drain(UARTwriteRaw). For each path it reports the
+ *              host time per call, the bytes per call on the UART and the calls per
+ *              second a 115200 bit/s line carries. The log path is also timed without LOG_drain(), the cost left
+ *              at the call site when the main loop drains the ring later. The host
+ *              times only rank the two paths.
+ *              With -o and -t the binary log and the text of the first -r calls are
+ *              written to files, and LOG_decode -c must rebuild the text byte for byte.
+ *
+ * @note        Build and run from this folder:
+ *              gcc -O2 -Wall -Wextra -DHOST_SIM -I. -I"../../TM4C123G LaunchPad UART Stdio"
+ *                  -I"../../TM4C123G LaunchPad UART Stdio/uartStdio" LOG_bench.c
+ *                  "../../TM4C123G LaunchPad UART Stdio/uartStdio/uartstdio.c"
+ *                  "../../TM4C123G LaunchPad UART Stdio/uartStdio/LOG_defer.c"
+ *                  "../../TM4C123G LaunchPad UART Stdio/uartStdio/RING_spsc.c"
+ *                  "../../TM4C123G LaunchPad UART Stdio/uartStdio/FMT_num.c" -o LOG_bench
+ *              ./LOG_bench
+ *              ./LOG_bench -o log.bin -t text.txt && ./LOG_decode -c log.bin | cmp - text.txt
+ * @file        LOG_bench.c
+ */
+/* -----------------------          Include Files       --------------------- */
+#include <stdio.h>                          // Library for Standard I/O
+#include <stdlib.h>                         // Standard Library
+#include <string.h>                         // Library for String functions
+#include <unistd.h>                         // Library for getopt
+#include <time.h>                           // Library for clock_gettime
+#include "HOST_uart.h"
+#include "uartstdio.h"
+#include "LOG_defer.h"
+
+/* -----------------------      Macro Definitions       --------------------- */
+#define BENCH_BAUD          115200                  // Macro for the bit rate of the console
+#define BENCH_MIX           5                       // Macro for the calls of one round of the mix
+
+/* -----------------------      Global Variables        --------------------- */
+// The dictionary, for the UARTprintf() path
+#define LOG_FORMAT(eId, pcFormat)   [eId] = pcFormat,
+static const char *g_ppcFormats[LOG_IDS] = {
+    [LOG_DROPPED] = LOG_DROPPED_FORMAT,
+#include "LOG_formats.h"
+};
+#undef LOG_FORMAT
+
+static FILE *g_psOut;                               // File of the bytes sent, NULL to only count them
+static uint64_t g_ui64Bytes;                        // Bytes sent by the UART
+static volatile uint8_t g_ui8Sink;                  // Last byte sent, so that the sends are not removed
+
+static uint32_t g_ui32Calls = 2000000;              // Calls per timed run
+static uint32_t g_ui32Record = 10000;               // Calls written with -o and -t
+
+/* -----------------------      Function Definition     --------------------- */
+// Function of the UART of HOST_uart.h, taking every byte sent
+void HOST_uartPut(unsigned char ucData){
+    g_ui8Sink = ucData;
+    g_ui64Bytes++;
+    if (g_psOut) fputc(ucData, g_psOut);
+}
+
+// Function of the UART of HOST_uart.h, nothing is received
+int32_t HOST_uartGet(void){
+    return '\r';
+}
+
+// Function to get the time in s
+static double BENCH_now(void){
+    struct timespec sTime;
+
+    clock_gettime(CLOCK_MONOTONIC, &sTime);
+    return sTime.tv_sec + sTime.tv_nsec * 1e-9;
+}
+
+// Function to send call ui32N of the mix as text
+static void BENCH_text(uint32_t ui32N){
+    switch (ui32N % BENCH_MIX){
+    case 0: UARTprintf(g_ppcFormats[LOG_RX], 'a' + ui32N % 26, 'a' + ui32N % 26); break;
+    case 1: UARTprintf(g_ppcFormats[LOG_LED], 1 + ui32N % 1000); break;
+    case 2: UARTprintf(g_ppcFormats[LOG_RX], ' ' + ui32N % 95, ' ' + ui32N % 95); break;
+    case 3: UARTprintf(g_ppcFormats[LOG_LED], 1 + ui32N % 1000); break;
+    default: UARTprintf(g_ppcFormats[LOG_BLINK], ui32N % 1001, 80000 * (ui32N % 1001) - 1); break;
+    }
+}
+
+// Function to send call ui32N of the mix as a record, draining the ring when bDrain
+static void BENCH_log(uint32_t ui32N, bool bDrain){
+    switch (ui32N % BENCH_MIX){
+    case 0: LOG2(LOG_RX, 'a' + ui32N % 26, 'a' + ui32N % 26); break;
+    case 1: LOG1(LOG_LED, 1 + ui32N % 1000); break;
+    case 2: LOG2(LOG_RX, ' ' + ui32N % 95, ' ' + ui32N % 95); break;
+    case 3: LOG1(LOG_LED, 1 + ui32N % 1000); break;
+    default: LOG2(LOG_BLINK, ui32N % 1001, 80000 * (ui32N % 1001) - 1); break;
+    }
+    if (bDrain) LOG_drain(UARTwriteRaw);
+}
+
+// Function to time one path, mode 0 text, 1 log and drain, 2 log with a drain every 16 calls
+static void BENCH_run(const char *pcName, uint32_t ui32Mode){
+    double f64Start, f64Time, f64Bytes;
+    uint32_t ui32N;
+
+    g_ui64Bytes = 0;
+    LOG_init();
+    f64Start = BENCH_now();
+    for (ui32N = 0; ui32N < g_ui32Calls; ui32N++){
+        if (ui32Mode == 0) BENCH_text(ui32N);
+        else BENCH_log(ui32N, ui32Mode == 1);
+        if (ui32Mode == 2 && (ui32N & 15) == 15){
+            f64Time = BENCH_now();
+            LOG_drain(UARTwriteRaw);
+            f64Start += BENCH_now() - f64Time;
+        }
+    }
+    f64Time = BENCH_now() - f64Start;
+    LOG_drain(UARTwriteRaw);
+
+    f64Bytes = (double)g_ui64Bytes / g_ui32Calls;
+    printf("%-22s %10.1f %12.2f %14.0f %9u\n", pcName, 1e9 * f64Time / g_ui32Calls, f64Bytes,
+           BENCH_BAUD / 10.0 / f64Bytes, LOG_dropped());
+}
+
+// Function to write the first calls of both paths to files
+static int BENCH_record(const char *pcLog, const char *pcText){
+    uint32_t ui32N;
+
+    if (pcLog){
+        g_psOut = fopen(pcLog, "wb");
+        if (!g_psOut){
+            perror(pcLog);
+            return 1;
+        }
+        LOG_init();
+        for (ui32N = 0; ui32N < g_ui32Record; ui32N++)
+            BENCH_log(ui32N, true);
+        fclose(g_psOut);
+    }
+    if (pcText){
+        g_psOut = fopen(pcText, "wb");
+        if (!g_psOut){
+            perror(pcText);
+            return 1;
+        }
+        for (ui32N = 0; ui32N < g_ui32Record; ui32N++)
+            BENCH_text(ui32N);
+        fclose(g_psOut);
+    }
+    g_psOut = NULL;
+    return 0;
+}
+
+/* -----------------------          Main Program        --------------------- */
+int main(int argc, char *argv[]){
+    const char *pcLog = NULL, *pcText = NULL;
+    int iOpt;
+
+    while ((iOpt = getopt(argc, argv, "n:r:o:t:")) != -1){
+        switch (iOpt){
+        case 'n': g_ui32Calls = strtoul(optarg, NULL, 0); break;
+        case 'r': g_ui32Record = strtoul(optarg, NULL, 0); break;
+        case 'o': pcLog = optarg; break;
+        case 't': pcText = optarg; break;
+        default:
+            fprintf(stderr, "usage: %s [-n calls] [-r calls recorded] [-o log.bin] [-t text.txt]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (g_ui32Calls == 0) g_ui32Calls = 1;
+
+    UARTStdioConfig(0, BENCH_BAUD, 80000000);
+    if (BENCH_record(pcLog, pcText)) return 1;
+
+    printf("%u calls, %u bit/s\n", g_ui32Calls, BENCH_BAUD);
+    printf("%-22s %10s %12s %14s %9s\n", "path", "ns/call", "bytes/call", "calls/s line", "dropped");
+    BENCH_run("UARTprintf", 0);
+    BENCH_run("LOGn + LOG_drain", 1);
+    BENCH_run("LOGn, drain later", 2);
+    return 0;
+}
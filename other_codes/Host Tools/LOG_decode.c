@@ -0,0 +1,283 @@
+/*!
+ * @author      Yash Bansod
+ * @date        17th October 2026
+ *
+ * @brief       Host decoder for the deferred binary log of uartstdio (UART Stdio)
+ * @details     The program reads the bytes sent by LOG_drain() from the virtual serial
+ *              port, a file or stdin ("-"), finds the records by their SOF and check
+ *              byte and prints the text UARTprintf() would have sent for each one. The
+ *              dictionary of formats is LOG_formats.h of the firmware, compiled in with
+ *              the same LOG_FORMAT() lines that give the IDs to the target, so the tool
+ *              must be rebuilt whenever the file changes; -d prints it.
+ *              Each conversion takes the next word of the record: %c %d %i %u %x %X %o
+ *              %p as UARTprintf() does, %f %e %g as the bits of a float. Bytes outside
+ *              the records are skipped, or passed through with -t when the log shares
+ *              the UART with UARTprintf(). -c ends the lines with CR LF as UARTwrite()
+ *              does. Records with a bad check byte, an unknown ID or a number of words
+ *              that does not match their format, and the records the target dropped,
+ *              are counted on stderr. A serial port is read until Ctrl-C.
+ *
+ * @note        Build and run from this folder:
+ *              gcc -O2 -Wall -Wextra -I"../../TM4C123G LaunchPad UART Stdio"
+ *                  -I"../../TM4C123G LaunchPad UART Stdio/uartStdio" LOG_decode.c -o LOG_decode
+ *              ./LOG_decode /dev/ttyACM0
+ *              ./LOG_decode -d
+ *              ./LOG_bench -o log.bin -t text.txt && ./LOG_decode -c log.bin | cmp - text.txt
+ * @file        LOG_decode.c
+ */
+/* -----------------------          Include Files       --------------------- */
+#include <stdio.h>                          // Library for Standard I/O
+#include <stdlib.h>                         // Standard Library
+#include <string.h>                         // Library for String functions
+#include <signal.h>                         // Library for stopping on Ctrl-C
+#include <fcntl.h>                          // Library for opening the serial port
+#include <termios.h>                        // Library for the serial port settings
+#include <unistd.h>                         // Library for read and getopt
+#include "LOG_defer.h"
+
+/* -----------------------      Macro Definitions       --------------------- */
+#define DEC_SPEC_MAX        16                      // Macro for the longest conversion specification
+
+/* -----------------------      Global Variables        --------------------- */
+typedef struct {
+    uint8_t pui8Win[LOG_MAX_RECORD];                // Bytes of the record being received
+    uint32_t ui32Len;                               // Bytes in pui8Win
+    uint32_t ui32Records;                           // Records decoded
+    uint32_t ui32BadCheck;                          // Records dropped for their check byte
+    uint32_t ui32Unknown;                           // Records with an ID missing from the dictionary
+    uint32_t ui32Mismatch;                          // Records whose words do not match the format
+    uint32_t ui32Dropped;                           // Records dropped on the target
+    uint32_t ui32Skipped;                           // Bytes outside the records
+} tDecoder;
+
+// The dictionary, LOG_DROPPED first and then one format per line of LOG_formats.h
+#define LOG_FORMAT(eId, pcFormat)   [eId] = pcFormat,
+static const char *g_ppcFormats[LOG_IDS] = {
+    [LOG_DROPPED] = LOG_DROPPED_FORMAT,
+#include "LOG_formats.h"
+};
+#undef LOG_FORMAT
+
+static bool g_bCrLf;                                // End the lines with CR LF
+static bool g_bText;                                // Pass the bytes outside the records through
+static volatile sig_atomic_t g_bStop;               // Set by Ctrl-C
+
+/* -----------------------      Function Definition     --------------------- */
+// Function to stop reading at the next byte
+static void DEC_stop(int iSignal){
+    (void)iSignal;
+    g_bStop = 1;
+}
+
+// Function to open the input, a serial port is set to raw mode at 115200 baud
+static int DEC_open(const char *pcPath){
+    struct termios sTio;
+    int iFd = (strcmp(pcPath, "-") == 0) ? STDIN_FILENO : open(pcPath, O_RDONLY | O_NOCTTY);
+
+    if (iFd < 0){
+        perror(pcPath);
+        return -1;
+    }
+    if (isatty(iFd) && tcgetattr(iFd, &sTio) == 0){
+        cfmakeraw(&sTio);
+        cfsetispeed(&sTio, B115200);
+        sTio.c_cflag |= CLOCAL | CREAD;
+        tcsetattr(iFd, TCSANOW, &sTio);
+        tcflush(iFd, TCIFLUSH);
+    }
+    return iFd;
+}
+
+// Function to output a character of the text, LF as CR LF with -c
+static void DEC_putc(char cChar){
+    if (cChar == '\n' && g_bCrLf) putchar('\r');
+    putchar(cChar);
+}
+
+// Function to output a string of the text
+static void DEC_puts(const char *pcText){
+    while (*pcText) DEC_putc(*pcText++);
+}
+
+// Function to count the words a format takes
+static uint32_t DEC_words(const char *pcFormat){
+    uint32_t ui32Words = 0;
+
+    while (*pcFormat){
+        if (*pcFormat++ != '%') continue;
+        pcFormat += strspn(pcFormat, "-+ #0123456789.hlLqjzt");
+        if (*pcFormat == '\0') break;
+        if (*pcFormat++ != '%') ui32Words++;
+    }
+    return ui32Words;
+}
+
+// Function to print the text of a record
+static void DEC_render(tDecoder *psDec, uint32_t ui32Id, uint32_t ui32Args, const uint32_t *pui32Arg){
+    const char *pcFormat;
+    char pcSpec[DEC_SPEC_MAX + 2], pcOut[64];
+    uint32_t ui32Used = 0, ui32Word;
+    size_t iSpec;
+    float f32Value;
+
+    if (ui32Id >= LOG_IDS || g_ppcFormats[ui32Id] == NULL){
+        psDec->ui32Unknown++;
+        snprintf(pcOut, sizeof(pcOut), "[log ID %u with %u words]\n", ui32Id, ui32Args);
+        DEC_puts(pcOut);
+        return;
+    }
+    pcFormat = g_ppcFormats[ui32Id];
+    if (ui32Id == LOG_DROPPED && ui32Args == 1) psDec->ui32Dropped += pui32Arg[0];
+    if (DEC_words(pcFormat) != ui32Args) psDec->ui32Mismatch++;
+
+    while (*pcFormat){
+        if (*pcFormat != '%'){
+            DEC_putc(*pcFormat++);
+            continue;
+        }
+
+        // Flags, width and precision are kept, length modifiers are dropped
+        iSpec = strspn(pcFormat + 1, "-+ #0123456789.");
+        if (iSpec > DEC_SPEC_MAX - 1) iSpec = DEC_SPEC_MAX - 1;
+        memcpy(pcSpec, pcFormat, iSpec + 1);
+        pcFormat += 1 + iSpec;
+        pcFormat += strspn(pcFormat, "hlLqjzt");
+        if (*pcFormat == '\0') break;
+        if (*pcFormat == '%'){
+            DEC_putc(*pcFormat++);
+            continue;
+        }
+        pcSpec[iSpec + 1] = *pcFormat;
+        pcSpec[iSpec + 2] = '\0';
+        ui32Word = ui32Used < ui32Args ? pui32Arg[ui32Used] : 0;
+        ui32Used++;
+
+        switch (*pcFormat++){
+        case 'c': snprintf(pcOut, sizeof(pcOut), pcSpec, (int)(uint8_t)ui32Word); break;
+        case 'd': case 'i': snprintf(pcOut, sizeof(pcOut), pcSpec, (int)(int32_t)ui32Word); break;
+        case 'u': case 'x': case 'X': case 'o': snprintf(pcOut, sizeof(pcOut), pcSpec, (unsigned)ui32Word); break;
+        case 'p':
+            pcSpec[iSpec + 1] = 'x';
+            snprintf(pcOut, sizeof(pcOut), pcSpec, (unsigned)ui32Word);
+            break;
+        case 'f': case 'e': case 'g': case 'E': case 'G':
+            memcpy(&f32Value, &ui32Word, sizeof(f32Value));
+            snprintf(pcOut, sizeof(pcOut), pcSpec, (double)f32Value);
+            break;
+        default:
+            // %s and unknown conversions cannot be rebuilt from a word
+            snprintf(pcOut, sizeof(pcOut), "<%s 0x%08x>", pcSpec, (unsigned)ui32Word);
+            break;
+        }
+        DEC_puts(pcOut);
+    }
+}
+
+// Function to take the first bytes of the window, passing them through with -t
+static void DEC_shift(tDecoder *psDec, uint32_t ui32Bytes, bool bSkipped){
+    uint32_t ui32Idx;
+
+    if (bSkipped){
+        psDec->ui32Skipped += ui32Bytes;
+        if (g_bText)
+            for (ui32Idx = 0; ui32Idx < ui32Bytes; ui32Idx++) putchar(psDec->pui8Win[ui32Idx]);
+    }
+    psDec->ui32Len -= ui32Bytes;
+    memmove(psDec->pui8Win, psDec->pui8Win + ui32Bytes, psDec->ui32Len);
+}
+
+// Function to feed a byte of the stream
+static void DEC_byte(tDecoder *psDec, uint8_t ui8Byte){
+    uint32_t pui32Arg[LOG_MAX_ARGS], ui32Header, ui32Args, ui32Len, ui32Idx;
+    uint8_t ui8Sum;
+
+    psDec->pui8Win[psDec->ui32Len++] = ui8Byte;
+    while (psDec->ui32Len){
+        if (psDec->pui8Win[0] != LOG_SOF){
+            DEC_shift(psDec, 1, true);
+            continue;
+        }
+        if (psDec->ui32Len < 3) return;
+        ui32Header = psDec->pui8Win[1] | ((uint32_t)psDec->pui8Win[2] << 8);
+        ui32Args = ui32Header >> LOG_ARGS_SHIFT;
+        if (ui32Args > LOG_MAX_ARGS){
+            DEC_shift(psDec, 1, true);
+            continue;
+        }
+        ui32Len = LOG_OVERHEAD + 4 * ui32Args;
+        if (psDec->ui32Len < ui32Len) return;
+
+        // A bad check byte means the SOF was a byte of something else
+        ui8Sum = 0;
+        for (ui32Idx = 1; ui32Idx < ui32Len; ui32Idx++) ui8Sum += psDec->pui8Win[ui32Idx];
+        if (ui8Sum != 0xFF){
+            psDec->ui32BadCheck++;
+            DEC_shift(psDec, 1, true);
+            continue;
+        }
+        for (ui32Idx = 0; ui32Idx < ui32Args; ui32Idx++){
+            const uint8_t *pui8Word = psDec->pui8Win + 3 + 4 * ui32Idx;
+            pui32Arg[ui32Idx] = pui8Word[0] | ((uint32_t)pui8Word[1] << 8) |
+                                ((uint32_t)pui8Word[2] << 16) | ((uint32_t)pui8Word[3] << 24);
+        }
+        psDec->ui32Records++;
+        DEC_render(psDec, ui32Header & LOG_ID_MASK, ui32Args, pui32Arg);
+        DEC_shift(psDec, ui32Len, false);
+    }
+}
+
+// Function to print the dictionary
+static void DEC_dictionary(void){
+    uint32_t ui32Id;
+    const char *pcChar;
+
+    for (ui32Id = 0; ui32Id < LOG_IDS; ui32Id++){
+        printf("%u\t%u\t\"", ui32Id, DEC_words(g_ppcFormats[ui32Id]));
+        for (pcChar = g_ppcFormats[ui32Id]; *pcChar; pcChar++){
+            if (*pcChar == '\n') printf("\\n");
+            else if (*pcChar == '"' || *pcChar == '\\') printf("\\%c", *pcChar);
+            else putchar(*pcChar);
+        }
+        printf("\"\n");
+    }
+}
+
+/* -----------------------          Main Program        --------------------- */
+int main(int argc, char *argv[]){
+    tDecoder sDec;
+    uint8_t pui8Buf[4096];
+    struct sigaction sAction;
+    ssize_t iRead, iIndex;
+    int iOpt, iFd;
+
+    while ((iOpt = getopt(argc, argv, "dct")) != -1){
+        switch (iOpt){
+        case 'd': DEC_dictionary(); return 0;
+        case 'c': g_bCrLf = true; break;
+        case 't': g_bText = true; break;
+        default: optind = argc; break;
+        }
+    }
+    if (optind != argc - 1){
+        fprintf(stderr, "usage: %s [-c] [-t] <port|file|->\n       %s -d\n", argv[0], argv[0]);
+        return 1;
+    }
+    iFd = DEC_open(argv[optind]);
+    if (iFd < 0) return 1;
+
+    // Ctrl-C interrupts read() so that the output is completed
+    memset(&sAction, 0, sizeof(sAction));
+    sAction.sa_handler = DEC_stop;
+    sigaction(SIGINT, &sAction, NULL);
+
+    memset(&sDec, 0, sizeof(sDec));
+    while (!g_bStop && (iRead = read(iFd, pui8Buf, sizeof(pui8Buf))) > 0)
+        for (iIndex = 0; iIndex < iRead; iIndex++)
+            DEC_byte(&sDec, pui8Buf[iIndex]);
+
+    fflush(stdout);
+    fprintf(stderr, "%u records, %u dropped on the target, %u bad check bytes, %u unknown IDs, "
+            "%u word count mismatches, %u bytes outside records\n", sDec.ui32Records, sDec.ui32Dropped,
+            sDec.ui32BadCheck, sDec.ui32Unknown, sDec.ui32Mismatch, sDec.ui32Skipped);
+    return 0;
+}
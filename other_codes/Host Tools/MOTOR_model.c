@@ -0,0 +1,49 @@
+/*!
+ * @author      Yash Bansod
+ * @date        17th October 2026
+ *
+ * @brief       Source containing the DC motor plant model used by the host simulator
+ * @file        MOTOR_model.c
+ */
+/* -----------------------          Include Files       --------------------- */
+#include <math.h>                           // Library of Math functions
+#include <string.h>                         // Library for String functions
+#include "MOTOR_model.h"
+
+/* -----------------------      Function Definition     --------------------- */
+// Function to reset the motor to rest at count 0
+void MOTOR_reset(tMotorModel *psMotor){
+    memset(psMotor, 0, sizeof(*psMotor));
+}
+
+// Function to advance the motor by f32Dt seconds with f32Volts across the winding
+void MOTOR_step(tMotorModel *psMotor, float f32Volts, float f32Dt){
+    const float f32J = MOTOR_J_ROTOR + MOTOR_J_LOAD;
+    const float f32H = f32Dt / MOTOR_SUBSTEPS;
+    int iter;
+
+    for (iter = 0; iter < MOTOR_SUBSTEPS; iter++){
+        float f32Omega = psMotor->f32Omega;
+
+        // Quasi-static winding current and the resulting drive torque
+        psMotor->f32Current = (f32Volts - MOTOR_KT * f32Omega) / MOTOR_R_OHM;
+        float f32Torque = MOTOR_KT * psMotor->f32Current - MOTOR_B_VISCOUS * f32Omega;
+
+        // Coulomb friction opposes the motion, or holds the shaft if it cannot break away
+        if (f32Omega == 0.0f && fabsf(f32Torque) <= MOTOR_T_FRICTION)
+            continue;
+        f32Torque -= (f32Omega > 0.0f || (f32Omega == 0.0f && f32Torque > 0.0f)) ?
+                     MOTOR_T_FRICTION : -MOTOR_T_FRICTION;
+
+        float f32OmegaNew = f32Omega + f32Torque / f32J * f32H;
+        // Stop at the zero crossing instead of letting friction reverse the shaft
+        if ((f32Omega > 0.0f && f32OmegaNew < 0.0f) || (f32Omega < 0.0f && f32OmegaNew > 0.0f))
+            f32OmegaNew = 0.0f;
+
+        psMotor->f64Theta += 0.5 * (double)(f32Omega + f32OmegaNew) * f32H;
+        psMotor->f32Omega = f32OmegaNew;
+    }
+
+    // Quadrature count at the gearbox output (MOTOR_ENC_CPR per rotor revolution)
+    psMotor->i64Count = (int64_t)floor(psMotor->f64Theta * (MOTOR_ENC_CPR / (2.0 * M_PI)));
+}
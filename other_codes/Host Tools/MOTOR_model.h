@@ -0,0 +1,43 @@
+/*!
+ * @author      Yash Bansod
+ * @date        17th October 2026
+ *
+ * @brief       Header containing the DC motor plant model used by the host simulator
+ * @details     Faulhaber 12V(17W) Coreless motor, 64:1 Planetary gearbox, 120RPM,
+ *              12 PPR Encoder (3072 CPR of quadrature at the gearbox output).
+ *              The winding inductance is neglected (L/R = 34 us against a 244 us
+ *              control tick) and the gearbox is lumped into the load inertia and
+ *              the Coulomb friction seen at the motor shaft.
+ * @file        MOTOR_model.h
+ */
+/* -----------------------          Include Files       --------------------- */
+#include <stdint.h>                         // Library of Standard Integer Types
+
+#ifndef MOTOR_MODEL_H_
+#define MOTOR_MODEL_H_
+
+/* -----------------------      Macro Definitions       --------------------- */
+#define MOTOR_SUPPLY_V      12.0f                   // Macro for the H-Bridge supply voltage
+#define MOTOR_R_OHM         1.9f                    // Macro for the terminal resistance
+#define MOTOR_KT            0.0134f                 // Macro for the torque (and back-EMF) constant in Nm/A
+#define MOTOR_J_ROTOR       5.7e-7f                 // Macro for the rotor inertia in kg m^2
+#define MOTOR_J_LOAD        1.5e-7f                 // Macro for the gearbox + load inertia seen at the rotor
+#define MOTOR_T_FRICTION    1.0e-3f                 // Macro for the Coulomb friction torque in Nm
+#define MOTOR_B_VISCOUS     2.0e-7f                 // Macro for the viscous friction in Nm s/rad
+#define MOTOR_GEAR_RATIO    64                      // Macro for the gearbox reduction
+#define MOTOR_ENC_CPR       48                      // Macro for the quadrature counts per rotor revolution
+#define MOTOR_SUBSTEPS      8                       // Macro for the integration steps per control tick
+
+/* -----------------------      Global Variables        --------------------- */
+typedef struct {
+    float f32Omega;                                 // Rotor speed in rad/s
+    double f64Theta;                                // Rotor angle in rad
+    float f32Current;                               // Winding current in A
+    int64_t i64Count;                               // Quadrature count at the gearbox output
+} tMotorModel;
+
+/* -----------------------      Function Prototypes     --------------------- */
+void MOTOR_reset(tMotorModel *psMotor);                                 // Reset the motor to rest at count 0
+void MOTOR_step(tMotorModel *psMotor, float f32Volts, float f32Dt);     // Advance the motor by f32Dt seconds
+
+#endif /* MOTOR_MODEL_H_ */
@@ -0,0 +1,1541 @@
+/*!
+ * @author      Yash Bansod
+ * @date        17th October 2026
+ *
+ * @brief       Host closed-loop simulator for PID with UART and FPU
+ * @details     The program compiles the QEI1IntHandler, PID_Update and the peripheral
+ *              configuration of "TM4C123G LaunchPad PID with UART and FPU" on a Linux
+ *              host, against the DriverLib stand-in in HOST_stub.c, and closes the loop
+ *              through the Faulhaber motor model in MOTOR_model.c. The QEI1 interrupt is
+ *              raised every 1/2^VEL_INT_FREQ s of simulated time.
+ *              A step of the desired position is applied for every combination of the
+ *              K_P, K_I and K_D ranges and one CSV line is printed per combination with
+ *              the overshoot, rise time, settling time, final error and the DriverLib
+ *              calls made per interrupt.
+ *              The float, Q15 and Q31 variants of the control law can be selected at run
+ *              time with --arith. --accuracy replays the error sequence of a float run
+ *              through every variant and reports the duty cycle mismatches against the
+ *              float result and the host time per call.
+ *              --axes-bench times PID_axesUpdate for 1 to PID_MAX_AXES axes, each axis
+ *              driving a simple integrator plant, and reports the cost per tick and axis.
+ *              The step goes through the motion profile of the firmware, with the limits
+ *              of macros.h or those given by --profile. "--profile none" applies the raw
+ *              step to the PID setpoint. The largest error while following the profile and
+ *              the share of ticks at 100% duty show how well the loop keeps up with it.
+ *              The commands are sent as frames of "PROTO_frame.h" through UART0IntHandler
+ *              and CMD_service(), as the supervisory PC would.
+ *              --autotune sends PROTO_TUNE while the motor holds its position,
+ *              runs the relay experiment of PID_tune.c, prints Ku, Pu and the gains it
+ *              loaded, checks that they are the computed ones unless PROTO_GET_TUNE reports
+ *              them as limited, and then runs the step response with the tuned gains.
+ *              --fuzz N sends N bytes of PROTO_SET_POS frames, each carrying its number,
+ *              to UART0IntHandler in bursts of 1 to 4 frames separated by more than
+ *              UART0_GAP_US of idle line. The bytes come at UART0_BAUDRATE, with the RX
+ *              interrupt at 8 bytes in the FIFO and the receive timeout 32 bit times after
+ *              the last byte, and Wide Timer 0B counts the time of the line. One frame in
+ *              4 is corrupted: random bytes before it, a byte changed or dropped, or its
+ *              end cut off. A frame after a corruption in its burst is at risk, since the
+ *              frame left open may take it as its payload; every other frame is safe.
+ *              The run reports the corruptions, the frames lost by class, the loss of
+ *              uncorrupted frames, the errors and idle aborts counted by the parser and
+ *              the host time per byte. It fails, exit code 1, on a safe frame lost, on more
+ *              frames queued that were not sent than CRC-16 lets through (twice 1 in 2^16
+ *              of the frames checked, plus 8) or on a full queue.
+ *              --telemetry <file> sends PROTO_TELEMETRY with --decim ticks per record before
+ *              each step and writes every byte sent by UART0 to the file, for TELEM_decode.
+ *              The UART0 TX FIFO is drained at UART0_BAUDRATE / 10 bytes/s of simulated
+ *              time. The bytes sent, the use of the link and the records dropped are
+ *              reported on stderr.
+ *              --gain-test S rewrites the gains from the main thread for S seconds, switching
+ *              between fixed gains and a gain schedule, while SIGALRM plays the QEI1
+ *              interrupt every 10 us: it selects the gains of the tick and checks that they
+ *              all belong to one update (K_I = K_P / 2, K_D = K_P / 4 and the Q15 and Q31
+ *              forms agree). The count of interrupts that landed in the middle of an update
+ *              shows that the test reached the critical window. It then times
+ *              PID_gainsSchedule(), checks that every axis of a multi-axis update gets
+ *              the gains of its own error, and sends a gain schedule, stores it with
+ *              PROTO_SAVE_PARAMS, and checks that PARAM_load() brings it back after reset.
+ *              --limits-test sends PROTO_SET_LIMITS with limits that are not numbers, not
+ *              positive or too large for Q24 and checks that each is refused with
+ *              PROTO_STATUS_RANGE and leaves the limits in use. It then moves 10^8 ticks
+ *              with the largest limits accepted and checks that the profile stays within
+ *              them and ends on the target.
+ *              --units compares the multiply and shift conversions of UNIT_convert.h, the
+ *              RPM one of the PID with UART project and the RPM_convert.h of the Quadrature
+ *              Encoder project with the integer divisions they replace over the range they
+ *              are specified for, and then searches how far beyond it they stay exact (up
+ *              to 2^31).
+ *              --vel-bench feeds the velocity estimator of VEL_estimate.c with the PhA edges
+ *              of an encoder turning at constant speeds from 0.1 to 5000 RPM, the capture
+ *              timer wrapping during every run, and reports the error of the M/T estimate
+ *              against the QEI1 count alone and the capture interrupts per second. A ramp
+ *              from 0 to 5000 RPM then shows the largest error and the largest jump of the
+ *              estimate in the edge time, blend and count bands.
+ *              --pos-test N moves the 64 bit position of POS_track.c through N billion
+ *              synthetic counts in small random moves, out and back through both signs,
+ *              with a move of the largest allowed size (2^31 - 1) now and then, and checks
+ *              it after every update against a 64 bit reference. It then feeds QEI1IntHandler
+ *              with counts far past 2^32 and runs the +90 and -90 degree steps twice, once
+ *              with the QEI1 counter powered up where the step wraps it, and checks that
+ *              the responses are the same.
+ *              --obs-gains[=A:J] iterates the Riccati equation of the constant velocity model
+ *              driven by white acceleration A and of the constant acceleration model driven
+ *              by white jerk J (ticks per tick^2 and ^3) to their steady-state Kalman gains,
+ *              for a reading with 1/12 tick^2 of quantisation noise, and prints them as the
+ *              OBS_ macros of macros.h. --observer drives the motor model open loop at 1 V
+ *              and with a +/-6 V square wave and reports, for the raw difference and both
+ *              observers, the velocity noise at the constant voltage and the lag and error
+ *              on the square wave, then the step response of each with the tick to tick
+ *              jitter of the Difference of Error. --obs selects the observer of the runs.
+ *              The closed-loop runs also capture the PhA edges of the motor model, placed
+ *              in time by linear interpolation within the tick.
+ *
+ * @note        Build and run from this folder:
+ *              gcc -O2 -DHOST_SIM -I. -I"../../TM4C123G LaunchPad PID with UART and FPU"
+ *                  PID_sim.c HOST_stub.c MOTOR_model.c -lm -o PID_sim
+ *              ./PID_sim --kp 0.1:0.5:0.05 --ki 0.002 --kd 0:0.03:0.005 -t 900
+ *              ./PID_sim --arith all --accuracy
+ *              ./PID_sim --arith q15 --axes-bench
+ *              ./PID_sim --profile 4800:48000:0 -t 1800
+ *              ./PID_sim --autotune -t 1800
+ *              ./PID_sim --fuzz 1000000
+ *              ./PID_sim --telemetry run.bin --decim 4 -s 5
+ *              ./PID_sim --gain-test 5
+ *              ./PID_sim --limits-test
+ *              ./PID_sim --units
+ *              ./PID_sim --vel-bench
+ *              ./PID_sim --pos-test 10
+ *              ./PID_sim --obs-gains=0.005:0.0005
+ *              ./PID_sim --observer --kd 0.5
+ *              A range is given as "first:last:step", a single value runs one point.
+ *              Use -o <file> to dump the tick by tick trace of the first run.
+ * @file        PID_sim.c
+ */
+/* -----------------------          Include Files       --------------------- */
+#include <stdio.h>                          // Library for Standard I/O
+#include <math.h>                           // Library of Math functions
+#include <time.h>                           // Library for the host monotonic clock
+#include <getopt.h>                         // Library for command line parsing
+#include <signal.h>                         // Library for the signal that plays the QEI1 interrupt
+#include <sys/time.h>                       // Library for the interval timer
+#include "HOST_stub.h"
+#include "MOTOR_model.h"
+
+#include "macros.h"
+#include "PID_control.h"
+
+/* -----------------------      Global Variables        --------------------- */
+typedef int16_t (*tPidCompute)(int32_t i32Error, int32_t i32DiffError, int32_t *pi32SumError);
+
+static const double g_f64DefaultKp = K_P;           // Proportional gain set in macros.h
+static const double g_f64DefaultKi = K_I;           // Integral gain set in macros.h
+static const double g_f64DefaultKd = K_D;           // Derivative gain set in macros.h
+static double g_f64SimKp;                           // Proportional gain of the current run
+static double g_f64SimKi;                           // Integral gain of the current run
+static double g_f64SimKd;                           // Derivative gain of the current run
+static tPidCompute g_pfnSimCompute;                 // Control law of the current run
+
+// Variants of the control law, in the order of the PID_F32, PID_Q15 and PID_Q31 macros
+static const struct {
+    const char *pcName;
+    tPidCompute pfnCompute;
+} g_psSimArith[] = {
+    {"f32", PID_computeF32},
+    {"q15", PID_computeQ15},
+    {"q31", PID_computeQ31},
+};
+#define SIM_ARITH_COUNT (sizeof(g_psSimArith) / sizeof(g_psSimArith[0]))
+
+/* -----------------------      Firmware Sources        --------------------- */
+// The firmware is compiled in this translation unit so that the file-static
+// globals of globalVariables.h are shared with the simulator. The control law
+// is redirected to the variant selected by the simulator.
+#undef PID_compute
+#define PID_compute     g_pfnSimCompute
+#define main            firmware_main
+#include "main.c"
+#include "QEI_config.c"
+#include "PWM_config.c"
+#include "PWM_lut.c"
+#include "UART_config.c"
+#include "PID_control.c"
+#include "PID_axes.c"
+#include "TRAJ_profile.c"
+#include "PID_tune.c"
+#include "PROTO_frame.c"
+#include "TELEM_stream.c"
+#include "PARAM_store.c"
+#include "WTIMER_config.c"
+#include "VEL_estimate.c"
+#include "POS_track.c"
+#include "OBS_filter.c"
+#undef main
+
+/* -----------------------      Macro Definitions       --------------------- */
+#define SIM_TICK_HZ     (1UL << VEL_INT_FREQ)       // Macro for the QEI1 interrupt frequency
+#define SIM_BENCH_LOOPS 200                         // Macro for the replays of the error sequence per variant
+#define SIM_AXES_TICKS  2000000                     // Macro for the controller updates timed per axis count
+#define SIM_FUZZ_BYTE   (HOST_SYSCLK_HZ / (UART0_BAUDRATE / 10))    // Macro for a byte time of UART0 in Wide Timer 0 counts
+#define SIM_FUZZ_TIMEOUT (32 * SIM_FUZZ_BYTE / 10)  // Macro for the receive timeout of UART0, 32 bit times
+#define SIM_FUZZ_RX_LEVEL 8                         // Macro for the RX FIFO level of the RX interrupt (4/8)
+#define SIM_FUZZ_JUNK   32                          // Macro for the longest run of random bytes before a frame
+#define SIM_FUZZ_IDLE_MIN ((UART0_GAP_US + 500) * (HOST_SYSCLK_HZ / 1000000))   // Macro for the shortest idle line between bursts
+#define SIM_FUZZ_IDLE_MAX (4 * UART0_GAP_US * (HOST_SYSCLK_HZ / 1000000))       // Macro for the longest idle line between bursts
+#define SIM_XORSHIFT(X) ((X) ^= (X) << 13, (X) ^= (X) >> 17, (X) ^= (X) << 5)  // Macro for the next value of a 32 bit xorshift
+#define SIM_TEAR_US     10                          // Macro for the period of the interrupt of --gain-test
+#define SIM_SCHED_CALLS 10000000                    // Macro for the PID_gainsSchedule calls timed
+#define SIM_VEL_SECONDS 20                          // Macro for the length of every constant speed of --vel-bench
+#define SIM_VEL_SKIP    2                           // Macro for the seconds of --vel-bench before the error is measured
+#define SIM_VEL_RAMP    5                           // Macro for the seconds of the 0 to 5000 RPM ramp of --vel-bench
+#define SIM_POS_EXTREME 4096                        // Macro for the updates of --pos-test between two moves of +/-(2^31 - 1)
+#define SIM_POS_TICKS   20000                       // Macro for the QEI1 interrupts of --pos-test with large moves
+#define SIM_OBS_NOISE   (1.0 / 12.0)                // Macro for the variance of the encoder quantisation in ticks^2
+#define SIM_OBS_SIGMA_A 0.005                       // Macro for the default white acceleration of --obs-gains in ticks/tick^2
+#define SIM_OBS_SIGMA_J 0.0005                      // Macro for the default white jerk of --obs-gains in ticks/tick^3
+#define SIM_OBS_LAG     64                          // Macro for the largest lag in ticks searched by --observer
+#define SIM_OBS_SECONDS 2                           // Macro for the length of each drive of --observer
+#define SIM_OBS_RPM     (60.0 * SIM_TICK_HZ / QEI1_CPR) // Macro for the RPM of 1 tick per QEI1 tick
+
+/* -----------------------      Global Variables        --------------------- */
+typedef struct {
+    double f64First;                                // First value of the range
+    double f64Last;                                 // Last value of the range
+    double f64Step;                                 // Increment of the range
+} tSimRange;
+
+typedef struct {
+    int32_t *pi32Error;                             // Error of every tick
+    int32_t *pi32DiffError;                         // Difference of Error of every tick
+    uint32_t ui32Count;                             // Number of ticks recorded
+} tSimRecord;
+
+typedef struct {
+    double f64OvershootPct;                         // Peak overshoot in % of the step
+    double f64RiseMs;                               // 10% to 90% rise time in ms
+    double f64SettleMs;                             // Time after which the error stays in band, -1 if never
+    int32_t i32FinalError;                          // Error at the end of the run in ticks
+    double f64CallsPerTick;                         // Mean DriverLib calls per QEI1 interrupt
+    uint32_t ui32MaxCallsPerTick;                   // Worst case DriverLib calls per QEI1 interrupt
+    double f64PwmWritesPerTick;                     // Mean PWM updates per QEI1 interrupt
+    int32_t i32MaxError;                            // Largest error between setpoint and position in ticks
+    double f64SatPct;                               // Ticks at 100% duty in % of the run
+    double f64TicksPerSec;                          // Host simulation throughput
+} tSimResult;
+
+typedef struct {
+    bool bEnable;                                   // Apply the step through the motion profile
+    float f32VelMax;                                // Velocity limit in ticks/s
+    float f32AccMax;                                // Acceleration limit in ticks/s^2
+    float f32JerkMax;                               // Jerk limit in ticks/s^3
+} tSimProfile;
+
+enum {SIM_FUZZ_JUNK_RUN, SIM_FUZZ_FLIP, SIM_FUZZ_DROP, SIM_FUZZ_CUT, SIM_FUZZ_KINDS};    // Corruptions of --fuzz
+enum {SIM_FUZZ_SAFE, SIM_FUZZ_AT_RISK, SIM_FUZZ_CORRUPT, SIM_FUZZ_CLASSES};                 // Frames of --fuzz
+
+typedef struct {
+    uint8_t *pui8Stream;                            // Bytes received by UART0
+    uint8_t *pui8Class;                             // SIM_FUZZ_SAFE, _AT_RISK or _CORRUPT for every frame sent
+    uint32_t ui32Sent;                              // Frames sent
+    uint32_t ui32Seen;                              // Command queue entries checked
+    uint32_t ui32Next;                              // Number of the next frame expected
+    uint32_t ui32Matched;                           // Frames queued as sent
+    uint32_t ui32False;                             // Frames queued that were not sent
+    uint32_t pui32Lost[SIM_FUZZ_CLASSES];           // Frames sent and never queued, by class
+} tSimFuzz;
+
+static tSimProfile g_sSimProfile = {true, TRAJ_VEL_MAX, TRAJ_ACC_MAX, TRAJ_JERK_MAX};
+static uint32_t g_ui32SimTxCredit;                  // UART0 TX bytes owed to the link, in 1/SIM_TICK_HZ
+static FILE *g_psSimTelem;                          // File receiving the bytes sent by UART0
+static uint16_t g_ui16SimDecim = 4;                 // QEI1 ticks per telemetry record
+static volatile sig_atomic_t g_bSimWriting;         // The main thread is inside a gain update
+static volatile uint32_t g_ui32SimChecks;           // Interrupts of --gain-test
+static volatile uint32_t g_ui32SimMidWrite;         // Interrupts that came during a gain update
+static volatile uint32_t g_ui32SimTorn;             // Interrupts that saw gains of two updates
+static uint64_t g_ui64SimTick;                      // QEI1 ticks since SIM_reset
+static uint32_t g_ui32SimQeiStart;                  // QEI1 counter value at power up
+static tVelEstimate g_sSimVel;                      // Velocity estimator of --vel-bench
+static uint32_t g_ui32SimVelIrq;                    // Capture interrupts of --vel-bench
+static uint8_t g_ui8SimObs = OBS_MODE;              // Observer of the closed-loop runs
+static const char *g_ppcSimObs[] = {"off", "ab", "kf"};    // Names of OBS_OFF, OBS_ALPHA_BETA and OBS_KALMAN
+
+/* -----------------------      Function Definition     --------------------- */
+// Function to parse a "first:last:step" range or a single value
+static int SIM_parseRange(const char *pcArg, tSimRange *psRange){
+    int iFields = sscanf(pcArg, "%lf:%lf:%lf", &psRange->f64First, &psRange->f64Last, &psRange->f64Step);
+    if (iFields == 1){
+        psRange->f64Last = psRange->f64First;
+        psRange->f64Step = 1.0;
+        return 0;
+    }
+    return (iFields == 3 && psRange->f64Step > 0.0) ? 0 : -1;
+}
+
+// Function to read the voltage applied by the H-Bridge from the PWM and direction pins
+static float SIM_bridgeVolts(void){
+    uint32_t ui32Pulse = (g_sHost.ui32PwmPeriod - 1 - g_sHost.ui32PwmCmp) & 0xFFFF;
+    float f32Duty = (g_sHost.ui32PwmPeriod == 0) ? 0.0f : (float)ui32Pulse / (float)g_sHost.ui32PwmPeriod;
+
+    if (f32Duty > 1.0f) f32Duty = 1.0f;
+    switch (g_sHost.ui32GpioD & (GPIO_PIN_2 | GPIO_PIN_3)){
+    case GPIO_PIN_2:    return  f32Duty * MOTOR_SUPPLY_V;
+    case GPIO_PIN_3:    return -f32Duty * MOTOR_SUPPLY_V;
+    default:            return 0.0f;        // Both legs low brake the motor
+    }
+}
+
+// Function to bring the firmware and the plant back to power-on state
+static void SIM_reset(tMotorModel *psMotor){
+    void (*pfnUartTx)(uint8_t ui8Byte) = g_sHost.pfnUartTx;
+    memset(&g_sHost, 0, sizeof(g_sHost));
+    g_sHost.pfnUartTx = pfnUartTx;
+    g_ui32SimTxCredit = 0;
+    g_ui64SimTick = 0;
+    MOTOR_reset(psMotor);
+
+    PID_axesInit(&sPIDAxes, PID_AXES);
+    OBS_init(&sPIDAxes.sObs, g_ui8SimObs);
+    PROTO_parserInit(&sProtoParser);
+    ui32UartGap = ROM_SysCtlClockGet() / 1000000 * UART0_GAP_US;
+    ui32UartLast = 0;
+    ui32CmdHead = ui32CmdTail = 0;
+    ui32CmdDropped = 0;
+    TELEM_init(&sTelem);
+    VEL_init(&sVelEst, SIM_TICK_HZ, HOST_SYSCLK_HZ);
+    sPIDAxes.i64DesPos[0] = 0;
+    TRAJ_init(&sTraj, 0);
+    TRAJ_limits(&sTraj, g_sSimProfile.f32VelMax, g_sSimProfile.f32AccMax,
+                g_sSimProfile.f32JerkMax, SIM_TICK_HZ);
+    i16Adjust_PWM1_0 = 0;
+    i16AdjustOld_PWM1_0 = 0;
+
+    QEI1_init();
+    WTIMER0_init();
+    PWM1_0_init();
+    WTIMER0_enable();
+    QEI1_enable();
+    PWM1_0_enable();
+
+    // A counter that powers up elsewhere must not change anything but the raw readings.
+    // The multi-turn position then starts at 0 as main() starts it after QEI1_enable().
+    g_sHost.ui32QeiPosOffset += g_ui32SimQeiStart;
+    g_sHost.ui32QeiPos += g_ui32SimQeiStart;
+    ui32Qei1Pos = ROM_QEIPositionGet(QEI1_BASE);
+    POS_init(&sQei1Track, ui32Qei1Pos, 0);
+    i64Qei1Pos = 0;
+}
+
+// Function to execute the queued commands, the transmitter is drained after each one
+// at once so that a reply never waits for the previous one
+static void SIM_service(void){
+    while (ui32CmdHead != ui32CmdTail){
+        CMD_service();
+        while (sTelem.ui32StageIdx != sTelem.ui32StageLen || sTelem.ui32ReplyLen){
+            HOST_uartTxDrain(HOST_UART_FIFO);
+            UART0IntHandler();
+        }
+    }
+}
+
+// Function to write a byte sent by UART0 to the telemetry file
+static void SIM_telemByte(uint8_t ui8Byte){
+    fputc(ui8Byte, g_psSimTelem);
+}
+
+// Function to send a command frame over UART0 and return the status of the reply
+static int SIM_command(uint8_t ui8Type, const uint8_t *pui8Payload, uint8_t ui8Len){
+    uint8_t pui8Frame[PROTO_MAX_FRAME];
+    tProtoParser sReply;
+    uint32_t ui32Index;
+
+    g_sHost.ui32UartTxLen = 0;
+    HOST_uartFeed(pui8Frame, PROTO_encode(ui8Type, pui8Payload, ui8Len, pui8Frame));
+    UART0IntHandler();
+    SIM_service();
+
+    PROTO_parserInit(&sReply);
+    for (ui32Index = 0; ui32Index < g_sHost.ui32UartTxLen; ui32Index++)
+        if (PROTO_parse(&sReply, (uint8_t)g_sHost.pcUartTx[ui32Index]) && sReply.sFrame.ui8Type == (ui8Type | PROTO_REPLY))
+            return sReply.sFrame.pui8Payload[0];
+    return -1;
+}
+
+// Function to convert a time in QEI1 ticks to the count of the capture timer
+static uint32_t SIM_timerCount(double f64Ticks){
+    return (uint32_t)(uint64_t)llround(f64Ticks * ((double)HOST_SYSCLK_HZ / SIM_TICK_HZ));
+}
+
+// Function to call f for the PhA edges crossed while the position x (in counts) moves linearly from
+// f64From to f64To over one tick that starts at f64Tick. PhA changes on the even counts.
+static void SIM_phaEdges(double f64From, double f64To, double f64Tick, void (*pfnEdge)(uint32_t ui32Time)){
+    int64_t i64Edge, i64Last;
+    int32_t i32Step;
+
+    if (f64To > f64From){
+        i64Edge = (int64_t)floor(f64From) + 1;
+        i64Last = (int64_t)floor(f64To);
+        i32Step = 1;
+    }
+    else {
+        i64Edge = (int64_t)floor(f64From);
+        i64Last = (int64_t)floor(f64To) + 1;
+        i32Step = -1;
+    }
+    if (i64Edge & 1) i64Edge += i32Step;
+    for (; i32Step * (i64Last - i64Edge) >= 0; i64Edge += 2 * i32Step)
+        pfnEdge(SIM_timerCount(f64Tick + (i64Edge - f64From) / (f64To - f64From)));
+}
+
+// Function to capture a PhA edge in Wide Timer 0A and raise its interrupt
+static void SIM_captureEdge(uint32_t ui32Time){
+    if (HOST_timerCapture(ui32Time))
+        WTIMER0AIntHandler();
+}
+
+// Function to advance the plant over one QEI1 velocity period and raise the QEI1 interrupt
+static uint32_t SIM_tick(tMotorModel *psMotor, int64_t *pi64Prev){
+    // Shift out the bytes sent during the tick, the TX interrupt refills the FIFO
+    g_ui32SimTxCredit += UART0_BAUDRATE / 10;
+    HOST_uartTxDrain(g_ui32SimTxCredit / SIM_TICK_HZ);
+    g_ui32SimTxCredit %= SIM_TICK_HZ;
+    if (g_sHost.ui32UartInt)
+        UART0IntHandler();
+
+    double f64From = psMotor->f64Theta * (MOTOR_ENC_CPR / (2.0 * M_PI));
+    MOTOR_step(psMotor, SIM_bridgeVolts(), 1.0f / SIM_TICK_HZ);
+    SIM_phaEdges(f64From, psMotor->f64Theta * (MOTOR_ENC_CPR / (2.0 * M_PI)), (double)g_ui64SimTick, SIM_captureEdge);
+    g_sHost.ui32TimerNow = SIM_timerCount((double)++g_ui64SimTick);
+    int64_t i64Delta = psMotor->i64Count - *pi64Prev;
+    HOST_qeiCount(psMotor->i64Count, (uint32_t)(i64Delta < 0 ? -i64Delta : i64Delta));
+    *pi64Prev = psMotor->i64Count;
+
+    // Return the DriverLib calls made by the interrupt
+    uint32_t ui32Calls = g_sHost.ui32Calls;
+    QEI1IntHandler();
+    return g_sHost.ui32Calls - ui32Calls;
+}
+
+// Function to run a single step response and collect the metrics
+static void SIM_run(int32_t i32TargetDeg, double f64Seconds, int32_t i32Band,
+                    FILE *psTrace, tSimRecord *psRecord, tSimResult *psResult){
+    tMotorModel sMotor;
+    const uint32_t ui32Ticks = (uint32_t)(f64Seconds * SIM_TICK_HZ);
+    uint32_t ui32Tick, ui32CallsTotal = 0, ui32LastOutside = 0;
+    uint32_t ui32Rise10 = 0, ui32Rise90 = 0, ui32Saturated = 0;
+    int64_t i64Prev = 0;
+    int32_t i32Peak = 0;
+    struct timespec sStart, sEnd;
+
+    SIM_reset(&sMotor);
+    memset(psResult, 0, sizeof(*psResult));
+
+    // Send the step as a PROTO_SET_POS command, or bypass the profile
+    const int32_t i32DesPos = UNIT_DEG_TO_TICKS(i32TargetDeg);
+    if (g_sSimProfile.bEnable){
+        uint8_t pui8Payload[8];
+        PROTO_putU64(pui8Payload, (uint64_t)(int64_t)i32DesPos);
+        SIM_command(PROTO_SET_POS, pui8Payload, sizeof(pui8Payload));
+    }
+    else
+        TRAJ_init(&sTraj, i32DesPos);
+    if (g_psSimTelem){
+        uint8_t pui8Payload[2];
+        PROTO_putU16(pui8Payload, g_ui16SimDecim);
+        SIM_command(PROTO_TELEMETRY, pui8Payload, sizeof(pui8Payload));
+    }
+    const uint32_t ui32TxBytes = g_sHost.ui32UartTxBytes;
+    const int32_t i32Target = i32DesPos;
+    const int32_t i32Sign = (i32Target < 0) ? -1 : 1;
+    const uint32_t ui32PwmWrites = g_sHost.ui32PwmWrites;
+
+    if (psTrace) fprintf(psTrace, "t_ms,position,error,duty,volts\n");
+
+    clock_gettime(CLOCK_MONOTONIC, &sStart);
+    for (ui32Tick = 1; ui32Tick <= ui32Ticks; ui32Tick++){
+        uint32_t ui32Calls = SIM_tick(&sMotor, &i64Prev);
+        ui32CallsTotal += ui32Calls;
+        if (ui32Calls > psResult->ui32MaxCallsPerTick) psResult->ui32MaxCallsPerTick = ui32Calls;
+
+        // Step response metrics, measured in the direction of the step
+        int32_t i32Pos = (int32_t)i64Qei1Pos;
+        int32_t i32Progress = i32Sign * i32Pos;
+        if (i32Progress - i32Sign * i32Target > i32Peak) i32Peak = i32Progress - i32Sign * i32Target;
+        if (!ui32Rise10 && 10 * i32Progress >= 1 * i32Sign * i32Target) ui32Rise10 = ui32Tick;
+        if (!ui32Rise90 && 10 * i32Progress >= 9 * i32Sign * i32Target) ui32Rise90 = ui32Tick;
+        if (abs(i32Target - i32Pos) > i32Band) ui32LastOutside = ui32Tick;
+        if (abs(sPIDAxes.i32ErrorNew[0]) > psResult->i32MaxError) psResult->i32MaxError = abs(sPIDAxes.i32ErrorNew[0]);
+        if (i16Adjust_PWM1_0 >= 100) ui32Saturated++;
+
+        if (psRecord){
+            psRecord->pi32Error[ui32Tick - 1] = sPIDAxes.i32ErrorNew[0];
+            psRecord->pi32DiffError[ui32Tick - 1] = sPIDAxes.i32DiffError[0];
+            psRecord->ui32Count = ui32Tick;
+        }
+
+        if (psTrace)
+            fprintf(psTrace, "%.3f,%d,%d,%d,%.3f\n", 1000.0 * ui32Tick / SIM_TICK_HZ,
+                    i32Pos, sPIDAxes.i32ErrorNew[0], i16Adjust_PWM1_0, SIM_bridgeVolts());
+    }
+    clock_gettime(CLOCK_MONOTONIC, &sEnd);
+
+    double f64Elapsed = (sEnd.tv_sec - sStart.tv_sec) + 1e-9 * (sEnd.tv_nsec - sStart.tv_nsec);
+    psResult->f64OvershootPct = (i32Target != 0) ? 100.0 * i32Peak / abs(i32Target) : 0.0;
+    psResult->f64RiseMs = (ui32Rise10 && ui32Rise90) ? 1000.0 * (ui32Rise90 - ui32Rise10) / SIM_TICK_HZ : -1.0;
+    psResult->f64SettleMs = (ui32LastOutside < ui32Ticks) ? 1000.0 * ui32LastOutside / SIM_TICK_HZ : -1.0;
+    psResult->i32FinalError = i32Target - (int32_t)i64Qei1Pos;
+    psResult->f64CallsPerTick = ui32Ticks ? (double)ui32CallsTotal / ui32Ticks : 0.0;
+    psResult->f64PwmWritesPerTick = ui32Ticks ? (double)(g_sHost.ui32PwmWrites - ui32PwmWrites) / ui32Ticks : 0.0;
+    psResult->f64SatPct = ui32Ticks ? 100.0 * ui32Saturated / ui32Ticks : 0.0;
+    psResult->f64TicksPerSec = (f64Elapsed > 0.0) ? ui32Ticks / f64Elapsed : 0.0;
+
+    if (g_psSimTelem)
+        fprintf(stderr, "telemetry: %u frames, %u bytes, %.1f%% of the link, %u records dropped\n",
+                sTelem.ui32Frames, g_sHost.ui32UartTxBytes - ui32TxBytes,
+                100.0 * (g_sHost.ui32UartTxBytes - ui32TxBytes) * 10 * SIM_TICK_HZ / ((double)UART0_BAUDRATE * ui32Ticks),
+                sTelem.ui32Dropped);
+}
+
+// Function to replay a recorded error sequence through every variant of the control law
+static void SIM_accuracy(const tSimRecord *psRecord){
+    int16_t *pi16Reference = malloc(psRecord->ui32Count * sizeof(int16_t));
+    uint32_t ui32Arith, ui32Tick, ui32Loop;
+
+    printf("arith,mismatches,max_duty_diff,ns_per_call\n");
+    for (ui32Arith = 0; ui32Arith < SIM_ARITH_COUNT; ui32Arith++){
+        tPidCompute pfnCompute = g_psSimArith[ui32Arith].pfnCompute;
+        uint32_t ui32Mismatch = 0;
+        int32_t i32MaxDiff = 0;
+        int32_t i32Sum = 0;
+        volatile int16_t i16Sink;
+        struct timespec sStart, sEnd;
+
+        // Compare the Control signal tick by tick, with the dead band reset of PID_Update
+        for (ui32Tick = 0; ui32Tick < psRecord->ui32Count; ui32Tick++){
+            int16_t i16Control = pfnCompute(psRecord->pi32Error[ui32Tick], psRecord->pi32DiffError[ui32Tick], &i32Sum);
+            if (abs(psRecord->pi32Error[ui32Tick]) <= 5) i32Sum = 0;
+            if (ui32Arith == 0) pi16Reference[ui32Tick] = i16Control;
+            int32_t i32Diff = abs(i16Control - pi16Reference[ui32Tick]);
+            if (i32Diff) ui32Mismatch++;
+            if (i32Diff > i32MaxDiff) i32MaxDiff = i32Diff;
+        }
+
+        clock_gettime(CLOCK_MONOTONIC, &sStart);
+        for (ui32Loop = 0; ui32Loop < SIM_BENCH_LOOPS; ui32Loop++){
+            i32Sum = 0;
+            for (ui32Tick = 0; ui32Tick < psRecord->ui32Count; ui32Tick++)
+                i16Sink = pfnCompute(psRecord->pi32Error[ui32Tick], psRecord->pi32DiffError[ui32Tick], &i32Sum);
+        }
+        clock_gettime(CLOCK_MONOTONIC, &sEnd);
+        (void)i16Sink;
+
+        double f64Elapsed = (sEnd.tv_sec - sStart.tv_sec) + 1e-9 * (sEnd.tv_nsec - sStart.tv_nsec);
+        printf("%s,%u,%d,%.2f\n", g_psSimArith[ui32Arith].pcName, ui32Mismatch, i32MaxDiff,
+               1e9 * f64Elapsed / ((double)SIM_BENCH_LOOPS * psRecord->ui32Count));
+    }
+    free(pi16Reference);
+}
+
+// Function to run the auto-tuner of the firmware on the motor held at rest
+static int SIM_autotune(void){
+    tMotorModel sMotor;
+    int64_t i64Prev = 0;
+    uint32_t ui32Tick;
+
+    SIM_reset(&sMotor);
+    for (ui32Tick = 0; ui32Tick < SIM_TICK_HZ / 10; ui32Tick++)
+        SIM_tick(&sMotor, &i64Prev);
+
+    // Start the relay experiment over UART0 as the supervisory PC would
+    if (SIM_command(PROTO_TUNE, NULL, 0) != PROTO_STATUS_OK){
+        fprintf(stderr, "PROTO_TUNE refused\n");
+        return -1;
+    }
+    for (ui32Tick = 0; ui32Tick <= TUNE_TIMEOUT && sTune.ui8State == TUNE_RUN; ui32Tick++)
+        SIM_tick(&sMotor, &i64Prev);
+    // One pass of the main loop loads the gains
+    CMD_service();
+
+    if (sTune.ui8State != TUNE_DONE){
+        fprintf(stderr, "auto-tune failed after %u ticks\n", ui32Tick);
+        return -1;
+    }
+    // The gains in use must be those computed, unless PROTO_GET_TUNE reports them as limited
+    float f32Kp, f32Ki, f32Kd;
+    int iStatus = SIM_command(PROTO_GET_TUNE, NULL, 0);
+    PID_gainsGet(&f32Kp, &f32Ki, &f32Kd);
+    bool bSame = f32Kp == sTune.f32Kp && f32Ki == sTune.f32Ki && f32Kd == sTune.f32Kd;
+    printf("ku,pu_ms,kp,ki,kd,status\n%g,%.2f,%g,%g,%g,%s\n", sTune.f32Ku, 1000.0 * sTune.f32Pu / SIM_TICK_HZ,
+           f32Kp, f32Ki, f32Kd, (iStatus == PROTO_STATUS_CLIP) ? "limited" : "ok");
+    if (bSame != (iStatus == PROTO_STATUS_OK)){
+        fprintf(stderr, "auto-tune gains %g,%g,%g loaded as %g,%g,%g with status %d\n", sTune.f32Kp,
+                sTune.f32Ki, sTune.f32Kd, f32Kp, f32Ki, f32Kd, iStatus);
+        return -1;
+    }
+    return 0;
+}
+
+// Function to deliver the received bytes [ui32From, ui32To) to UART0IntHandler at the Wide Timer 0 time ui64Now
+// with the interrupt ui32Int, and to match the frames it queues with the frames sent
+static void SIM_fuzzIsr(tSimFuzz *psFuzz, uint32_t ui32From, uint32_t ui32To, uint64_t ui64Now, uint32_t ui32Int){
+    g_sHost.ui32TimerNow = (uint32_t)ui64Now;
+    g_sHost.ui32UartInt |= ui32Int;
+    g_sHost.ui32UartTxLen = 0;
+    HOST_uartFeed(psFuzz->pui8Stream + ui32From, ui32To - ui32From);
+    UART0IntHandler();
+
+    // Every frame queued must be the next frame sent, or a later one if frames were lost
+    for (; psFuzz->ui32Seen != ui32CmdHead; psFuzz->ui32Seen++){
+        const tProtoFrame *psCmd = &sCmdQueue[psFuzz->ui32Seen & (CMD_QUEUE_LEN - 1)];
+        uint64_t ui64Seq = PROTO_getU64(psCmd->pui8Payload);
+        if (psCmd->ui8Type == PROTO_SET_POS && psCmd->ui8Len == 8 &&
+            ui64Seq >= psFuzz->ui32Next && ui64Seq < psFuzz->ui32Sent){
+            for (; psFuzz->ui32Next < ui64Seq; psFuzz->ui32Next++)
+                psFuzz->pui32Lost[psFuzz->pui8Class[psFuzz->ui32Next]]++;
+            psFuzz->ui32Next++;
+            psFuzz->ui32Matched++;
+        }
+        else psFuzz->ui32False++;
+    }
+    SIM_service();
+}
+
+// Function to send N bytes of frames in bursts, some of them corrupted, to UART0IntHandler with the
+// timing of the line, returns -1 on a failed check
+static int SIM_fuzz(uint32_t ui32Bytes){
+    tSimFuzz sFuzz = {0};
+    tMotorModel sMotor;
+    uint64_t *pui64Time = malloc((ui32Bytes + 2 * SIM_FUZZ_JUNK + 4 * PROTO_MAX_FRAME) * sizeof(uint64_t));
+    uint32_t pui32Kind[SIM_FUZZ_KINDS] = {0}, pui32Class[SIM_FUZZ_CLASSES] = {0};
+    uint32_t ui32Len = 0, ui32Index, ui32Read = 0;
+    uint32_t ui32Seed = 2463534242UL;
+    uint64_t ui64Time = 0;
+    struct timespec sStart, sEnd;
+
+    sFuzz.pui8Stream = malloc(ui32Bytes + 2 * SIM_FUZZ_JUNK + 4 * PROTO_MAX_FRAME);
+    sFuzz.pui8Class = malloc(ui32Bytes);
+
+    // Bursts of 1 to 4 back to back PROTO_SET_POS frames, each carrying its number, separated by
+    // idle line. A frame is corrupted with a chance of 1/4: random bytes before it, a byte changed,
+    // a byte dropped or its end cut off. A frame after a corruption in its burst is at risk.
+    while (ui32Len < ui32Bytes){
+        uint32_t ui32Burst, ui32Frame;
+        bool bHit = false;
+        SIM_XORSHIFT(ui32Seed);
+        ui32Burst = 1 + (ui32Seed & 3);
+        for (ui32Frame = 0; ui32Frame < ui32Burst; ui32Frame++){
+            uint8_t pui8Payload[8], pui8Frame[PROTO_MAX_FRAME];
+            uint32_t ui32FrameLen, ui32Kind, ui32Pos;
+
+            PROTO_putU64(pui8Payload, sFuzz.ui32Sent);
+            ui32FrameLen = PROTO_encode(PROTO_SET_POS, pui8Payload, sizeof(pui8Payload), pui8Frame);
+            SIM_XORSHIFT(ui32Seed);
+            ui32Kind = (ui32Seed >> 8) % (4 * SIM_FUZZ_KINDS);
+            ui32Pos = (ui32Seed >> 16) % ui32FrameLen;
+            sFuzz.pui8Class[sFuzz.ui32Sent] = bHit ? SIM_FUZZ_AT_RISK : SIM_FUZZ_SAFE;
+            if (ui32Kind < SIM_FUZZ_KINDS){
+                pui32Kind[ui32Kind]++;
+                bHit = true;
+                sFuzz.pui8Class[sFuzz.ui32Sent] = (ui32Kind == SIM_FUZZ_JUNK_RUN) ? SIM_FUZZ_AT_RISK : SIM_FUZZ_CORRUPT;
+            }
+            if (ui32Kind == SIM_FUZZ_JUNK_RUN){
+                uint32_t ui32Run = 1 + (ui32Seed >> 24) % SIM_FUZZ_JUNK;
+                for (; ui32Run; ui32Run--){
+                    SIM_XORSHIFT(ui32Seed);
+                    pui64Time[ui32Len] = ui64Time;
+                    sFuzz.pui8Stream[ui32Len++] = (uint8_t)ui32Seed;
+                    ui64Time += SIM_FUZZ_BYTE;
+                }
+            }
+            else if (ui32Kind == SIM_FUZZ_FLIP)
+                pui8Frame[ui32Pos] ^= (uint8_t)(1 + (ui32Seed >> 24) % 255);
+            else if (ui32Kind == SIM_FUZZ_DROP){
+                memmove(pui8Frame + ui32Pos, pui8Frame + ui32Pos + 1, ui32FrameLen - ui32Pos - 1);
+                ui32FrameLen--;
+            }
+            else if (ui32Kind == SIM_FUZZ_CUT)
+                ui32FrameLen = 1 + ui32Pos % (ui32FrameLen - 1);
+            pui32Class[sFuzz.pui8Class[sFuzz.ui32Sent]]++;
+            sFuzz.ui32Sent++;
+
+            for (ui32Pos = 0; ui32Pos < ui32FrameLen; ui32Pos++){
+                pui64Time[ui32Len] = ui64Time;
+                sFuzz.pui8Stream[ui32Len++] = pui8Frame[ui32Pos];
+                ui64Time += SIM_FUZZ_BYTE;
+            }
+        }
+        // Idle line of more than UART0_GAP_US plus the receive timeout, up to 4 times UART0_GAP_US
+        SIM_XORSHIFT(ui32Seed);
+        ui64Time += SIM_FUZZ_IDLE_MIN + (ui32Seed >> 8) % (SIM_FUZZ_IDLE_MAX - SIM_FUZZ_IDLE_MIN);
+    }
+
+    // The RX interrupt comes with SIM_FUZZ_RX_LEVEL bytes in the FIFO, the receive timeout
+    // SIM_FUZZ_TIMEOUT after the last byte when fewer are left
+    SIM_reset(&sMotor);
+    sFuzz.ui32Seen = ui32CmdHead;
+    clock_gettime(CLOCK_MONOTONIC, &sStart);
+    for (ui32Index = 0; ui32Index < ui32Len; ui32Index++){
+        if (ui32Read < ui32Index && pui64Time[ui32Index] - pui64Time[ui32Index - 1] > SIM_FUZZ_TIMEOUT){
+            SIM_fuzzIsr(&sFuzz, ui32Read, ui32Index, pui64Time[ui32Index - 1] + SIM_FUZZ_TIMEOUT, UART_INT_RT);
+            ui32Read = ui32Index;
+        }
+        if (ui32Index + 1 - ui32Read >= SIM_FUZZ_RX_LEVEL){
+            SIM_fuzzIsr(&sFuzz, ui32Read, ui32Index + 1, pui64Time[ui32Index], UART_INT_RX);
+            ui32Read = ui32Index + 1;
+        }
+    }
+    if (ui32Read < ui32Len)
+        SIM_fuzzIsr(&sFuzz, ui32Read, ui32Len, pui64Time[ui32Len - 1] + SIM_FUZZ_TIMEOUT, UART_INT_RT);
+    clock_gettime(CLOCK_MONOTONIC, &sEnd);
+    for (; sFuzz.ui32Next < sFuzz.ui32Sent; sFuzz.ui32Next++)
+        sFuzz.pui32Lost[sFuzz.pui8Class[sFuzz.ui32Next]]++;
+    free(sFuzz.pui8Stream);
+    free(sFuzz.pui8Class);
+    free(pui64Time);
+
+    // A safe frame is never lost, so a corruption costs at most the frames of its burst. CRC-16 passes
+    // 1 in 2^16 of the corrupted frames checked, the false accepts stay within twice that and a margin.
+    double f64Ns = 1e9 * (sEnd.tv_sec - sStart.tv_sec) + (sEnd.tv_nsec - sStart.tv_nsec);
+    uint32_t ui32FalseMax = 2 * (sProtoParser.ui32CrcErrors + sFuzz.ui32False) / 65536 + 8;
+    bool bOk = sFuzz.ui32False <= ui32FalseMax && sFuzz.pui32Lost[SIM_FUZZ_SAFE] == 0 && ui32CmdDropped == 0;
+    printf("bytes,frames_sent,junk,flip,drop,cut,safe,at_risk,safe_lost,at_risk_lost,corrupt_lost,"
+           "clean_loss_pct,false_accepts,crc_errors,len_errors,idle_aborts,dropped,ns_per_byte,result\n");
+    printf("%u,%u", ui32Len, sFuzz.ui32Sent);
+    for (ui32Index = 0; ui32Index < SIM_FUZZ_KINDS; ui32Index++)
+        printf(",%u", pui32Kind[ui32Index]);
+    printf(",%u,%u,%u,%u,%u,%.2f,%u,%u,%u,%u,%u,%.2f,%s\n", pui32Class[SIM_FUZZ_SAFE], pui32Class[SIM_FUZZ_AT_RISK],
+           sFuzz.pui32Lost[SIM_FUZZ_SAFE], sFuzz.pui32Lost[SIM_FUZZ_AT_RISK], sFuzz.pui32Lost[SIM_FUZZ_CORRUPT],
+           100.0 * (sFuzz.pui32Lost[SIM_FUZZ_SAFE] + sFuzz.pui32Lost[SIM_FUZZ_AT_RISK]) /
+           (pui32Class[SIM_FUZZ_SAFE] + pui32Class[SIM_FUZZ_AT_RISK]), sFuzz.ui32False, sProtoParser.ui32CrcErrors, sProtoParser.ui32LenErrors, sProtoParser.ui32Aborts,
+           ui32CmdDropped, f64Ns / ui32Len, bOk ? "ok" : "FAIL");
+    return bOk ? 0 : -1;
+}
+
+// Function to check that the gains of a tick all come from one update of --gain-test
+static bool SIM_gainsWhole(const tPIDGains *psCheck){
+    return psCheck->f32Ki * 2.0f == psCheck->f32Kp && psCheck->f32Kd * 4.0f == psCheck->f32Kp &&
+           psCheck->i32KpQ15 == PID_Q15_GAIN(psCheck->f32Kp, psCheck->ui8KpShift) &&
+           psCheck->i32KiQ15 == PID_Q15_GAIN(psCheck->f32Ki, psCheck->ui8KiShift) &&
+           psCheck->i32KdQ15 == PID_Q15_GAIN(psCheck->f32Kd, psCheck->ui8KdShift) &&
+           psCheck->i64KpQ31 == PID_Q31_GAIN(psCheck->f32Kp, psCheck->ui8KpShift) &&
+           psCheck->i64KiQ31 == PID_Q31_GAIN(psCheck->f32Ki, psCheck->ui8KiShift) &&
+           psCheck->i64KdQ31 == PID_Q31_GAIN(psCheck->f32Kd, psCheck->ui8KdShift);
+}
+
+// Function playing the QEI1 interrupt of --gain-test
+static void SIM_gainIsr(int iSignal){
+    static uint32_t ui32Seed = 2463534242UL;
+    (void)iSignal;
+
+    ui32Seed ^= ui32Seed << 13; ui32Seed ^= ui32Seed >> 17; ui32Seed ^= ui32Seed << 5;
+    PID_gainsSchedule((int32_t)(ui32Seed % (PID_SCHED_POINTS << 8)), 0);
+    g_ui32SimChecks++;
+    if (g_bSimWriting) g_ui32SimMidWrite++;
+    if (!SIM_gainsWhole(psGains)) g_ui32SimTorn++;
+}
+
+// Function to check the atomic gain updates, time the gain schedule and store it in the EEPROM
+static int SIM_gainTest(double f64Seconds){
+    float pf32Sched[PID_SCHED_POINTS][3];
+    float pf32Back[PID_SCHED_POINTS][3];
+    uint8_t pui8Payload[PROTO_SCHED_LEN];
+    uint8_t ui8Source, ui8Shift;
+    struct sigaction sAction;
+    struct itimerval sTimer = {{0, SIM_TEAR_US}, {0, SIM_TEAR_US}};
+    struct timespec sStart, sNow;
+    uint32_t ui32Update = 0, ui32Point, ui32Call;
+    tMotorModel sMotor;
+    double f64Elapsed = 0.0;
+
+    // Start from gains of the checked form, then start the interrupt
+    PID_gainsSet(1.0f / 4096, 0.5f / 4096, 0.25f / 4096);
+    memset(&sAction, 0, sizeof(sAction));
+    sAction.sa_handler = SIM_gainIsr;
+    sigaction(SIGALRM, &sAction, NULL);
+    setitimer(ITIMER_REAL, &sTimer, NULL);
+
+    // Gains n / 4096 with K_I = K_P / 2 and K_D = K_P / 4 are exact in float, Q15 and Q31
+    clock_gettime(CLOCK_MONOTONIC, &sStart);
+    while (f64Elapsed < f64Seconds){
+        float f32Kp = (float)(1 + ui32Update % 4000) / 4096.0f;
+        g_bSimWriting = 1;
+        if (ui32Update & 1){
+            for (ui32Point = 0; ui32Point < PID_SCHED_POINTS; ui32Point++){
+                pf32Sched[ui32Point][0] = f32Kp;
+                pf32Sched[ui32Point][1] = f32Kp / 2;
+                pf32Sched[ui32Point][2] = f32Kp / 4;
+            }
+            PID_scheduleSet(PID_SCHED_ERROR, 8, (const float (*)[3])pf32Sched);
+        }
+        else
+            PID_gainsSet(f32Kp, f32Kp / 2, f32Kp / 4);
+        g_bSimWriting = 0;
+        ui32Update++;
+
+        clock_gettime(CLOCK_MONOTONIC, &sNow);
+        f64Elapsed = (sNow.tv_sec - sStart.tv_sec) + 1e-9 * (sNow.tv_nsec - sStart.tv_nsec);
+    }
+    sTimer.it_value.tv_usec = sTimer.it_interval.tv_usec = 0;
+    setitimer(ITIMER_REAL, &sTimer, NULL);
+
+    // Cost of the interpolation for one tick, with the input sweeping all the segments
+    for (ui32Point = 0; ui32Point < PID_SCHED_POINTS; ui32Point++){
+        pf32Sched[ui32Point][0] = 0.3f - 0.05f * ui32Point;
+        pf32Sched[ui32Point][1] = 0.002f;
+        pf32Sched[ui32Point][2] = 0.01f + 0.005f * ui32Point;
+    }
+    PID_scheduleSet(PID_SCHED_ERROR, 8, (const float (*)[3])pf32Sched);
+    clock_gettime(CLOCK_MONOTONIC, &sStart);
+    for (ui32Call = 0; ui32Call < SIM_SCHED_CALLS; ui32Call++)
+        PID_gainsSchedule((int32_t)(ui32Call & 1023) - 512, 0);
+    clock_gettime(CLOCK_MONOTONIC, &sNow);
+    double f64Ns = 1e9 * (sNow.tv_sec - sStart.tv_sec) + (sNow.tv_nsec - sStart.tv_nsec);
+
+    // Every axis of one update must get the gains of its own error: compare each with a lone axis
+    tPIDAxes sAxes, sLone;
+    int64_t pi64Pos[PID_MAX_AXES] = {0};
+    int32_t pi32Rpm[PID_MAX_AXES] = {0};
+    uint32_t ui32Axis, ui32Mismatch = 0;
+    PID_axesInit(&sAxes, PID_MAX_AXES);
+    for (ui32Axis = 0; ui32Axis < PID_MAX_AXES; ui32Axis++)
+        sAxes.i64DesPos[ui32Axis] = 20 + 50 * ui32Axis;
+    PID_axesUpdate(&sAxes, pi64Pos, pi32Rpm);
+    for (ui32Axis = 0; ui32Axis < PID_MAX_AXES; ui32Axis++){
+        PID_axesInit(&sLone, 1);
+        sLone.i64DesPos[0] = sAxes.i64DesPos[ui32Axis];
+        PID_axesUpdate(&sLone, pi64Pos, pi32Rpm);
+        if (sLone.i16Control[0] != sAxes.i16Control[ui32Axis]) ui32Mismatch++;
+    }
+
+    // Send the schedule over UART0, store it, and load it again after a reset
+    SIM_reset(&sMotor);
+    pui8Payload[0] = PID_SCHED_RPM;
+    pui8Payload[1] = 5;
+    for (ui32Point = 0; ui32Point < PID_SCHED_POINTS; ui32Point++){
+        PROTO_putF32(pui8Payload + 2 + 12 * ui32Point, pf32Sched[ui32Point][0]);
+        PROTO_putF32(pui8Payload + 6 + 12 * ui32Point, pf32Sched[ui32Point][1]);
+        PROTO_putF32(pui8Payload + 10 + 12 * ui32Point, pf32Sched[ui32Point][2]);
+    }
+    bool bStored = SIM_command(PROTO_SET_SCHED, pui8Payload, sizeof(pui8Payload)) == PROTO_STATUS_OK &&
+                   SIM_command(PROTO_SAVE_PARAMS, NULL, 0) == PROTO_STATUS_OK;
+    PID_gainsSet(K_P, K_I, K_D);
+    bool bLoaded = PARAM_load();
+    PID_scheduleGet(&ui8Source, &ui8Shift, pf32Back);
+    bool bSame = bStored && bLoaded && ui8Source == PID_SCHED_RPM && ui8Shift == 5 &&
+                 memcmp(pf32Back, pf32Sched, sizeof(pf32Sched)) == 0;
+    PID_gainsSet(K_P, K_I, K_D);
+
+    printf("updates,interrupts,mid_update,torn,ns_per_schedule,axis_mismatch,eeprom_roundtrip\n");
+    printf("%u,%u,%u,%u,%.2f,%u,%s\n", ui32Update, g_ui32SimChecks, g_ui32SimMidWrite, g_ui32SimTorn,
+           f64Ns / SIM_SCHED_CALLS, ui32Mismatch, bSame ? "ok" : "failed");
+    return (g_ui32SimTorn || ui32Mismatch || !bSame) ? -1 : 0;
+}
+
+// Function to check that PROTO_SET_LIMITS refuses the limits the Q24 profile cannot hold
+static int SIM_limitsTest(void){
+    static const struct {
+        float f32Vel, f32Acc, f32Jerk;
+        int iStatus;
+    } psCase[] = {
+        {4800.0f, 48000.0f, 1920000.0f, PROTO_STATUS_OK},
+        {NAN, 48000.0f, 0.0f, PROTO_STATUS_RANGE},
+        {4800.0f, NAN, 0.0f, PROTO_STATUS_RANGE},
+        {4800.0f, 48000.0f, NAN, PROTO_STATUS_RANGE},
+        {-4800.0f, 48000.0f, 0.0f, PROTO_STATUS_RANGE},
+        {4800.0f, -48000.0f, 0.0f, PROTO_STATUS_RANGE},
+        {4800.0f, 48000.0f, -1.0f, PROTO_STATUS_RANGE},
+        {0.0f, 48000.0f, 0.0f, PROTO_STATUS_RANGE},
+        {INFINITY, 48000.0f, 0.0f, PROTO_STATUS_RANGE},
+        {1e30f, 48000.0f, 0.0f, PROTO_STATUS_RANGE},
+        {4800.0f, 1e30f, 0.0f, PROTO_STATUS_RANGE},
+        {262144.0f, 48000.0f, 0.0f, PROTO_STATUS_RANGE},
+        {4800.0f, 48000.0f, INFINITY, PROTO_STATUS_OK},
+        {262000.0f, 1.07e9f, 0.0f, PROTO_STATUS_OK},
+    };
+    const uint32_t ui32Cases = sizeof(psCase) / sizeof(psCase[0]);
+    uint8_t pui8Payload[12];
+    tMotorModel sMotor;
+    uint32_t ui32Case, ui32Bad = 0, ui32Tick;
+
+    SIM_reset(&sMotor);
+    printf("vel,acc,jerk,status,expected,vel_q24,acc_q24\n");
+    for (ui32Case = 0; ui32Case < ui32Cases; ui32Case++){
+        int32_t i32VelMax = sTraj.i32VelMax, i32AccMax = sTraj.i32AccMax;
+        PROTO_putF32(pui8Payload, psCase[ui32Case].f32Vel);
+        PROTO_putF32(pui8Payload + 4, psCase[ui32Case].f32Acc);
+        PROTO_putF32(pui8Payload + 8, psCase[ui32Case].f32Jerk);
+        int iStatus = SIM_command(PROTO_SET_LIMITS, pui8Payload, sizeof(pui8Payload));
+        bool bKept = sTraj.i32VelMax == i32VelMax && sTraj.i32AccMax == i32AccMax;
+        if (iStatus != psCase[ui32Case].iStatus || (iStatus == PROTO_STATUS_RANGE && !bKept)) ui32Bad++;
+        printf("%g,%g,%g,%d,%d,%d,%d\n", psCase[ui32Case].f32Vel, psCase[ui32Case].f32Acc, psCase[ui32Case].f32Jerk,
+               iStatus, psCase[ui32Case].iStatus, sTraj.i32VelMax, sTraj.i32AccMax);
+    }
+
+    // A long move with the largest limits accepted, the profile only, stays within them
+    int64_t i64Target = 100000000, i64Last = TRAJ_update(&sTraj);
+    int32_t i32VelMax = sTraj.i32VelMax;
+    bool bMove = true;
+    TRAJ_target(&sTraj, i64Target);
+    for (ui32Tick = 0; ui32Tick < 1U << 24 && !sTraj.bDone; ui32Tick++){
+        int64_t i64Pos = TRAJ_update(&sTraj);
+        if (i64Pos < i64Last || sTraj.i32Vel < 0 || sTraj.i32Vel > i32VelMax) bMove = false;
+        i64Last = i64Pos;
+    }
+    bMove = bMove && sTraj.bDone && i64Last == i64Target;
+    printf("move_ticks,%u,%s\n", ui32Tick, bMove ? "ok" : "failed");
+    return (ui32Bad || !bMove) ? -1 : 0;
+}
+
+// The RPM conversion of the Quadrature Encoder project, where VEL_INT_FREQ is in Hz and not a power of 2
+#pragma push_macro("VEL_INT_FREQ")
+#undef VEL_INT_FREQ
+#include "../../TM4C123G LaunchPad Quadrature Encoder/RPM_convert.h"
+
+// Function to check RPM_FROM_VEL of the Quadrature Encoder project and print its row, returns the mismatches
+static uint32_t SIM_unitsQei(void){
+    uint32_t ui32Bad = 0;
+    int64_t i64Value;
+
+    for (i64Value = 0; i64Value <= (int64_t)RPM_VEL_MAX; i64Value++)
+        if (RPM_FROM_VEL(i64Value) != (uint64_t)(i64Value * RPM_NUM / QEI1_PPR)) ui32Bad++;
+    for (i64Value = RPM_VEL_MAX; i64Value < INT32_MAX; i64Value++)
+        if (RPM_FROM_VEL(i64Value + 1) != (uint64_t)((i64Value + 1) * RPM_NUM / QEI1_PPR)) break;
+
+    printf("qei_vel_to_rpm,%llu,%d,0..%llu,%u,%lld\n", (unsigned long long)RPM_MUL, RPM_SHIFT,
+           (unsigned long long)RPM_VEL_MAX, ui32Bad, (long long)i64Value);
+    return ui32Bad;
+}
+#pragma pop_macro("VEL_INT_FREQ")
+
+// The RPM conversion of PID with UART, whose QEI1IntHandler has no velocity estimator. Its macros.h is
+// skipped by the include guard, and has the VEL_INT_FREQ and QEI1_CPR of this project.
+#undef UNIT_CONVERT_H_
+#include "../../TM4C123G LaunchPad PID with UART/UNIT_convert.h"
+
+// Function to check the conversions of UNIT_convert.h against the integer divisions
+static int SIM_units(void){
+    uint32_t ui32RpmBad = 0, ui32DegBad = 0;
+    int64_t i64Value, i64RpmExact, i64DegExact;
+
+    for (i64Value = 0; i64Value <= (int64_t)UNIT_RPM_VEL_MAX; i64Value++)
+        if (UNIT_VEL_TO_RPM(i64Value) != (uint32_t)(i64Value * UNIT_RPM_NUM / UNIT_RPM_DEN)) ui32RpmBad++;
+    for (i64Value = -UNIT_DEG_MAX; i64Value <= UNIT_DEG_MAX; i64Value++){
+        int32_t i32Deg = (int32_t)i64Value;
+        if (UNIT_DEG_TO_TICKS(i32Deg) != (int32_t)(i64Value * UNIT_DEG_NUM / UNIT_DEG_DEN)) ui32DegBad++;
+    }
+
+    // Margin: first value past the specified range that converts differently
+    for (i64RpmExact = UNIT_RPM_VEL_MAX; i64RpmExact < INT32_MAX; i64RpmExact++)
+        if (UNIT_VEL_TO_RPM(i64RpmExact + 1) != (uint32_t)((i64RpmExact + 1) * UNIT_RPM_NUM / UNIT_RPM_DEN)) break;
+    for (i64DegExact = UNIT_DEG_MAX; i64DegExact < INT32_MAX; i64DegExact++)
+        if (UNIT_DEG_TO_TICKS_U(i64DegExact + 1) != (int32_t)((i64DegExact + 1) * UNIT_DEG_NUM / UNIT_DEG_DEN)) break;
+
+    printf("conversion,mul,shift,range,mismatches,exact_up_to\n");
+    printf("vel_to_rpm,%llu,%d,0..%llu,%u,%lld\n", (unsigned long long)UNIT_RPM_MUL, UNIT_RPM_SHIFT,
+           (unsigned long long)UNIT_RPM_VEL_MAX, ui32RpmBad, (long long)i64RpmExact);
+    printf("deg_to_ticks,%llu,%d,+/-%d,%u,%lld\n", (unsigned long long)UNIT_DEG_MUL, UNIT_DEG_SHIFT,
+           UNIT_DEG_MAX, ui32DegBad, (long long)i64DegExact);
+    uint32_t ui32QeiBad = SIM_unitsQei();
+    return (ui32RpmBad || ui32DegBad || ui32QeiBad) ? -1 : 0;
+}
+
+// Function to feed a PhA edge of the synthetic encoder to the estimator of --vel-bench
+static void SIM_benchEdge(uint32_t ui32Time){
+    if (g_sSimVel.bCapture){
+        VEL_edge(&g_sSimVel, ui32Time);
+        g_ui32SimVelIrq++;
+    }
+}
+
+// Function to move the synthetic encoder at f64Rpm over the tick that starts at f64Tick and estimate the velocity
+static float SIM_velTick(double *pf64Pos, double f64Rpm, double f64Tick){
+    double f64From = *pf64Pos;
+
+    *pf64Pos += f64Rpm * QEI1_CPR / 60.0 / SIM_TICK_HZ;
+    SIM_phaEdges(f64From, *pf64Pos, f64Tick, SIM_benchEdge);
+    int64_t i64Count = (int64_t)floor(*pf64Pos) - (int64_t)floor(f64From);
+    return VEL_update(&g_sSimVel, (uint32_t)llabs(i64Count), (f64Rpm < 0) ? -1 : 1, SIM_timerCount(f64Tick + 1.0));
+}
+
+// Function to compare the M/T estimate with the count alone on synthetic encoder edge streams
+static void SIM_velBench(void){
+    static const double pf64Rpm[] = {0.1, 0.3, 1, 3, 10, 30, 100, 300, 1000, 3000, 5000};
+    static const char *ppcBand[] = {"edge_times", "blend", "count"};
+    // Start the capture timer close to its wrap, so that every run crosses it
+    const double f64Start = 0xF0000000u / ((double)HOST_SYSCLK_HZ / SIM_TICK_HZ);
+    const uint32_t ui32Ticks = SIM_VEL_SECONDS * SIM_TICK_HZ;
+    uint32_t ui32Speed, ui32Tick, ui32Band;
+
+    printf("rpm,edges_per_s,capture_irq_per_s,mt_mean_err_pct,mt_rms_err_pct,mt_max_err_pct,m_rms_err_pct,m_max_err_pct\n");
+    for (ui32Speed = 0; ui32Speed < sizeof(pf64Rpm) / sizeof(pf64Rpm[0]); ui32Speed++){
+        double f64Rpm = pf64Rpm[ui32Speed], f64Pos = 0.37;
+        double f64Sum = 0, f64SumSq = 0, f64Max = 0, f64SumSqM = 0, f64MaxM = 0;
+        uint32_t ui32Measured = 0;
+
+        VEL_init(&g_sSimVel, SIM_TICK_HZ, HOST_SYSCLK_HZ);
+        g_ui32SimVelIrq = 0;
+        for (ui32Tick = 0; ui32Tick < ui32Ticks; ui32Tick++){
+            double f64Err = 100.0 * (SIM_velTick(&f64Pos, f64Rpm, f64Start + ui32Tick) - f64Rpm) / f64Rpm;
+            double f64ErrM = 100.0 * (g_sSimVel.f32RpmM - f64Rpm) / f64Rpm;
+            if (ui32Tick < SIM_VEL_SKIP * SIM_TICK_HZ) continue;
+            f64Sum += f64Err;
+            f64SumSq += f64Err * f64Err;
+            f64SumSqM += f64ErrM * f64ErrM;
+            if (fabs(f64Err) > f64Max) f64Max = fabs(f64Err);
+            if (fabs(f64ErrM) > f64MaxM) f64MaxM = fabs(f64ErrM);
+            ui32Measured++;
+        }
+        printf("%g,%.1f,%.1f,%.4f,%.4f,%.4f,%.2f,%.2f\n", f64Rpm, f64Rpm * QEI1_CPR / 120.0,
+               (double)g_ui32SimVelIrq / SIM_VEL_SECONDS, f64Sum / ui32Measured, sqrt(f64SumSq / ui32Measured),
+               f64Max, sqrt(f64SumSqM / ui32Measured), f64MaxM);
+    }
+
+    // Ramp through the crossover: the largest error and the largest step of the estimate beyond the
+    // step of the true speed, in each band of the count per tick
+    double pf64MaxErr[3] = {0}, pf64MaxJump[3] = {0};
+    double f64Pos = 0.37, f64Prev = 0, f64PrevTrue = 0;
+    const uint32_t ui32RampTicks = SIM_VEL_RAMP * SIM_TICK_HZ;
+
+    VEL_init(&g_sSimVel, SIM_TICK_HZ, HOST_SYSCLK_HZ);
+    for (ui32Tick = 0; ui32Tick < ui32RampTicks; ui32Tick++){
+        double f64True = 5000.0 * (ui32Tick + 0.5) / ui32RampTicks;
+        double f64Est = SIM_velTick(&f64Pos, f64True, f64Start + ui32Tick);
+        double f64Count = f64True * QEI1_CPR / 60.0 / SIM_TICK_HZ;
+
+        ui32Band = (f64Count <= VEL_MT_LOW) ? 0 : (f64Count < VEL_MT_HIGH) ? 1 : 2;
+        if (ui32Tick >= SIM_TICK_HZ / 10){
+            if (fabs(f64Est - f64True) > pf64MaxErr[ui32Band]) pf64MaxErr[ui32Band] = fabs(f64Est - f64True);
+            if (fabs((f64Est - f64Prev) - (f64True - f64PrevTrue)) > pf64MaxJump[ui32Band])
+                pf64MaxJump[ui32Band] = fabs((f64Est - f64Prev) - (f64True - f64PrevTrue));
+        }
+        f64Prev = f64Est;
+        f64PrevTrue = f64True;
+    }
+    printf("ramp_band,max_err_rpm,max_jump_rpm\n");
+    for (ui32Band = 0; ui32Band < 3; ui32Band++)
+        printf("%s,%.2f,%.2f\n", ppcBand[ui32Band], pf64MaxErr[ui32Band], pf64MaxJump[ui32Band]);
+}
+
+// Function to step a xorshift64 generator
+static uint64_t SIM_rand64(uint64_t *pui64State){
+    *pui64State ^= *pui64State << 13;
+    *pui64State ^= *pui64State >> 7;
+    *pui64State ^= *pui64State << 17;
+    return *pui64State;
+}
+
+// Function to drive the multi-turn position through f64Billions * 10^9 synthetic counts and
+// check it against a 64 bit reference, then through QEI1IntHandler and a closed loop step
+static int SIM_posTest(double f64Billions){
+    const int64_t i64Half = (int64_t)(f64Billions * 5e8);
+    uint64_t ui64Rand = 88172645463325252ULL, ui64Travel = 0, ui64Updates = 0;
+    uint32_t ui32Raw = 0xFFFFF000u, ui32Wraps = 0, ui32Bad = 0, ui32Phase;
+    int64_t i64Ref = 0;
+    tPosTrack sTrack;
+    struct timespec sStart, sEnd;
+
+    // Random moves of -64 .. +191 (then +64 .. -191) counts out to +i64Half, back through 0 to
+    // -i64Half and back to 0. Every SIM_POS_EXTREME updates a move of +/-(2^31 - 1), the largest
+    // allowed, is made and undone.
+    int32_t i32Undo = 0;
+    POS_init(&sTrack, ui32Raw, 0);
+    clock_gettime(CLOCK_MONOTONIC, &sStart);
+    for (ui32Phase = 0; ui32Phase < 3; ui32Phase++){
+        const int32_t i32Dir = (ui32Phase == 1) ? -1 : 1;
+        const int64_t i64End = (ui32Phase == 0) ? i64Half : ((ui32Phase == 1) ? -i64Half : 0);
+
+        while (i32Undo || i32Dir * (i64End - i64Ref) > 0){
+            uint64_t ui64Rnd = SIM_rand64(&ui64Rand);
+            int32_t i32Move = i32Dir * ((int32_t)(ui64Rnd & 255) - 64);
+            if (i32Undo){
+                i32Move = i32Undo;
+                i32Undo = 0;
+            }
+            else if (++ui64Updates % SIM_POS_EXTREME == 0){
+                i32Move = (ui64Rnd & 256) ? INT32_MAX : -INT32_MAX;
+                i32Undo = -i32Move;
+            }
+
+            uint32_t ui32Next = ui32Raw + (uint32_t)i32Move;
+            if ((i32Move > 0) ? (ui32Next < ui32Raw) : (ui32Next > ui32Raw)) ui32Wraps++;
+            ui32Raw = ui32Next;
+            i64Ref += i32Move;
+            ui64Travel += (uint64_t)(i32Move < 0 ? -(int64_t)i32Move : i32Move);
+            if (POS_update(&sTrack, ui32Raw) != i64Ref) ui32Bad++;
+        }
+    }
+    clock_gettime(CLOCK_MONOTONIC, &sEnd);
+    double f64Ns = 1e9 * (sEnd.tv_sec - sStart.tv_sec) + (sEnd.tv_nsec - sStart.tv_nsec);
+
+    printf("updates,counts_travelled,counter_wraps,mismatches,final_position,ns_per_update\n");
+    printf("%llu,%llu,%u,%u,%lld,%.2f\n", (unsigned long long)ui64Updates, (unsigned long long)ui64Travel,
+           ui32Wraps, ui32Bad, (long long)sTrack.i64Pos, f64Ns / ui64Updates);
+
+    // Through the firmware: moves of up to 2^24 counts per QEI1 tick take the count far past 2^32
+    tMotorModel sMotor;
+    int64_t i64Count = 0, i64Max = 0, i64Min = 0;
+    uint32_t ui32Tick, ui32IsrBad = 0;
+
+    g_pfnSimCompute = g_psSimArith[PID_ARITHMETIC].pfnCompute;
+    PID_gainsSet(K_P, K_I, K_D);
+    SIM_reset(&sMotor);
+    for (ui32Tick = 0; ui32Tick < SIM_POS_TICKS; ui32Tick++){
+        uint64_t ui64Rnd = SIM_rand64(&ui64Rand);
+        int32_t i32Move = (int32_t)(ui64Rnd & 0xFFFFFF) - ((ui32Tick < SIM_POS_TICKS / 2) ? 0x600000 : 0xA00000);
+        i64Count += i32Move;
+        HOST_qeiCount(i64Count, (uint32_t)abs(i32Move));
+        QEI1IntHandler();
+        if (i64Qei1Pos != i64Count) ui32IsrBad++;
+        if (i64Count > i64Max) i64Max = i64Count;
+        if (i64Count < i64Min) i64Min = i64Count;
+    }
+    printf("isr_ticks,max_count,min_count,mismatches\n%u,%lld,%lld,%u\n", SIM_POS_TICKS,
+           (long long)i64Max, (long long)i64Min, ui32IsrBad);
+
+    // Closed loop: each step runs with the counter powered up where the step wraps it and where it
+    // does not, and the two runs must give the same response
+    static const struct {
+        int32_t i32Deg;
+        uint32_t ui32Wrap, ui32Clear;
+    } psStep[] = {{900, 0xFFFFFF00u, 0}, {-900, 0, 0x80000000u}};
+    bool bSame = true;
+    uint32_t ui32Step;
+
+    printf("step_deg,settle_ms,final_error,raw_start,raw_end,settle_ms_nowrap,final_error_nowrap,same\n");
+    for (ui32Step = 0; ui32Step < 2; ui32Step++){
+        tSimResult sWrap, sClear;
+        g_ui32SimQeiStart = psStep[ui32Step].ui32Wrap;
+        SIM_run(psStep[ui32Step].i32Deg, 2.0, 5, NULL, NULL, &sWrap);
+        uint32_t ui32End = ui32Qei1Pos;
+        g_ui32SimQeiStart = psStep[ui32Step].ui32Clear;
+        SIM_run(psStep[ui32Step].i32Deg, 2.0, 5, NULL, NULL, &sClear);
+
+        // Everything but the host throughput must match
+        sWrap.f64TicksPerSec = sClear.f64TicksPerSec = 0;
+        bool bStep = memcmp(&sWrap, &sClear, sizeof(sWrap)) == 0;
+        bSame = bSame && bStep;
+        printf("%.1f,%.2f,%d,0x%08X,0x%08X,%.2f,%d,%s\n", psStep[ui32Step].i32Deg / 10.0, sWrap.f64SettleMs,
+               sWrap.i32FinalError, psStep[ui32Step].ui32Wrap, ui32End, sClear.f64SettleMs, sClear.i32FinalError,
+               bStep ? "yes" : "no");
+    }
+    g_ui32SimQeiStart = 0;
+
+    return (ui32Bad || ui32IsrBad || !bSame) ? -1 : 0;
+}
+
+// Function to iterate the Riccati equation of the constant velocity (2 states) or constant
+// acceleration (3 states) model, driven by white noise of f64Sigma on its highest derivative,
+// to the steady-state Kalman gains of a reading with SIM_OBS_NOISE of quantisation noise
+static void SIM_obsRiccati(uint32_t ui32States, double f64Sigma, double *pf64K){
+    static const double pf64G2[3] = {0.5, 1.0, 0.0}, pf64G3[3] = {1.0 / 6.0, 0.5, 1.0};
+    static const double ppf64F[3][3] = {{1, 1, 0.5}, {0, 1, 1}, {0, 0, 1}};
+    const double *pf64G = (ui32States == 3) ? pf64G3 : pf64G2;
+    double ppf64P[3][3] = {{0}}, ppf64Pm[3][3], ppf64T[3][3], pf64Old[3] = {0};
+    uint32_t ui32Iter, i, j, k;
+
+    for (i = 0; i < ui32States; i++) ppf64P[i][i] = 1e3;
+    pf64K[2] = 0;
+    for (ui32Iter = 0; ui32Iter < 1000000; ui32Iter++){
+        // Prediction: Pm = F P F' + sigma^2 G G'
+        for (i = 0; i < ui32States; i++)
+            for (j = 0; j < ui32States; j++){
+                ppf64T[i][j] = 0;
+                for (k = 0; k < ui32States; k++) ppf64T[i][j] += ppf64F[i][k] * ppf64P[k][j];
+            }
+        for (i = 0; i < ui32States; i++)
+            for (j = 0; j < ui32States; j++){
+                ppf64Pm[i][j] = f64Sigma * f64Sigma * pf64G[i] * pf64G[j];
+                for (k = 0; k < ui32States; k++) ppf64Pm[i][j] += ppf64T[i][k] * ppf64F[j][k];
+            }
+        // Correction by the position reading: K = Pm H' / (H Pm H' + R), P = (I - K H) Pm
+        double f64S = ppf64Pm[0][0] + SIM_OBS_NOISE, f64Change = 0;
+        for (i = 0; i < ui32States; i++){
+            pf64K[i] = ppf64Pm[i][0] / f64S;
+            f64Change += fabs(pf64K[i] - pf64Old[i]);
+            pf64Old[i] = pf64K[i];
+        }
+        for (i = 0; i < ui32States; i++)
+            for (j = 0; j < ui32States; j++) ppf64P[i][j] = ppf64Pm[i][j] - pf64K[i] * ppf64Pm[0][j];
+        if (ui32Iter > 10 && f64Change < 1e-15) break;
+    }
+}
+
+// Function to print the observer gains for macros.h
+static void SIM_obsGains(double f64SigmaA, double f64SigmaJ){
+    double pf64Ab[3], pf64Kf[3];
+
+    SIM_obsRiccati(2, f64SigmaA, pf64Ab);
+    SIM_obsRiccati(3, f64SigmaJ, pf64Kf);
+    printf("// --obs-gains %g:%g (white acceleration %g ticks/tick^2, white jerk %g ticks/tick^3)\n",
+           f64SigmaA, f64SigmaJ, f64SigmaA, f64SigmaJ);
+    printf("#define OBS_AB_ALPHA    %.6ff\n#define OBS_AB_BETA     %.6ff\n", pf64Ab[0], pf64Ab[1]);
+    printf("#define OBS_KF_KX       %.6ff\n#define OBS_KF_KV       %.6ff\n#define OBS_KF_KA       %.8ff\n",
+           pf64Kf[0], pf64Kf[1], pf64Kf[2]);
+}
+
+// Function to compare the velocity of every observer mode with the motor model: driven open loop at a
+// constant voltage (noise) and by a +/-6 V square wave (lag), then in the closed-loop step response
+static void SIM_observer(int32_t i32TargetDeg, double f64Seconds, int32_t i32Band){
+    const uint32_t ui32Ticks = SIM_OBS_SECONDS * SIM_TICK_HZ;
+    float *pf32True = malloc(ui32Ticks * sizeof(float)), *pf32Est = malloc(ui32Ticks * sizeof(float));
+    uint8_t ui8Mode;
+
+    printf("obs,slow_rpm,slow_noise_rpm,square_lag_ms,square_rms_rpm,ns_per_update\n");
+    for (ui8Mode = OBS_OFF; ui8Mode <= OBS_KALMAN; ui8Mode++){
+        double f64Slow = 0, f64SlowSq = 0, f64BestRms = 1e300, f64Ns;
+        uint32_t ui32Drive, ui32Tick, ui32Lag, ui32BestLag = 0, ui32Measured = 0;
+        struct timespec sStart, sEnd;
+
+        for (ui32Drive = 0; ui32Drive < 2; ui32Drive++){
+            tMotorModel sMotor;
+            tObserver sObs;
+            int64_t i64Prev = 0;
+
+            MOTOR_reset(&sMotor);
+            OBS_init(&sObs, ui8Mode);
+            for (ui32Tick = 0; ui32Tick < ui32Ticks; ui32Tick++){
+                // 1 V turns the motor at a few RPM, the square wave reverses it every 100 ms
+                float f32Volts = ui32Drive ? (((ui32Tick / (SIM_TICK_HZ / 10)) & 1) ? -6.0f : 6.0f) : 1.0f;
+                MOTOR_step(&sMotor, f32Volts, 1.0f / SIM_TICK_HZ);
+                OBS_update(&sObs, 1, &sMotor.i64Count);
+                pf32True[ui32Tick] = sMotor.f32Omega * (MOTOR_ENC_CPR / (2.0f * (float)M_PI)) / SIM_TICK_HZ;
+                pf32Est[ui32Tick] = (ui8Mode == OBS_OFF) ? (float)(sMotor.i64Count - i64Prev) : sObs.f32Vel[0];
+                i64Prev = sMotor.i64Count;
+            }
+
+            if (!ui32Drive){
+                // Noise of the last half at the constant voltage
+                for (ui32Tick = ui32Ticks / 2; ui32Tick < ui32Ticks; ui32Tick++){
+                    double f64Err = SIM_OBS_RPM * (pf32Est[ui32Tick] - pf32True[ui32Tick]);
+                    f64Slow += SIM_OBS_RPM * pf32True[ui32Tick];
+                    f64SlowSq += f64Err * f64Err;
+                    ui32Measured++;
+                }
+                continue;
+            }
+            // The lag is the delay of the true velocity that matches the estimate best
+            for (ui32Lag = 0; ui32Lag <= SIM_OBS_LAG; ui32Lag++){
+                double f64SumSq = 0;
+                for (ui32Tick = SIM_OBS_LAG; ui32Tick < ui32Ticks; ui32Tick++){
+                    double f64Err = SIM_OBS_RPM * (pf32Est[ui32Tick] - pf32True[ui32Tick - ui32Lag]);
+                    f64SumSq += f64Err * f64Err;
+                }
+                if (f64SumSq < f64BestRms){
+                    f64BestRms = f64SumSq;
+                    ui32BestLag = ui32Lag;
+                }
+            }
+            f64BestRms = sqrt(f64BestRms / (ui32Ticks - SIM_OBS_LAG));
+        }
+
+        // Host time of one update of a single axis
+        {
+            tObserver sObs;
+            int64_t i64Pos = 0;
+            OBS_init(&sObs, ui8Mode);
+            clock_gettime(CLOCK_MONOTONIC, &sStart);
+            for (ui32Tick = 0; ui32Tick < SIM_AXES_TICKS; ui32Tick++){
+                i64Pos += (ui32Tick & 3) == 0;
+                OBS_update(&sObs, 1, &i64Pos);
+            }
+            clock_gettime(CLOCK_MONOTONIC, &sEnd);
+            f64Ns = (1e9 * (sEnd.tv_sec - sStart.tv_sec) + (sEnd.tv_nsec - sStart.tv_nsec)) / SIM_AXES_TICKS;
+            if (sObs.f32Vel[0] > 1.0f) printf("#");             // Keeps the loop from being optimised out
+        }
+
+        printf("%s,%.2f,%.3f,%.2f,%.3f,%.2f\n", g_ppcSimObs[ui8Mode], f64Slow / ui32Measured,
+               sqrt(f64SlowSq / ui32Measured), 1000.0 * ui32BestLag / SIM_TICK_HZ, f64BestRms,
+               (ui8Mode == OBS_OFF) ? 0.0 : f64Ns);
+    }
+    free(pf32True);
+    free(pf32Est);
+
+    // The step response with each observer, and the tick to tick jitter of the Difference of Error
+    const uint32_t ui32RunTicks = (uint32_t)(f64Seconds * SIM_TICK_HZ);
+    const uint8_t ui8Saved = g_ui8SimObs;
+    tSimRecord sRecord;
+
+    sRecord.pi32Error = malloc(ui32RunTicks * sizeof(int32_t));
+    sRecord.pi32DiffError = malloc(ui32RunTicks * sizeof(int32_t));
+    printf("obs,overshoot_pct,rise_ms,settle_ms,final_error,max_error,diff_jitter_ticks\n");
+    for (ui8Mode = OBS_OFF; ui8Mode <= OBS_KALMAN; ui8Mode++){
+        tSimResult sResult;
+        double f64SumSq = 0;
+        uint32_t ui32Tick;
+
+        g_ui8SimObs = ui8Mode;
+        sRecord.ui32Count = 0;
+        SIM_run(i32TargetDeg, f64Seconds, i32Band, NULL, &sRecord, &sResult);
+        for (ui32Tick = 1; ui32Tick < sRecord.ui32Count; ui32Tick++){
+            double f64Jump = (sRecord.pi32DiffError[ui32Tick] - sRecord.pi32DiffError[ui32Tick - 1]) /
+                             (double)(1 << PID_DIFF_SHIFT);
+            f64SumSq += f64Jump * f64Jump;
+        }
+        printf("%s,%.2f,%.2f,%.2f,%d,%d,%.4f\n", g_ppcSimObs[ui8Mode], sResult.f64OvershootPct, sResult.f64RiseMs,
+               sResult.f64SettleMs, sResult.i32FinalError, sResult.i32MaxError,
+               sRecord.ui32Count > 1 ? sqrt(f64SumSq / (sRecord.ui32Count - 1)) : 0.0);
+    }
+    g_ui8SimObs = ui8Saved;
+    free(sRecord.pi32Error);
+    free(sRecord.pi32DiffError);
+}
+
+// Function to time the multi-axis controller for 1 to PID_MAX_AXES axes
+static void SIM_axesBench(void){
+    tPIDAxes sAxes;
+    int64_t pi64Pos[PID_MAX_AXES];
+    int32_t pi32Rpm[PID_MAX_AXES] = {0};
+    uint32_t ui32Axes, ui32Axis, ui32Tick;
+
+    printf("axes,ns_per_tick,ns_per_axis\n");
+    for (ui32Axes = 1; ui32Axes <= PID_MAX_AXES; ui32Axes++){
+        struct timespec sStart, sEnd;
+
+        PID_axesInit(&sAxes, ui32Axes);
+        for (ui32Axis = 0; ui32Axis < ui32Axes; ui32Axis++){
+            pi64Pos[ui32Axis] = 0;
+            sAxes.i64DesPos[ui32Axis] = 500 * (int32_t)(ui32Axis + 1);
+        }
+
+        clock_gettime(CLOCK_MONOTONIC, &sStart);
+        for (ui32Tick = 0; ui32Tick < SIM_AXES_TICKS; ui32Tick++){
+            PID_axesUpdate(&sAxes, pi64Pos, pi32Rpm);
+            // Each axis moves by 1/16 of its Control signal per tick
+            for (ui32Axis = 0; ui32Axis < ui32Axes; ui32Axis++)
+                pi64Pos[ui32Axis] += sAxes.i16Control[ui32Axis] / 16;
+        }
+        clock_gettime(CLOCK_MONOTONIC, &sEnd);
+
+        double f64Ns = 1e9 * (sEnd.tv_sec - sStart.tv_sec) + (sEnd.tv_nsec - sStart.tv_nsec);
+        printf("%u,%.2f,%.2f\n", ui32Axes, f64Ns / SIM_AXES_TICKS, f64Ns / SIM_AXES_TICKS / ui32Axes);
+    }
+}
+
+/* -----------------------          Main Program        --------------------- */
+int main(int argc, char *argv[]){
+    tSimRange sKp = {g_f64DefaultKp, g_f64DefaultKp, 1.0};
+    tSimRange sKi = {g_f64DefaultKi, g_f64DefaultKi, 1.0};
+    tSimRange sKd = {g_f64DefaultKd, g_f64DefaultKd, 1.0};
+    int32_t i32TargetDeg = 900;
+    int32_t i32Band = 5;
+    double f64Seconds = 2.0;
+    const char *pcTrace = NULL;
+    const char *pcTelem = NULL;
+    double f64GainTest = 0.0;
+    bool bUnits = false;
+    bool bLimitsTest = false;
+    bool bVelBench = false;
+    bool bObserver = false;
+    double f64SigmaA = 0.0, f64SigmaJ = 0.0;
+    double f64PosTest = 0.0;
+    uint32_t ui32ArithFirst = PID_ARITHMETIC, ui32ArithLast = PID_ARITHMETIC, ui32Arith;
+    bool bAccuracy = false;
+    bool bAxesBench = false;
+    bool bAutotune = false;
+    uint32_t ui32Fuzz = 0;
+    int iOpt;
+
+    static const struct option psOptions[] = {
+        {"kp", required_argument, NULL, 'p'},
+        {"ki", required_argument, NULL, 'i'},
+        {"kd", required_argument, NULL, 'd'},
+        {"target", required_argument, NULL, 't'},
+        {"seconds", required_argument, NULL, 's'},
+        {"band", required_argument, NULL, 'b'},
+        {"trace", required_argument, NULL, 'o'},
+        {"arith", required_argument, NULL, 'a'},
+        {"accuracy", no_argument, NULL, 'c'},
+        {"axes-bench", no_argument, NULL, 'x'},
+        {"profile", required_argument, NULL, 'r'},
+        {"autotune", no_argument, NULL, 'u'},
+        {"fuzz", required_argument, NULL, 'f'},
+        {"telemetry", required_argument, NULL, 'm'},
+        {"decim", required_argument, NULL, 'n'},
+        {"gain-test", required_argument, NULL, 'g'},
+        {"units", no_argument, NULL, 'v'},
+        {"limits-test", no_argument, NULL, 'y'},
+        {"vel-bench", no_argument, NULL, 'e'},
+        {"pos-test", required_argument, NULL, 'w'},
+        {"obs", required_argument, NULL, 'j'},
+        {"obs-gains", optional_argument, NULL, 'k'},
+        {"observer", no_argument, NULL, 'l'},
+        {NULL, 0, NULL, 0}
+    };
+
+    while ((iOpt = getopt_long(argc, argv, "p:i:d:t:s:b:o:a:cxr:uf:m:n:g:vyew:j:k::l", psOptions, NULL)) != -1){
+        int iErr = 0;
+        switch (iOpt){
+        case 'p': iErr = SIM_parseRange(optarg, &sKp); break;
+        case 'i': iErr = SIM_parseRange(optarg, &sKi); break;
+        case 'd': iErr = SIM_parseRange(optarg, &sKd); break;
+        case 't': i32TargetDeg = atoi(optarg); break;
+        case 's': f64Seconds = atof(optarg); break;
+        case 'b': i32Band = atoi(optarg); break;
+        case 'o': pcTrace = optarg; break;
+        case 'c': bAccuracy = true; break;
+        case 'x': bAxesBench = true; break;
+        case 'u': bAutotune = true; break;
+        case 'f': ui32Fuzz = (uint32_t)strtoul(optarg, NULL, 0); break;
+        case 'm': pcTelem = optarg; break;
+        case 'v': bUnits = true; break;
+        case 'y': bLimitsTest = true; break;
+        case 'e': bVelBench = true; break;
+        case 'w': f64PosTest = atof(optarg); iErr = (f64PosTest <= 0.0); break;
+        case 'l': bObserver = true; break;
+        case 'j':
+            for (g_ui8SimObs = OBS_OFF; g_ui8SimObs <= OBS_KALMAN; g_ui8SimObs++)
+                if (strcmp(optarg, g_ppcSimObs[g_ui8SimObs]) == 0) break;
+            iErr = (g_ui8SimObs > OBS_KALMAN);
+            break;
+        case 'k':
+            f64SigmaA = SIM_OBS_SIGMA_A;
+            f64SigmaJ = SIM_OBS_SIGMA_J;
+            if (optarg)
+                iErr = (sscanf(optarg, "%lf:%lf", &f64SigmaA, &f64SigmaJ) != 2 || f64SigmaA <= 0.0 || f64SigmaJ <= 0.0);
+            break;
+        case 'g': f64GainTest = atof(optarg); iErr = (f64GainTest <= 0.0); break;
+        case 'n': g_ui16SimDecim = (uint16_t)atoi(optarg); iErr = (g_ui16SimDecim == 0); break;
+        case 'r':
+            g_sSimProfile.bEnable = (strcmp(optarg, "none") != 0);
+            if (g_sSimProfile.bEnable)
+                iErr = (sscanf(optarg, "%f:%f:%f", &g_sSimProfile.f32VelMax, &g_sSimProfile.f32AccMax,
+                               &g_sSimProfile.f32JerkMax) != 3) ||
+                       !TRAJ_limits(&sTraj, g_sSimProfile.f32VelMax, g_sSimProfile.f32AccMax,
+                                    g_sSimProfile.f32JerkMax, SIM_TICK_HZ);
+            break;
+        case 'a':
+            if (strcmp(optarg, "all") == 0){
+                ui32ArithFirst = 0;
+                ui32ArithLast = SIM_ARITH_COUNT - 1;
+                break;
+            }
+            for (ui32Arith = 0; ui32Arith < SIM_ARITH_COUNT; ui32Arith++)
+                if (strcmp(optarg, g_psSimArith[ui32Arith].pcName) == 0) break;
+            ui32ArithFirst = ui32ArithLast = ui32Arith;
+            iErr = (ui32Arith == SIM_ARITH_COUNT);
+            break;
+        default:  iErr = -1; break;
+        }
+        if (iErr){
+            fprintf(stderr, "usage: %s [--kp R] [--ki R] [--kd R] [-t deg*10] [-s seconds] "
+                            "[-b band ticks] [-o trace.csv] [--arith f32|q15|q31|all] [--accuracy] [--axes-bench] "
+                            "[--profile vel:acc:jerk|none] [--autotune] [--fuzz bytes] [--telemetry file] [--decim ticks] [--gain-test seconds] [--limits-test] [--units] [--vel-bench] [--pos-test billions] "
+                            "[--obs off|ab|kf] [--obs-gains[=acc:jerk]] [--observer]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    FILE *psTrace = pcTrace ? fopen(pcTrace, "w") : NULL;
+    if (pcTrace && !psTrace){
+        perror(pcTrace);
+        return 1;
+    }
+
+    if (pcTelem){
+        g_psSimTelem = fopen(pcTelem, "wb");
+        if (!g_psSimTelem){
+            perror(pcTelem);
+            return 1;
+        }
+        g_sHost.pfnUartTx = SIM_telemByte;
+    }
+
+    if (bLimitsTest)
+        return SIM_limitsTest() ? 1 : 0;
+
+    if (bUnits)
+        return SIM_units() ? 1 : 0;
+
+    if (f64PosTest > 0.0)
+        return SIM_posTest(f64PosTest) ? 1 : 0;
+
+    if (f64SigmaA > 0.0){
+        SIM_obsGains(f64SigmaA, f64SigmaJ);
+        return 0;
+    }
+
+    if (bObserver){
+        g_pfnSimCompute = g_psSimArith[ui32ArithFirst].pfnCompute;
+        PID_gainsSet((float)sKp.f64First, (float)sKi.f64First, (float)sKd.f64First);
+        SIM_observer(i32TargetDeg, f64Seconds, i32Band);
+        return 0;
+    }
+
+    if (bVelBench){
+        SIM_velBench();
+        return 0;
+    }
+
+    if (f64GainTest > 0.0){
+        g_pfnSimCompute = g_psSimArith[ui32ArithFirst].pfnCompute;
+        return SIM_gainTest(f64GainTest) ? 1 : 0;
+    }
+
+    if (ui32Fuzz)
+        return SIM_fuzz(ui32Fuzz) ? 1 : 0;
+
+    if (bAutotune){
+        // Tune, then run the step response with the tuned gains
+        float f32Kp, f32Ki, f32Kd;
+        g_pfnSimCompute = g_psSimArith[ui32ArithFirst].pfnCompute;
+        if (SIM_autotune()) return 1;
+        PID_gainsGet(&f32Kp, &f32Ki, &f32Kd);
+        sKp.f64First = sKp.f64Last = f32Kp;
+        sKi.f64First = sKi.f64Last = f32Ki;
+        sKd.f64First = sKd.f64Last = f32Kd;
+        ui32ArithLast = ui32ArithFirst;
+    }
+
+    printf("arith,kp,ki,kd,overshoot_pct,rise_ms,settle_ms,final_error,calls_per_tick,"
+           "max_calls_per_tick,pwm_writes_per_tick,max_error,sat_pct,ticks_per_s\n");
+
+    // Small epsilon so that the last point of a range survives the floating point steps
+    for (g_f64SimKp = sKp.f64First; g_f64SimKp <= sKp.f64Last + 1e-9; g_f64SimKp += sKp.f64Step)
+    for (g_f64SimKi = sKi.f64First; g_f64SimKi <= sKi.f64Last + 1e-9; g_f64SimKi += sKi.f64Step)
+    for (g_f64SimKd = sKd.f64First; g_f64SimKd <= sKd.f64Last + 1e-9; g_f64SimKd += sKd.f64Step)
+    for (ui32Arith = ui32ArithFirst; ui32Arith <= ui32ArithLast; ui32Arith++){
+        tSimResult sResult;
+        g_pfnSimCompute = g_psSimArith[ui32Arith].pfnCompute;
+        PID_gainsSet((float)g_f64SimKp, (float)g_f64SimKi, (float)g_f64SimKd);
+        SIM_run(i32TargetDeg, f64Seconds, i32Band, psTrace, NULL, &sResult);
+        if (psTrace){
+            fclose(psTrace);
+            psTrace = NULL;
+        }
+        printf("%s,%g,%g,%g,%.2f,%.2f,%.2f,%d,%.2f,%u,%.3f,%d,%.2f,%.0f\n", g_psSimArith[ui32Arith].pcName,
+               g_f64SimKp, g_f64SimKi, g_f64SimKd, sResult.f64OvershootPct, sResult.f64RiseMs,
+               sResult.f64SettleMs, sResult.i32FinalError, sResult.f64CallsPerTick,
+               sResult.ui32MaxCallsPerTick, sResult.f64PwmWritesPerTick, sResult.i32MaxError,
+               sResult.f64SatPct, sResult.f64TicksPerSec);
+    }
+
+    if (bAccuracy){
+        // Record the error sequence of a float run with the first gains of the ranges
+        tSimRecord sRecord;
+        tSimResult sResult;
+        uint32_t ui32Ticks = (uint32_t)(f64Seconds * SIM_TICK_HZ);
+
+        sRecord.pi32Error = malloc(ui32Ticks * sizeof(int32_t));
+        sRecord.pi32DiffError = malloc(ui32Ticks * sizeof(int32_t));
+        sRecord.ui32Count = 0;
+        g_f64SimKp = sKp.f64First;
+        g_f64SimKi = sKi.f64First;
+        g_f64SimKd = sKd.f64First;
+        g_pfnSimCompute = PID_computeF32;
+        PID_gainsSet((float)g_f64SimKp, (float)g_f64SimKi, (float)g_f64SimKd);
+        SIM_run(i32TargetDeg, f64Seconds, i32Band, NULL, &sRecord, &sResult);
+        SIM_accuracy(&sRecord);
+        free(sRecord.pi32Error);
+        free(sRecord.pi32DiffError);
+    }
+
+    if (bAxesBench){
+        g_f64SimKp = sKp.f64First;
+        g_f64SimKi = sKi.f64First;
+        g_f64SimKd = sKd.f64First;
+        g_pfnSimCompute = g_psSimArith[ui32ArithFirst].pfnCompute;
+        PID_gainsSet((float)g_f64SimKp, (float)g_f64SimKi, (float)g_f64SimKd);
+        SIM_axesBench();
+    }
+
+    if (g_psSimTelem) fclose(g_psSimTelem);
+    return 0;
+}
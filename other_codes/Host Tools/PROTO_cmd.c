@@ -0,0 +1,207 @@
+/*!
+ * @author      Yash Bansod
+ * @date        17th October 2026
+ *
+ * @brief       Host command tool for the framed UART0 protocol of PID with UART and FPU
+ * @details     The program encodes one command with PROTO_frame.c of the firmware, sends
+ *              it to the LaunchPad over the virtual serial port and decodes the reply.
+ *              With "-" in place of the port the frame is printed in hex instead, which
+ *              is handy to check a frame or to drive another serial program.
+ *              "stream" reads one position (ticks from the power up position) per line from
+ *              stdin and sends them back to back without waiting for the replies, to
+ *              push setpoints at the rate of the serial link.
+ *              "telemetry N" starts the telemetry stream with a record every N QEI1
+ *              ticks (0 stops it); record it with TELEM_decode. PROTO_MAX_PAYLOAD is
+ *              raised so that the telemetry frames are skipped whole while a reply is
+ *              awaited.
+ *
+ * @note        Build and run from this folder:
+ *              gcc -O2 -DPROTO_MAX_PAYLOAD=156 -I"../../TM4C123G LaunchPad PID with UART and FPU"
+ *                  PROTO_cmd.c "../../TM4C123G LaunchPad PID with UART and FPU/PROTO_frame.c"
+ *                  -o PROTO_cmd
+ *              ./PROTO_cmd /dev/ttyACM0 pos 768
+ *              ./PROTO_cmd /dev/ttyACM0 limits 4800 48000 1920000
+ *              ./PROTO_cmd /dev/ttyACM0 gains 0.25 0.002 0.015
+ *              ./PROTO_cmd /dev/ttyACM0 state | gains | tune | tune-result
+ *              ./PROTO_cmd /dev/ttyACM0 telemetry 4
+ *              ./PROTO_cmd /dev/ttyACM0 sched error 6 0.4 0.002 0.02  0.3 0.002 0.015  0.25 0.002 0.01  0.2 0 0.01
+ *              ./PROTO_cmd /dev/ttyACM0 sched | save
+ *              ./PROTO_cmd - pos 768
+ * @file        PROTO_cmd.c
+ */
+/* -----------------------          Include Files       --------------------- */
+#include <stdio.h>                          // Library for Standard I/O
+#include <stdlib.h>                         // Standard Library
+#include <string.h>                         // Library for String functions
+#include <fcntl.h>                          // Library for opening the serial port
+#include <termios.h>                        // Library for the serial port settings
+#include <unistd.h>                         // Library for read and write
+#include <poll.h>                           // Library for the reply timeout
+#include "PROTO_frame.h"
+
+/* -----------------------      Macro Definitions       --------------------- */
+#define CMD_TIMEOUT_MS  500                         // Macro for the time to wait for a reply
+
+/* -----------------------      Function Definition     --------------------- */
+// Function to open the serial port in raw mode at 115200 baud
+static int CMD_open(const char *pcPort){
+    struct termios sTio;
+    int iFd = open(pcPort, O_RDWR | O_NOCTTY);
+
+    if (iFd < 0 || tcgetattr(iFd, &sTio) != 0){
+        perror(pcPort);
+        return -1;
+    }
+    cfmakeraw(&sTio);
+    cfsetispeed(&sTio, B115200);
+    cfsetospeed(&sTio, B115200);
+    sTio.c_cflag |= CLOCAL | CREAD;
+    tcsetattr(iFd, TCSANOW, &sTio);
+    tcflush(iFd, TCIOFLUSH);
+    return iFd;
+}
+
+// Function to wait for the reply of ui8Type, returns 0 and the frame in psParser->sFrame
+static int CMD_reply(int iFd, uint8_t ui8Type, tProtoParser *psParser){
+    struct pollfd sPoll = {iFd, POLLIN, 0};
+    uint8_t ui8Byte;
+
+    PROTO_parserInit(psParser);
+    while (poll(&sPoll, 1, CMD_TIMEOUT_MS) > 0 && read(iFd, &ui8Byte, 1) == 1)
+        if (PROTO_parse(psParser, ui8Byte) && psParser->sFrame.ui8Type == (ui8Type | PROTO_REPLY))
+            return 0;
+    return -1;
+}
+
+// Function to print the data of a reply
+static void CMD_print(const tProtoFrame *psFrame){
+    static const char *ppcStatus[] = {"ok", "bad length", "unknown type", "busy", "failed", "gains limited", "out of range"};
+    static const char *ppcSource[] = {"off", "error", "rpm"};
+    static const char *ppcTune[] = {"idle", "running", "done", "failed"};
+    const uint8_t *pui8Data = psFrame->pui8Payload;
+    uint8_t ui8Status = psFrame->ui8Len ? pui8Data[0] : 0xFF;
+
+    uint32_t ui32Point;
+
+    printf("status=%s\n", (ui8Status < 7) ? ppcStatus[ui8Status] : "?");
+    switch (psFrame->ui8Type & ~PROTO_REPLY){
+    case PROTO_GET_STATE:
+        if (psFrame->ui8Len < 22) break;
+        printf("position=%lld\ndesired=%lld\nduty=%d\nrpm=%u\ndone=%d\ntuning=%d\n",
+               (long long)PROTO_getU64(pui8Data + 1), (long long)PROTO_getU64(pui8Data + 9),
+               (int16_t)PROTO_getU16(pui8Data + 17), PROTO_getU16(pui8Data + 19),
+               !!(pui8Data[21] & PROTO_FLAG_DONE), !!(pui8Data[21] & PROTO_FLAG_TUNING));
+        break;
+    case PROTO_GET_GAINS:
+        if (psFrame->ui8Len < 13) break;
+        printf("kp=%g\nki=%g\nkd=%g\n", PROTO_getF32(pui8Data + 1), PROTO_getF32(pui8Data + 5),
+               PROTO_getF32(pui8Data + 9));
+        break;
+    case PROTO_GET_TUNE:
+        if (psFrame->ui8Len < 10) break;
+        printf("tuner=%s\nku=%g\npu_ms=%.2f\n", (pui8Data[1] < 4) ? ppcTune[pui8Data[1]] : "?",
+               PROTO_getF32(pui8Data + 2), 1000.0 * PROTO_getF32(pui8Data + 6) / 4096);
+        break;
+    case PROTO_GET_SCHED:
+        if (psFrame->ui8Len < 1 + PROTO_SCHED_LEN) break;
+        printf("input=%s\nshift=%u\n", (pui8Data[1] < 3) ? ppcSource[pui8Data[1]] : "?", pui8Data[2]);
+        for (ui32Point = 0; ui32Point < PROTO_SCHED_POINTS; ui32Point++)
+            printf("point%u=%u kp=%g ki=%g kd=%g\n", ui32Point, ui32Point << pui8Data[2],
+                   PROTO_getF32(pui8Data + 3 + 12 * ui32Point), PROTO_getF32(pui8Data + 7 + 12 * ui32Point),
+                   PROTO_getF32(pui8Data + 11 + 12 * ui32Point));
+        break;
+    }
+}
+
+/* -----------------------          Main Program        --------------------- */
+int main(int argc, char *argv[]){
+    uint8_t pui8Payload[PROTO_MAX_PAYLOAD];
+    uint8_t pui8Frame[PROTO_MAX_FRAME];
+    uint8_t ui8Type, ui8Len = 0;
+    tProtoParser sParser;
+    int iFd = -1;
+    uint32_t ui32Index;
+
+    if (argc < 3){
+        fprintf(stderr, "usage: %s <port|-> pos <ticks> | limits <vel> <acc> <jerk> | gains <kp> <ki> <kd> |\n"
+                        "       state | gains | tune | tune-result | telemetry <ticks> | stream |\n"
+                        "       sched <off|error|rpm> <shift> <kp ki kd> x %u | sched | save\n", argv[0], PROTO_SCHED_POINTS);
+        return 1;
+    }
+
+    const char *pcCmd = argv[2];
+    if (strcmp(pcCmd, "pos") == 0 && argc == 4){
+        ui8Type = PROTO_SET_POS;
+        PROTO_putU64(pui8Payload, (uint64_t)strtoll(argv[3], NULL, 0));
+        ui8Len = 8;
+    }
+    else if ((strcmp(pcCmd, "limits") == 0 || strcmp(pcCmd, "gains") == 0) && argc == 6){
+        ui8Type = (pcCmd[0] == 'l') ? PROTO_SET_LIMITS : PROTO_SET_GAINS;
+        for (ui32Index = 0; ui32Index < 3; ui32Index++)
+            PROTO_putF32(pui8Payload + 4 * ui32Index, strtof(argv[3 + ui32Index], NULL));
+        ui8Len = 12;
+    }
+    else if (strcmp(pcCmd, "gains") == 0 && argc == 3) ui8Type = PROTO_GET_GAINS;
+    else if (strcmp(pcCmd, "state") == 0) ui8Type = PROTO_GET_STATE;
+    else if (strcmp(pcCmd, "tune") == 0) ui8Type = PROTO_TUNE;
+    else if (strcmp(pcCmd, "tune-result") == 0) ui8Type = PROTO_GET_TUNE;
+    else if (strcmp(pcCmd, "telemetry") == 0 && argc == 4){
+        ui8Type = PROTO_TELEMETRY;
+        PROTO_putU16(pui8Payload, (uint16_t)strtoul(argv[3], NULL, 0));
+        ui8Len = 2;
+    }
+    else if (strcmp(pcCmd, "sched") == 0 && argc == 5 + 3 * PROTO_SCHED_POINTS){
+        ui8Type = PROTO_SET_SCHED;
+        pui8Payload[0] = (argv[3][0] == 'e') ? 1 : ((argv[3][0] == 'r') ? 2 : 0);
+        pui8Payload[1] = (uint8_t)strtoul(argv[4], NULL, 0);
+        for (ui32Index = 0; ui32Index < 3 * PROTO_SCHED_POINTS; ui32Index++)
+            PROTO_putF32(pui8Payload + 2 + 4 * ui32Index, strtof(argv[5 + ui32Index], NULL));
+        ui8Len = PROTO_SCHED_LEN;
+    }
+    else if (strcmp(pcCmd, "sched") == 0 && argc == 3) ui8Type = PROTO_GET_SCHED;
+    else if (strcmp(pcCmd, "save") == 0) ui8Type = PROTO_SAVE_PARAMS;
+    else if (strcmp(pcCmd, "stream") == 0) ui8Type = PROTO_SET_POS;
+    else {
+        fprintf(stderr, "unknown command %s\n", pcCmd);
+        return 1;
+    }
+
+    if (strcmp(argv[1], "-") != 0 && (iFd = CMD_open(argv[1])) < 0)
+        return 1;
+
+    if (strcmp(pcCmd, "stream") == 0){
+        // Send every position of stdin, the replies are left unread
+        char pcLine[64];
+        uint32_t ui32Sent = 0;
+        while (fgets(pcLine, sizeof(pcLine), stdin)){
+            PROTO_putU64(pui8Payload, (uint64_t)strtoll(pcLine, NULL, 0));
+            uint32_t ui32Len = PROTO_encode(PROTO_SET_POS, pui8Payload, 8, pui8Frame);
+            if (iFd < 0){
+                for (ui32Index = 0; ui32Index < ui32Len; ui32Index++) printf("%02X ", pui8Frame[ui32Index]);
+                printf("\n");
+            }
+            else if (write(iFd, pui8Frame, ui32Len) != (ssize_t)ui32Len){
+                perror("write");
+                return 1;
+            }
+            ui32Sent++;
+        }
+        fprintf(stderr, "%u frames sent\n", ui32Sent);
+        return 0;
+    }
+
+    uint32_t ui32Len = PROTO_encode(ui8Type, pui8Payload, ui8Len, pui8Frame);
+    if (iFd < 0){
+        for (ui32Index = 0; ui32Index < ui32Len; ui32Index++) printf("%02X ", pui8Frame[ui32Index]);
+        printf("\n");
+        return 0;
+    }
+
+    if (write(iFd, pui8Frame, ui32Len) != (ssize_t)ui32Len || CMD_reply(iFd, ui8Type, &sParser) != 0){
+        fprintf(stderr, "no reply\n");
+        return 1;
+    }
+    CMD_print(&sParser.sFrame);
+    close(iFd);
+    return 0;
+}
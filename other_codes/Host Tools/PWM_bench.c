@@ -0,0 +1,213 @@
+/*!
+ * @author      Yash Bansod
+ * @date        17th October 2026
+ *
+ * @brief       Host equivalence test and benchmark of the PWM duty cycle to compare tables
+ * @details     The program checks PWM_lut.c of the firmware exhaustively against the
+ *              pulse width formulas it replaces and times both ways of an update.
+ *              Equivalence: for every period a 16 bit generator can count (2 to 65536
+ *              PWM clocks, as given to PWMGenPeriodSet) the % and per mille tables are
+ *              built and every entry is compared with the compare register written by
+ *              the register stand-in HOST_regs.c for PWMPulseWidthSet(duty * period
+ *              / 100) and PWMPulseWidthSet(duty * period / 1000), the formulas of the
+ *              PID and Servo projects. The servo microsecond table is compared, for
+ *              every PWM divider and every frequency from 20 to 400 Hz the counter
+ *              can hold, with floor(max(us, PWM_LUT_US_MIN) * PWM clock / 10^6)
+ *              computed in double precision. Duties past the end of a table must give
+ *              its last entry.
+ *              Benchmark: random per mille duties at 50 Hz through the formula alone
+ *              and the table alone, then through the former update (formula and
+ *              PWMPulseWidthSet) and the table update (table load and HWREG write),
+ *              both into the stand-in, in ns per update. The compilers turn the
+ *              division by the constant 100 or 1000 into a multiply-high on the host
+ *              and on the Cortex-M4 alike, so the formula and the table cost about the
+ *              same; what the table update saves on the target is the DriverLib call,
+ *              which reads CTL and LOAD before its write. The stand-in behind HWREG is
+ *              a function as well, so the last two lines do not show that saving.
+ *
+ * @note        Build and run from this folder:
+ *              gcc -O2 -Wall -Wextra -DHOST_SIM -I. -I"../TM4C123G LaunchPad Humper Robot Rev2"
+ *                  PWM_bench.c HOST_regs.c "../TM4C123G LaunchPad Humper Robot Rev2/PWM_lut.c" -o PWM_bench
+ *              ./PWM_bench
+ *              ./PWM_bench -s -n 10000000
+ * @file        PWM_bench.c
+ */
+/* -----------------------          Include Files       --------------------- */
+#include <stdio.h>                          // Library for Standard I/O
+#include <stdlib.h>                         // Standard Library
+#include <time.h>                           // Library for clock_gettime
+#include <unistd.h>                         // Library for getopt
+#include "HOST_regs.h"
+#include "PWM_lut.h"
+
+/* -----------------------      Macro Definitions       --------------------- */
+#define BENCH_PERIOD_MAX    65536                   // Macro for the longest period of a 16 bit generator
+#define BENCH_UPDATES       (1u << 22)              // Macro for the default updates timed per way
+#define BENCH_REPEATS       5                       // Macro for the runs per way, the fastest is kept
+#define BENCH_SERVO_HZ      50                      // Macro for the frequency of the benchmark and servo tables
+
+/* -----------------------      Global Variables        --------------------- */
+static uint16_t g_pui16Cmp[PWM_LUT_ENTRIES(PWM_LUT_SERVO_US)];   // Table under test, large enough for any unit
+static volatile uint32_t g_ui32Sink;                // Keeps the timed loops from being optimised away
+
+/* -----------------------      Function Definition     --------------------- */
+// Function to get a monotonic time in ns
+static double BENCH_now(void){
+    struct timespec sTime;
+    clock_gettime(CLOCK_MONOTONIC, &sTime);
+    return sTime.tv_sec * 1e9 + sTime.tv_nsec;
+}
+
+// Function to compare the % or per mille tables of every period with the stand-in, returns the mismatches
+static uint32_t BENCH_equivDuty(uint8_t ui8Unit){
+    uint32_t ui32Divisor = (ui8Unit == PWM_LUT_PERCENT) ? 100 : 1000;
+    uint32_t ui32Period, ui32Duty, ui32Bad = 0, ui32Entries = 0;
+    tHostPwmGen *psGen = &g_sRegs.psPwm[0].psGen[0];
+    tPwmLut sLut;
+
+    HOST_regsReset();
+    ROM_PWMGenConfigure(PWM0_BASE, PWM_GEN_0, PWM_GEN_MODE_DOWN);
+
+    for (ui32Period = 2; ui32Period <= BENCH_PERIOD_MAX; ui32Period++){
+        PWM_lutInit(&sLut, ui8Unit, ui32Period, HOST_SYSCLK_HZ, g_pui16Cmp);
+        ROM_PWMGenPeriodSet(PWM0_BASE, PWM_GEN_0, ui32Period);
+
+        for (ui32Duty = 0; ui32Duty <= sLut.ui16Last; ui32Duty++){
+            ROM_PWMPulseWidthSet(PWM0_BASE, PWM_OUT_0, ui32Duty * ui32Period / ui32Divisor);
+            if (PWM_LUT_CMP(&sLut, ui32Duty) != (psGen->pui32CmpNext[0] & 0xFFFF)){
+                if (ui32Bad++ < 5)
+                    printf("     period %u duty %u: table %u, PWMPulseWidthSet %u\n", ui32Period, ui32Duty,
+                           PWM_LUT_CMP(&sLut, ui32Duty), psGen->pui32CmpNext[0] & 0xFFFF);
+            }
+            ui32Entries++;
+        }
+        // Past the end of the table the last entry is used
+        if (PWM_LUT_CMP(&sLut, sLut.ui16Last + 1) != g_pui16Cmp[sLut.ui16Last] ||
+            PWM_LUT_CMP(&sLut, 0xFFFFFFFFu) != g_pui16Cmp[sLut.ui16Last])
+            ui32Bad++;
+    }
+    printf("%-4s %s table: %u periods, %u entries, %u mismatches\n", ui32Bad ? "FAIL" : "ok",
+           (ui8Unit == PWM_LUT_PERCENT) ? "%" : "per mille", BENCH_PERIOD_MAX - 1, ui32Entries, ui32Bad);
+    return ui32Bad;
+}
+
+// Function to compare the servo microsecond tables with a double precision reference, returns the mismatches
+static uint32_t BENCH_equivServo(void){
+    uint32_t ui32Shift, ui32Hz, ui32Us, ui32Bad = 0, ui32Tables = 0;
+    tPwmLut sLut;
+
+    for (ui32Shift = 0; ui32Shift <= 6; ui32Shift++){
+        uint32_t ui32Clock = HOST_SYSCLK_HZ >> ui32Shift;
+
+        for (ui32Hz = 20; ui32Hz <= 400; ui32Hz++){
+            uint32_t ui32Period = ui32Clock / ui32Hz - 1;
+
+            if (ui32Period > BENCH_PERIOD_MAX)
+                continue;
+            PWM_lutInit(&sLut, PWM_LUT_SERVO_US, ui32Period, ui32Clock, g_pui16Cmp);
+            ui32Tables++;
+
+            for (ui32Us = 0; ui32Us <= PWM_LUT_US_MAX; ui32Us++){
+                double f64Us = (ui32Us < PWM_LUT_US_MIN) ? PWM_LUT_US_MIN : ui32Us;
+                uint32_t ui32Width = (uint32_t)(f64Us * ui32Clock / 1e6);
+                if (g_pui16Cmp[ui32Us] != (uint16_t)(ui32Period - 1 - ui32Width))
+                    ui32Bad++;
+            }
+        }
+    }
+    printf("%-4s servo us table: %u tables (dividers 1 to 64, 20 to 400 Hz), %u mismatches\n",
+           ui32Bad ? "FAIL" : "ok", ui32Tables, ui32Bad);
+    return ui32Bad;
+}
+
+// Function to time the four ways of an update, in ns per update
+static void BENCH_speed(uint32_t ui32Updates){
+    volatile uint32_t ui32PeriodVol = (HOST_SYSCLK_HZ >> 6) / BENCH_SERVO_HZ - 1;
+    uint32_t ui32Period = ui32PeriodVol;
+    uint32_t ui32Reg = PWM_LUT_CMP_REG(PWM0_BASE, PWM_OUT_0);
+    double pf64Best[4] = {1e30, 1e30, 1e30, 1e30};
+    uint16_t *pui16Duty = malloc(ui32Updates * sizeof(uint16_t));
+    uint32_t ui32Run, ui32Index, ui32Way;
+    double f64Start, f64Init;
+    tPwmLut sLut;
+
+    if (!pui16Duty){
+        printf("out of memory\n");
+        return;
+    }
+    srand(1);
+    for (ui32Index = 0; ui32Index < ui32Updates; ui32Index++)
+        pui16Duty[ui32Index] = (uint16_t)(rand() % 1001);
+
+    HOST_regsReset();
+    ROM_PWMGenConfigure(PWM0_BASE, PWM_GEN_0, PWM_GEN_MODE_DOWN);
+    ROM_PWMGenPeriodSet(PWM0_BASE, PWM_GEN_0, ui32Period);
+    f64Start = BENCH_now();
+    PWM_lutInit(&sLut, PWM_LUT_PERMILLE, ui32Period, HOST_SYSCLK_HZ >> 6, g_pui16Cmp);
+    f64Init = BENCH_now() - f64Start;
+
+    for (ui32Run = 0; ui32Run < BENCH_REPEATS; ui32Run++){
+        for (ui32Way = 0; ui32Way < 4; ui32Way++){
+            uint32_t ui32Sum = 0;
+
+            f64Start = BENCH_now();
+            switch (ui32Way){
+            case 0:
+                for (ui32Index = 0; ui32Index < ui32Updates; ui32Index++)
+                    ui32Sum += ui32Period - 1 - pui16Duty[ui32Index] * ui32Period / 1000;
+                break;
+            case 1:
+                for (ui32Index = 0; ui32Index < ui32Updates; ui32Index++)
+                    ui32Sum += PWM_LUT_CMP(&sLut, pui16Duty[ui32Index]);
+                break;
+            case 2:
+                for (ui32Index = 0; ui32Index < ui32Updates; ui32Index++)
+                    ROM_PWMPulseWidthSet(PWM0_BASE, PWM_OUT_0, pui16Duty[ui32Index] * ui32Period / 1000);
+                break;
+            default:
+                for (ui32Index = 0; ui32Index < ui32Updates; ui32Index++)
+                    HWREG(ui32Reg) = PWM_LUT_CMP(&sLut, pui16Duty[ui32Index]);
+                break;
+            }
+            g_ui32Sink = ui32Sum;
+            double f64Ns = (BENCH_now() - f64Start) / ui32Updates;
+            if (f64Ns < pf64Best[ui32Way]) pf64Best[ui32Way] = f64Ns;
+        }
+    }
+    free(pui16Duty);
+
+    printf("way,ns_per_update\n");
+    printf("formula,%.2f\n", pf64Best[0]);
+    printf("table,%.2f\n", pf64Best[1]);
+    printf("formula+PWMPulseWidthSet,%.2f\n", pf64Best[2]);
+    printf("table+HWREG,%.2f\n", pf64Best[3]);
+    printf("per mille table of %u entries (%u bytes) built in %.1f us\n", sLut.ui16Last + 1,
+           (uint32_t)((sLut.ui16Last + 1) * sizeof(uint16_t)), f64Init / 1e3);
+}
+
+/* -----------------------          Main Program        --------------------- */
+int main(int argc, char *argv[]){
+    uint32_t ui32Updates = BENCH_UPDATES, ui32Bad = 0;
+    bool bSkipEquiv = false;
+    int iOpt;
+
+    while ((iOpt = getopt(argc, argv, "sn:")) != -1){
+        switch (iOpt){
+        case 's': bSkipEquiv = true; break;
+        case 'n': ui32Updates = (uint32_t)strtoul(optarg, NULL, 0); break;
+        default:
+            printf("usage: %s [-s (skip the equivalence test)] [-n updates]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (ui32Updates == 0) ui32Updates = 1;
+
+    if (!bSkipEquiv){
+        ui32Bad += BENCH_equivDuty(PWM_LUT_PERCENT);
+        ui32Bad += BENCH_equivDuty(PWM_LUT_PERMILLE);
+        ui32Bad += BENCH_equivServo();
+    }
+    BENCH_speed(ui32Updates);
+
+    return ui32Bad ? 1 : 0;
+}
@@ -0,0 +1,270 @@
+/*!
+ * @author      Yash Bansod
+ * @date        17th October 2026
+ *
+ * @brief       Host check of the table-driven servo PWM driver of Humper Robot Rev2
+ * @details     The program compiles PWM_config.c of the firmware against the register
+ *              stand-in HOST_regs.c and checks, from the registers only, that
+ *              - every channel of psPwmChannel has its own pin and output, the
+ *                channels of a generator share its frequency and the distinct
+ *                frequencies fit the PWM_LUTS compare tables;
+ *              - PWM_init() and PWM_enable() clock the modules and ports, divide the
+ *                PWM clock by 64, route each pin to the output of its descriptor and
+ *                set its generator to count down with synchronous updates, at the
+ *                frequency of the descriptor;
+ *              - for every duty from 0 to 999 in 1/1000 (PWM_RESOLUTION per mille),
+ *                PWM_updateAll() writes the compare register of the output (CMPA
+ *                for even outputs, CMPB for odd) that gives the pulse width of the
+ *                former PWMx_y_update() functions,
+ *                duty * ((SysClk / 64) / PWM_FREQUENCY - 1) / 1000, and leaves the
+ *                other compare register of the generator alone;
+ *              - new duties are not in use before the next zero count, the channels
+ *                of a module take them in use on the same PWM clock, and the high time
+ *                measured on each output in the following period is the pulse width;
+ *              - a pulse width written without the global sync is never taken in use.
+ *              Each check prints ok or FAIL, the exit code is the number of failures.
+ *
+ * @note        Build and run from this folder:
+ *              gcc -O2 -Wall -Wextra -DHOST_SIM -I. -I"../TM4C123G LaunchPad Humper Robot Rev2"
+ *                  PWM_check.c HOST_regs.c "../TM4C123G LaunchPad Humper Robot Rev2/PWM_lut.c" -o PWM_check
+ *              ./PWM_check
+ * @file        PWM_check.c
+ */
+/* -----------------------          Include Files       --------------------- */
+#include <stdio.h>                          // Library for Standard I/O
+#include "HOST_regs.h"
+
+// The firmware source is included for its static descriptor table and periods
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#include "PWM_config.c"
+
+/* -----------------------      Macro Definitions       --------------------- */
+#define CHECK_DUTY_MAX      1000                    // Macro for the duty of a full period, in 1/1000
+
+/* -----------------------      Global Variables        --------------------- */
+static uint32_t g_ui32Fails = 0;                    // Checks that failed
+
+/* -----------------------      Function Definition     --------------------- */
+// Function to print the result of a check
+static void CHECK_report(bool bOk, const char *pcName){
+    printf("%-4s %s\n", bOk ? "ok" : "FAIL", pcName);
+    if (!bOk) g_ui32Fails++;
+}
+
+// Function to get the register model of the generator of a channel
+static tHostPwmGen *CHECK_gen(const tPwmChannel *psChannel){
+    return &g_sRegs.psPwm[HOST_pwmIndex(psChannel->ui32PwmBase)].psGen[(psChannel->ui32Gen >> 6) - 1];
+}
+
+// Function to get the output number (0 to 7) of a channel
+static uint8_t CHECK_out(const tPwmChannel *psChannel){
+    return (uint8_t)(((psChannel->ui32Out >> 6) - 1) * 2 + (psChannel->ui32Out & 1));
+}
+
+// Function to get the pin number of a channel
+static uint8_t CHECK_pin(const tPwmChannel *psChannel){
+    uint8_t ui8Pin = 0;
+    while (ui8Pin < 7 && !(psChannel->ui8GpioPin & (1u << ui8Pin))) ui8Pin++;
+    return ui8Pin;
+}
+
+// Function to get the pulse width of the former PWMx_y_update() functions
+static uint32_t CHECK_width(int16_t i16Duty){
+    uint32_t ui32Period = ((HOST_SYSCLK_HZ >> 6) / PWM_FREQUENCY) - 1;
+    return i16Duty * ui32Period / 1000;
+}
+
+// Function to check the descriptor table alone
+static void CHECK_table(void){
+    bool bPins = true, bOuts = true, bFreq = true;
+    uint8_t ui8I, ui8J;
+
+    for (ui8I = 0; ui8I < PWM_CHANNELS; ui8I++){
+        for (ui8J = ui8I + 1; ui8J < PWM_CHANNELS; ui8J++){
+            const tPwmChannel *psA = &psPwmChannel[ui8I], *psB = &psPwmChannel[ui8J];
+            if (psA->ui32GpioBase == psB->ui32GpioBase && psA->ui8GpioPin == psB->ui8GpioPin) bPins = false;
+            if (psA->ui32PwmBase == psB->ui32PwmBase && psA->ui32Out == psB->ui32Out) bOuts = false;
+            if (psA->ui32PwmBase == psB->ui32PwmBase && psA->ui32Gen == psB->ui32Gen &&
+                psA->ui16Frequency != psB->ui16Frequency) bFreq = false;
+        }
+        // PWM_OUT_n belongs to PWM_GEN_n/2 and PWM_OUT_n_BIT and PWM_GEN_n_BIT agree with them
+        if ((psPwmChannel[ui8I].ui32Out & ~1u) != psPwmChannel[ui8I].ui32Gen ||
+            psPwmChannel[ui8I].ui32OutBit != (1u << CHECK_out(&psPwmChannel[ui8I])) ||
+            psPwmChannel[ui8I].ui32GenBit != (1u << ((psPwmChannel[ui8I].ui32Gen >> 6) - 1)))
+            bOuts = false;
+    }
+    CHECK_report(bPins, "table: one channel per pin");
+    CHECK_report(bOuts, "table: one channel per output, outputs on their generators");
+    CHECK_report(bFreq, "table: channels of a generator share its frequency");
+
+    // The channels with a frequency not seen before each need a compare table
+    uint8_t ui8Distinct = 0;
+    for (ui8I = 0; ui8I < PWM_CHANNELS; ui8I++){
+        for (ui8J = 0; ui8J < ui8I && psPwmChannel[ui8J].ui16Frequency != psPwmChannel[ui8I].ui16Frequency; ui8J++);
+        if (ui8J == ui8I) ui8Distinct++;
+    }
+    CHECK_report(ui8Distinct <= PWM_LUTS, "table: distinct frequencies fit the PWM_LUTS compare tables");
+}
+
+// Function to check the registers written by PWM_init() and PWM_enable()
+static void CHECK_init(const int16_t *pi16Duty){
+    bool bClocks = true, bMux = true, bMode = true, bFreq = true, bEnabled = true;
+    uint8_t ui8Index;
+
+    for (ui8Index = 0; ui8Index < PWM_CHANNELS; ui8Index++){
+        const tPwmChannel *psChannel = &psPwmChannel[ui8Index];
+        int32_t i32Module = HOST_pwmIndex(psChannel->ui32PwmBase);
+        tHostPwmGen *psGen = CHECK_gen(psChannel);
+        double f64Freq = (double)HOST_pwmClockHz() / (psGen->ui32LoadNext + 1);
+
+        if (!(g_sRegs.ui32RcgcPwm & (1u << i32Module)) ||
+            !(g_sRegs.ui32RcgcGpio & (1u << HOST_portIndex(psChannel->ui32GpioBase))))
+            bClocks = false;
+        if (HOST_pinSignal(psChannel->ui32GpioBase, CHECK_pin(psChannel)) !=
+            HOST_PWM_SIGNAL(i32Module, CHECK_out(psChannel)))
+            bMux = false;
+        if ((psGen->ui32Ctl & ~HOST_PWM_X_CTL_ENABLE) != (PWM_GEN_MODE_DOWN | PWM_GEN_MODE_SYNC))
+            bMode = false;
+        if (f64Freq < 0.999 * psChannel->ui16Frequency || f64Freq > 1.001 * psChannel->ui16Frequency)
+            bFreq = false;
+        if (!(psGen->ui32Ctl & HOST_PWM_X_CTL_ENABLE) || !(g_sRegs.psPwm[i32Module].ui32Enable & psChannel->ui32OutBit))
+            bEnabled = false;
+        if (psGen->pui32CmpNext[psChannel->ui32Out & 1] != psGen->ui32LoadNext - CHECK_width(pi16Duty[ui8Index]))
+            bMode = false;
+    }
+    CHECK_report(bClocks, "init: PWM modules and GPIO ports clocked");
+    CHECK_report(HOST_pwmClockHz() == HOST_SYSCLK_HZ / 64, "init: PWM clock is SysClk / 64");
+    CHECK_report(bMux, "init: each pin carries the output of its descriptor");
+    CHECK_report(bMode, "init: generators count down with synchronous updates, initial duties written");
+    CHECK_report(bFreq, "init: generator frequencies match the descriptors");
+    CHECK_report(bEnabled, "init: generators and outputs enabled");
+    CHECK_report(g_sRegs.psPwm[0].ui32Syncs && g_sRegs.psPwm[1].ui32Syncs, "init: time bases of the modules synchronised");
+    CHECK_report(g_sRegs.ui32Asserts == 0, "init: no DriverLib ASSERT failed");
+}
+
+// Function to check every duty against the pulse width formula of the former driver
+static void CHECK_duties(void){
+    bool bCmp = true, bOther = true;
+    int16_t pi16Duty[PWM_CHANNELS];
+    int16_t i16Duty;
+    uint8_t ui8Index;
+
+    for (i16Duty = 0; i16Duty < CHECK_DUTY_MAX; i16Duty++){
+        uint32_t pui32Other[PWM_CHANNELS];
+
+        for (ui8Index = 0; ui8Index < PWM_CHANNELS; ui8Index++){
+            pi16Duty[ui8Index] = i16Duty;
+            pui32Other[ui8Index] = CHECK_gen(&psPwmChannel[ui8Index])->pui32CmpNext[~psPwmChannel[ui8Index].ui32Out & 1];
+        }
+        PWM_updateAll(pi16Duty);
+
+        for (ui8Index = 0; ui8Index < PWM_CHANNELS; ui8Index++){
+            const tPwmChannel *psChannel = &psPwmChannel[ui8Index];
+            tHostPwmGen *psGen = CHECK_gen(psChannel);
+            bool bShared = false;
+            uint8_t ui8Other;
+
+            if (psGen->pui32CmpNext[psChannel->ui32Out & 1] != psGen->ui32LoadNext - CHECK_width(i16Duty))
+                bCmp = false;
+            // The other compare register only changes when another channel uses it
+            for (ui8Other = 0; ui8Other < PWM_CHANNELS; ui8Other++)
+                if (psPwmChannel[ui8Other].ui32PwmBase == psChannel->ui32PwmBase &&
+                    psPwmChannel[ui8Other].ui32Out == (psChannel->ui32Out ^ 1))
+                    bShared = true;
+            if (!bShared && psGen->pui32CmpNext[~psChannel->ui32Out & 1] != pui32Other[ui8Index])
+                bOther = false;
+        }
+    }
+    CHECK_report(bCmp, "update: duties 0-999 give the pulse widths of the former driver");
+    CHECK_report(bOther, "update: the other compare register of a generator is untouched");
+    CHECK_report(g_sRegs.ui32Asserts == 0, "update: no DriverLib ASSERT failed");
+}
+
+// Function to check that a batch of duties is taken in use on one period boundary per module
+static void CHECK_sync(const int16_t *pi16Old, const int16_t *pi16New){
+    bool bHeld = true, bTogether = true, bBoundary = true, bWidth = true;
+    uint32_t pui32Updates[PWM_CHANNELS];
+    uint64_t pui64Updated[HOST_PWM_MODULES] = {0, 0};
+    uint8_t ui8Index;
+
+    // Settle the initial duties and run into the middle of a period
+    HOST_pwmRun(3 * (CHECK_gen(&psPwmChannel[0])->ui32Load + 1) / 2);
+
+    for (ui8Index = 0; ui8Index < PWM_CHANNELS; ui8Index++)
+        pui32Updates[ui8Index] = CHECK_gen(&psPwmChannel[ui8Index])->ui32Updates;
+    PWM_updateAll(pi16New);
+
+    // Up to the end of the period the old duties stay in use
+    for (ui8Index = 0; ui8Index < PWM_CHANNELS; ui8Index++){
+        const tPwmChannel *psChannel = &psPwmChannel[ui8Index];
+        tHostPwmGen *psGen = CHECK_gen(psChannel);
+        if (psGen->pui32Cmp[psChannel->ui32Out & 1] != psGen->ui32Load - CHECK_width(pi16Old[ui8Index]))
+            bHeld = false;
+    }
+    HOST_pwmRun(CHECK_gen(&psPwmChannel[0])->ui32Count);
+    for (ui8Index = 0; ui8Index < PWM_CHANNELS; ui8Index++)
+        if (CHECK_gen(&psPwmChannel[ui8Index])->ui32Updates != pui32Updates[ui8Index])
+            bHeld = false;
+
+    // Two more periods: one to take the new duties in use, one to measure them
+    HOST_pwmRun(2 * (CHECK_gen(&psPwmChannel[0])->ui32Load + 1) + 1);
+    for (ui8Index = 0; ui8Index < PWM_CHANNELS; ui8Index++){
+        const tPwmChannel *psChannel = &psPwmChannel[ui8Index];
+        tHostPwmGen *psGen = CHECK_gen(psChannel);
+        int32_t i32Module = HOST_pwmIndex(psChannel->ui32PwmBase);
+
+        if (psGen->ui32Updates != pui32Updates[ui8Index] + 1)
+            bBoundary = false;
+        if (pui64Updated[i32Module] == 0)
+            pui64Updated[i32Module] = psGen->ui64Updated;
+        else if (pui64Updated[i32Module] != psGen->ui64Updated)
+            bTogether = false;
+        if (psGen->pui32High[psChannel->ui32Out & 1] != CHECK_width(pi16New[ui8Index]))
+            bWidth = false;
+    }
+    printf("     PWM0 updated on clock %llu, PWM1 on clock %llu\n",
+           (unsigned long long)pui64Updated[0], (unsigned long long)pui64Updated[1]);
+    CHECK_report(bHeld, "sync: old duties in use until the end of the period");
+    CHECK_report(bBoundary, "sync: new duties taken in use once, at the next zero count");
+    CHECK_report(bTogether, "sync: the channels of a module update on the same clock");
+    CHECK_report(bWidth, "sync: measured high times equal the pulse widths");
+}
+
+// Function to check that a compare register written without the global sync is held
+static void CHECK_nosync(void){
+    const tPwmChannel *psChannel = &psPwmChannel[0];
+    tHostPwmGen *psGen = CHECK_gen(psChannel);
+    uint32_t ui32Cmp = psGen->pui32Cmp[psChannel->ui32Out & 1];
+
+    ROM_PWMPulseWidthSet(psChannel->ui32PwmBase, psChannel->ui32Out, CHECK_width(CHECK_DUTY_MAX / 2));
+    HOST_pwmRun(4 * (psGen->ui32Load + 1));
+    CHECK_report(psGen->pui32Cmp[psChannel->ui32Out & 1] == ui32Cmp, "sync: a write without the global sync is held");
+}
+
+/* -----------------------          Main Program        --------------------- */
+int main(void){
+    int16_t pi16Old[PWM_CHANNELS], pi16New[PWM_CHANNELS];
+    uint8_t ui8Index;
+
+    for (ui8Index = 0; ui8Index < PWM_CHANNELS; ui8Index++){
+        pi16Old[ui8Index] = i16ServoDuty[ui8Index][1];
+        pi16New[ui8Index] = i16ServoDuty[ui8Index][0];
+    }
+
+    CHECK_table();
+
+    HOST_regsReset();
+    PWM_init(pi16Old);
+    PWM_enable();
+    CHECK_init(pi16Old);
+    CHECK_sync(pi16Old, pi16New);
+    CHECK_nosync();
+
+    HOST_regsReset();
+    PWM_init(pi16Old);
+    PWM_enable();
+    CHECK_duties();
+
+    printf("%u check(s) failed, %u DriverLib calls\n", g_ui32Fails, g_sRegs.ui32Calls);
+    return (int)g_ui32Fails;
+}
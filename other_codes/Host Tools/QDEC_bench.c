@@ -0,0 +1,360 @@
+/*!
+ * @author      Yash Bansod
+ * @date        17th October 2026
+ *
+ * @brief       Host benchmark of the GPIO quadrature decoder of Humper Robot Rev2
+ * @details     The program replays A/B edge streams through QDEC_decode.c of the firmware
+ *              and a cycle model of the port interrupt, and finds the highest edge rate
+ *              per encoder at which no count is lost.
+ *              The stream is either generated (every channel turning at the same mean
+ *              edge rate, each edge interval spread by the phase error of the encoder,
+ *              with reversals that dither around an edge) or read from a recording with
+ *              -p. A recording is a text file of "<time in ns> <port pins>" lines, the
+ *              first giving the pins at the start, and lines starting with '#' are
+ *              skipped; -r writes the generated stream in this form.
+ *              The stream is played at rates from 1 kHz to 20 MHz per channel, its times
+ *              scaled for each rate. A pin edge latches the port interrupt, which starts
+ *              after the entry latency (or the tail chain after the previous handler),
+ *              clears the latch, reads the pins and decodes them, at the cycle offsets of
+ *              the options. The edges between the clear and the read are decoded by this
+ *              read and run the handler once more for nothing. Each rate prints the
+ *              handlers run, the CPU load, the illegal transitions counted and the counts
+ *              lost against a reference that decodes every edge of the stream alone.
+ *              The default cycle counts are estimates for the PortC/PortE handlers of
+ *              main.c at 80 MHz with the APB GPIO aperture; measure them with the DWT
+ *              cycle counter and pass them with -e, -c, -d and -b/-k.
+ *
+ * @note        Build and run from this folder:
+ *              gcc -O2 -Wall -Wextra -I"../TM4C123G LaunchPad Humper Robot Rev2" QDEC_bench.c
+ *                  "../TM4C123G LaunchPad Humper Robot Rev2/QDEC_decode.c" -o QDEC_bench
+ *              ./QDEC_bench -n 4 -j 120
+ *              ./QDEC_bench -p legs.txt
+ * @file        QDEC_bench.c
+ */
+/* -----------------------          Include Files       --------------------- */
+#include <stdio.h>                          // Library for Standard I/O
+#include <stdlib.h>                         // Standard Library
+#include <string.h>                         // Library for String functions
+#include <unistd.h>                         // Library for getopt
+#include "QDEC_decode.h"
+
+/* -----------------------      Macro Definitions       --------------------- */
+#define BENCH_CPU_HZ        80e6                    // Macro for the system clock of the target
+#define BENCH_EDGES         100000                  // Macro for the default edges per channel
+#define BENCH_RATE_MIN      1e3                     // Macro for the lowest edge rate per channel
+#define BENCH_RATE_MAX      20e6                    // Macro for the highest edge rate per channel
+#define BENCH_RATE_STEP     1.122                   // Macro for the ratio of consecutive rates (1 dB)
+#define BENCH_EXIT          10                      // Macro for the cycles of an exception return
+
+/* -----------------------      Global Variables        --------------------- */
+typedef struct {
+    double f64Time;                                 // Time of the edge, in edge periods or ns
+    uint8_t ui8Pins;                                // Port pins after the edge
+} tEdge;
+
+typedef struct {
+    uint32_t ui32Entry;                             // Cycles from the latch to the first instruction
+    uint32_t ui32Chain;                             // Cycles to tail chain into the next handler
+    uint32_t ui32Clear;                             // Cycles into the handler when the latch is cleared
+    uint32_t ui32Read;                              // Cycles into the handler when the pins are read
+    uint32_t ui32Base;                              // Cycles of the handler without a changed channel
+    uint32_t ui32PerChannel;                        // Cycles per channel looked up
+    uint32_t ui32Jitter;                            // Largest extra latency from other interrupts
+} tIsrModel;
+
+typedef struct {
+    uint32_t ui32Isrs;                              // Handlers run
+    double f64Load;                                 // Share of the CPU in the handlers
+    uint32_t ui32Illegal;                           // Illegal transitions counted
+    uint32_t ui32Lost;                              // Counts lost against the reference
+} tBenchResult;
+
+static tEdge *g_psEdges;                            // Edge stream, sorted by time
+static size_t g_sizeEdges;                          // Edges in the stream
+static uint8_t g_ui8Start;                          // Port pins at the start of the stream
+static uint8_t g_ui8Channels = 2;                   // Channels of the port, from pin 0
+static uint64_t g_ui64Rand = 0x9E3779B97F4A7C15ull; // State of the random generator
+
+/* -----------------------      Function Definition     --------------------- */
+// Function to return the 2 bit Gray state (PhB << 1 | PhA) of a position
+static uint8_t BENCH_gray(int32_t i32Pos){
+    uint8_t ui8Pos = (uint8_t)(i32Pos & 3);
+    return (uint8_t)(ui8Pos ^ (ui8Pos >> 1));
+}
+
+// Function to return a random number in [0, 1)
+static double BENCH_rand(void){
+    g_ui64Rand ^= g_ui64Rand << 13;
+    g_ui64Rand ^= g_ui64Rand >> 7;
+    g_ui64Rand ^= g_ui64Rand << 17;
+    return (double)(g_ui64Rand >> 11) / 9007199254740992.0;
+}
+
+// Function to generate ui32Edges edges per channel at one edge per unit of time
+static void BENCH_generate(uint32_t ui32Edges, double f64Spread, double f64Reverse){
+    double pf64Next[QDEC_PORT_CHANNELS];
+    int32_t pi32Pos[QDEC_PORT_CHANNELS], pi32Dir[QDEC_PORT_CHANNELS];
+    uint32_t pui32Left[QDEC_PORT_CHANNELS];
+    uint8_t ui8Pins = 0, ui8Ch;
+
+    g_sizeEdges = 0;
+    g_psEdges = malloc(sizeof(tEdge) * ui32Edges * g_ui8Channels);
+    for (ui8Ch = 0; ui8Ch < g_ui8Channels; ui8Ch++){
+        pf64Next[ui8Ch] = BENCH_rand();
+        pi32Pos[ui8Ch] = (int32_t)(BENCH_rand() * 4);
+        pi32Dir[ui8Ch] = (ui8Ch & 1) ? -1 : 1;
+        pui32Left[ui8Ch] = ui32Edges;
+        ui8Pins |= (uint8_t)(BENCH_gray(pi32Pos[ui8Ch]) << (2 * ui8Ch));
+    }
+    g_ui8Start = ui8Pins;
+
+    for (;;){
+        // The channel with the earliest edge moves one state
+        int iNext = -1;
+        for (ui8Ch = 0; ui8Ch < g_ui8Channels; ui8Ch++)
+            if (pui32Left[ui8Ch] && (iNext < 0 || pf64Next[ui8Ch] < pf64Next[iNext])) iNext = ui8Ch;
+        if (iNext < 0) break;
+
+        pi32Pos[iNext] += pi32Dir[iNext];
+        ui8Pins = (uint8_t)((ui8Pins & ~(3u << (2 * iNext))) | ((uint32_t)BENCH_gray(pi32Pos[iNext]) << (2 * iNext)));
+        g_psEdges[g_sizeEdges].f64Time = pf64Next[iNext];
+        g_psEdges[g_sizeEdges].ui8Pins = ui8Pins;
+        g_sizeEdges++;
+        pui32Left[iNext]--;
+
+        // A reversal comes back over the same edge after a short dwell
+        if (BENCH_rand() < f64Reverse){
+            pi32Dir[iNext] = -pi32Dir[iNext];
+            pf64Next[iNext] += 0.5 + BENCH_rand();
+        }
+        else
+            pf64Next[iNext] += 1.0 + f64Spread * (2.0 * BENCH_rand() - 1.0);
+    }
+}
+
+// Function to load a recorded stream, returns false if the file cannot be read
+static bool BENCH_load(const char *pcFile){
+    FILE *pFile = fopen(pcFile, "r");
+    char pcLine[128];
+    size_t sizeAlloc = 0;
+    bool bStart = false;
+    double f64Time;
+    int iPins;
+
+    if (!pFile) return false;
+    g_sizeEdges = 0;
+    while (fgets(pcLine, sizeof(pcLine), pFile)){
+        if (pcLine[0] == '#' || sscanf(pcLine, "%lf %i", &f64Time, &iPins) != 2) continue;
+        if (!bStart){
+            g_ui8Start = (uint8_t)iPins;
+            bStart = true;
+            continue;
+        }
+        if (g_sizeEdges == sizeAlloc){
+            sizeAlloc = sizeAlloc ? 2 * sizeAlloc : 4096;
+            g_psEdges = realloc(g_psEdges, sizeof(tEdge) * sizeAlloc);
+        }
+        g_psEdges[g_sizeEdges].f64Time = f64Time;
+        g_psEdges[g_sizeEdges].ui8Pins = (uint8_t)iPins;
+        g_sizeEdges++;
+    }
+    fclose(pFile);
+    return bStart;
+}
+
+// Function to write the stream with the times in ns at f64Rate edges/s per channel
+static void BENCH_record(const char *pcFile, double f64Scale){
+    FILE *pFile = fopen(pcFile, "w");
+    size_t sizeIndex;
+
+    if (!pFile){
+        perror(pcFile);
+        return;
+    }
+    fprintf(pFile, "# QDEC_bench stream, %u channels from pin 0\n", g_ui8Channels);
+    fprintf(pFile, "0 0x%02x\n", g_ui8Start);
+    for (sizeIndex = 0; sizeIndex < g_sizeEdges; sizeIndex++)
+        fprintf(pFile, "%.1f 0x%02x\n", g_psEdges[sizeIndex].f64Time * f64Scale, g_psEdges[sizeIndex].ui8Pins);
+    fclose(pFile);
+}
+
+// Function to count the steps of every channel edge by edge, independently of the table
+static bool BENCH_reference(int32_t *pi32Count){
+    static const int8_t i8Bin[4] = {0, 1, 3, 2};    // Gray state to position
+    uint8_t ui8Old = g_ui8Start, ui8Ch;
+    size_t sizeIndex;
+    bool bValid = true;
+
+    memset(pi32Count, 0, sizeof(int32_t) * QDEC_PORT_CHANNELS);
+    for (sizeIndex = 0; sizeIndex < g_sizeEdges; sizeIndex++){
+        uint8_t ui8New = g_psEdges[sizeIndex].ui8Pins;
+        for (ui8Ch = 0; ui8Ch < g_ui8Channels; ui8Ch++){
+            int iStep = (i8Bin[(ui8New >> (2 * ui8Ch)) & 3] - i8Bin[(ui8Old >> (2 * ui8Ch)) & 3]) & 3;
+            if (iStep == 1) pi32Count[ui8Ch]++;
+            else if (iStep == 3) pi32Count[ui8Ch]--;
+            else if (iStep == 2) bValid = false;
+        }
+        ui8Old = ui8New;
+    }
+    return bValid;
+}
+
+// Function to play the stream with f64Scale CPU cycles per unit of its time
+static tBenchResult BENCH_run(const tIsrModel *psIsr, double f64Scale, const int32_t *pi32Ref){
+    tQdecChannel psChannel[QDEC_PORT_CHANNELS];
+    tQdecPort sPort;
+    tBenchResult sResult = {0, 0, 0, 0};
+    double f64Clear = -1e300, f64Free = -1e300, f64Busy = 0;
+    size_t sizePend = 0, sizeRead = 0;
+    uint8_t ui8Pins = g_ui8Start, ui8Ch;
+
+    QDEC_portInit(&sPort, 0, g_ui8Channels, psChannel, g_ui8Start);
+
+    for (;;){
+        double f64Pend, f64Start;
+        uint32_t ui32Changed, ui32Body;
+
+        // The first edge after the last clear latches the interrupt
+        while (sizePend < g_sizeEdges && g_psEdges[sizePend].f64Time * f64Scale <= f64Clear) sizePend++;
+        if (sizePend == g_sizeEdges) break;
+        f64Pend = g_psEdges[sizePend].f64Time * f64Scale;
+
+        // Enter from the thread, or tail chain if the previous handler ends later
+        if (f64Pend + psIsr->ui32Entry >= f64Free + psIsr->ui32Chain){
+            f64Start = f64Pend + psIsr->ui32Entry;
+            f64Busy += psIsr->ui32Entry + BENCH_EXIT;
+        }
+        else {
+            f64Start = f64Free + psIsr->ui32Chain;
+            f64Busy += psIsr->ui32Chain;
+        }
+        if (psIsr->ui32Jitter) f64Start += (double)(uint32_t)(BENCH_rand() * (psIsr->ui32Jitter + 1));
+
+        // Clear the latch, then read and decode the pins
+        f64Clear = f64Start + psIsr->ui32Clear;
+        while (sizeRead < g_sizeEdges && g_psEdges[sizeRead].f64Time * f64Scale <= f64Start + psIsr->ui32Read)
+            ui8Pins = g_psEdges[sizeRead++].ui8Pins;
+        ui32Changed = (ui8Pins ^ sPort.ui8State) & sPort.ui8Mask;
+        QDEC_portUpdate(&sPort, ui8Pins);
+
+        // The handler costs its base and every channel up to the last changed one
+        ui32Body = psIsr->ui32Base;
+        while (ui32Changed){
+            ui32Body += psIsr->ui32PerChannel;
+            ui32Changed >>= 2;
+        }
+        if (ui32Body < psIsr->ui32Read) ui32Body = psIsr->ui32Read;
+        f64Free = f64Start + ui32Body;
+        f64Busy += ui32Body;
+        sResult.ui32Isrs++;
+    }
+
+    for (ui8Ch = 0; ui8Ch < g_ui8Channels; ui8Ch++){
+        int32_t i32Diff = psChannel[ui8Ch].i32Count - pi32Ref[ui8Ch];
+        sResult.ui32Lost += (uint32_t)(i32Diff < 0 ? -i32Diff : i32Diff);
+        sResult.ui32Illegal += psChannel[ui8Ch].ui32Illegal;
+    }
+    if (g_sizeEdges)
+        sResult.f64Load = f64Busy / (g_psEdges[g_sizeEdges - 1].f64Time * f64Scale + 1.0);
+    return sResult;
+}
+
+// Function to print the usage of the program
+static void BENCH_usage(const char *pcName){
+    fprintf(stderr,
+            "usage: %s [-n channels] [-m edges] [-s spread] [-v reversal] [-p stream | -r stream]\n"
+            "          [-e entry] [-t chain] [-c clear] [-d read] [-b base] [-k per channel] [-j jitter]\n"
+            "  -n  encoders on the port, 1 to %d (default 2)\n"
+            "  -m  edges per channel of the generated stream (default %d)\n"
+            "  -s  spread of the edge interval, 0.3 is +-30%% (default 0.3)\n"
+            "  -v  chance of a reversal per edge (default 0.001)\n"
+            "  -p  replay a recorded stream, -r write the generated stream at 100 kHz per channel\n"
+            "  -e -t -c -d -b -k  cycles of the entry, tail chain, clear, read, base handler\n"
+            "                     and each channel looked up (default 12 6 8 14 30 9)\n"
+            "  -j  largest extra latency from other interrupts in cycles (default 0)\n",
+            pcName, QDEC_PORT_CHANNELS, BENCH_EDGES);
+}
+
+/* -----------------------          Main Program        --------------------- */
+int main(int argc, char *argv[]){
+    tIsrModel sIsr = {12, 6, 8, 14, 30, 9, 0};
+    const char *pcPlay = NULL, *pcRecord = NULL;
+    uint32_t ui32Edges = BENCH_EDGES;
+    double f64Spread = 0.3, f64Reverse = 0.001, f64Rate, f64Span, f64Best = 0;
+    int32_t pi32Ref[QDEC_PORT_CHANNELS];
+    bool bFailed = false;
+    int iOpt;
+
+    while ((iOpt = getopt(argc, argv, "n:m:s:v:p:r:e:t:c:d:b:k:j:")) != -1){
+        switch (iOpt){
+        case 'n': g_ui8Channels = (uint8_t)atoi(optarg); break;
+        case 'm': ui32Edges = (uint32_t)strtoul(optarg, NULL, 0); break;
+        case 's': f64Spread = atof(optarg); break;
+        case 'v': f64Reverse = atof(optarg); break;
+        case 'p': pcPlay = optarg; break;
+        case 'r': pcRecord = optarg; break;
+        case 'e': sIsr.ui32Entry = (uint32_t)atoi(optarg); break;
+        case 't': sIsr.ui32Chain = (uint32_t)atoi(optarg); break;
+        case 'c': sIsr.ui32Clear = (uint32_t)atoi(optarg); break;
+        case 'd': sIsr.ui32Read = (uint32_t)atoi(optarg); break;
+        case 'b': sIsr.ui32Base = (uint32_t)atoi(optarg); break;
+        case 'k': sIsr.ui32PerChannel = (uint32_t)atoi(optarg); break;
+        case 'j': sIsr.ui32Jitter = (uint32_t)atoi(optarg); break;
+        default: BENCH_usage(argv[0]); return 1;
+        }
+    }
+    if (g_ui8Channels < 1 || g_ui8Channels > QDEC_PORT_CHANNELS || f64Spread < 0 || f64Spread >= 1 ||
+        sIsr.ui32Clear > sIsr.ui32Read){
+        BENCH_usage(argv[0]);
+        return 1;
+    }
+
+    if (pcPlay){
+        if (!BENCH_load(pcPlay)){
+            fprintf(stderr, "%s: cannot read a stream\n", pcPlay);
+            return 1;
+        }
+        // Express the recording in mean edge periods per channel, like a generated stream
+        if (g_sizeEdges < 2){
+            fprintf(stderr, "%s: fewer than 2 edges\n", pcPlay);
+            return 1;
+        }
+        f64Span = g_psEdges[g_sizeEdges - 1].f64Time;
+        {
+            double f64Unit = f64Span * g_ui8Channels / (double)g_sizeEdges;
+            size_t sizeIndex;
+            for (sizeIndex = 0; sizeIndex < g_sizeEdges; sizeIndex++) g_psEdges[sizeIndex].f64Time /= f64Unit;
+        }
+    }
+    else {
+        BENCH_generate(ui32Edges, f64Spread, f64Reverse);
+        if (pcRecord){
+            BENCH_record(pcRecord, 1e9 / 100e3);
+            fprintf(stderr, "%zu edges written to %s\n", g_sizeEdges, pcRecord);
+        }
+    }
+
+    if (!BENCH_reference(pi32Ref)){
+        fprintf(stderr, "the stream skips states itself, it cannot be used as the reference\n");
+        return 1;
+    }
+
+    printf("# %zu edges on %u channels, ISR cycles entry %u chain %u clear %u read %u base %u channel %u jitter %u\n",
+           g_sizeEdges, g_ui8Channels, sIsr.ui32Entry, sIsr.ui32Chain, sIsr.ui32Clear, sIsr.ui32Read,
+           sIsr.ui32Base, sIsr.ui32PerChannel, sIsr.ui32Jitter);
+    printf("edges_per_s,isrs,cpu_load_pct,illegal,lost\n");
+    for (f64Rate = BENCH_RATE_MIN; f64Rate <= BENCH_RATE_MAX; f64Rate *= BENCH_RATE_STEP){
+        tBenchResult sResult = BENCH_run(&sIsr, BENCH_CPU_HZ / f64Rate, pi32Ref);
+
+        printf("%.0f,%u,%.1f,%u,%u\n", f64Rate, sResult.ui32Isrs, 100.0 * sResult.f64Load,
+               sResult.ui32Illegal, sResult.ui32Lost);
+        if (sResult.ui32Illegal || sResult.ui32Lost)
+            bFailed = true;
+        else if (!bFailed)
+            f64Best = f64Rate;
+    }
+
+    printf("# highest rate without a lost count: %.0f edges/s per channel, %.0f edges/s on the port\n",
+           f64Best, f64Best * g_ui8Channels);
+    return 0;
+}
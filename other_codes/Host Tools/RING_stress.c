@@ -0,0 +1,273 @@
+/*!
+ * @author      Yash Bansod
+ * @date        17th October 2026
+ *
+ * @brief       Host stress test and benchmark of the SPSC ring of uartstdio (UART Stdio)
+ * @details     The stress test runs RING_spsc.c with a producer and a consumer thread,
+ *              standing for UARTwrite() and the UART interrupt, for ring sizes of 16 to
+ *              1024 bytes. The producer pushes a numbered byte stream in random mixes of
+ *              RING_push() and RING_pushN() chunks of up to 40 bytes, the consumer pops it
+ *              with RING_pop() and RING_popN() chunks of up to 16 bytes (a FIFO refill)
+ *              and checks every byte; the counts start just below their wrap. A thread
+ *              that finds the ring full or empty sleeps for 1 us, so that the test also
+ *              runs on a single core. The exit code is 1 on a lost, repeated or corrupted
+ *              byte.
+ *              The benchmark moves bytes through a ring in one thread: byte by byte with
+ *              the former buffer of uartstdio (indices advanced with %, counts read
+ *              through volatile pointers), byte by byte with RING_push()/RING_pop(), and
+ *              in 16 byte chunks with RING_pushN()/RING_popN(), then through the two
+ *              threads. The former buffer sizes need not be powers of 2, so the divide
+ *              is kept by a volatile size.
+ *
+ * @note        Build and run from this folder:
+ *              gcc -O2 -Wall -Wextra -pthread -I"../../TM4C123G LaunchPad UART Stdio/uartStdio"
+ *                  RING_stress.c "../../TM4C123G LaunchPad UART Stdio/uartStdio/RING_spsc.c"
+ *                  -o RING_stress
+ *              ./RING_stress
+ *              ./RING_stress -n 20000000
+ * @file        RING_stress.c
+ */
+/* -----------------------          Include Files       --------------------- */
+#include <stdio.h>                          // Library for Standard I/O
+#include <stdlib.h>                         // Standard Library
+#include <string.h>                         // Library for String functions
+#include <unistd.h>                         // Library for getopt
+#include <time.h>                           // Library for clock_gettime
+#include <pthread.h>                        // Library for POSIX threads
+#include "RING_spsc.h"
+
+/* -----------------------      Macro Definitions       --------------------- */
+#define STRESS_WRAP         0xFFFFF000u             // Macro for the counts at the start of a run
+#define STRESS_PUSH_MAX     40                      // Macro for the longest RING_pushN() of the producer
+#define STRESS_POP_MAX      16                      // Macro for the longest RING_popN() of the consumer (TX FIFO)
+#define BENCH_SIZE          1024                    // Macro for the ring size of the benchmark (UART_TX_BUFFER_SIZE)
+#define BENCH_CHUNK         16                      // Macro for the chunk of the bulk benchmark
+#define STRESS_BYTE(ui64N)  ((uint8_t)((ui64N) * 167 + ((ui64N) >> 8)))
+
+/* -----------------------      Global Variables        --------------------- */
+typedef struct {
+    tRing *psRing;                                  // Ring shared by the threads
+    uint64_t ui64Bytes;                             // Bytes to move
+    uint64_t ui64Errors;                            // Bytes popped out of sequence
+    uint32_t ui32Seed;                              // Seed of the chunk lengths
+    bool bBulkOnly;                                 // Only RING_pushN()/RING_popN() of full chunks
+} tStress;
+
+static uint64_t g_ui64Bytes = 2000000;              // Bytes per stress run
+
+// The former uartstdio buffer, for the benchmark
+static uint8_t g_pui8Old[BENCH_SIZE];
+static volatile uint32_t g_ui32OldWrite, g_ui32OldRead;
+static volatile uint32_t g_ui32OldSize = BENCH_SIZE;
+
+/* -----------------------      Function Definition     --------------------- */
+// Function to get the time in s
+static double STRESS_now(void){
+    struct timespec sTime;
+
+    clock_gettime(CLOCK_MONOTONIC, &sTime);
+    return sTime.tv_sec + sTime.tv_nsec * 1e-9;
+}
+
+// Function to give the other thread the core when the ring is full or empty
+static void STRESS_wait(void){
+    struct timespec sWait = {0, 1000};
+
+    nanosleep(&sWait, NULL);
+}
+
+// Function to get a random number of a thread
+static uint32_t STRESS_rand(uint32_t *pui32State){
+    *pui32State = *pui32State * 1664525u + 1013904223u;
+    return *pui32State >> 8;
+}
+
+// Function of the producer thread, UARTwrite()
+static void *STRESS_producer(void *pvArg){
+    tStress *psStress = pvArg;
+    uint32_t ui32State = psStress->ui32Seed;
+    uint8_t pui8Chunk[STRESS_PUSH_MAX];
+    uint64_t ui64N = 0;
+
+    while (ui64N < psStress->ui64Bytes){
+        uint32_t ui32Len = psStress->bBulkOnly ? BENCH_CHUNK : STRESS_rand(&ui32State) % STRESS_PUSH_MAX + 1;
+        uint32_t ui32Idx, ui32Done;
+
+        if (ui32Len > psStress->ui64Bytes - ui64N) ui32Len = (uint32_t)(psStress->ui64Bytes - ui64N);
+        if (!psStress->bBulkOnly && (STRESS_rand(&ui32State) & 3) == 0){
+            // One byte at a time
+            if (RING_push(psStress->psRing, STRESS_BYTE(ui64N))) ui64N++;
+            else STRESS_wait();
+            continue;
+        }
+        for (ui32Idx = 0; ui32Idx < ui32Len; ui32Idx++)
+            pui8Chunk[ui32Idx] = STRESS_BYTE(ui64N + ui32Idx);
+        ui32Done = RING_pushN(psStress->psRing, pui8Chunk, ui32Len);
+        if (ui32Done == 0) STRESS_wait();
+        ui64N += ui32Done;
+    }
+    return NULL;
+}
+
+// Function of the consumer thread, the UART interrupt
+static void *STRESS_consumer(void *pvArg){
+    tStress *psStress = pvArg;
+    uint32_t ui32State = psStress->ui32Seed ^ 0x5A5A5A5Au;
+    uint8_t pui8Fifo[STRESS_POP_MAX];
+    uint64_t ui64N = 0;
+
+    while (ui64N < psStress->ui64Bytes){
+        uint32_t ui32Idx, ui32Got;
+        uint8_t ui8Byte;
+
+        if (!psStress->bBulkOnly && (STRESS_rand(&ui32State) & 3) == 0){
+            // One byte at a time
+            if (RING_pop(psStress->psRing, &ui8Byte)){
+                if (ui8Byte != STRESS_BYTE(ui64N)) psStress->ui64Errors++;
+                ui64N++;
+            } else STRESS_wait();
+            continue;
+        }
+        ui32Got = RING_popN(psStress->psRing, pui8Fifo,
+                            psStress->bBulkOnly ? STRESS_POP_MAX : STRESS_rand(&ui32State) % STRESS_POP_MAX + 1);
+        if (ui32Got == 0) STRESS_wait();
+        for (ui32Idx = 0; ui32Idx < ui32Got; ui32Idx++)
+            if (pui8Fifo[ui32Idx] != STRESS_BYTE(ui64N + ui32Idx)) psStress->ui64Errors++;
+        ui64N += ui32Got;
+    }
+    return NULL;
+}
+
+// Function to run the two threads over a ring, returns the bytes per second
+static double STRESS_run(uint32_t ui32Size, uint64_t ui64Bytes, bool bBulkOnly, uint64_t *pui64Errors){
+    uint8_t *pui8Buf = malloc(ui32Size);
+    pthread_t sProducer, sConsumer;
+    tRing sRing;
+    tStress sStress = {&sRing, ui64Bytes, 0, ui32Size * 7919u + 1, bBulkOnly};
+    double f64Start;
+
+    RING_init(&sRing, pui8Buf, ui32Size);
+    sRing.ui32Head = sRing.ui32Tail = STRESS_WRAP;
+
+    f64Start = STRESS_now();
+    pthread_create(&sConsumer, NULL, STRESS_consumer, &sStress);
+    pthread_create(&sProducer, NULL, STRESS_producer, &sStress);
+    pthread_join(sProducer, NULL);
+    pthread_join(sConsumer, NULL);
+    f64Start = STRESS_now() - f64Start;
+
+    if (!RING_EMPTY(&sRing)) sStress.ui64Errors++;
+    *pui64Errors = sStress.ui64Errors;
+    free(pui8Buf);
+    return ui64Bytes / f64Start;
+}
+
+// Function to tell if the former buffer is full, as IsBufferFull() of uartstdio
+static bool OLD_full(volatile uint32_t *pui32Read, volatile uint32_t *pui32Write, uint32_t ui32Size){
+    uint32_t ui32Write = *pui32Write, ui32Read = *pui32Read;
+
+    return ((ui32Write + 1) % ui32Size) == ui32Read;
+}
+
+// Function to tell if the former buffer is empty, as IsBufferEmpty() of uartstdio
+static bool OLD_empty(volatile uint32_t *pui32Read, volatile uint32_t *pui32Write){
+    uint32_t ui32Write = *pui32Write, ui32Read = *pui32Read;
+
+    return ui32Write == ui32Read;
+}
+
+// Function to move bytes through the former buffer one at a time, returns a checksum
+static uint32_t BENCH_old(uint64_t ui64Bytes){
+    uint32_t ui32Sum = 0;
+    uint64_t ui64N;
+
+    for (ui64N = 0; ui64N < ui64Bytes; ){
+        // Write as UARTwrite() did until full, then read as UARTPrimeTransmit() did until empty
+        while (ui64N < ui64Bytes && !OLD_full(&g_ui32OldRead, &g_ui32OldWrite, g_ui32OldSize)){
+            g_pui8Old[g_ui32OldWrite] = (uint8_t)ui64N++;
+            g_ui32OldWrite = (g_ui32OldWrite + 1) % g_ui32OldSize;
+        }
+        while (!OLD_empty(&g_ui32OldRead, &g_ui32OldWrite)){
+            ui32Sum += g_pui8Old[g_ui32OldRead];
+            g_ui32OldRead = (g_ui32OldRead + 1) % g_ui32OldSize;
+        }
+    }
+    return ui32Sum;
+}
+
+// Function to move bytes through the ring, one at a time or in chunks, returns a checksum
+static uint32_t BENCH_ring(uint64_t ui64Bytes, bool bBulk){
+    static uint8_t pui8Buf[BENCH_SIZE];
+    uint8_t pui8Chunk[BENCH_CHUNK];
+    uint32_t ui32Sum = 0, ui32Idx, ui32Got;
+    uint64_t ui64N;
+    uint8_t ui8Byte;
+    tRing sRing;
+
+    RING_init(&sRing, pui8Buf, BENCH_SIZE);
+    for (ui32Idx = 0; ui32Idx < BENCH_CHUNK; ui32Idx++) pui8Chunk[ui32Idx] = (uint8_t)ui32Idx;
+
+    for (ui64N = 0; ui64N < ui64Bytes; ){
+        if (bBulk){
+            while (ui64N < ui64Bytes && RING_pushN(&sRing, pui8Chunk, BENCH_CHUNK)) ui64N += BENCH_CHUNK;
+            while ((ui32Got = RING_popN(&sRing, pui8Chunk, BENCH_CHUNK)) != 0) ui32Sum += pui8Chunk[ui32Got - 1];
+        } else{
+            while (ui64N < ui64Bytes && RING_push(&sRing, (uint8_t)ui64N)) ui64N++;
+            while (RING_pop(&sRing, &ui8Byte)) ui32Sum += ui8Byte;
+        }
+    }
+    return ui32Sum;
+}
+
+// Function to print the options
+static void STRESS_usage(const char *pcName){
+    fprintf(stderr, "usage: %s [-n bytes per run]\n", pcName);
+}
+
+/* -----------------------          Main Program        --------------------- */
+int main(int argc, char *argv[]){
+    static const uint32_t pui32Size[] = {16, 32, 128, 1024};
+    uint64_t ui64Errors, ui64Failed = 0;
+    uint32_t ui32Size, ui32Sum;
+    double f64Start, f64Rate;
+    int iOpt;
+
+    while ((iOpt = getopt(argc, argv, "n:")) != -1){
+        switch (iOpt){
+        case 'n': g_ui64Bytes = strtoull(optarg, NULL, 0); break;
+        default: STRESS_usage(argv[0]); return 2;
+        }
+    }
+    if (g_ui64Bytes == 0){
+        STRESS_usage(argv[0]);
+        return 2;
+    }
+
+    printf("stress, %llu bytes per ring, counts from 0x%08X\n", (unsigned long long)g_ui64Bytes, STRESS_WRAP);
+    for (ui32Size = 0; ui32Size < sizeof(pui32Size) / sizeof(pui32Size[0]); ui32Size++){
+        f64Rate = STRESS_run(pui32Size[ui32Size], g_ui64Bytes, false, &ui64Errors);
+        printf("  %4u bytes  %8.1f MB/s  %llu errors\n", pui32Size[ui32Size], f64Rate / 1e6,
+               (unsigned long long)ui64Errors);
+        ui64Failed += ui64Errors;
+    }
+
+    printf("benchmark, %u byte ring, one thread\n", BENCH_SIZE);
+    f64Start = STRESS_now();
+    ui32Sum = BENCH_old(g_ui64Bytes);
+    printf("  former buffer, byte by byte     %8.1f MB/s  (sum %08X)\n",
+           g_ui64Bytes / (STRESS_now() - f64Start) / 1e6, ui32Sum);
+    f64Start = STRESS_now();
+    ui32Sum = BENCH_ring(g_ui64Bytes, false);
+    printf("  RING_push/RING_pop              %8.1f MB/s  (sum %08X)\n",
+           g_ui64Bytes / (STRESS_now() - f64Start) / 1e6, ui32Sum);
+    f64Start = STRESS_now();
+    ui32Sum = BENCH_ring(g_ui64Bytes, true);
+    printf("  RING_pushN/RING_popN, %2u bytes  %8.1f MB/s  (sum %08X)\n", BENCH_CHUNK,
+           g_ui64Bytes / (STRESS_now() - f64Start) / 1e6, ui32Sum);
+    f64Rate = STRESS_run(BENCH_SIZE, g_ui64Bytes, true, &ui64Errors);
+    printf("  RING_pushN/RING_popN, 2 threads %8.1f MB/s\n", f64Rate / 1e6);
+    ui64Failed += ui64Errors;
+
+    printf("%s\n", ui64Failed ? "FAIL" : "ok");
+    return ui64Failed ? 1 : 0;
+}
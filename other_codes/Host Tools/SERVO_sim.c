@@ -0,0 +1,307 @@
+/*!
+ * @author      Yash Bansod
+ * @date        17th October 2026
+ *
+ * @brief       Host simulation of the gait throughput of the Humper Robot Rev2 servo motion
+ * @details     The program runs SERVO_motion.c of the firmware against a model of four
+ *              MG995 servos and the command loop with the PC, and reports the steps per
+ *              second, the peak and RMS current of the four servos together and how far
+ *              the legs still were from their targets when the step was reported done.
+ *              A step: the command arrives over UART, the legs move, the range ping is
+ *              triggered, its echo returns and the status goes back to the PC, which
+ *              thinks for -p ms and sends the next command (alternating the two duty
+ *              cycles of i16ServoDuty, or the commands of -s). The ping is triggered
+ *              400 ms after the command by the former firmware (legs jumped at once) and
+ *              by the completion event of the motion engine in the new one.
+ *              The servo drives its motor with the error between the pulse width and
+ *              its position less its speed times the damping time -d, full voltage
+ *              beyond -b units of it; the motor current is
+ *              I_stall * (drive - speed / no-load speed) and the speed follows the drive
+ *              with the mechanical time constant -t. The pulse width is taken at the
+ *              50 Hz PWM period. Positions are in the per mille unit of the firmware
+ *              (20 us, about 2 degrees of an MG995).
+ *              Rows: the former firmware, jumps with the completion event, and a grid of
+ *              velocity and acceleration limits. The settle ticks of each row are the
+ *              fewest for which every leg is within -e units of its target when the
+ *              step is reported; the row of the firmware macros is marked with '*'.
+ *              -m N instead sends N new targets with the firmware limits, each after a
+ *              random number of ticks so that many land in the middle of a motion, and
+ *              checks at every tick that no leg changes its velocity by more than the
+ *              acceleration limit or exceeds the velocity limit, that a leg stops with a
+ *              last step of at most the acceleration limit, and that every leg ends on
+ *              its last target. The targets passed and turned back to are counted.
+ *
+ * @note        Build and run from this folder:
+ *              gcc -O2 -Wall -Wextra -I"../TM4C123G LaunchPad Humper Robot Rev2" SERVO_sim.c
+ *                  "../TM4C123G LaunchPad Humper Robot Rev2/SERVO_motion.c"
+ *                  "../TM4C123G LaunchPad Humper Robot Rev2/QDEC_decode.c" -o SERVO_sim -lm
+ *              ./SERVO_sim
+ *              ./SERVO_sim -s 9,6,F,0 -p 10
+ *              ./SERVO_sim -m 100000
+ * @file        SERVO_sim.c
+ */
+/* -----------------------          Include Files       --------------------- */
+#include <stdio.h>                          // Library for Standard I/O
+#include <stdlib.h>                         // Standard Library
+#include <string.h>                         // Library for String functions
+#include <math.h>                           // Library for sqrt
+#include <unistd.h>                         // Library for getopt
+
+// The firmware header is included for i16ServoDuty and the SERVO macros
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#include "globalVariables.h"
+
+/* -----------------------      Macro Definitions       --------------------- */
+#define SIM_DT              50e-6                   // Macro for the simulation step in s
+#define SIM_TICK            (1.0 / SERVO_TICK_HZ)   // Macro for the motion tick and PWM period in s
+#define SIM_FORMER_WAIT     0.4                     // Macro for the wait of the former firmware in s
+#define SIM_COMMANDS_MAX    16                      // Macro for the most commands of -s
+#define SIM_SETTLE_MAX      50                      // Macro for the most settle ticks searched
+#define SIM_FAST            30000                   // Macro for limits that make the engine jump
+#define SIM_MOVE_TICKS      40                      // Macro for the most ticks between two targets of -m
+#define SIM_TARGET_MIN      25                      // Macro for the smallest target of -m in units
+#define SIM_TARGET_SPAN     100                     // Macro for the span of the targets of -m in units
+
+/* -----------------------      Global Variables        --------------------- */
+typedef struct {
+    double f64Pos;                                  // Position in units
+    double f64Speed;                                // Speed in units per s
+    double f64Pulse;                                // Pulse width in use in units
+} tSimServo;
+
+typedef struct {
+    double f64StepsPerSec;                          // Steps per second
+    double f64StepMs;                               // Mean step time in ms
+    double f64PeakA;                                // Peak current of the four servos in A
+    double f64RmsA;                                 // RMS current of the four servos in A
+    double f64Residual;                             // Largest leg error when a step was reported, in units
+} tSimResult;
+
+static double g_f64NoLoad = 175;                    // No-load speed in units per s (0.2 s / 60 degrees)
+static double g_f64Tau = 0.03;                      // Mechanical time constant with the leg in s
+static double g_f64Stall = 1.5;                     // Stall current in A
+static double g_f64Band = 4.0;                      // Error for full drive in units (about 8 degrees)
+static double g_f64Damp = 0.02;                     // Damping of the servo amplifier, speed times s
+static double g_f64Tol = 0.5;                       // Error allowed when a step is reported, in units
+static double g_f64Think = 0.002;                   // Time of the PC per step in s
+static double g_f64Range = 0.3;                     // Distance to the wall in m
+static uint32_t g_ui32Steps = 40;                   // Steps simulated per row
+static uint8_t g_pui8Command[SIM_COMMANDS_MAX] = {0x0, 0xF};    // Motor commands of the steps
+static uint32_t g_ui32Commands = 2;                 // Motor commands in g_pui8Command
+
+/* -----------------------      Function Definition     --------------------- */
+// Function to get the duty cycles of a 4 bit motor command, as the UART0 handler does
+static void SIM_duty(uint8_t ui8Command, int16_t *pi16Duty){
+    uint8_t ui8Index;
+    for (ui8Index = 0; ui8Index < PWM_CHANNELS; ui8Index++)
+        pi16Duty[ui8Index] = i16ServoDuty[ui8Index][(ui8Command >> (PWM_CHANNELS - 1 - ui8Index)) & 1];
+}
+
+// Function to advance a servo by one simulation step, returns its current in A
+static double SIM_servo(tSimServo *psServo){
+    double f64Drive = (psServo->f64Pulse - psServo->f64Pos - psServo->f64Speed * g_f64Damp) / g_f64Band;
+    if (f64Drive > 1) f64Drive = 1;
+    if (f64Drive < -1) f64Drive = -1;
+
+    psServo->f64Speed += (g_f64NoLoad * f64Drive - psServo->f64Speed) * SIM_DT / g_f64Tau;
+    psServo->f64Pos += psServo->f64Speed * SIM_DT;
+    return g_f64Stall * (f64Drive - psServo->f64Speed / g_f64NoLoad);
+}
+
+// Function to run the command loop, bFormer for the 400 ms wait, else the engine with its limits
+static void SIM_run(bool bFormer, uint32_t ui32VelMax, uint32_t ui32Accel, uint8_t ui8Settle, tSimResult *psRes){
+    // Echo of the range, 6 status bytes and 1 command byte at 115200 baud, and the PC
+    double f64Loop = 2 * g_f64Range / 343.0 + 7 * 10 / 115200.0 + g_f64Think;
+    tSimServo psServo[PWM_CHANNELS];
+    tServoMotion sMotion;
+    int16_t pi16Duty[PWM_CHANNELS], pi16Target[PWM_CHANNELS];
+    double f64Time = 0, f64NextTick = SIM_TICK, f64Ping = -1, f64Arrive, f64Sq = 0, f64Peak = 0;
+    uint32_t ui32Step = 0, ui32Samples = 0;
+    uint8_t ui8Index;
+
+    SIM_duty(g_pui8Command[g_ui32Commands - 1], pi16Duty);
+    for (ui8Index = 0; ui8Index < PWM_CHANNELS; ui8Index++){
+        psServo[ui8Index].f64Pos = pi16Duty[ui8Index];
+        psServo[ui8Index].f64Speed = 0;
+        psServo[ui8Index].f64Pulse = pi16Duty[ui8Index];
+    }
+    SERVO_init(&sMotion, pi16Duty, ui32VelMax, ui32Accel, SERVO_TICK_HZ, ui8Settle);
+    psRes->f64Residual = 0;
+    f64Arrive = f64Loop;
+
+    while (ui32Step < g_ui32Steps){
+        double f64Current = 0;
+
+        if (f64Arrive >= 0 && f64Time >= f64Arrive){
+            // A command arrives, the former firmware writes it and waits 400 ms
+            SIM_duty(g_pui8Command[ui32Step % g_ui32Commands], pi16Target);
+            if (bFormer){
+                memcpy(pi16Duty, pi16Target, sizeof(pi16Duty));
+                f64Ping = f64Time + SIM_FORMER_WAIT;
+            } else
+                SERVO_moveTo(&sMotion, pi16Target);
+            f64Arrive = -1;
+        }
+        if (f64Time >= f64NextTick){
+            // The PWM period boundary, also the motion tick of the new firmware
+            f64NextTick += SIM_TICK;
+            if (!bFormer){
+                uint8_t ui8Done = SERVO_tick(&sMotion, pi16Duty);
+                if (ui8Done && SERVO_IDLE(&sMotion) && f64Arrive < 0 && f64Ping < 0)
+                    f64Ping = f64Time;
+            }
+            for (ui8Index = 0; ui8Index < PWM_CHANNELS; ui8Index++)
+                psServo[ui8Index].f64Pulse = pi16Duty[ui8Index];
+        }
+        if (f64Ping >= 0 && f64Time >= f64Ping){
+            // The step is reported, the next command follows after the loop time
+            for (ui8Index = 0; ui8Index < PWM_CHANNELS; ui8Index++){
+                double f64Err = fabs(psServo[ui8Index].f64Pos - pi16Target[ui8Index]);
+                if (f64Err > psRes->f64Residual) psRes->f64Residual = f64Err;
+            }
+            f64Arrive = f64Time + f64Loop;
+            f64Ping = -1;
+            ui32Step++;
+        }
+
+        for (ui8Index = 0; ui8Index < PWM_CHANNELS; ui8Index++)
+            f64Current += fabs(SIM_servo(&psServo[ui8Index]));
+        if (f64Current > f64Peak) f64Peak = f64Current;
+        f64Sq += f64Current * f64Current;
+        ui32Samples++;
+        f64Time += SIM_DT;
+    }
+    psRes->f64StepsPerSec = g_ui32Steps / f64Time;
+    psRes->f64StepMs = 1e3 * f64Time / g_ui32Steps;
+    psRes->f64PeakA = f64Peak;
+    psRes->f64RmsA = sqrt(f64Sq / ui32Samples);
+}
+
+// Function to find the fewest settle ticks that report every step in tolerance and print the row
+static void SIM_row(const char *pcMode, uint32_t ui32VelMax, uint32_t ui32Accel){
+    tSimResult sRes;
+    uint8_t ui8Settle;
+    bool bFirmware = (ui32VelMax == SERVO_VEL_MAX && ui32Accel == SERVO_ACCEL);
+
+    for (ui8Settle = 0; ui8Settle <= SIM_SETTLE_MAX; ui8Settle++){
+        SIM_run(false, ui32VelMax, ui32Accel, ui8Settle, &sRes);
+        if (sRes.f64Residual <= g_f64Tol) break;
+    }
+    printf("%s%s,%u,%u,%u,%.2f,%.1f,%.2f,%.2f,%.2f\n", pcMode, bFirmware ? "*" : "", ui32VelMax, ui32Accel,
+           ui8Settle, sRes.f64StepsPerSec, sRes.f64StepMs, sRes.f64PeakA, sRes.f64RmsA, sRes.f64Residual);
+}
+
+// Function to check the velocity and acceleration limits over ui32Moves random targets, returns -1 on a failure
+static int SIM_retarget(uint32_t ui32Moves){
+    tServoMotion sMotion;
+    int16_t pi16Pulse[PWM_CHANNELS], pi16Target[PWM_CHANNELS];
+    int32_t pi32Pos[PWM_CHANNELS], pi32Vel[PWM_CHANNELS], pi32Side[PWM_CHANNELS];
+    uint32_t ui32Seed = 1, ui32Move, ui32Tick, ui32Ticks = 0, ui32Jumps = 0, ui32Passed = 0, ui32Missed = 0;
+    int32_t i32MaxStep = 0;
+    uint8_t ui8Index;
+
+    for (ui8Index = 0; ui8Index < PWM_CHANNELS; ui8Index++){
+        pi16Pulse[ui8Index] = SIM_TARGET_MIN + SIM_TARGET_SPAN / 2;
+        pi32Pos[ui8Index] = (int32_t)pi16Pulse[ui8Index] << SERVO_Q;
+        pi32Vel[ui8Index] = 0;
+        pi32Side[ui8Index] = 0;
+    }
+    SERVO_init(&sMotion, pi16Pulse, SERVO_VEL_MAX, SERVO_ACCEL, SERVO_TICK_HZ, SERVO_SETTLE_TICKS);
+
+    for (ui32Move = 0; ui32Move <= ui32Moves; ui32Move++){
+        // The last move runs until the engine is idle
+        uint32_t ui32Run = (ui32Move < ui32Moves) ? 1 + (ui32Seed >> 8) % SIM_MOVE_TICKS : UINT32_MAX;
+
+        for (ui8Index = 0; ui8Index < PWM_CHANNELS; ui8Index++){
+            ui32Seed = ui32Seed * 1664525u + 1013904223u;
+            pi16Target[ui8Index] = (int16_t)(SIM_TARGET_MIN + (ui32Seed >> 8) % (SIM_TARGET_SPAN + 1));
+            pi32Side[ui8Index] = 0;
+        }
+        SERVO_moveTo(&sMotion, pi16Target);
+
+        for (ui32Tick = 0; ui32Tick < ui32Run && !SERVO_IDLE(&sMotion); ui32Tick++){
+            SERVO_tick(&sMotion, pi16Pulse);
+            ui32Ticks++;
+            for (ui8Index = 0; ui8Index < PWM_CHANNELS; ui8Index++){
+                int32_t i32Pos = sMotion.psAxis[ui8Index].i32Pos;
+                int32_t i32Vel = sMotion.psAxis[ui8Index].i32Vel;
+                int32_t i32Side = ((int32_t)pi16Target[ui8Index] << SERVO_Q) - i32Pos;
+                // A leg at rest on its target took a last step of at most a, else its velocity moved
+                int32_t i32Step = (i32Vel == 0 && i32Side == 0) ? abs(i32Pos - pi32Pos[ui8Index]) :
+                                                                   abs(i32Vel - pi32Vel[ui8Index]);
+
+                if (i32Step > i32MaxStep) i32MaxStep = i32Step;
+                if (i32Step > sMotion.i32Accel || abs(i32Vel) > sMotion.i32VelMax) ui32Jumps++;
+                // A leg that ends up on the other side of its target has passed it
+                i32Side = (i32Side > 0) - (i32Side < 0);
+                if (i32Side != 0 && pi32Side[ui8Index] == -i32Side) ui32Passed++;
+                if (i32Side != 0) pi32Side[ui8Index] = i32Side;
+                pi32Pos[ui8Index] = i32Pos;
+                pi32Vel[ui8Index] = i32Vel;
+            }
+        }
+    }
+    for (ui8Index = 0; ui8Index < PWM_CHANNELS; ui8Index++)
+        if (pi16Pulse[ui8Index] != pi16Target[ui8Index] || pi32Vel[ui8Index] != 0) ui32Missed++;
+
+    bool bOk = ui32Jumps == 0 && ui32Missed == 0;
+    printf("moves,ticks,targets_passed,max_vel_step,accel,velocity_jumps,legs_off_target,result\n");
+    printf("%u,%u,%u,%d,%d,%u,%u,%s\n", ui32Moves, ui32Ticks, ui32Passed, i32MaxStep, sMotion.i32Accel,
+           ui32Jumps, ui32Missed, bOk ? "ok" : "failed");
+    return bOk ? 0 : -1;
+}
+
+/* -----------------------          Main Program        --------------------- */
+int main(int argc, char *argv[]){
+    static const uint32_t pui32Vel[] = {100, 150, 200, 300};
+    static const uint32_t pui32Accel[] = {750, 1500, 3000, 6000};
+    uint32_t ui32Vel, ui32Accel;
+    tSimResult sRes;
+    uint32_t ui32Retarget = 0;
+    int iOpt;
+
+    while ((iOpt = getopt(argc, argv, "s:p:r:n:t:w:b:d:e:m:")) != -1){
+        switch (iOpt){
+        case 's':{
+            char *pcToken = strtok(optarg, ",");
+            g_ui32Commands = 0;
+            while (pcToken && g_ui32Commands < SIM_COMMANDS_MAX){
+                g_pui8Command[g_ui32Commands++] = (uint8_t)(strtoul(pcToken, NULL, 16) & 0x0F);
+                pcToken = strtok(NULL, ",");
+            }
+            break;
+        }
+        case 'p': g_f64Think = atof(optarg) / 1e3; break;
+        case 'r': g_f64Range = atof(optarg); break;
+        case 'n': g_ui32Steps = (uint32_t)strtoul(optarg, NULL, 0); break;
+        case 't': g_f64Tau = atof(optarg); break;
+        case 'w': g_f64NoLoad = atof(optarg); break;
+        case 'b': g_f64Band = atof(optarg); break;
+        case 'd': g_f64Damp = atof(optarg); break;
+        case 'e': g_f64Tol = atof(optarg); break;
+        case 'm': ui32Retarget = (uint32_t)strtoul(optarg, NULL, 0); break;
+        default:
+            printf("usage: %s [-s commands in hex, e.g. 9,6] [-p PC ms] [-r range m] [-n steps]\n"
+                   "       [-t servo time constant s] [-w no-load speed units/s] [-b full drive error]\n"
+                   "       [-d damping s] [-e tolerance] [-m targets of the retarget check]\n",
+                   argv[0]);
+            return 1;
+        }
+    }
+    if (g_ui32Commands == 0 || g_ui32Steps == 0 || g_f64Tau <= 0 || g_f64NoLoad <= 0 || g_f64Band <= 0 || g_f64Damp < 0){
+        printf("bad option\n");
+        return 1;
+    }
+    if (ui32Retarget)
+        return SIM_retarget(ui32Retarget) ? 1 : 0;
+
+    printf("mode,vel_max,accel,settle_ticks,steps_per_s,step_ms,peak_a,rms_a,residual\n");
+    SIM_run(true, 0, 0, 0, &sRes);
+    printf("former,-,-,-,%.2f,%.1f,%.2f,%.2f,%.2f\n", sRes.f64StepsPerSec, sRes.f64StepMs, sRes.f64PeakA,
+           sRes.f64RmsA, sRes.f64Residual);
+    SIM_row("jump", SIM_FAST, SIM_FAST * SERVO_TICK_HZ);
+    for (ui32Vel = 0; ui32Vel < sizeof(pui32Vel) / sizeof(pui32Vel[0]); ui32Vel++)
+        for (ui32Accel = 0; ui32Accel < sizeof(pui32Accel) / sizeof(pui32Accel[0]); ui32Accel++)
+            SIM_row("profile", pui32Vel[ui32Vel], pui32Accel[ui32Accel]);
+    return 0;
+}
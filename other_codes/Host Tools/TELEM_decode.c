@@ -0,0 +1,343 @@
+/*!
+ * @author      Yash Bansod
+ * @date        17th October 2026
+ *
+ * @brief       Host decoder for the telemetry stream of PID with UART and FPU
+ * @details     The program reads the bytes sent by UART0 from the virtual serial port,
+ *              a file written by "PID_sim --telemetry" or stdin ("-"), decodes the
+ *              PROTO_TELEM_DATA frames with PROTO_frame.c of the firmware and prints one
+ *              CSV line per record. Other frames (command replies) are skipped.
+ *              The 16 bit sequence numbers are unwrapped; records dropped on the target
+ *              or frames lost on the link show as a jump of the sequence and are reported
+ *              on stderr. The time of a record is the QEI1 tick in the frame header plus
+ *              the ticks per record for each record before it in the frame, so it stays
+ *              right across gaps and changes of the decimation.
+ *              -t N runs TELEM_stream.c of the firmware for N QEI1 ticks against the
+ *              HOST_stub.c UART, with a link too slow for every record, changes of the
+ *              decimation, stops and replies in between, and decodes what it sends. Each
+ *              record carries its own tick in its position and error, so a record decoded
+ *              with the wrong tick or sequence is found. The program exits with 1 if any
+ *              record is wrong, if the records lost differ from those the firmware dropped,
+ *              or if no batch was dropped.
+ *              With -b the records are written instead to a columnar file: the magic
+ *              "TLM1", u16 number of columns, u16 QEI1 ticks per second, 16 byte column
+ *              names, then blocks of u32 rows followed by one array of i32 per column,
+ *              all little-endian. numpy.fromfile() reads each array directly.
+ *              A serial port is read until Ctrl-C.
+ *
+ * @note        Build and run from this folder:
+ *              gcc -O2 -DHOST_SIM -DPROTO_MAX_PAYLOAD=156 -I. -I"../../TM4C123G LaunchPad PID with UART and FPU"
+ *                  TELEM_decode.c HOST_stub.c "../../TM4C123G LaunchPad PID with UART and FPU/PROTO_frame.c"
+ *                  "../../TM4C123G LaunchPad PID with UART and FPU/TELEM_stream.c" -o TELEM_decode
+ *              ./TELEM_decode -t 1000000
+ *              ./PROTO_cmd /dev/ttyACM0 telemetry 4
+ *              ./TELEM_decode /dev/ttyACM0 > run.csv
+ *              ./PID_sim --telemetry run.bin --decim 4 && ./TELEM_decode -b run.tlm run.bin
+ * @file        TELEM_decode.c
+ */
+/* -----------------------          Include Files       --------------------- */
+#include <stdio.h>                          // Library for Standard I/O
+#include <stdlib.h>                         // Standard Library
+#include <string.h>                         // Library for String functions
+#include <signal.h>                         // Library for stopping on Ctrl-C
+#include <fcntl.h>                          // Library for opening the serial port
+#include <termios.h>                        // Library for the serial port settings
+#include <unistd.h>                         // Library for read and write
+#include "HOST_stub.h"
+#include "macros.h"
+#include "PROTO_frame.h"
+#include "TELEM_stream.h"
+
+#if PROTO_MAX_PAYLOAD < PROTO_TELEM_PAYLOAD
+#error "Build with -DPROTO_MAX_PAYLOAD=156 so that the telemetry frames are accepted"
+#endif
+
+/* -----------------------      Macro Definitions       --------------------- */
+#define DEC_COLUMNS     8                           // Macro for the columns of a record
+#define DEC_BLOCK_ROWS  1024                        // Macro for the rows per block of the columnar file
+#define DEC_TEST_PERIOD 5000                        // Macro for the QEI1 ticks between decimation changes of -t
+#define DEC_TEST_DRAIN  6                           // Macro for the most bytes the link of -t takes per tick
+
+/* -----------------------      Global Variables        --------------------- */
+typedef struct {
+    bool bStarted;                                  // A telemetry frame has been decoded
+    uint16_t ui16Seq;                               // Sequence number of the next record expected
+    int64_t i64Seq;                                 // Unwrapped sequence number of the next record
+    uint32_t ui32Tick;                              // QEI1 tick in the header of the last frame
+    int64_t i64Tick;                                // Unwrapped ui32Tick
+    uint32_t ui32Frames;                            // Telemetry frames decoded
+    uint32_t ui32Other;                             // Other frames skipped
+    uint32_t ui32Gaps;                              // Jumps of the sequence
+    uint32_t ui32Lost;                              // Records missing in the jumps
+} tDecoder;
+
+static const char *g_ppcColumns[DEC_COLUMNS] = {
+    "seq", "tick", "position", "error", "diff_error", "sum_error", "duty", "vel_counts"
+};
+
+static FILE *g_psColumns;                           // Columnar output, NULL for CSV
+static int32_t g_ppi32Block[DEC_COLUMNS][DEC_BLOCK_ROWS];   // Rows waiting for the columnar file
+static uint32_t g_ui32BlockRows;                    // Rows in g_ppi32Block
+static volatile sig_atomic_t g_bStop;               // Set by Ctrl-C
+
+typedef struct {
+    bool bOn;                                       // Records are checked instead of written
+    tProtoParser sParser;                           // Parser of the bytes sent by TELEM_stream.c
+    tDecoder sDec;                                  // Decoder of the frames
+    uint32_t ui32Records;                           // Records checked
+    uint32_t ui32Bad;                               // Records with the wrong tick or sequence
+    int64_t i64LastSeq;                             // Sequence number of the last record checked
+} tDecTest;
+
+static tDecTest g_sTest;                            // State of -t
+
+/* -----------------------      Function Definition     --------------------- */
+// Function to stop reading at the next byte
+static void DEC_stop(int iSignal){
+    (void)iSignal;
+    g_bStop = 1;
+}
+
+// Function to open the input, a serial port is set to raw mode at 115200 baud
+static int DEC_open(const char *pcPath){
+    struct termios sTio;
+    int iFd = (strcmp(pcPath, "-") == 0) ? STDIN_FILENO : open(pcPath, O_RDONLY | O_NOCTTY);
+
+    if (iFd < 0){
+        perror(pcPath);
+        return -1;
+    }
+    if (isatty(iFd) && tcgetattr(iFd, &sTio) == 0){
+        cfmakeraw(&sTio);
+        cfsetispeed(&sTio, B115200);
+        sTio.c_cflag |= CLOCAL | CREAD;
+        tcsetattr(iFd, TCSANOW, &sTio);
+        tcflush(iFd, TCIFLUSH);
+    }
+    return iFd;
+}
+
+// Function to write the rows of the block to the columnar file
+static void DEC_flush(void){
+    uint32_t ui32Col, ui32Row;
+    uint8_t pui8Word[4];
+
+    if (!g_ui32BlockRows) return;
+    PROTO_putU32(pui8Word, g_ui32BlockRows);
+    fwrite(pui8Word, 4, 1, g_psColumns);
+    for (ui32Col = 0; ui32Col < DEC_COLUMNS; ui32Col++)
+        for (ui32Row = 0; ui32Row < g_ui32BlockRows; ui32Row++){
+            PROTO_putU32(pui8Word, (uint32_t)g_ppi32Block[ui32Col][ui32Row]);
+            fwrite(pui8Word, 4, 1, g_psColumns);
+        }
+    g_ui32BlockRows = 0;
+}
+
+// Function to write the header of the columnar file
+static void DEC_header(void){
+    uint8_t pui8Head[8] = {'T', 'L', 'M', '1'};
+    char pcName[16];
+    uint32_t ui32Col;
+
+    PROTO_putU16(pui8Head + 4, DEC_COLUMNS);
+    PROTO_putU16(pui8Head + 6, 1 << VEL_INT_FREQ);
+    fwrite(pui8Head, sizeof(pui8Head), 1, g_psColumns);
+    for (ui32Col = 0; ui32Col < DEC_COLUMNS; ui32Col++){
+        memset(pcName, 0, sizeof(pcName));
+        strncpy(pcName, g_ppcColumns[ui32Col], sizeof(pcName) - 1);
+        fwrite(pcName, sizeof(pcName), 1, g_psColumns);
+    }
+}
+
+// Function to output one record
+static void DEC_record(const int32_t *pi32Row){
+    uint32_t ui32Col;
+
+    // The position of a -t record is 3 times its tick and the error the low 15 bits of it
+    if (g_sTest.bOn){
+        if (pi32Row[2] != (int32_t)(3 * (uint32_t)pi32Row[1]) || pi32Row[3] != (pi32Row[1] & 0x7FFF) ||
+            pi32Row[0] <= g_sTest.i64LastSeq){
+            if (g_sTest.ui32Bad++ < 10)
+                fprintf(stderr, "record seq %d tick %d has position %d error %d\n", pi32Row[0], pi32Row[1],
+                        pi32Row[2], pi32Row[3]);
+        }
+        g_sTest.i64LastSeq = pi32Row[0];
+        g_sTest.ui32Records++;
+        return;
+    }
+
+    if (g_psColumns){
+        for (ui32Col = 0; ui32Col < DEC_COLUMNS; ui32Col++)
+            g_ppi32Block[ui32Col][g_ui32BlockRows] = pi32Row[ui32Col];
+        if (++g_ui32BlockRows == DEC_BLOCK_ROWS) DEC_flush();
+        return;
+    }
+    // RPM at the gearbox output from the count of one 1/2^VEL_INT_FREQ s period
+    printf("%d,%.3f,%d,%d,%d,%d,%d,%d,%d\n", pi32Row[0], 1000.0 * pi32Row[1] / (1 << VEL_INT_FREQ),
+           pi32Row[2], pi32Row[3], pi32Row[4], pi32Row[5], pi32Row[6], pi32Row[7],
+           (pi32Row[7] << VEL_INT_FREQ) * 60 / QEI1_CPR);
+}
+
+// Function to decode a PROTO_TELEM_DATA frame
+static void DEC_frame(tDecoder *psDec, const tProtoFrame *psFrame){
+    const uint8_t *pui8Data = psFrame->pui8Payload;
+    uint16_t ui16Seq = PROTO_getU16(pui8Data);
+    uint16_t ui16Decim = PROTO_getU16(pui8Data + 2);
+    uint32_t ui32Tick = PROTO_getU32(pui8Data + 4);
+    int32_t pi32Row[DEC_COLUMNS];
+    uint32_t ui32Rec;
+
+    if (psFrame->ui8Type != PROTO_TELEM_DATA || psFrame->ui8Len != PROTO_TELEM_PAYLOAD){
+        psDec->ui32Other++;
+        return;
+    }
+
+    // Records between the expected and the received sequence number were lost
+    uint16_t ui16Skip = psDec->bStarted ? (uint16_t)(ui16Seq - psDec->ui16Seq) : 0;
+    if (ui16Skip){
+        psDec->ui32Gaps++;
+        psDec->ui32Lost += ui16Skip;
+        if (!g_sTest.bOn)
+            fprintf(stderr, "gap of %u records before sequence %lld\n", ui16Skip, (long long)(psDec->i64Seq + ui16Skip));
+    }
+    // The 32 bit tick of the header is unwrapped against the previous frame
+    psDec->i64Tick = psDec->bStarted ? psDec->i64Tick + (uint32_t)(ui32Tick - psDec->ui32Tick) : ui32Tick;
+    psDec->ui32Tick = ui32Tick;
+    psDec->bStarted = true;
+    psDec->i64Seq += ui16Skip;
+
+    pi32Row[2] = (int32_t)PROTO_getU32(pui8Data + 8);
+    for (ui32Rec = 0; ui32Rec < PROTO_TELEM_BATCH; ui32Rec++){
+        const uint8_t *pui8Rec = pui8Data + PROTO_TELEM_HEADER + ui32Rec * PROTO_TELEM_RECORD;
+        pi32Row[0] = (int32_t)psDec->i64Seq++;
+        pi32Row[1] = (int32_t)(psDec->i64Tick + (int64_t)ui32Rec * ui16Decim);
+        pi32Row[2] += (int16_t)PROTO_getU16(pui8Rec);
+        pi32Row[3] = (int16_t)PROTO_getU16(pui8Rec + 2);
+        pi32Row[4] = (int8_t)pui8Rec[4];
+        pi32Row[5] = (int16_t)PROTO_getU16(pui8Rec + 5);
+        pi32Row[6] = (int8_t)pui8Rec[7];
+        pi32Row[7] = (int8_t)pui8Rec[8];
+        DEC_record(pi32Row);
+    }
+    psDec->ui16Seq = (uint16_t)(ui16Seq + PROTO_TELEM_BATCH);
+    psDec->ui32Frames++;
+}
+
+// Function to decode a byte sent by the UART0 of -t
+static void DEC_testByte(uint8_t ui8Byte){
+    if (PROTO_parse(&g_sTest.sParser, ui8Byte))
+        DEC_frame(&g_sTest.sDec, &g_sTest.sParser.sFrame);
+}
+
+// Function of one QEI1 tick of -t: a record, the bytes the link takes and the refill of the TX FIFO
+static void DEC_testTick(tTelemStream *psTelem, uint32_t ui32Drain){
+    uint32_t ui32Tick = psTelem->ui32Tick + 1;
+
+    TELEM_sample(psTelem, (int32_t)(3 * ui32Tick), (int32_t)(ui32Tick & 0x7FFF), 0, 0, 0, 0);
+    HOST_uartTxDrain(ui32Drain);
+    TELEM_txFill(psTelem);
+}
+
+// Function to stream ui32Ticks QEI1 ticks of records through TELEM_stream.c and check the decoded ones
+static int DEC_test(uint32_t ui32Ticks){
+    static const uint16_t pui16Decim[] = {1, 2, 3, 7, 0};
+    static tTelemStream sTelem;
+    uint8_t pui8Reply[PROTO_MAX_FRAME];
+    uint32_t ui32Seed = 2463534242UL;
+    uint32_t ui32Tick, ui32Replies = 0;
+
+    memset(&g_sTest, 0, sizeof(g_sTest));
+    g_sTest.bOn = true;
+    g_sTest.i64LastSeq = -1;
+    PROTO_parserInit(&g_sTest.sParser);
+    memset(&g_sHost, 0, sizeof(g_sHost));
+    g_sHost.pfnUartTx = DEC_testByte;
+    TELEM_init(&sTelem);
+
+    // The link takes 0 to DEC_TEST_DRAIN bytes per tick, the records of decimation 1 need 9
+    for (ui32Tick = 0; ui32Tick < ui32Ticks; ui32Tick++){
+        if (ui32Tick % DEC_TEST_PERIOD == 0)
+            TELEM_start(&sTelem, pui16Decim[(ui32Tick / DEC_TEST_PERIOD) % 5]);
+        ui32Seed ^= ui32Seed << 13; ui32Seed ^= ui32Seed >> 17; ui32Seed ^= ui32Seed << 5;
+        if ((ui32Seed >> 8) % 512 == 0 && TELEM_reply(&sTelem, pui8Reply, PROTO_encode(PROTO_GET_STATE | PROTO_REPLY,
+                                                                                         pui8Reply, 1, pui8Reply)))
+            ui32Replies++;
+        DEC_testTick(&sTelem, ui32Seed % (DEC_TEST_DRAIN + 1));
+    }
+
+    // A last batch on a fast link puts every drop before a frame, then the stream stops and drains
+    TELEM_start(&sTelem, 1);
+    for (ui32Tick = 0; ui32Tick < 4 * PROTO_TELEM_BATCH; ui32Tick++)
+        DEC_testTick(&sTelem, HOST_UART_FIFO);
+    uint32_t ui32Dropped = sTelem.ui32Dropped;
+    TELEM_start(&sTelem, 0);
+    for (ui32Tick = 0; ui32Tick < TELEM_RING * PROTO_TELEM_RECORD; ui32Tick++)
+        DEC_testTick(&sTelem, HOST_UART_FIFO);
+
+    bool bOk = g_sTest.ui32Bad == 0 && g_sTest.sDec.ui32Frames == sTelem.ui32Frames &&
+               g_sTest.sDec.ui32Lost == ui32Dropped && g_sTest.sDec.ui32Other == ui32Replies &&
+               ui32Dropped > 0 && g_sTest.sParser.ui32CrcErrors == 0;
+    printf("ticks,frames,records,bad,dropped,lost,gaps,replies,result\n");
+    printf("%u,%u,%u,%u,%u,%u,%u,%u,%s\n", ui32Ticks, g_sTest.sDec.ui32Frames, g_sTest.ui32Records,
+           g_sTest.ui32Bad, ui32Dropped, g_sTest.sDec.ui32Lost, g_sTest.sDec.ui32Gaps, g_sTest.sDec.ui32Other,
+           bOk ? "ok" : "failed");
+    return bOk ? 0 : 1;
+}
+
+/* -----------------------          Main Program        --------------------- */
+int main(int argc, char *argv[]){
+    const char *pcColumns = NULL;
+    tProtoParser sParser;
+    tDecoder sDec;
+    uint8_t pui8Buf[4096];
+    struct sigaction sAction;
+    ssize_t iRead;
+    int iOpt;
+
+    while ((iOpt = getopt(argc, argv, "b:t:")) != -1){
+        if (iOpt == 't') return DEC_test((uint32_t)strtoul(optarg, NULL, 0));
+        if (iOpt != 'b') break;
+        pcColumns = optarg;
+    }
+    if (optind != argc - 1){
+        fprintf(stderr, "usage: %s [-b columns.tlm] <port|file|-> | -t ticks\n", argv[0]);
+        return 1;
+    }
+
+    int iFd = DEC_open(argv[optind]);
+    if (iFd < 0) return 1;
+    if (pcColumns){
+        g_psColumns = fopen(pcColumns, "wb");
+        if (!g_psColumns){
+            perror(pcColumns);
+            return 1;
+        }
+        DEC_header();
+    }
+    else
+        printf("seq,t_ms,position,error,diff_error,sum_error,duty,vel_counts,rpm\n");
+
+    // Ctrl-C interrupts read() so that the output is completed
+    memset(&sAction, 0, sizeof(sAction));
+    sAction.sa_handler = DEC_stop;
+    sigaction(SIGINT, &sAction, NULL);
+
+    memset(&sDec, 0, sizeof(sDec));
+    PROTO_parserInit(&sParser);
+    while (!g_bStop && (iRead = read(iFd, pui8Buf, sizeof(pui8Buf))) > 0){
+        ssize_t iIndex;
+        for (iIndex = 0; iIndex < iRead; iIndex++)
+            if (PROTO_parse(&sParser, pui8Buf[iIndex]))
+                DEC_frame(&sDec, &sParser.sFrame);
+    }
+
+    if (g_psColumns){
+        DEC_flush();
+        fclose(g_psColumns);
+    }
+    fflush(stdout);
+    fprintf(stderr, "%u frames, %u records, %u gaps (%u records lost), %u other frames, %u CRC errors\n",
+            sDec.ui32Frames, sDec.ui32Frames * PROTO_TELEM_BATCH, sDec.ui32Gaps, sDec.ui32Lost,
+            sDec.ui32Other, sParser.ui32CrcErrors);
+    return 0;
+}
@@ -0,0 +1,290 @@
+/*!
+ * @author      Yash Bansod
+ * @date        17th October 2026
+ *
+ * @brief       Host report of the interrupt load of the GP Timer PWM modes against frequency
+ * @details     The program simulates, cycle by cycle of an 80 MHz CPU, the three ways the
+ *              PWM using GP Timer project can drive an LED and reports for each PWM
+ *              frequency the interrupts per second, the CPU load they take and the period
+ *              and duty cycle the pin gets:
+ *              former  the Timer0 handler of the project before TPWM_config.c: it reads the
+ *                      pin back, toggles it and writes the next time with TimerLoadSet,
+ *                      which restarts the counter, so every edge is late by the interrupt
+ *                      latency and the handler time and the period grows by both.
+ *              soft    TPWM_softIntHandler() of a channel without CCP: the pin state is
+ *                      kept in RAM and the time after the next one is written, taken by
+ *                      the timer at its timeout, so the edges only move with the latency.
+ *              timer   a channel in the native PWM mode of its timer half: no interrupt,
+ *                      the timer drives the pin and only a duty update takes the CPU.
+ *              The CPU also serves another interrupt (UART0 say) at the same priority,
+ *              arriving at random at the rate of -r and running -j cycles; the NVIC takes
+ *              it first when both are pending. A timeout that finds the PWM interrupt
+ *              still pending is lost, and the pin then runs out of phase. The latencies
+ *              and handler times are estimates for the DriverLib builds of the handlers;
+ *              measure them with the DWT cycle counter and pass them with the options.
+ *              Rows where the load passes 100 % or timeouts are lost show where the soft
+ *              modes stop working.
+ *
+ * @note        Build and run from this folder:
+ *              gcc -O2 -Wall -Wextra TPWM_load.c -o TPWM_load -lm
+ *              ./TPWM_load
+ *              ./TPWM_load -D 10 -j 400 -r 20000
+ * @file        TPWM_load.c
+ */
+/* -----------------------          Include Files       --------------------- */
+#include <stdio.h>                          // Library for Standard I/O
+#include <stdlib.h>                         // Standard Library
+#include <stdint.h>                         // Library of Standard Integer Types
+#include <stdbool.h>                        // Library of Standard Boolean Types
+#include <math.h>                           // Library for log
+#include <unistd.h>                         // Library for getopt
+
+/* -----------------------      Macro Definitions       --------------------- */
+#define LOAD_CLOCK_HZ       80000000                // Macro for the system clock of the project
+#define LOAD_TAIL_CHAIN     6                       // Macro for the cycles of a tail chained entry
+#define LOAD_NEVER          INT64_MAX               // Macro for an event that is not scheduled
+#define LOAD_SKIP           2                       // Macro for the periods skipped before measuring
+
+/* -----------------------      Global Variables        --------------------- */
+typedef struct {
+    const char *pcName;                             // Name of the mode in the report
+    uint32_t ui32Handler;                           // Cycles of the handler from its first instruction
+    uint32_t ui32PinAt;                             // Cycle of the handler writing the pin
+    uint32_t ui32LoadAt;                            // Cycle of the handler writing the timer load
+    bool bRestart;                                  // The load write restarts the counter
+    bool bPrescale;                                 // The times count ticks of the 16 bit prescaler
+} tLoadIsr;
+
+typedef struct {
+    double f64IrqPerSec;                            // PWM interrupts per second
+    double f64LoadPct;                              // CPU load of the PWM in %
+    double f64PeriodErrPct;                         // Error of the mean period in %
+    double f64DutyErrMean;                          // Mean error of the duty in percentage points
+    double f64DutyErrMax;                           // Largest error of the duty in percentage points
+    int64_t i64Jitter;                              // Longest less shortest period in cycles
+    uint32_t ui32Lost;                              // Timeouts lost while the interrupt was pending
+} tLoadResult;
+
+static uint32_t g_ui32Entry = 12;                   // Cycles from the interrupt to the first instruction
+static uint32_t g_ui32Exit = 10;                    // Cycles of the exception return
+static uint32_t g_ui32Duty = 50;                    // Duty of the simulated LED in %
+static uint32_t g_ui32Periods = 1000;               // PWM periods simulated per frequency
+static uint32_t g_ui32OtherCycles = 200;            // Cycles of the other interrupt, 0 for none
+static uint32_t g_ui32OtherHz = 5000;               // Mean rate of the other interrupt
+static uint32_t g_ui32Updates = 10;                 // Duty updates per second of the timer mode
+static uint32_t g_ui32UpdateCycles = 120;           // Cycles of TPWM_set() in the timer mode
+
+static tLoadIsr g_sFormer = {"former", 110, 64, 100, true, false};  // Timer0IntHandler before TPWM_config.c
+static tLoadIsr g_sSoft = {"soft", 70, 38, 62, false, true};        // TPWM_softIntHandler()
+
+static const uint32_t pui32Hz[] = {50, 128, 500, 1000, 2000, 5000, 10000, 20000, 50000, 100000, 200000, 400000};
+
+/* -----------------------      Function Definition     --------------------- */
+// Function to get the cycles to the next arrival of the other interrupt
+static int64_t LOAD_nextOther(void){
+    double f64Uniform = (rand() + 1.0) / (RAND_MAX + 2.0);
+    return (int64_t)(-log(f64Uniform) * LOAD_CLOCK_HZ / g_ui32OtherHz) + 1;
+}
+
+// Function to simulate a soft PWM mode at one frequency
+static void LOAD_soft(const tLoadIsr *psIsr, uint32_t ui32Hz, tLoadResult *psRes){
+    int64_t i64Period = LOAD_CLOCK_HZ / ui32Hz, i64Tick = 1, i64On, i64Off;
+    int64_t i64End, i64Now = 0, i64Timeout, i64Other, i64Pin = LOAD_NEVER, i64Load = LOAD_NEVER;
+    int64_t i64JobEnd = LOAD_NEVER, i64Idle = 0, i64Busy = 0, i64Ilr;
+    uint32_t ui32Edges = 0, ui32MaxEdges = g_ui32Periods * 4 + 16, ui32Irqs = 0, ui32OtherPending = 0;
+    bool bPwmPending = false, bHigh = true, bPwmJob = false, bJob = false;
+    int64_t *pi64Edge = malloc(ui32MaxEdges * sizeof(int64_t));
+    bool *pbLevel = malloc(ui32MaxEdges * sizeof(bool));
+
+    // The intervals of TPWM_config.c count prescaled ticks, the former handler used the 32 bit timer
+    if (psIsr->bPrescale)
+        i64Tick = ((i64Period - 1) >> 16) + 1;
+    i64On = (i64Period / i64Tick) * g_ui32Duty / 100 * i64Tick;
+    i64Off = (i64Period / i64Tick) * i64Tick - i64On;
+    i64End = i64Period * g_ui32Periods;
+
+    // The pin starts high with the On time in the counter and the Off time loaded for the next
+    pi64Edge[ui32Edges] = 0; pbLevel[ui32Edges++] = true;
+    i64Timeout = i64On;
+    i64Ilr = psIsr->bRestart ? i64On : i64Off;
+    i64Other = g_ui32OtherCycles ? LOAD_nextOther() : LOAD_NEVER;
+    psRes->ui32Lost = 0;
+
+    while (i64Now < i64End){
+        int64_t i64Next = i64Timeout;
+        if (i64Other < i64Next) i64Next = i64Other;
+        if (i64Pin < i64Next) i64Next = i64Pin;
+        if (i64Load < i64Next) i64Next = i64Load;
+        if (bJob && i64JobEnd < i64Next) i64Next = i64JobEnd;
+        if (!bJob && (bPwmPending || ui32OtherPending) && i64Idle > i64Now && i64Idle < i64Next) i64Next = i64Idle;
+        i64Now = i64Next;
+
+        if (i64Now == i64Pin){
+            // The handler writes the pin
+            bHigh = !bHigh;
+            if (ui32Edges < ui32MaxEdges){
+                pi64Edge[ui32Edges] = i64Now; pbLevel[ui32Edges++] = bHigh;
+            }
+            i64Pin = LOAD_NEVER;
+        } else if (i64Now == i64Load){
+            // The handler writes the time of the state it set, or of the state after it
+            if (psIsr->bRestart){
+                i64Ilr = bHigh ? i64On : i64Off;
+                i64Timeout = i64Now + i64Ilr;
+            } else
+                i64Ilr = bHigh ? i64Off : i64On;
+            i64Load = LOAD_NEVER;
+        } else if (i64Now == i64Timeout){
+            // The counter reloads with the last written time and raises the interrupt
+            if (bPwmPending) psRes->ui32Lost++;
+            bPwmPending = true;
+            i64Timeout = i64Now + i64Ilr;
+        } else if (i64Now == i64Other){
+            ui32OtherPending++;
+            i64Other = i64Now + LOAD_nextOther();
+        } else if (bJob && i64Now == i64JobEnd){
+            // A pending interrupt is tail chained (i64Idle -1), else the exception returns
+            bJob = false;
+            if (bPwmPending || ui32OtherPending)
+                i64Idle = -1;
+            else{
+                i64Idle = i64Now + g_ui32Exit;
+                if (bPwmJob) i64Busy += g_ui32Exit;
+            }
+        }
+
+        // Start the next handler when the CPU is free, the other interrupt first
+        if (!bJob && (bPwmPending || ui32OtherPending) && i64Now >= i64Idle){
+            uint32_t ui32Latency = (i64Idle < 0) ? LOAD_TAIL_CHAIN : g_ui32Entry;
+            int64_t i64Start = i64Now + ui32Latency;
+            bJob = true;
+            if (ui32OtherPending){
+                ui32OtherPending--;
+                bPwmJob = false;
+                i64JobEnd = i64Start + g_ui32OtherCycles;
+            } else{
+                bPwmPending = false;
+                bPwmJob = true;
+                ui32Irqs++;
+                i64Pin = i64Start + psIsr->ui32PinAt;
+                i64Load = i64Start + psIsr->ui32LoadAt;
+                i64JobEnd = i64Start + psIsr->ui32Handler;
+                i64Busy += ui32Latency + psIsr->ui32Handler;
+            }
+        }
+    }
+
+    // Measure the periods between rising edges and the high time in each
+    {
+        uint32_t ui32Index, ui32Rise = 0, ui32Periods = 0, ui32Seen = 0;
+        int64_t i64Min = LOAD_NEVER, i64Max = 0, i64Sum = 0, i64Fall = -1;
+        double f64ErrSum = 0, f64ErrMax = 0;
+
+        for (ui32Index = 1; ui32Index < ui32Edges; ui32Index++){
+            if (!pbLevel[ui32Index]){
+                if (pbLevel[ui32Index - 1]) i64Fall = pi64Edge[ui32Index];
+                continue;
+            }
+            if (pbLevel[ui32Index - 1] || i64Fall < 0){
+                ui32Rise = ui32Index;
+                continue;
+            }
+            if (ui32Seen++ >= LOAD_SKIP){
+                int64_t i64Length = pi64Edge[ui32Index] - pi64Edge[ui32Rise];
+                double f64Err = fabs(100.0 * (i64Fall - pi64Edge[ui32Rise]) / i64Length - g_ui32Duty);
+                if (i64Length < i64Min) i64Min = i64Length;
+                if (i64Length > i64Max) i64Max = i64Length;
+                i64Sum += i64Length;
+                f64ErrSum += f64Err;
+                if (f64Err > f64ErrMax) f64ErrMax = f64Err;
+                ui32Periods++;
+            }
+            ui32Rise = ui32Index;
+            i64Fall = -1;
+        }
+        psRes->f64IrqPerSec = (double)ui32Irqs * LOAD_CLOCK_HZ / i64Now;
+        psRes->f64LoadPct = 100.0 * i64Busy / i64Now;
+        psRes->f64PeriodErrPct = ui32Periods ? 100.0 * ((double)i64Sum / ui32Periods - i64Period) / i64Period : 100;
+        psRes->f64DutyErrMean = ui32Periods ? f64ErrSum / ui32Periods : 100;
+        psRes->f64DutyErrMax = ui32Periods ? f64ErrMax : 100;
+        psRes->i64Jitter = ui32Periods ? i64Max - i64Min : 0;
+    }
+    free(pi64Edge);
+    free(pbLevel);
+}
+
+// Function to get the figures of the native timer PWM mode at one frequency
+static void LOAD_timer(uint32_t ui32Hz, tLoadResult *psRes){
+    int64_t i64Period = LOAD_CLOCK_HZ / ui32Hz;
+    int64_t i64Width = i64Period * g_ui32Duty / 100;
+
+    // The pin is high from the reload to the match, with the duty of TPWM_set() to one count
+    psRes->f64IrqPerSec = 0;
+    psRes->f64LoadPct = 100.0 * g_ui32Updates * (g_ui32Entry + g_ui32UpdateCycles + g_ui32Exit) / LOAD_CLOCK_HZ;
+    psRes->f64PeriodErrPct = 100.0 * (i64Period * (double)ui32Hz - LOAD_CLOCK_HZ) / LOAD_CLOCK_HZ;
+    psRes->f64DutyErrMean = fabs(100.0 * i64Width / i64Period - g_ui32Duty);
+    psRes->f64DutyErrMax = psRes->f64DutyErrMean;
+    psRes->i64Jitter = 0;
+    psRes->ui32Lost = 0;
+}
+
+// Function to print a row of the report
+static void LOAD_print(const char *pcName, uint32_t ui32Hz, const tLoadResult *psRes){
+    printf("%s,%u,%.0f,%.3f,%.3f,%.3f,%.3f,%lld,%u\n", pcName, ui32Hz, psRes->f64IrqPerSec, psRes->f64LoadPct,
+           psRes->f64PeriodErrPct, psRes->f64DutyErrMean, psRes->f64DutyErrMax, (long long)psRes->i64Jitter,
+           psRes->ui32Lost);
+}
+
+/* -----------------------          Main Program        --------------------- */
+int main(int argc, char *argv[]){
+    uint32_t ui32Index;
+    tLoadResult sRes;
+    int iOpt;
+
+    while ((iOpt = getopt(argc, argv, "D:n:e:x:j:r:o:s:u:d:")) != -1){
+        uint32_t ui32Value = (uint32_t)strtoul(optarg, NULL, 0);
+        switch (iOpt){
+        case 'D': g_ui32Duty = ui32Value; break;
+        case 'n': g_ui32Periods = ui32Value; break;
+        case 'e': g_ui32Entry = ui32Value; break;
+        case 'x': g_ui32Exit = ui32Value; break;
+        case 'j': g_ui32OtherCycles = ui32Value; break;
+        case 'r': g_ui32OtherHz = ui32Value; break;
+        case 'o': g_sFormer.ui32Handler = ui32Value; break;
+        case 's': g_sSoft.ui32Handler = ui32Value; break;
+        case 'u': g_ui32Updates = ui32Value; break;
+        case 'd': g_ui32UpdateCycles = ui32Value; break;
+        default:
+            printf("usage: %s [-D duty %%] [-n periods] [-e entry] [-x exit] [-j other cycles] [-r other Hz]\n"
+                   "       [-o former handler cycles] [-s soft handler cycles] [-u updates/s] [-d update cycles]\n",
+                   argv[0]);
+            return 1;
+        }
+    }
+    if (g_ui32Duty < 1 || g_ui32Duty > 99){
+        printf("the duty must be 1 to 99 %%, 0 and 100 %% drive the pin as a GPIO\n");
+        return 1;
+    }
+    if (g_ui32Periods < LOAD_SKIP + 2) g_ui32Periods = LOAD_SKIP + 2;
+    if (g_ui32OtherHz == 0) g_ui32OtherCycles = 0;
+    if (g_sFormer.ui32PinAt > g_sFormer.ui32Handler) g_sFormer.ui32PinAt = g_sFormer.ui32Handler;
+    if (g_sFormer.ui32LoadAt > g_sFormer.ui32Handler) g_sFormer.ui32LoadAt = g_sFormer.ui32Handler;
+    if (g_sSoft.ui32PinAt > g_sSoft.ui32Handler) g_sSoft.ui32PinAt = g_sSoft.ui32Handler;
+    if (g_sSoft.ui32LoadAt > g_sSoft.ui32Handler) g_sSoft.ui32LoadAt = g_sSoft.ui32Handler;
+
+    printf("# %u %% duty, entry %u, exit %u, former %u, soft %u cycles, other interrupt %u cycles at %u Hz\n",
+           g_ui32Duty, g_ui32Entry, g_ui32Exit, g_sFormer.ui32Handler, g_sSoft.ui32Handler, g_ui32OtherCycles,
+           g_ui32OtherHz);
+    printf("mode,pwm_hz,irq_per_s,cpu_load_pct,period_err_pct,duty_err_mean_pp,duty_err_max_pp,jitter_cycles,lost\n");
+    for (ui32Index = 0; ui32Index < sizeof(pui32Hz) / sizeof(pui32Hz[0]); ui32Index++){
+        srand(1);
+        LOAD_soft(&g_sFormer, pui32Hz[ui32Index], &sRes);
+        LOAD_print(g_sFormer.pcName, pui32Hz[ui32Index], &sRes);
+        srand(1);
+        LOAD_soft(&g_sSoft, pui32Hz[ui32Index], &sRes);
+        LOAD_print(g_sSoft.pcName, pui32Hz[ui32Index], &sRes);
+        LOAD_timer(pui32Hz[ui32Index], &sRes);
+        LOAD_print("timer", pui32Hz[ui32Index], &sRes);
+    }
+    return 0;
+}
@@ -0,0 +1,592 @@
+/*!
+ * @author      Yash Bansod
+ * @date        17th October 2026
+ *
+ * @brief       Host test of the buffered uartstdio (UART Stdio) against a register model of the UART
+ * @details     The program compiles the uartstdio.c of the project with UART_BUFFERED, and
+ *              with UART_DMA too in its second build, and runs it, UARTStdioIntHandler()
+ *              included, against the UART and uDMA channel of HOST_uart.c, a byte time
+ *              of the line at a time. The uDMA build thus runs the transfers chained by
+ *              UARTDMATransmit() from the rings in place, wrapped runs included. It
+ *              checks, byte for byte:
+ *              output  random UARTwrite(), UARTwriteRaw() and UARTprintf() calls paced
+ *                      against the line, the ring filling up at times, against the
+ *                      characters each call reports as taken with every LF sent as CR LF,
+ *                      the random bytes of UARTwriteRaw() as they are and all or none.
+ *              echo    typed lines with backspaces and CR, LF and CR LF ends against
+ *                      the echo of the handler and the lines UARTgets() returns.
+ *              mixed   typed characters and output at once: the echo and the output each
+ *                      in order on the line, every typed character read back by
+ *                      UARTgetc(), and no echo waiting longer than a FIFO, the
+ *                      receive timeout and, with UART_DMA, a transfer behind the output.
+ *              discard UARTFlushTx(true) in the middle of a block: the line sends a start
+ *                      of the block, then the next write whole.
+ *              binary  every byte value read back raw with UARTEchoSet(false), no echo.
+ *              The register model also counts a write to a full FIFO, a read of an
+ *              empty one, a uDMA transfer set up on a running channel or longer than
+ *              1024 bytes, a failed ASSERT and an interrupt that is never cleared; a
+ *              transfer longer than UART_DMA_SEGMENT_SIZE is a mismatch too. The exit
+ *              code is 1 on any of these or a mismatch.
+ *              Built without UART_BUFFERED, as the UART Stdio project is, it runs the
+ *              shell and the log of its main.c instead:
+ *              shell   commands typed into CMD_input() by the interrupt handler, which
+ *                      logs each character, while the main loop runs CMD_poll() and
+ *                      LOG_drain(UARTwriteRaw). UARTCharPut() waits a byte time for each
+ *                      byte and the handler takes the characters typed meanwhile, so it
+ *                      runs in the middle of the writes. Every record must go out whole
+ *                      and in order, no character may be lost, and the text of the shell
+ *                      must be the same as without the log.
+ *
+ * @note        Build and run from this folder:
+ *              gcc -O2 -Wall -Wextra -DHOST_SIM -DUART_BUFFERED -I. -I"../../TM4C123G LaunchPad UART Stdio/uartStdio"
+ *                  UART_check.c HOST_uart.c "../../TM4C123G LaunchPad UART Stdio/uartStdio/uartstdio.c"
+ *                  "../../TM4C123G LaunchPad UART Stdio/uartStdio/RING_spsc.c"
+ *                  "../../TM4C123G LaunchPad UART Stdio/uartStdio/FMT_num.c" -o UART_check
+ *              ./UART_check
+ *              ./UART_check -n 100000 -s 7
+ *              The uDMA build adds -DUART_DMA, and -DUART_DMA_SEGMENT_SIZE=16 to chain
+ *              many short transfers, with -o UART_check_dma.
+ *              The shell build leaves out -DUART_BUFFERED and HOST_uart.c, and adds
+ *              -I"../../TM4C123G LaunchPad UART Stdio" and the CMD_shell.c and LOG_defer.c
+ *              of uartStdio, with -o UART_check_shell.
+ * @file        UART_check.c
+ */
+/* -----------------------          Include Files       --------------------- */
+#include <stdio.h>                          // Library for Standard I/O
+#include <stdlib.h>                         // Standard Library
+#include <string.h>                         // Library for String functions
+#include <unistd.h>                         // Library for getopt
+#include "HOST_uart.h"
+#include "uartstdio.h"
+#ifndef UART_BUFFERED
+#include "CMD_shell.h"
+#include "LOG_defer.h"
+#endif
+
+/* -----------------------      Macro Definitions       --------------------- */
+#define CHECK_LINE_MAX      (1u << 24)              // Macro for the bytes captured from the line
+#define CHECK_MSG_MAX       300                     // Macro for the longest random write
+#define CHECK_GAP_MAX       320                     // Macro for the most byte times between writes
+#define CHECK_KEY_MAX       (CHECK_LINE_MAX / 64)   // Macro for the characters typed into the shell
+#define CHECK_KEY_GAP       256                     // Macro for the most byte times between two characters typed
+#ifdef UART_DMA
+#define CHECK_ECHO_BOUND    (HOST_UART_TIMEOUT + HOST_UART_FIFO + 2 + UART_DMA_SEGMENT_SIZE)   // Macro for the longest wait of an echo
+#else
+#define CHECK_ECHO_BOUND    (HOST_UART_TIMEOUT + HOST_UART_FIFO + 2)    // Macro for the longest wait of an echo
+#endif
+
+/* -----------------------      Global Variables        --------------------- */
+static char g_pcLine[CHECK_LINE_MAX];               // Bytes sent by the line
+static uint64_t g_pui64LineTime[CHECK_LINE_MAX];    // Byte time each byte was sent at
+static uint32_t g_ui32LineLen;                      // Bytes captured
+static char g_pcExpect[CHECK_LINE_MAX];             // Bytes the line should send
+static uint32_t g_ui32ExpectLen;                    // Bytes expected
+static uint64_t g_ui64Now;                          // Byte times run
+static uint32_t g_ui32Mismatches;                   // Failed checks
+#ifndef UART_BUFFERED
+static char g_pcKeys[CHECK_KEY_MAX];                // Characters typed into the shell
+static uint64_t g_pui64KeyAt[CHECK_KEY_MAX];        // Byte time each character arrives at
+static uint32_t g_ui32Keys;                         // Characters of the script
+static uint32_t g_ui32KeyNext;                      // Next character to arrive
+static uint32_t g_ui32KeysLost;                     // Characters the shell had no space for
+static bool g_bCheckLog;                            // The handler logs and the main loop drains
+static bool g_bCheckInIsr;                          // The interrupt handler is running
+#endif
+
+/* -----------------------      Function Definition     --------------------- */
+#ifdef UART_BUFFERED
+// Function of the UART of HOST_uart.h, capturing every byte the line sends
+void HOST_uartPut(unsigned char ucData){
+    if (g_ui32LineLen < CHECK_LINE_MAX){
+        g_pui64LineTime[g_ui32LineLen] = g_ui64Now;
+        g_pcLine[g_ui32LineLen++] = (char)ucData;
+    }
+}
+
+// Function to run the line for a number of byte times
+static void CHECK_run(uint32_t ui32Bytes){
+    while (ui32Bytes--){
+        g_ui64Now++;
+        HOST_uartRun(1);
+    }
+}
+
+// Function to run the line until the buffers and the FIFO are empty
+static void CHECK_drain(void){
+    uint32_t ui32Idle = 0;
+
+    // The FIFO is empty for a whole FIFO of byte times once nothing is left
+    while (ui32Idle < 2 * HOST_UART_FIFO){
+        ui32Idle = g_sHostUart.ui32TxCount ? 0 : ui32Idle + 1;
+        CHECK_run(1);
+    }
+}
+
+#else
+// Function of the interrupt handler of UART Stdio, which queues each character for the shell and logs it
+static void CHECK_isr(void){
+    char cChar;
+
+    // The handler does not interrupt itself
+    if (g_bCheckInIsr) return;
+    g_bCheckInIsr = true;
+    while (g_ui32KeyNext < g_ui32Keys && g_pui64KeyAt[g_ui32KeyNext] <= g_ui64Now){
+        cChar = g_pcKeys[g_ui32KeyNext++];
+        if (!CMD_input(cChar)) g_ui32KeysLost++;
+        if (g_bCheckLog) LOG2(LOG_RX, cChar, (uint8_t)cChar);
+    }
+    g_bCheckInIsr = false;
+}
+
+// Function of the UART of HOST_uart.h, capturing every byte the line sends. UARTCharPut() waits a
+// byte time for each byte, in which the interrupt handler takes the characters typed by then.
+void HOST_uartPut(unsigned char ucData){
+    if (g_ui32LineLen < CHECK_LINE_MAX){
+        g_pui64LineTime[g_ui32LineLen] = g_ui64Now;
+        g_pcLine[g_ui32LineLen++] = (char)ucData;
+    }
+    g_ui64Now++;
+    CHECK_isr();
+}
+
+// Function of the UART of HOST_uart.h for UARTgets(), which the shell does not call
+int32_t HOST_uartGet(void){
+    return -1;
+}
+#endif
+
+#ifdef UART_BUFFERED
+// Function to add the bytes the line sends for a text, every LF going out as CR LF
+static void CHECK_expect(const char *pcText, uint32_t ui32Len){
+    while (ui32Len--){
+        if (*pcText == '\n') g_pcExpect[g_ui32ExpectLen++] = '\r';
+        g_pcExpect[g_ui32ExpectLen++] = *pcText++;
+    }
+}
+
+// Function to start a phase with nothing captured and nothing expected
+static void CHECK_start(void){
+    g_ui32LineLen = 0;
+    g_ui32ExpectLen = 0;
+}
+#endif
+
+// Function to compare what the line sent to what was expected
+static void CHECK_compare(const char *pcPhase){
+    uint32_t ui32Idx;
+
+    for (ui32Idx = 0; ui32Idx < g_ui32LineLen && ui32Idx < g_ui32ExpectLen; ui32Idx++)
+        if (g_pcLine[ui32Idx] != g_pcExpect[ui32Idx]) break;
+    if (ui32Idx == g_ui32LineLen && ui32Idx == g_ui32ExpectLen) return;
+    g_ui32Mismatches++;
+    printf("%-8s line differs at byte %u of %u, %u expected\n", pcPhase, ui32Idx, g_ui32LineLen, g_ui32ExpectLen);
+}
+
+#ifdef UART_BUFFERED
+// Function to type characters at the line rate
+static void CHECK_type(const char *pcText){
+    while (*pcText){
+        HOST_uartFeed((uint8_t)*pcText++);
+        CHECK_run(1);
+    }
+    CHECK_run(2 * HOST_UART_TIMEOUT);
+}
+
+// Function to fill a random text of lowercase letters, digits, spaces and LFs
+static void CHECK_text(char *pcText, uint32_t ui32Len){
+    static const char pcChars[] = "abcdefghijklmnopqrstuvwxyz0123456789 ,.\n";
+
+    while (ui32Len--) *pcText++ = pcChars[rand() % (sizeof(pcChars) - 1)];
+}
+
+// Function of the output phase, random writes paced against the line
+static void CHECK_output(uint32_t ui32Writes){
+    char pcMsg[CHECK_MSG_MAX], pcNum[32];
+    uint32_t ui32Idx, ui32Byte, ui32Len, ui32Taken, ui32Full = 0;
+    uint64_t ui64Start = g_ui64Now, ui64Ints = g_sHostUart.ui64Ints;
+
+    CHECK_start();
+    for (ui32Idx = 0; ui32Idx < ui32Writes; ui32Idx++){
+        if (rand() % 4 == 0 && UARTTxBytesFree() > 64){
+            // UARTprintf() writes in pieces, so only while all of them fit
+            snprintf(pcNum, sizeof(pcNum), "%u,%x\n", ui32Idx, ui32Idx * 2654435761u);
+            UARTprintf("%u,%x\n", ui32Idx, ui32Idx * 2654435761u);
+            CHECK_expect(pcNum, strlen(pcNum));
+        }
+        else if (rand() % 4 == 0){
+            // UARTwriteRaw() sends every byte value as it is, the whole block or none of it
+            ui32Len = 1 + rand() % CHECK_MSG_MAX;
+            for (ui32Byte = 0; ui32Byte < ui32Len; ui32Byte++) pcMsg[ui32Byte] = (char)rand();
+            ui32Taken = UARTwriteRaw((const uint8_t *)pcMsg, ui32Len);
+            if (ui32Taken != ui32Len) ui32Full++;
+            if (ui32Taken != ui32Len && ui32Taken != 0){
+                g_ui32Mismatches++;
+                printf("%-8s UARTwriteRaw() took %u of %u bytes\n", "output", ui32Taken, ui32Len);
+            }
+            memcpy(g_pcExpect + g_ui32ExpectLen, pcMsg, ui32Taken);
+            g_ui32ExpectLen += ui32Taken;
+        }
+        else{
+            ui32Len = 1 + rand() % CHECK_MSG_MAX;
+            CHECK_text(pcMsg, ui32Len);
+            ui32Taken = UARTwrite(pcMsg, ui32Len);
+            if (ui32Taken != ui32Len) ui32Full++;
+            CHECK_expect(pcMsg, ui32Taken);
+        }
+        CHECK_run(rand() % CHECK_GAP_MAX);
+    }
+    CHECK_drain();
+    CHECK_compare("output");
+    printf("%-8s %u writes, %u bytes, %u writes cut by a full buffer, %.1f interrupts per 100 bytes, "
+           "line %.0f%% busy\n", "output", ui32Writes, g_ui32LineLen, ui32Full,
+           100.0 * (g_sHostUart.ui64Ints - ui64Ints) / (g_ui32LineLen ? g_ui32LineLen : 1),
+           100.0 * g_ui32LineLen / (double)(g_ui64Now - ui64Start));
+}
+
+// Function of the echo phase, typed lines against the echo and UARTgets()
+static void CHECK_echo(void){
+    static const struct {
+        const char *pcTyped;                        // Characters typed
+        const char *pcEcho;                         // Echo on the line
+        const char *pcGets;                         // Line of UARTgets()
+    } psCases[] = {
+        {"hello\r",             "hello\r\n\r",                  "hello"},
+        {"ab\bc\r\n",           "ab\b \bc\r\n\r",               "ac"},
+        {"lf only\n",           "lf only\r\n\r",                "lf only"},
+        {"\b\bx\r",             "x\r\n\r",                      "x"},
+        {"esc\x1b",             "esc\r\n\r",                    "esc"},
+        {"two\rlines\r",        "two\r\n\rlines\r\n\r",         "two"},
+        {"",                    "",                             "lines"},
+    };
+    char pcGot[64];
+    uint32_t ui32Idx;
+
+    for (ui32Idx = 0; ui32Idx < sizeof(psCases) / sizeof(psCases[0]); ui32Idx++){
+        CHECK_start();
+        CHECK_type(psCases[ui32Idx].pcTyped);
+        CHECK_drain();
+        memcpy(g_pcExpect, psCases[ui32Idx].pcEcho, strlen(psCases[ui32Idx].pcEcho));
+        g_ui32ExpectLen = strlen(psCases[ui32Idx].pcEcho);
+        CHECK_compare("echo");
+
+        if (UARTPeek('\r') < 0 && UARTPeek('\n') < 0 && UARTPeek(0x1b) < 0){
+            g_ui32Mismatches++;
+            printf("%-8s no line end received for case %u\n", "echo", ui32Idx);
+            continue;
+        }
+        UARTgets(pcGot, sizeof(pcGot));
+        if (strcmp(pcGot, psCases[ui32Idx].pcGets) != 0){
+            g_ui32Mismatches++;
+            printf("%-8s case %u read \"%s\", expected \"%s\"\n", "echo", ui32Idx, pcGot, psCases[ui32Idx].pcGets);
+        }
+    }
+
+    // A LF only ends no line of its own after a CR, the last case read the line its CR ended
+    UARTFlushRx();
+    printf("%-8s %u cases\n", "echo", (uint32_t)(sizeof(psCases) / sizeof(psCases[0])));
+}
+
+// Function of the mixed phase, typing while the output runs
+static void CHECK_mixed(uint32_t ui32Writes){
+    static char pcTyped[CHECK_LINE_MAX / 64], pcEcho[CHECK_LINE_MAX / 64];
+    static uint64_t pui64TypedAt[CHECK_LINE_MAX / 64];
+    char pcMsg[CHECK_MSG_MAX];
+    uint32_t ui32Idx, ui32Len, ui32Gap, ui32Typed = 0, ui32Read = 0, ui32Echoed = 0, ui32Out = 0;
+    uint64_t ui64Wait, ui64Worst = 0;
+    unsigned char ucChar;
+
+    CHECK_start();
+    for (ui32Idx = 0; ui32Idx < ui32Writes && ui32Typed < sizeof(pcTyped); ui32Idx++){
+        ui32Len = 1 + rand() % CHECK_MSG_MAX;
+        CHECK_text(pcMsg, ui32Len);
+        CHECK_expect(pcMsg, UARTwrite(pcMsg, ui32Len));
+
+        // Type uppercase letters now and then while the line runs, and read them back
+        for (ui32Gap = rand() % CHECK_GAP_MAX; ui32Gap; ui32Gap--){
+            if (rand() % 8 == 0 && ui32Typed < sizeof(pcTyped)){
+                pcTyped[ui32Typed] = 'A' + rand() % 26;
+                pui64TypedAt[ui32Typed] = g_ui64Now;
+                HOST_uartFeed((uint8_t)pcTyped[ui32Typed++]);
+            }
+            CHECK_run(1);
+            while (UARTRxBytesAvail()){
+                ucChar = UARTgetc();
+                if (ucChar != (unsigned char)pcTyped[ui32Read]){
+                    g_ui32Mismatches++;
+                    printf("%-8s typed byte %u read as 0x%02X\n", "mixed", ui32Read, ucChar);
+                }
+                ui32Read++;
+            }
+        }
+    }
+    CHECK_drain();
+    while (UARTRxBytesAvail()){
+        ucChar = UARTgetc();
+        if (ucChar != (unsigned char)pcTyped[ui32Read]) g_ui32Mismatches++;
+        ui32Read++;
+    }
+    if (ui32Read != ui32Typed){
+        g_ui32Mismatches++;
+        printf("%-8s %u bytes typed, %u read\n", "mixed", ui32Typed, ui32Read);
+    }
+
+    // Split the line into the echo, uppercase, and the output
+    for (ui32Idx = 0; ui32Idx < g_ui32LineLen; ui32Idx++){
+        if (g_pcLine[ui32Idx] >= 'A' && g_pcLine[ui32Idx] <= 'Z'){
+            if (ui32Echoed < ui32Typed){
+                ui64Wait = g_pui64LineTime[ui32Idx] - pui64TypedAt[ui32Echoed];
+                if (ui64Wait > ui64Worst) ui64Worst = ui64Wait;
+            }
+            pcEcho[ui32Echoed++] = g_pcLine[ui32Idx];
+        }
+        else g_pcLine[ui32Out++] = g_pcLine[ui32Idx];
+    }
+    g_ui32LineLen = ui32Out;
+    CHECK_compare("mixed");
+    if (ui32Echoed != ui32Typed || memcmp(pcEcho, pcTyped, ui32Typed) != 0){
+        g_ui32Mismatches++;
+        printf("%-8s %u bytes typed, %u echoed or out of order\n", "mixed", ui32Typed, ui32Echoed);
+    }
+    if (ui64Worst > CHECK_ECHO_BOUND){
+        g_ui32Mismatches++;
+        printf("%-8s an echo waited %llu byte times, over %u\n", "mixed", (unsigned long long)ui64Worst,
+               (uint32_t)CHECK_ECHO_BOUND);
+    }
+    printf("%-8s %u bytes typed and echoed among %u bytes of output, longest echo wait %llu byte times\n",
+           "mixed", ui32Typed, ui32Out, (unsigned long long)ui64Worst);
+}
+
+// Function of the discard phase, UARTFlushTx(true) in the middle of a block
+static void CHECK_discard(uint32_t ui32Rounds){
+    char pcBlock[600], pcMark[40];
+    uint32_t ui32Round, ui32Taken, ui32Sent, ui32Idx;
+
+    for (ui32Round = 0; ui32Round < ui32Rounds; ui32Round++){
+        CHECK_start();
+        CHECK_text(pcBlock, sizeof(pcBlock));
+        ui32Taken = UARTwrite(pcBlock, sizeof(pcBlock));
+        CHECK_run(rand() % 400);
+        UARTFlushTx(true);
+        snprintf(pcMark, sizeof(pcMark), "<mark %u>\n", ui32Round);
+        UARTwrite(pcMark, strlen(pcMark));
+        CHECK_drain();
+
+        // The line ends with the mark, after a start of the block
+        CHECK_expect(pcBlock, ui32Taken);
+        g_ui32ExpectLen = 0;
+        CHECK_expect(pcMark, strlen(pcMark));
+        ui32Sent = g_ui32LineLen - g_ui32ExpectLen;
+        if (g_ui32LineLen < g_ui32ExpectLen ||
+            memcmp(g_pcLine + ui32Sent, g_pcExpect, g_ui32ExpectLen) != 0){
+            g_ui32Mismatches++;
+            printf("%-8s round %u does not end with the mark\n", "discard", ui32Round);
+            continue;
+        }
+        g_ui32ExpectLen = 0;
+        CHECK_expect(pcBlock, ui32Taken);
+        for (ui32Idx = 0; ui32Idx < ui32Sent && ui32Idx < g_ui32ExpectLen; ui32Idx++)
+            if (g_pcLine[ui32Idx] != g_pcExpect[ui32Idx]) break;
+        if (ui32Idx != ui32Sent){
+            g_ui32Mismatches++;
+            printf("%-8s round %u sent %u bytes that are not a start of the block\n", "discard", ui32Round, ui32Sent);
+        }
+    }
+    printf("%-8s %u rounds\n", "discard", ui32Rounds);
+}
+
+// Function of the binary phase, every byte value read back raw without echo
+static void CHECK_binary(void){
+    uint32_t ui32Value;
+    unsigned char ucChar;
+
+    CHECK_start();
+    UARTEchoSet(false);
+    for (ui32Value = 0; ui32Value < 256; ui32Value++){
+        HOST_uartFeed((uint8_t)ui32Value);
+        CHECK_run(1);
+        while (UARTRxBytesAvail()){
+            ucChar = UARTgetc();
+            if (ucChar != (unsigned char)g_ui32ExpectLen){
+                g_ui32Mismatches++;
+                printf("%-8s byte %u read as 0x%02X\n", "binary", g_ui32ExpectLen, ucChar);
+            }
+            g_ui32ExpectLen++;
+        }
+    }
+    CHECK_run(2 * HOST_UART_TIMEOUT);
+    while (UARTRxBytesAvail()){
+        ucChar = UARTgetc();
+        if (ucChar != (unsigned char)g_ui32ExpectLen) g_ui32Mismatches++;
+        g_ui32ExpectLen++;
+    }
+    CHECK_drain();
+    if (g_ui32ExpectLen != 256 || g_ui32LineLen != 0){
+        g_ui32Mismatches++;
+        printf("%-8s %u of 256 bytes read, %u bytes echoed\n", "binary", g_ui32ExpectLen, g_ui32LineLen);
+    }
+    UARTEchoSet(true);
+    printf("%-8s 256 bytes\n", "binary");
+}
+
+#else
+// Commands of CMD_table.h, printing their words the way main.c answers
+static int32_t CHECK_cmd(const char *pcName, uint32_t ui32Argc, char *ppcArgv[]){
+    uint32_t ui32Idx;
+
+    UARTprintf("%s", pcName);
+    for (ui32Idx = 1; ui32Idx < ui32Argc; ui32Idx++) UARTprintf(" [%s]", ppcArgv[ui32Idx]);
+    UARTprintf("\n");
+    return (ui32Argc > 3) ? CMD_ERR_USAGE : CMD_OK;
+}
+int32_t Cmd_blink(uint32_t ui32Argc, char *ppcArgv[]){ return CHECK_cmd("blink", ui32Argc, ppcArgv); }
+int32_t Cmd_clock(uint32_t ui32Argc, char *ppcArgv[]){ return CHECK_cmd("clock", ui32Argc, ppcArgv); }
+int32_t Cmd_echo(uint32_t ui32Argc, char *ppcArgv[]){ return CHECK_cmd("echo", ui32Argc, ppcArgv); }
+int32_t Cmd_log(uint32_t ui32Argc, char *ppcArgv[]){ return CHECK_cmd("log", ui32Argc, ppcArgv); }
+
+// Function to run the main loop of UART Stdio over the script, the log records going out after the shell
+static void CHECK_shellRun(bool bLog){
+    uint32_t ui32Len;
+    bool bRan;
+
+    g_ui32LineLen = 0;
+    g_ui64Now = 0;
+    g_ui32KeyNext = 0;
+    g_ui32KeysLost = 0;
+    g_bCheckLog = bLog;
+    LOG_init();
+    CMD_init(UARTwrite);
+    while (1){
+        ui32Len = g_ui32LineLen;
+        bRan = CMD_poll();
+        if (bLog) LOG_drain(UARTwriteRaw);
+
+        // The loop spins a byte time when it has nothing to send
+        if (g_ui32LineLen == ui32Len && !bRan){
+            if (g_ui32KeyNext == g_ui32Keys) break;
+            g_ui64Now++;
+            CHECK_isr();
+        }
+    }
+}
+
+// Function of the shell phase, typing commands while the main loop sends the log records of the characters
+static void CHECK_shell(uint32_t ui32Lines){
+    static const char *ppcScript[] = {
+        "help\r", "clock\r", "echo one \"two three\"\r", "ec\tx y\r\n", "bl\t5\r", "log on\r",
+        "nothing here\r", "abc\b\b\x03", "\x1b[Aecho up\r", "e\t\t\x03", "echo a b c d\r",
+    };
+    static char pcText[CHECK_LINE_MAX];
+    uint8_t pui8Record[LOG_OVERHEAD + 8];
+    uint32_t ui32Line, ui32Idx, ui32Sum, ui32Text = 0, ui32Records = 0, ui32Cut = 0;
+    uint64_t ui64At = 0;
+    const char *pcKeys;
+
+    // The script, each character a random number of byte times after the last
+    g_ui32Keys = 0;
+    for (ui32Line = 0; ui32Line < ui32Lines; ui32Line++){
+        pcKeys = ppcScript[rand() % (sizeof(ppcScript) / sizeof(ppcScript[0]))];
+        if (g_ui32Keys + strlen(pcKeys) > CHECK_KEY_MAX) break;
+        for (; *pcKeys; pcKeys++){
+            ui64At += 1 + rand() % CHECK_KEY_GAP;
+            g_pui64KeyAt[g_ui32Keys] = ui64At;
+            g_pcKeys[g_ui32Keys++] = *pcKeys;
+        }
+    }
+
+    // With the log, every record is whole and in the order of the characters
+    CHECK_shellRun(true);
+    for (ui32Idx = 0; ui32Idx < g_ui32LineLen; ui32Idx++){
+        if ((uint8_t)g_pcLine[ui32Idx] != LOG_SOF){
+            pcText[ui32Text++] = g_pcLine[ui32Idx];
+            continue;
+        }
+        pui8Record[0] = LOG_SOF;
+        pui8Record[1] = (uint8_t)LOG_RX;
+        pui8Record[2] = (uint8_t)((LOG_RX >> 8) | (2 << (LOG_ARGS_SHIFT - 8)));
+        memset(pui8Record + 3, 0, 8);
+        if (ui32Records < g_ui32Keys){
+            pui8Record[3] = pui8Record[7] = (uint8_t)g_pcKeys[ui32Records];
+        }
+        for (ui32Sum = 0, ui32Line = 1; ui32Line < LOG_OVERHEAD + 7; ui32Line++) ui32Sum += pui8Record[ui32Line];
+        pui8Record[LOG_OVERHEAD + 7] = (uint8_t)~ui32Sum;
+        if (ui32Idx + sizeof(pui8Record) > g_ui32LineLen ||
+            memcmp(g_pcLine + ui32Idx, pui8Record, sizeof(pui8Record)) != 0){
+            if (ui32Cut++ == 0) printf("%-8s record %u is cut or out of order at byte %u\n", "shell", ui32Records, ui32Idx);
+            continue;
+        }
+        ui32Records++;
+        ui32Idx += sizeof(pui8Record) - 1;
+    }
+    if (ui32Cut || ui32Records != g_ui32Keys || LOG_dropped() || g_ui32KeysLost){
+        g_ui32Mismatches++;
+        printf("%-8s %u of %u records whole, %u cut, %u dropped, %u characters lost\n", "shell", ui32Records,
+               g_ui32Keys, ui32Cut, LOG_dropped(), g_ui32KeysLost);
+    }
+
+    // Without the log, the shell sends the same text
+    memcpy(g_pcExpect, pcText, ui32Text);
+    g_ui32ExpectLen = ui32Text;
+    CHECK_shellRun(false);
+    CHECK_compare("shell");
+    if (g_ui32KeysLost){
+        g_ui32Mismatches++;
+        printf("%-8s %u characters lost without the log\n", "shell", g_ui32KeysLost);
+    }
+    printf("%-8s %u characters typed, %u log records whole among %u bytes of shell text\n",
+           "shell", g_ui32Keys, ui32Records, ui32Text);
+}
+#endif
+
+/* -----------------------          Main Program        --------------------- */
+int main(int argc, char *argv[]){
+    uint32_t ui32Writes = 20000;
+    int iOpt;
+
+    while ((iOpt = getopt(argc, argv, "n:s:")) != -1){
+        switch (iOpt){
+        case 'n': ui32Writes = strtoul(optarg, NULL, 0); break;
+        case 's': srand(strtoul(optarg, NULL, 0)); break;
+        default:
+            fprintf(stderr, "usage: %s [-n writes] [-s seed]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (ui32Writes > CHECK_LINE_MAX / (2 * CHECK_MSG_MAX)) ui32Writes = CHECK_LINE_MAX / (2 * CHECK_MSG_MAX);
+
+#ifdef UART_BUFFERED
+    HOST_uartReset();
+    UARTStdioConfig(0, 115200, 80000000);
+    printf("buffered uartstdio, %u byte transmit, %u byte receive and %u byte echo buffers\n",
+           UART_TX_BUFFER_SIZE, UART_RX_BUFFER_SIZE, UART_ECHO_BUFFER_SIZE);
+#ifdef UART_DMA
+    printf("uDMA transmit, transfers of up to %u bytes\n", UART_DMA_SEGMENT_SIZE);
+#endif
+
+    CHECK_output(ui32Writes);
+    CHECK_echo();
+    CHECK_mixed(ui32Writes / 4);
+    CHECK_discard(200);
+    CHECK_binary();
+
+#ifdef UART_DMA
+    printf("uDMA     %llu transfers, %.1f bytes each, longest %u\n", (unsigned long long)g_sHostUart.ui64DmaSets,
+           (double)g_sHostUart.ui64Sent / (g_sHostUart.ui64DmaSets ? g_sHostUart.ui64DmaSets : 1),
+           g_sHostUart.ui32DmaMax);
+    if (g_sHostUart.ui32DmaMax > UART_DMA_SEGMENT_SIZE){
+        g_ui32Mismatches++;
+        printf("uDMA     a transfer is longer than UART_DMA_SEGMENT_SIZE\n");
+    }
+#endif
+    if (g_sHostUart.ui32Errors || g_sHostUart.ui32Asserts || g_sHostUart.ui32RxLost){
+        g_ui32Mismatches++;
+        printf("register model: %u misuses, %u failed ASSERTs, %u bytes lost by the receive FIFO\n",
+               g_sHostUart.ui32Errors, g_sHostUart.ui32Asserts, g_sHostUart.ui32RxLost);
+    }
+#else
+    UARTStdioConfig(0, 115200, 80000000);
+    printf("unbuffered uartstdio, the shell and log of UART Stdio, %u character queue\n", CMD_RX_SIZE);
+    CHECK_shell(ui32Writes);
+#endif
+    printf("%u mismatches\n", g_ui32Mismatches);
+    return g_ui32Mismatches ? 1 : 0;
+}
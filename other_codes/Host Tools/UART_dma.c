@@ -0,0 +1,322 @@
+/*!
+ * @author      Yash Bansod
+ * @date        17th October 2026
+ *
+ * @brief       Host simulation of the uDMA transmit path of uartstdio (UART Stdio) against its FIFO refill
+ * @details     The program models UART0 of an 80 MHz CPU, its 16 byte transmit FIFO and
+ *              shift register, and the uDMA transmit channel, and feeds them messages
+ *              written by UARTwrite() at a share of the line rate. The transmit buffer
+ *              is RING_spsc.c itself, so the bytes the line sends are checked against
+ *              the bytes UARTwrite() took. For each load it reports the interrupts per
+ *              second and the CPU cycles per byte sent of:
+ *              polled  UARTwrite() without UART_BUFFERED: UARTCharPut() spins on a full
+ *                      FIFO, so the CPU waits for the line.
+ *              fifo    UART_BUFFERED: the transmit interrupt at the 1/8 FIFO level copies
+ *                      the ring into the FIFO (UARTPrimeTransmit()).
+ *              dma-N   UART_BUFFERED and UART_DMA with UART_DMA_SEGMENT_SIZE N: bursts of 4
+ *                      bytes at the 4/8 FIFO level read the ring in place and the completion
+ *                      interrupt chains the next run (UARTDMATransmit()), a wrapped run
+ *                      going out in two transfers.
+ *              The copy into the ring by UARTwrite() is the same in every mode and is not
+ *              counted. The uDMA takes bus cycles, not CPU cycles, but stalls the CPU
+ *              when both reach for the bus at once; they are given apart as the worst
+ *              case. The cycle counts of the handlers are estimates for the DriverLib
+ *              builds; measure them with the DWT cycle counter and pass them with the
+ *              options. The exit code is 1 on a lost or corrupted byte. The transmit
+ *              paths here are models of the handlers; UART_check.c runs the handlers
+ *              of uartstdio.c themselves.
+ *
+ * @note        Build and run from this folder:
+ *              gcc -O2 -Wall -Wextra -I"../../TM4C123G LaunchPad UART Stdio/uartStdio"
+ *                  UART_dma.c "../../TM4C123G LaunchPad UART Stdio/uartStdio/RING_spsc.c"
+ *                  -o UART_dma
+ *              ./UART_dma
+ *              ./UART_dma -l 100 -m 200 -F 120
+ * @file        UART_dma.c
+ */
+/* -----------------------          Include Files       --------------------- */
+#include <stdio.h>                          // Library for Standard I/O
+#include <stdlib.h>                         // Standard Library
+#include <string.h>                         // Library for String functions
+#include <unistd.h>                         // Library for getopt
+#include "RING_spsc.h"
+
+/* -----------------------      Macro Definitions       --------------------- */
+#define SIM_CLOCK_HZ        80000000                // Macro for the system clock of the project
+#define SIM_RING_SIZE       1024                    // Macro for UART_TX_BUFFER_SIZE
+#define SIM_FIFO_SIZE       16                      // Macro for the entries of the transmit FIFO
+#define SIM_FIFO_TX1_8      2                       // Macro for the transmit interrupt level of the fifo mode
+#define SIM_FIFO_TX4_8      8                       // Macro for the burst request level of the dma modes
+#define SIM_BURST           4                       // Macro for UDMA_ARB_4
+#define SIM_MSG_MAX         1024                    // Macro for the longest message
+#define SIM_NEVER           INT64_MAX               // Macro for an event that is not scheduled
+#define SIM_BYTE(ui64N)     ((uint8_t)((ui64N) * 167 + ((ui64N) >> 8)))
+
+/* -----------------------      Global Variables        --------------------- */
+typedef enum {SIM_POLLED, SIM_FIFO, SIM_DMA} tSimMode;
+
+typedef struct {
+    const char *pcName;                             // Name of the mode in the report
+    tSimMode eMode;                                 // Transmit path
+    uint32_t ui32Segment;                           // UART_DMA_SEGMENT_SIZE of the dma modes
+} tSimRow;
+
+typedef struct {
+    tRing sRing;                                    // Transmit buffer of uartstdio
+    uint8_t pui8Store[SIM_RING_SIZE];               // Its storage
+    uint8_t pui8Fifo[SIM_FIFO_SIZE];                // Transmit FIFO
+    uint32_t ui32FifoHead, ui32Fifo;                // Oldest entry and entries of the FIFO
+    int64_t i64ShiftEnd;                            // End of the byte in the shift register
+    bool bPending;                                  // UART interrupt pending in the NVIC
+    bool bTxInt;                                    // Transmit interrupt enabled (fifo mode)
+    bool bIdle;                                     // g_bUARTTxIdle
+    bool bChannel;                                  // uDMA channel enabled
+    uint8_t *pui8Src;                               // Next byte read by the channel
+    uint32_t ui32Remain;                            // Bytes left of the transfer
+    uint32_t ui32Len;                               // g_ui32UARTDMALen
+    uint64_t ui64Pushed, ui64Sent;                  // Bytes taken by UARTwrite() and sent by the line
+    uint64_t ui64Errors, ui64Isrs, ui64Cpu, ui64Bus;
+} tSim;
+
+typedef struct {
+    double f64IsrPerSec;                            // UART interrupts per second
+    double f64CpuPerByte;                           // CPU cycles per byte sent
+    double f64BusPerByte;                           // uDMA bus cycles per byte sent
+    double f64LoadPct;                              // CPU load of the transmit path in %
+    uint64_t ui64Dropped;                           // Bytes UARTwrite() found no space for
+    uint64_t ui64Errors;                            // Bytes lost or out of sequence
+} tSimResult;
+
+static uint32_t g_ui32Baud = 115200;                // Bit rate of the console
+static uint32_t g_ui32Msg = 48;                     // Bytes per UARTwrite()
+static uint64_t g_ui64Total = 500000;               // Bytes offered per run
+static uint32_t g_ui32Entry = 12;                   // Cycles from the interrupt to the first instruction
+static uint32_t g_ui32Exit = 10;                    // Cycles of the exception return
+static uint32_t g_ui32FifoBase = 90;                // Cycles of the fifo handler besides the bytes
+static uint32_t g_ui32FifoByte = 9;                 // Cycles of the fifo handler per byte moved
+static uint32_t g_ui32DmaBase = 210;                // Cycles of the dma handler, chaining included
+static uint32_t g_ui32DmaBus = 2;                   // Bus cycles of the uDMA per byte (read and write)
+static uint32_t g_ui32PutByte = 24;                 // Cycles of UARTCharPut() besides the wait
+
+static const uint32_t pui32Load[] = {10, 50, 95};
+static const tSimRow psRows[] = {
+    {"polled", SIM_POLLED, 0}, {"fifo", SIM_FIFO, 0},
+    {"dma-16", SIM_DMA, 16}, {"dma-64", SIM_DMA, 64}, {"dma-256", SIM_DMA, 256}, {"dma-1024", SIM_DMA, 1024}
+};
+
+/* -----------------------      Function Definition     --------------------- */
+// Function to put a byte into the transmit FIFO
+static void SIM_fifoPut(tSim *psSim, uint8_t ui8Byte){
+    if (psSim->ui32Fifo == SIM_FIFO_SIZE){
+        psSim->ui64Errors++;                        // Overrun, the byte is lost
+        return;
+    }
+    psSim->pui8Fifo[(psSim->ui32FifoHead + psSim->ui32Fifo++) % SIM_FIFO_SIZE] = ui8Byte;
+}
+
+// Function of the fifo handler, as UARTPrimeTransmit() of uartstdio.c
+static void SIM_fifoIsr(tSim *psSim){
+    uint8_t pui8Fifo[SIM_FIFO_SIZE];
+    uint32_t ui32Idx, ui32Count;
+
+    ui32Count = RING_popN(&psSim->sRing, pui8Fifo, SIM_FIFO_SIZE - psSim->ui32Fifo);
+    for (ui32Idx = 0; ui32Idx < ui32Count; ui32Idx++)
+        SIM_fifoPut(psSim, pui8Fifo[ui32Idx]);
+    psSim->ui64Cpu += g_ui32FifoBase + (uint64_t)g_ui32FifoByte * ui32Count;
+    psSim->bIdle = RING_EMPTY(&psSim->sRing);
+    psSim->bTxInt = !psSim->bIdle;
+}
+
+// Function of the dma handler, as UARTDMATransmit() of uartstdio.c
+static void SIM_dmaIsr(tSim *psSim, uint32_t ui32Segment){
+    uint8_t *pui8Seg;
+    uint32_t ui32Len;
+
+    psSim->ui64Cpu += g_ui32DmaBase;
+    if (psSim->ui32Len != 0){
+        if (psSim->bChannel) return;
+        RING_skip(&psSim->sRing, psSim->ui32Len);
+        psSim->ui32Len = 0;
+    }
+    ui32Len = RING_span(&psSim->sRing, &pui8Seg);
+    if (ui32Len == 0){
+        psSim->bIdle = true;
+        return;
+    }
+    if (ui32Len > ui32Segment) ui32Len = ui32Segment;
+    psSim->ui32Len = ui32Len;
+    psSim->bIdle = false;
+    psSim->pui8Src = pui8Seg;
+    psSim->ui32Remain = ui32Len;
+    psSim->bChannel = true;
+}
+
+// Function to run the hardware and the handler until nothing changes at the current time
+static void SIM_settle(tSim *psSim, const tSimRow *psRow, int64_t i64Now, int64_t i64Byte){
+    bool bChange = true;
+
+    while (bChange){
+        bChange = false;
+
+        // The shift register takes the oldest byte, the line checks it
+        if (psSim->i64ShiftEnd == SIM_NEVER && psSim->ui32Fifo){
+            uint8_t ui8Byte = psSim->pui8Fifo[psSim->ui32FifoHead];
+
+            psSim->ui32FifoHead = (psSim->ui32FifoHead + 1) % SIM_FIFO_SIZE;
+            psSim->ui32Fifo--;
+            if (ui8Byte != SIM_BYTE(psSim->ui64Sent)) psSim->ui64Errors++;
+            psSim->ui64Sent++;
+            psSim->i64ShiftEnd = i64Now + i64Byte;
+            if (psSim->ui32Fifo == SIM_FIFO_TX1_8 && psSim->bTxInt) psSim->bPending = true;
+            bChange = true;
+        }
+
+        // The channel answers the burst requests of the FIFO
+        if (psSim->bChannel && psSim->ui32Fifo <= SIM_FIFO_TX4_8){
+            uint32_t ui32Burst = psSim->ui32Remain < SIM_BURST ? psSim->ui32Remain : SIM_BURST;
+
+            psSim->ui32Remain -= ui32Burst;
+            psSim->ui64Bus += (uint64_t)g_ui32DmaBus * ui32Burst;
+            while (ui32Burst--)
+                SIM_fifoPut(psSim, *psSim->pui8Src++);
+            if (psSim->ui32Remain == 0){
+                psSim->bChannel = false;
+                psSim->bPending = true;             // Completion on the UART vector
+            }
+            bChange = true;
+        }
+
+        // The handler runs at once, its cycles being short of a byte time
+        if (psSim->bPending){
+            psSim->bPending = false;
+            psSim->ui64Isrs++;
+            psSim->ui64Cpu += g_ui32Entry + g_ui32Exit;
+            if (psRow->eMode == SIM_FIFO) SIM_fifoIsr(psSim);
+            else SIM_dmaIsr(psSim, psRow->ui32Segment);
+            bChange = true;
+        }
+    }
+}
+
+// Function to simulate one mode at a load in % of the line rate
+static void SIM_run(const tSimRow *psRow, uint32_t ui32Load, tSimResult *psRes){
+    static tSim sSim;
+    tSim *psSim = &sSim;
+    uint8_t pui8Msg[SIM_MSG_MAX];
+    int64_t i64Byte = (int64_t)SIM_CLOCK_HZ * 10 / g_ui32Baud;
+    int64_t i64Gap = (int64_t)g_ui32Msg * i64Byte * 100 / ui32Load;
+    int64_t i64Msg = 0, i64Now = 0, i64Next;
+    uint64_t ui64Offered = 0, ui64Dropped = 0;
+    uint32_t ui32Idx;
+
+    memset(psSim, 0, sizeof(*psSim));
+    RING_init(&psSim->sRing, psSim->pui8Store, SIM_RING_SIZE);
+    psSim->i64ShiftEnd = SIM_NEVER;
+    psSim->bIdle = true;
+
+    for (;;){
+        i64Next = ui64Offered < g_ui64Total ? i64Msg : SIM_NEVER;
+        if (psSim->i64ShiftEnd < i64Next) i64Next = psSim->i64ShiftEnd;
+        if (i64Next == SIM_NEVER) break;
+        i64Now = i64Next;
+
+        if (i64Now == psSim->i64ShiftEnd)
+            psSim->i64ShiftEnd = SIM_NEVER;
+        else if (psRow->eMode == SIM_POLLED){
+            // UARTCharPut() of every byte, spinning while the FIFO is full
+            for (ui32Idx = 0; ui32Idx < g_ui32Msg; ui32Idx++){
+                while (psSim->ui32Fifo == SIM_FIFO_SIZE){
+                    psSim->ui64Cpu += psSim->i64ShiftEnd - i64Now;
+                    i64Now = psSim->i64ShiftEnd;
+                    psSim->i64ShiftEnd = SIM_NEVER;
+                    SIM_settle(psSim, psRow, i64Now, i64Byte);
+                }
+                SIM_fifoPut(psSim, SIM_BYTE(psSim->ui64Pushed));
+                psSim->ui64Pushed++;
+                psSim->ui64Cpu += g_ui32PutByte;
+                SIM_settle(psSim, psRow, i64Now, i64Byte);
+            }
+            ui64Offered += g_ui32Msg;
+            i64Msg += i64Gap;
+            if (i64Msg < i64Now) i64Msg = i64Now;
+        } else{
+            // UARTwrite() copies what fits and restarts an idle transmitter
+            uint32_t ui32Done;
+
+            for (ui32Idx = 0; ui32Idx < g_ui32Msg; ui32Idx++)
+                pui8Msg[ui32Idx] = SIM_BYTE(psSim->ui64Pushed + ui32Idx);
+            ui32Done = RING_pushN(&psSim->sRing, pui8Msg, g_ui32Msg);
+            psSim->ui64Pushed += ui32Done;
+            ui64Dropped += g_ui32Msg - ui32Done;
+            ui64Offered += g_ui32Msg;
+            if (psSim->bIdle && !RING_EMPTY(&psSim->sRing)) psSim->bPending = true;
+            i64Msg += i64Gap;
+        }
+        SIM_settle(psSim, psRow, i64Now, i64Byte);
+    }
+
+    psRes->ui64Dropped = ui64Dropped;
+    psRes->ui64Errors = psSim->ui64Errors + (psSim->ui64Pushed - psSim->ui64Sent);
+    psRes->f64IsrPerSec = i64Now ? psSim->ui64Isrs * (double)SIM_CLOCK_HZ / i64Now : 0;
+    psRes->f64CpuPerByte = psSim->ui64Sent ? (double)psSim->ui64Cpu / psSim->ui64Sent : 0;
+    psRes->f64BusPerByte = psSim->ui64Sent ? (double)psSim->ui64Bus / psSim->ui64Sent : 0;
+    psRes->f64LoadPct = i64Now ? 100.0 * psSim->ui64Cpu / i64Now : 0;
+}
+
+// Function to print the usage of the program
+static void SIM_usage(const char *pcName){
+    fprintf(stderr, "usage: %s [-b baud] [-m bytes per write] [-n bytes] [-l load %%]\n"
+            "       [-e entry] [-x exit] [-F fifo handler] [-f fifo per byte]\n"
+            "       [-D dma handler] [-B dma bus per byte] [-p UARTCharPut]\n", pcName);
+}
+
+// Main Function
+int main(int argc, char **argv){
+    uint32_t ui32Load = 0, ui32L, ui32R, ui32Loads;
+    const uint32_t *pui32Loads = pui32Load;
+    uint64_t ui64Errors = 0;
+    int iOpt;
+
+    while ((iOpt = getopt(argc, argv, "b:m:n:l:e:x:F:f:D:B:p:")) != -1){
+        switch (iOpt){
+        case 'b': g_ui32Baud = strtoul(optarg, NULL, 0); break;
+        case 'm': g_ui32Msg = strtoul(optarg, NULL, 0); break;
+        case 'n': g_ui64Total = strtoull(optarg, NULL, 0); break;
+        case 'l': ui32Load = strtoul(optarg, NULL, 0); break;
+        case 'e': g_ui32Entry = strtoul(optarg, NULL, 0); break;
+        case 'x': g_ui32Exit = strtoul(optarg, NULL, 0); break;
+        case 'F': g_ui32FifoBase = strtoul(optarg, NULL, 0); break;
+        case 'f': g_ui32FifoByte = strtoul(optarg, NULL, 0); break;
+        case 'D': g_ui32DmaBase = strtoul(optarg, NULL, 0); break;
+        case 'B': g_ui32DmaBus = strtoul(optarg, NULL, 0); break;
+        case 'p': g_ui32PutByte = strtoul(optarg, NULL, 0); break;
+        default: SIM_usage(argv[0]); return 2;
+        }
+    }
+    if (g_ui32Baud == 0 || g_ui32Msg == 0 || g_ui32Msg > SIM_MSG_MAX || g_ui32Msg > SIM_RING_SIZE){
+        SIM_usage(argv[0]);
+        return 2;
+    }
+    ui32Loads = sizeof(pui32Load) / sizeof(pui32Load[0]);
+    if (ui32Load){
+        pui32Loads = &ui32Load;
+        ui32Loads = 1;
+    }
+
+    printf("UART at %u bit/s, %u byte writes, %llu bytes per run, ring of %u bytes\n",
+           g_ui32Baud, g_ui32Msg, (unsigned long long)g_ui64Total, SIM_RING_SIZE);
+    printf("%5s %-9s %10s %10s %10s %8s %9s %6s\n",
+           "load", "mode", "isr/s", "cpu/byte", "bus/byte", "cpu %", "dropped", "check");
+    for (ui32L = 0; ui32L < ui32Loads; ui32L++){
+        for (ui32R = 0; ui32R < sizeof(psRows) / sizeof(psRows[0]); ui32R++){
+            tSimResult sRes;
+
+            SIM_run(&psRows[ui32R], pui32Loads[ui32L], &sRes);
+            ui64Errors += sRes.ui64Errors;
+            printf("%4u%% %-9s %10.0f %10.2f %10.2f %8.3f %9llu %6s\n", pui32Loads[ui32L],
+                   psRows[ui32R].pcName, sRes.f64IsrPerSec, sRes.f64CpuPerByte, sRes.f64BusPerByte,
+                   sRes.f64LoadPct, (unsigned long long)sRes.ui64Dropped, sRes.ui64Errors ? "FAIL" : "ok");
+        }
+    }
+    return ui64Errors ? 1 : 0;
+}
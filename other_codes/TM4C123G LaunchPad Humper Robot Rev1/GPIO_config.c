@@ -28,8 +28,8 @@ void BUTTON_init(void){
 
 // Function for Enabling PF0 and PF4
 void BUTTON_enable(void){
-    // Configure and enable the Interrupt for PF0 and PF4
-    ROM_IntEnable(INT_GPIOF);
-    ROM_GPIOIntTypeSet(GPIO_PORTF_BASE, GPIO_PIN_4 | GPIO_PIN_0, GPIO_FALLING_EDGE);
-    GPIOIntEnable(GPIO_PORTF_BASE, GPIO_INT_PIN_0 | GPIO_INT_PIN_4);
+    // Sample PF0 and PF4 on the SysTick interrupt instead of their edges (see "BTN_event.h")
+    ROM_SysTickPeriodSet(ROM_SysCtlClockGet() / BUTTON_TICK_HZ);
+    ROM_SysTickIntEnable();
+    ROM_SysTickEnable();
 }
@@ -15,6 +15,6 @@
 
 void UART0IntHandler(void);                         // ISR Prototype for UART0 Interrupts
 void ADC1_SS0IntHandler(void);                      // ISR Prototype for Timer0 Interrupts
-void PortFIntHandler(void);                         // ISR Prototype for GPIOF Interrupts
+void SysTickIntHandler(void);                       // ISR Prototype for SysTick Interrupts
 
 #endif /* INT_HANDLERS_H_ */
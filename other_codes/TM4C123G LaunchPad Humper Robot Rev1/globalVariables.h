@@ -8,6 +8,7 @@
 /* -----------------------          Include Files       --------------------- */
 #include <stdint.h>                                 // Library of Standard Integer Types
 #include <stdbool.h>                                // Library of Standard Boolean Types
+#include "BTN_event.h"
 
 #ifndef GLOBALVARIABLES_H_
 #define GLOBALVARIABLES_H_
@@ -27,4 +28,6 @@ static int16_t i16Adjust_PWM0_1[2] = {90, 60};      // Array to store Duty Cycle
 static uint8_t ui8ServoStatus[2] = {0x00, 0x00};    // Array to store current and old servo status
 static uint8_t ui8TerminateStatus = 0x00;           // Variable to store the terminate condition
 
+static tBtnPort sBtnPort;                           // Debounced SW1 and SW2, sampled by the SysTick
+
 #endif /* GLOBALVARIABLES_H_ */
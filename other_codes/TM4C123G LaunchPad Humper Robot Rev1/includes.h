@@ -23,6 +23,7 @@
 #include "driverlib/adc.h"                  // Defines and macros for ADC API of driverLib
 #include "driverlib/sysctl.h"               // Defines and macros for System Control API of DriverLib
 #include "driverlib/interrupt.h"            // Defines and macros for NVIC Controller API of DriverLib
+#include "driverlib/systick.h"              // Defines and macros for SysTick API of DriverLib
 #include "driverlib/gpio.h"                 // Defines and macros for GPIO API of DriverLib
 #include "driverlib/pwm.h"                  // API function prototypes for PWM ports
 #include "driverlib/uart.h"                 // Defines and Macros for the UART
@@ -11,5 +11,9 @@
 /* -----------------------      Macro Definitions       --------------------- */
 #define PWM_FREQUENCY   50                          // Macro for the frequency of PWM signal in Hz
 #define UART0_BAUDRATE  115200                      // Macro for UART0 Baud rate
+#define BUTTON_TICK_HZ  100                         // Macro for the SysTick rate sampling the buttons in Hz
+#define BUTTON_SW1      4                           // Macro for the pin of SW1 (PF4) in the button events
+#define BUTTON_SW2      0                           // Macro for the pin of SW2 (PF0) in the button events
+#define BUTTON_PINS     (GPIO_PIN_4 | GPIO_PIN_0)   // Macro for the button pins of PortF
 
 #endif /* MACROS_H_ */
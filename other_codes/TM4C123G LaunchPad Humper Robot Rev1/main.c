@@ -8,6 +8,9 @@
  *              The Humper Robot is a Quadrupled Robot (4 x MG995 Servos)
  *              with a Range Sensor (Sharp GP2Y0A41SK0F) for measuring its
  *              distance from a wall.
+ *              SW1 and SW2 are sampled by the SysTick and their debounced events (see
+ *              "BTN_event.h") are handled by BUTTON_service() in the main loop, so no
+ *              interrupt waits for a button to be released.
  *
  * @note        The tm4c123ghpm_startup_ccs.c contains the vector table for the
  *              microcontroller.
@@ -22,10 +25,12 @@
 #include "UART_config.h"
 #include "ADC_config.h"
 #include "GPIO_config.h"
+#include "BTN_event.h"
 
 /* -----------------------      Global Variables        --------------------- */
 
 /* -----------------------      Function Prototypes     --------------------- */
+void BUTTON_service(void);                  // Function prototype for executing the button events
 
 /* -----------------------          Main Program        --------------------- */
 int main(void) {
@@ -48,8 +53,9 @@ int main(void) {
     PWM0_3_init();
     // Initialize the PWM0 module for output from PIN1
     PWM0_1_init();
-    // Initialize the Onboard Buttons
+    // Initialize the Onboard Buttons, sampled at BUTTON_TICK_HZ
     BUTTON_init();
+    BTN_init(&sBtnPort, BUTTON_PINS, BUTTON_PINS, BUTTON_TICK_HZ);
 
     // Enable the ADC1 peripheral
     ADC1_10_enable();
@@ -66,8 +72,10 @@ int main(void) {
     // Enable the Onboard Buttons
     BUTTON_enable();
 
-    // Start an infinite loop
-    while (true);
+    while (true){
+        // Execute the button events
+        BUTTON_service();
+    }
 }
 
 /* -----------------------      Function Definition     --------------------- */
@@ -142,78 +150,84 @@ void ADC1_SS0IntHandler(void){
     ROM_GPIOPinWrite(GPIO_PORTF_BASE, GPIO_PIN_3 | GPIO_PIN_2 | GPIO_PIN_1, 0x00);
 }
 
-void PortFIntHandler(void){
-    // The ISR for GPIO PortF Interrupt Handling
-    GPIOIntClear(GPIO_PORTF_BASE , GPIO_INT_PIN_4 | GPIO_INT_PIN_0);
-
-    // If SW1(PF4) is pressed then reduce the duty cycle
-    if(ROM_GPIOPinRead(GPIO_PORTF_BASE, GPIO_PIN_4 | GPIO_PIN_0)== GPIO_PIN_0){
-
-        // Disable the Timer
-        ROM_TimerDisable(TIMER0_BASE, TIMER_A);
-
-        // Glow the Green LED
-        ROM_GPIOPinWrite(GPIO_PORTF_BASE, GPIO_PIN_3 | GPIO_PIN_2 | GPIO_PIN_1, GPIO_PIN_3);
-
-        // Save the current Servo command and invert it
-        ui8ServoStatus[0] = ui8ServoStatus[1];
-        ui8ServoStatus[1] = (~ui8ServoStatus[1]) & 0x0F;
-
-        // Convert the Servo command message into motor control commands
-        uint8_t ui8MotorControl[4];
-        ui8MotorControl[0] = (ui8ServoStatus[1] & 0b00001000) >> 3;
-        ui8MotorControl[1] = (ui8ServoStatus[1] & 0b00000100) >> 2;
-        ui8MotorControl[2] = (ui8ServoStatus[1] & 0b00000010) >> 1;
-        ui8MotorControl[3] = (ui8ServoStatus[1] & 0b00000001);
-
-        // Update the PWM duty cycles of the motors
-        PWM1_2_update(ui8MotorControl[0]);
-        PWM0_5_update(ui8MotorControl[1]);
-        PWM0_1_update(ui8MotorControl[2]);
-        PWM0_3_update(ui8MotorControl[3]);
-
-        // Load the Timer with the calculated period (= 500ms)
-        // This is required to allow the Servo to actuate
-        ROM_TimerLoadSet(TIMER0_BASE, TIMER_A, (ROM_SysCtlClockGet() >> 1) - 1);
-
-        // While the SW1 is pressed, stall the program
-        while(ROM_GPIOPinRead(GPIO_PORTF_BASE, GPIO_PIN_4 | GPIO_PIN_0)== GPIO_PIN_0);
-        // Turn off the LED
-        ROM_GPIOPinWrite(GPIO_PORTF_BASE, GPIO_PIN_3 | GPIO_PIN_2 | GPIO_PIN_1, 0x00);
-
-        // Enable the Timer
-        ROM_TimerEnable(TIMER0_BASE, TIMER_A);
-    }
-    // If SW2(PW0) is pressed then increase the duty cycle
-    if(ROM_GPIOPinRead(GPIO_PORTF_BASE, GPIO_PIN_4 | GPIO_PIN_0)== GPIO_PIN_4){
-
-        // Disable the Timer
-        ROM_TimerDisable(TIMER0_BASE, TIMER_A);
-
-        // Glow the Red LED
-        ROM_GPIOPinWrite(GPIO_PORTF_BASE, GPIO_PIN_3 | GPIO_PIN_2 | GPIO_PIN_1, GPIO_PIN_1);
-
-        // Modify the terminate variable to send a terminate condition
-        ui8TerminateStatus = 0xFF;
-
-        // Transmit the UART Status messages to the computer
-        ROM_UARTCharPut(UART0_BASE, ui8ServoStatus[0]);
-        ROM_UARTCharPut(UART0_BASE, ui8ServoStatus[1]);
-        ROM_UARTCharPut(UART0_BASE, i8ADCChange);
-        ROM_UARTCharPut(UART0_BASE, ui8TerminateStatus);
-        ROM_UARTCharPut(UART0_BASE, '\r');
-        ROM_UARTCharPut(UART0_BASE, '\n');
-
-        // Load the Timer with the calculated period (= 500ms)
-        // This is required to allow the Servo to actuate
-        ROM_TimerLoadSet(TIMER0_BASE, TIMER_A, (ROM_SysCtlClockGet() >> 1) - 1);
-
-        // While the SW2 is pressed, stall the program
-        while(ROM_GPIOPinRead(GPIO_PORTF_BASE, GPIO_PIN_4 | GPIO_PIN_0)== GPIO_PIN_4);
-        // Turn off the LED
-        ROM_GPIOPinWrite(GPIO_PORTF_BASE, GPIO_PIN_3 | GPIO_PIN_2 | GPIO_PIN_1, 0x00);
+void SysTickIntHandler(void){
+    // The ISR for SysTick Interrupt Handling
+    // Sample SW1 and SW2, their events are handled by BUTTON_service()
+    BTN_sample(&sBtnPort, HWREG(GPIO_PORTF_BASE + GPIO_O_DATA + (BUTTON_PINS << 2)));
+}
 
-        // Enable the Timer
-        ROM_TimerEnable(TIMER0_BASE, TIMER_A);
+// Function to execute the button events posted by SysTickIntHandler
+void BUTTON_service(void){
+    uint8_t ui8Event;
+
+    while (BTN_get(&sBtnPort, &ui8Event)){
+        // If SW1(PF4) is pressed then invert the servo command
+        if (ui8Event == BTN_EVENT(BTN_PRESS, BUTTON_SW1)){
+
+            // Disable the Timer
+            ROM_TimerDisable(TIMER0_BASE, TIMER_A);
+
+            // Glow the Green LED
+            ROM_GPIOPinWrite(GPIO_PORTF_BASE, GPIO_PIN_3 | GPIO_PIN_2 | GPIO_PIN_1, GPIO_PIN_3);
+
+            // Save the current Servo command and invert it, with UART0IntHandler held off
+            ROM_IntMasterDisable();
+            ui8ServoStatus[0] = ui8ServoStatus[1];
+            ui8ServoStatus[1] = (~ui8ServoStatus[1]) & 0x0F;
+
+            // Convert the Servo command message into motor control commands
+            uint8_t ui8MotorControl[4];
+            ui8MotorControl[0] = (ui8ServoStatus[1] & 0b00001000) >> 3;
+            ui8MotorControl[1] = (ui8ServoStatus[1] & 0b00000100) >> 2;
+            ui8MotorControl[2] = (ui8ServoStatus[1] & 0b00000010) >> 1;
+            ui8MotorControl[3] = (ui8ServoStatus[1] & 0b00000001);
+
+            // Update the PWM duty cycles of the motors
+            PWM1_2_update(ui8MotorControl[0]);
+            PWM0_5_update(ui8MotorControl[1]);
+            PWM0_1_update(ui8MotorControl[2]);
+            PWM0_3_update(ui8MotorControl[3]);
+            ROM_IntMasterEnable();
+
+            // Load the Timer with the calculated period (= 500ms)
+            // This is required to allow the Servo to actuate
+            ROM_TimerLoadSet(TIMER0_BASE, TIMER_A, (ROM_SysCtlClockGet() >> 1) - 1);
+
+            // Enable the Timer
+            ROM_TimerEnable(TIMER0_BASE, TIMER_A);
+        }
+        // If SW2(PF0) is pressed then send the terminate condition
+        else if (ui8Event == BTN_EVENT(BTN_PRESS, BUTTON_SW2)){
+
+            // Disable the Timer
+            ROM_TimerDisable(TIMER0_BASE, TIMER_A);
+
+            // Glow the Red LED
+            ROM_GPIOPinWrite(GPIO_PORTF_BASE, GPIO_PIN_3 | GPIO_PIN_2 | GPIO_PIN_1, GPIO_PIN_1);
+
+            // Modify the terminate variable to send a terminate condition
+            ui8TerminateStatus = 0xFF;
+
+            // Transmit the UART Status messages to the computer, not mixed with the ones of the ADC ISR
+            ROM_IntMasterDisable();
+            ROM_UARTCharPut(UART0_BASE, ui8ServoStatus[0]);
+            ROM_UARTCharPut(UART0_BASE, ui8ServoStatus[1]);
+            ROM_UARTCharPut(UART0_BASE, i8ADCChange);
+            ROM_UARTCharPut(UART0_BASE, ui8TerminateStatus);
+            ROM_UARTCharPut(UART0_BASE, '\r');
+            ROM_UARTCharPut(UART0_BASE, '\n');
+            ROM_IntMasterEnable();
+
+            // Load the Timer with the calculated period (= 500ms)
+            // This is required to allow the Servo to actuate
+            ROM_TimerLoadSet(TIMER0_BASE, TIMER_A, (ROM_SysCtlClockGet() >> 1) - 1);
+
+            // Enable the Timer
+            ROM_TimerEnable(TIMER0_BASE, TIMER_A);
+        }
+        // When a switch is released, turn off the LED
+        else if (BTN_TYPE(ui8Event) == BTN_RELEASE){
+            ROM_GPIOPinWrite(GPIO_PORTF_BASE, GPIO_PIN_3 | GPIO_PIN_2 | GPIO_PIN_1, 0x00);
+        }
     }
 }
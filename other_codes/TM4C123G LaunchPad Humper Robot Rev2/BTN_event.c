@@ -0,0 +1,114 @@
+/*!
+ * @author      Yash Bansod
+ * @date        17th October 2026
+ *
+ * @brief       Source containing the debounced button events of the onboard switches
+ * @details     Only a short press arms the double press: the release of a long press or
+ *              of a double press does not, so holding or triple clicking a button does
+ *              not post extra BTN_DOUBLE events.
+ * @file        BTN_event.c
+ */
+/* -----------------------          Include Files       --------------------- */
+#include "BTN_event.h"
+
+/* -----------------------      Function Definition     --------------------- */
+// Function to convert a time in ms to ticks, rounded up and at least ui32Min
+static uint32_t BTN_ticks(uint32_t ui32Ms, uint32_t ui32TickHz, uint32_t ui32Min, uint32_t ui32Max){
+    uint32_t ui32Ticks = (ui32Ms * ui32TickHz + 999) / 1000;
+
+    if (ui32Ticks < ui32Min) ui32Ticks = ui32Min;
+    if (ui32Ticks > ui32Max) ui32Ticks = ui32Max;
+    return ui32Ticks;
+}
+
+// Function to post an event, dropped if the queue is full
+static void BTN_post(tBtnPort *psBtn, uint8_t ui8Event){
+    if (psBtn->ui32Head - psBtn->ui32Tail >= BTN_QUEUE_LEN)
+        psBtn->ui32Dropped++;
+    else{
+        psBtn->pui8Queue[psBtn->ui32Head & (BTN_QUEUE_LEN - 1)] = ui8Event;
+        psBtn->ui32Head++;
+    }
+}
+
+// Function to reset a port with all its buttons released, ticks of the sampling at ui32TickHz
+void BTN_init(tBtnPort *psBtn, uint8_t ui8Mask, uint8_t ui8ActiveLow, uint32_t ui32TickHz){
+    uint8_t ui8Pin;
+
+    for (ui8Pin = 0; ui8Pin < BTN_PINS; ui8Pin++){
+        psBtn->psPin[ui8Pin].ui8Count = 0;
+        psBtn->psPin[ui8Pin].ui8Flags = 0;
+        psBtn->psPin[ui8Pin].ui16Held = 0;
+    }
+    psBtn->ui8Mask = ui8Mask;
+    psBtn->ui8ActiveLow = ui8ActiveLow;
+    psBtn->ui8Pressed = 0;
+    psBtn->ui8Busy = 0;
+    psBtn->ui8DebounceTicks = (uint8_t)BTN_ticks(BTN_DEBOUNCE_MS, ui32TickHz, 2, 255);
+    psBtn->ui16LongTicks = (uint16_t)BTN_ticks(BTN_LONG_MS, ui32TickHz, 1, 65535);
+    psBtn->ui16DoubleTicks = (uint16_t)BTN_ticks(BTN_DOUBLE_MS, ui32TickHz, 1, 65535);
+    psBtn->ui32Head = 0;
+    psBtn->ui32Tail = 0;
+    psBtn->ui32Dropped = 0;
+}
+
+// Function to take one read of the port, called once per tick
+void BTN_sample(tBtnPort *psBtn, uint8_t ui8Pins){
+    uint8_t ui8Raw = (ui8Pins ^ psBtn->ui8ActiveLow) & psBtn->ui8Mask;     // Pins pressed now
+    uint8_t ui8Pin, ui8Busy = 0;
+
+    for (ui8Pin = 0; ui8Pin < BTN_PINS; ui8Pin++){
+        tBtnPin *psPin = &psBtn->psPin[ui8Pin];
+        uint8_t ui8Bit = 1u << ui8Pin;
+
+        if (!(psBtn->ui8Mask & ui8Bit)) continue;
+
+        // Move the debounce counter one step towards the raw level
+        if (ui8Raw & ui8Bit){
+            if (psPin->ui8Count < psBtn->ui8DebounceTicks) psPin->ui8Count++;
+        } else if (psPin->ui8Count) psPin->ui8Count--;
+
+        if (psBtn->ui8Pressed & ui8Bit){
+            if (psPin->ui8Count == 0){
+                // Released, a short press opens the double-press time
+                psBtn->ui8Pressed &= ~ui8Bit;
+                BTN_post(psBtn, BTN_EVENT(BTN_RELEASE, ui8Pin));
+                psPin->ui8Flags = (psPin->ui8Flags & (BTN_F_LONG | BTN_F_DOUBLE)) ? 0 : BTN_F_ARMED;
+                psPin->ui16Held = 0;
+            } else{
+                if (psPin->ui16Held < 0xFFFF) psPin->ui16Held++;
+                if (psPin->ui16Held >= psBtn->ui16LongTicks && !(psPin->ui8Flags & BTN_F_LONG)){
+                    psPin->ui8Flags |= BTN_F_LONG;
+                    BTN_post(psBtn, BTN_EVENT(BTN_LONG, ui8Pin));
+                }
+            }
+        } else if (psPin->ui8Count == psBtn->ui8DebounceTicks){
+            // Pressed, a double press when the last short press was released recently
+            psBtn->ui8Pressed |= ui8Bit;
+            BTN_post(psBtn, BTN_EVENT(BTN_PRESS, ui8Pin));
+            if (psPin->ui8Flags & BTN_F_ARMED){
+                psPin->ui8Flags = BTN_F_DOUBLE;
+                BTN_post(psBtn, BTN_EVENT(BTN_DOUBLE, ui8Pin));
+            } else
+                psPin->ui8Flags = 0;
+            psPin->ui16Held = 0;
+        } else if (psPin->ui8Flags & BTN_F_ARMED){
+            // The double-press time runs out
+            if (++psPin->ui16Held > psBtn->ui16DoubleTicks)
+                psPin->ui8Flags = 0;
+        }
+
+        if (psPin->ui8Count || (psPin->ui8Flags & BTN_F_ARMED) || (psBtn->ui8Pressed & ui8Bit))
+            ui8Busy |= ui8Bit;
+    }
+    psBtn->ui8Busy = ui8Busy;
+}
+
+// Function to take the oldest event of the queue, returns false when it is empty
+bool BTN_get(tBtnPort *psBtn, uint8_t *pui8Event){
+    if (psBtn->ui32Head == psBtn->ui32Tail)
+        return false;
+    *pui8Event = psBtn->pui8Queue[psBtn->ui32Tail & (BTN_QUEUE_LEN - 1)];
+    psBtn->ui32Tail++;
+    return true;
+}
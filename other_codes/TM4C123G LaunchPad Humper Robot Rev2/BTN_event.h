@@ -0,0 +1,97 @@
+/*!
+ * @author      Yash Bansod
+ * @date        17th October 2026
+ *
+ * @brief       Header containing the debounced button events of the onboard switches
+ * @details     BTN_sample() takes one read of the button pins per periodic tick, from an
+ *              interrupt, and posts the events it detects to a queue that BTN_get()
+ *              empties outside of the interrupt, so that no handler waits on a button.
+ *              A pin is debounced by a counter that moves one step per tick towards
+ *              its raw level, between 0 and the debounce ticks: the pin is pressed when
+ *              the counter reaches the top and released when it falls back to 0. A
+ *              bounce or a glitch shorter than the debounce ticks is absorbed.
+ *              Events of a pin, identified by its bit in the port (PF0 is 0, PF4 is 4):
+ *                  BTN_PRESS   the pin is pressed
+ *                  BTN_RELEASE the pin is released
+ *                  BTN_LONG    the pin has been held for the long-press time, once a press
+ *                  BTN_DOUBLE  a press within the double-press time of the last release,
+ *                              posted after its BTN_PRESS
+ *              Times are given in ms and converted to ticks by BTN_init(), the debounce
+ *              takes at least 2 ticks. The queue is written by the tick interrupt only
+ *              and read by the main loop only, so it needs no lock. This file only
+ *              needs <stdint.h> and <stdbool.h> and the same copy is used by the LED
+ *              Button Control, PWM Servo and Humper Robot projects and by BTN_bounce
+ *              (Host Tools).
+ * @file        BTN_event.h
+ */
+/* -----------------------          Include Files       --------------------- */
+#include <stdint.h>                         // Library of Standard Integer Types
+#include <stdbool.h>                        // Library of Standard Boolean Types
+
+#ifndef BTN_EVENT_H_
+#define BTN_EVENT_H_
+
+/* -----------------------      Macro Definitions       --------------------- */
+#define BTN_PINS            8                       // Macro for the pins of a port
+#define BTN_QUEUE_LEN       16                      // Macro for the events queued for the main loop (power of 2)
+
+#ifndef BTN_DEBOUNCE_MS
+#define BTN_DEBOUNCE_MS     20                      // Macro for the time a pin must hold its level in ms
+#endif
+#ifndef BTN_LONG_MS
+#define BTN_LONG_MS         800                     // Macro for the hold time of a long press in ms
+#endif
+#ifndef BTN_DOUBLE_MS
+#define BTN_DOUBLE_MS       400                     // Macro for the release to press time of a double press in ms
+#endif
+
+// Event types
+#define BTN_PRESS           1
+#define BTN_RELEASE         2
+#define BTN_LONG            3
+#define BTN_DOUBLE          4
+
+// Flags of a pin
+#define BTN_F_LONG          0x01                    // BTN_LONG was posted for this press
+#define BTN_F_DOUBLE        0x02                    // This press was a double press
+#define BTN_F_ARMED         0x04                    // Released from a short press, a press now is a double press
+
+// Macros to pack an event in a byte and to unpack it
+#define BTN_EVENT(ui8Type, ui8Pin)  ((uint8_t)(((ui8Type) << 3) | (ui8Pin)))
+#define BTN_TYPE(ui8Event)          ((ui8Event) >> 3)
+#define BTN_PIN(ui8Event)           ((ui8Event) & 0x07)
+
+// Macro for a port with its pins released and debounced, and no double press pending
+#define BTN_IDLE(psBtn)     ((psBtn)->ui8Busy == 0)
+
+// Macro for a queue with no event waiting for BTN_get()
+#define BTN_EMPTY(psBtn)    ((psBtn)->ui32Head == (psBtn)->ui32Tail)
+
+/* -----------------------      Global Variables        --------------------- */
+typedef struct {
+    uint8_t ui8Count;                               // Debounce counter, 0 .. ui8DebounceTicks
+    uint8_t ui8Flags;                               // BTN_F_x flags of the press
+    uint16_t ui16Held;                              // Ticks since the press, or since the release while armed
+} tBtnPin;
+
+typedef struct {
+    tBtnPin psPin[BTN_PINS];                        // Pins in the order of their bits
+    uint8_t ui8Mask;                                // Pins of the port that are buttons
+    uint8_t ui8ActiveLow;                           // Buttons that read 0 when pressed
+    uint8_t ui8Pressed;                             // Debounced pressed buttons
+    uint8_t ui8Busy;                                // Buttons bouncing, pressed or in their double-press time
+    uint8_t ui8DebounceTicks;                       // Ticks a pin must hold its level
+    uint16_t ui16LongTicks;                         // Hold ticks of a long press
+    uint16_t ui16DoubleTicks;                       // Release to press ticks of a double press
+    uint8_t pui8Queue[BTN_QUEUE_LEN];               // Events waiting for BTN_get()
+    volatile uint32_t ui32Head;                     // Events posted by BTN_sample()
+    volatile uint32_t ui32Tail;                     // Events taken by BTN_get()
+    uint32_t ui32Dropped;                           // Events dropped because the queue was full
+} tBtnPort;
+
+/* -----------------------      Function Prototypes     --------------------- */
+void BTN_init(tBtnPort *psBtn, uint8_t ui8Mask, uint8_t ui8ActiveLow, uint32_t ui32TickHz);   // Reset, all released
+void BTN_sample(tBtnPort *psBtn, uint8_t ui8Pins);                     // Take the pins of one tick
+bool BTN_get(tBtnPort *psBtn, uint8_t *pui8Event);                      // Take the oldest event
+
+#endif /* BTN_EVENT_H_ */
@@ -0,0 +1,168 @@
+/*!
+ * @author      Yash Bansod
+ * @date        17th October 2026
+ *
+ * @brief       Source containing the keyframe gait sequencer of the servo legs
+ * @details     The time of a track counts in 1/100 tick at 100 % speed, so a tick at a
+ *              speed of s % adds s and a frame of TICKS ticks lasts TICKS * 100, without
+ *              rounding at any speed. As every frame lasts at least one tick, a tick
+ *              passes at most GAIT_SPEED_MAX / 100 frames.
+ * @file        GAIT_seq.c
+ */
+/* -----------------------          Include Files       --------------------- */
+#include "GAIT_seq.h"
+
+/* -----------------------      Function Definition     --------------------- */
+// Function to check a table received over UART0 before it is played
+bool GAIT_check(const uint8_t *pui8Table, uint32_t ui32Len){
+    uint8_t ui8Frames, ui8Frame, ui8Leg;
+
+    if (ui32Len < GAIT_HEADER) return false;
+    ui8Frames = pui8Table[GAIT_O_FRAMES];
+    if (pui8Table[GAIT_O_LEGS] != GAIT_LEGS || ui8Frames == 0 || ui8Frames > GAIT_FRAMES_MAX ||
+        ui32Len != (uint32_t)GAIT_TABLE_LEN(ui8Frames) || (pui8Table[GAIT_O_FLAGS] & ~GAIT_LOOP) != 0 ||
+        pui8Table[GAIT_O_LOOP] >= ui8Frames)
+        return false;
+
+    for (ui8Frame = 0; ui8Frame < ui8Frames; ui8Frame++){
+        if (GAIT_TICKS(pui8Table, ui8Frame) == 0) return false;
+        for (ui8Leg = 0; ui8Leg < GAIT_LEGS; ui8Leg++)
+            if (GAIT_PULSE(pui8Table, ui8Frame, ui8Leg) < GAIT_PULSE_MIN ||
+                GAIT_PULSE(pui8Table, ui8Frame, ui8Leg) > GAIT_PULSE_MAX)
+                return false;
+    }
+    return true;
+}
+
+// Function to start a track at frame 0 from a pose
+static void GAIT_trackStart(tGaitTrack *psTrack, const uint8_t *pui8Table, const int16_t *pi16Pose){
+    uint8_t ui8Leg;
+
+    psTrack->pui8Table = pui8Table;
+    psTrack->ui8Frame = 0;
+    psTrack->ui32Time = 0;
+    psTrack->ui32Cycles = 0;
+    for (ui8Leg = 0; ui8Leg < GAIT_LEGS; ui8Leg++)
+        psTrack->pi16From[ui8Leg] = pi16Pose[ui8Leg];
+}
+
+// Function to advance a track by one tick, a track reaching its end holds the last frame with a null table
+static void GAIT_trackAdvance(tGaitTrack *psTrack, uint16_t ui16Speed, bool bStopAtEnd){
+    const uint8_t *pui8Table = psTrack->pui8Table;
+    uint32_t ui32Length;
+    uint8_t ui8Leg;
+
+    if (pui8Table == 0) return;
+    psTrack->ui32Time += ui16Speed;
+
+    while (psTrack->ui32Time >= (ui32Length = GAIT_TICKS(pui8Table, psTrack->ui8Frame) * 100u)){
+        // Frame reached, the next one starts from it
+        psTrack->ui32Time -= ui32Length;
+        for (ui8Leg = 0; ui8Leg < GAIT_LEGS; ui8Leg++)
+            psTrack->pi16From[ui8Leg] = GAIT_PULSE(pui8Table, psTrack->ui8Frame, ui8Leg);
+
+        if (psTrack->ui8Frame + 1 < pui8Table[GAIT_O_FRAMES])
+            psTrack->ui8Frame++;
+        else{
+            psTrack->ui32Cycles++;
+            if ((pui8Table[GAIT_O_FLAGS] & GAIT_LOOP) && !bStopAtEnd)
+                psTrack->ui8Frame = pui8Table[GAIT_O_LOOP];
+            else{
+                psTrack->pui8Table = 0;
+                psTrack->ui32Time = 0;
+                return;
+            }
+        }
+    }
+}
+
+// Function to get the pose of a track, interpolated between the previous frame and the next one
+static int32_t GAIT_trackPose(const tGaitTrack *psTrack, uint8_t ui8Leg){
+    const uint8_t *pui8Table = psTrack->pui8Table;
+    int32_t i32From = psTrack->pi16From[ui8Leg];
+
+    if (pui8Table == 0) return i32From;
+    return i32From + ((int32_t)GAIT_PULSE(pui8Table, psTrack->ui8Frame, ui8Leg) - i32From) *
+                     (int32_t)psTrack->ui32Time / (int32_t)(GAIT_TICKS(pui8Table, psTrack->ui8Frame) * 100u);
+}
+
+// Function to reset the sequencer, stopped with the legs at pi16Pose
+void GAIT_init(tGaitSeq *psSeq, const int16_t *pi16Pose){
+    uint8_t ui8Leg;
+
+    GAIT_trackStart(&psSeq->sNew, 0, pi16Pose);
+    GAIT_trackStart(&psSeq->sOld, 0, pi16Pose);
+    psSeq->ui16Speed = 100;
+    psSeq->ui16Blend = 0;
+    psSeq->ui16BlendTicks = 0;
+    psSeq->bStopAtEnd = false;
+    for (ui8Leg = 0; ui8Leg < GAIT_LEGS; ui8Leg++)
+        psSeq->pi16Pose[ui8Leg] = pi16Pose[ui8Leg];
+}
+
+// Function to play a checked table at a speed in %, the table being played only changes its speed
+void GAIT_play(tGaitSeq *psSeq, const uint8_t *pui8Table, uint16_t ui16Speed, uint16_t ui16BlendTicks){
+    if (ui16Speed > GAIT_SPEED_MAX) ui16Speed = GAIT_SPEED_MAX;
+    psSeq->ui16Speed = ui16Speed;
+    psSeq->bStopAtEnd = false;
+    if (pui8Table == psSeq->sNew.pui8Table)
+        return;
+
+    // The gait played fades out, one started during a blend takes the place of the faded one
+    if (GAIT_PLAYING(psSeq) && ui16BlendTicks){
+        psSeq->sOld = psSeq->sNew;
+        psSeq->ui16Blend = ui16BlendTicks;
+        psSeq->ui16BlendTicks = ui16BlendTicks;
+    } else{
+        psSeq->sOld.pui8Table = 0;
+        psSeq->ui16Blend = 0;
+    }
+    // The new gait moves to its first frame from the pose of the last tick
+    GAIT_trackStart(&psSeq->sNew, pui8Table, psSeq->pi16Pose);
+}
+
+// Function to stop at once, or when the gait played reaches its last frame
+void GAIT_stop(tGaitSeq *psSeq, bool bNow){
+    if (bNow){
+        psSeq->sNew.pui8Table = 0;
+        psSeq->sOld.pui8Table = 0;
+        psSeq->ui16Blend = 0;
+    } else
+        psSeq->bStopAtEnd = true;
+}
+
+// Function to advance the sequencer by one tick and write the pose, returns false once stopped
+bool GAIT_tick(tGaitSeq *psSeq, int16_t *pi16Pose){
+    uint8_t ui8Leg;
+
+    if (!GAIT_PLAYING(psSeq)){
+        for (ui8Leg = 0; ui8Leg < GAIT_LEGS; ui8Leg++)
+            pi16Pose[ui8Leg] = psSeq->pi16Pose[ui8Leg];
+        return false;
+    }
+
+    GAIT_trackAdvance(&psSeq->sNew, psSeq->ui16Speed, psSeq->bStopAtEnd);
+    if (psSeq->ui16Blend){
+        GAIT_trackAdvance(&psSeq->sOld, psSeq->ui16Speed, false);
+        psSeq->ui16Blend--;
+    }
+
+    for (ui8Leg = 0; ui8Leg < GAIT_LEGS; ui8Leg++){
+        int32_t i32Pose = GAIT_trackPose(&psSeq->sNew, ui8Leg);
+
+        if (psSeq->ui16Blend){
+            // Weight of the old gait falls linearly from 1 to 0 over the blend
+            int32_t i32Old = GAIT_trackPose(&psSeq->sOld, ui8Leg);
+            i32Pose += (i32Old - i32Pose) * psSeq->ui16Blend / psSeq->ui16BlendTicks;
+        }
+        psSeq->pi16Pose[ui8Leg] = (int16_t)i32Pose;
+        pi16Pose[ui8Leg] = (int16_t)i32Pose;
+    }
+
+    // A gait that ends also ends its blend
+    if (!GAIT_PLAYING(psSeq)){
+        psSeq->sOld.pui8Table = 0;
+        psSeq->ui16Blend = 0;
+    }
+    return true;
+}
@@ -0,0 +1,85 @@
+/*!
+ * @author      Yash Bansod
+ * @date        17th October 2026
+ *
+ * @brief       Header containing the keyframe gait sequencer of the servo legs
+ * @details     A gait table is a compact byte string:
+ *                  LEGS | FRAMES | FLAGS | LOOP | FRAMES x (TICKS | PULSE[LEGS])
+ *              LEGS must be GAIT_LEGS, FRAMES is 1 .. GAIT_FRAMES_MAX, FLAGS holds
+ *              GAIT_LOOP and LOOP is the frame the gait jumps back to after its last
+ *              one (the frames before it play once, as a start). TICKS is the time in
+ *              motion ticks (at SERVO_TICK_HZ) to move from the previous frame to this
+ *              one at 100 % speed, and PULSE the pulse width of each leg at the frame in
+ *              1/1000 of the PWM period, GAIT_PULSE_MIN .. GAIT_PULSE_MAX. The first
+ *              frame is reached from the pose of the legs when the gait starts.
+ *              GAIT_tick(), once per motion tick, interpolates the pose between the
+ *              frames at the speed in % of the table timing. A gait started while
+ *              another plays is cross-faded with it over the blend ticks: both keep
+ *              running and the weight of the new one rises linearly from 0 to 1.
+ *              The pose is meant as the target of the motion engine of SERVO_motion.h,
+ *              which keeps the legs within its velocity and acceleration limits
+ *              whatever the table asks for.
+ *              The tables are built and played on a host by GAIT_tool (Host Tools).
+ * @file        GAIT_seq.h
+ */
+/* -----------------------          Include Files       --------------------- */
+#include <stdint.h>                         // Library of Standard Integer Types
+#include <stdbool.h>                        // Library of Standard Boolean Types
+#include "macros.h"
+
+#ifndef GAIT_SEQ_H_
+#define GAIT_SEQ_H_
+
+/* -----------------------      Macro Definitions       --------------------- */
+#define GAIT_LEGS           PWM_CHANNELS            // Macro for the legs of a frame
+#define GAIT_FRAMES_MAX     24                      // Macro for the most frames of a table
+#define GAIT_HEADER         4                       // Macro for the bytes before the first frame
+#define GAIT_FRAME_BYTES    (1 + GAIT_LEGS)         // Macro for the bytes of a frame
+#define GAIT_TABLE_MAX      (GAIT_HEADER + GAIT_FRAMES_MAX * GAIT_FRAME_BYTES)  // Macro for the largest table
+#define GAIT_TABLE_LEN(ui8Frames)   (GAIT_HEADER + (ui8Frames) * GAIT_FRAME_BYTES)  // Macro for the bytes of a table
+
+#define GAIT_O_LEGS         0                       // Macro for the offset of LEGS
+#define GAIT_O_FRAMES       1                       // Macro for the offset of FRAMES
+#define GAIT_O_FLAGS        2                       // Macro for the offset of FLAGS
+#define GAIT_O_LOOP         3                       // Macro for the offset of LOOP
+#define GAIT_LOOP           0x01                    // Macro for the FLAGS bit of a looping gait
+
+#define GAIT_PULSE_MIN      25                      // Macro for the shortest pulse width of a frame (0.5 ms)
+#define GAIT_PULSE_MAX      125                     // Macro for the longest pulse width of a frame (2.5 ms)
+#define GAIT_SPEED_MAX      400                     // Macro for the highest speed in %
+
+// Macros for the fields of frame ui8Frame of a table
+#define GAIT_TICKS(pui8Table, ui8Frame)         ((pui8Table)[GAIT_HEADER + (ui8Frame) * GAIT_FRAME_BYTES])
+#define GAIT_PULSE(pui8Table, ui8Frame, ui8Leg) ((pui8Table)[GAIT_HEADER + (ui8Frame) * GAIT_FRAME_BYTES + 1 + (ui8Leg)])
+
+// Macro to check for a gait being played
+#define GAIT_PLAYING(psSeq)     ((psSeq)->sNew.pui8Table != 0)
+
+/* -----------------------      Global Variables        --------------------- */
+typedef struct {
+    const uint8_t *pui8Table;                       // Table played, 0 when stopped
+    uint8_t ui8Frame;                               // Frame being moved to
+    uint32_t ui32Time;                              // Time since the previous frame, 1/100 tick at 100 %
+    int16_t pi16From[GAIT_LEGS];                    // Pose of the previous frame
+    uint32_t ui32Cycles;                            // Times the last frame was reached
+} tGaitTrack;
+
+typedef struct {
+    tGaitTrack sNew;                                // Gait played
+    tGaitTrack sOld;                                // Gait faded out during a blend
+    uint16_t ui16Speed;                             // Speed in % of the table timing
+    uint16_t ui16Blend;                             // Blend ticks left
+    uint16_t ui16BlendTicks;                        // Blend ticks of the blend under way
+    bool bStopAtEnd;                                // Stop at the last frame instead of looping
+    int16_t pi16Pose[GAIT_LEGS];                    // Pose of the last tick
+} tGaitSeq;
+
+/* -----------------------      Function Prototypes     --------------------- */
+bool GAIT_check(const uint8_t *pui8Table, uint32_t ui32Len);           // Check a table received
+void GAIT_init(tGaitSeq *psSeq, const int16_t *pi16Pose);               // Reset, stopped at a pose
+void GAIT_play(tGaitSeq *psSeq, const uint8_t *pui8Table, uint16_t ui16Speed,
+               uint16_t ui16BlendTicks);                                // Start a table or change the speed
+void GAIT_stop(tGaitSeq *psSeq, bool bNow);                             // Stop at once or at the last frame
+bool GAIT_tick(tGaitSeq *psSeq, int16_t *pi16Pose);                     // Advance one tick, false once stopped
+
+#endif /* GAIT_SEQ_H_ */
@@ -16,6 +16,5 @@
 #define GPIO_CONFIG_H_
 
 void BUTTON_init(void);                           // Function for Initializing PF0 and PF4
-void BUTTON_enable(void);                         // Function for Enabling PF0 and PF4
 
 #endif /* GPIO_CONFIG_H_ */
@@ -17,6 +17,7 @@ void UART0IntHandler(void);                         // ISR Prototype for UART0 I
 void Timer0IntHandler(void);                        // ISR Prototype for Timer0 Interrupts
 void Timer1IntHandler(void);                        // ISR Prototype for Timer1 Interrupts
 void PortAIntHandler(void);                         // ISR Prototype for GPIOA Interrupts
-void PortFIntHandler(void);                         // ISR Prototype for GPIOF Interrupts
+void PortCIntHandler(void);                         // ISR Prototype for GPIOC Interrupts
+void PortEIntHandler(void);                         // ISR Prototype for GPIOE Interrupts
 
 #endif /* INT_HANDLERS_H_ */
@@ -0,0 +1,104 @@
+/*!
+ * @author      Yash Bansod
+ * @date        17th October 2026
+ *
+ * @brief       Header containing the framed binary command protocol of UART0
+ * @details     A frame is  SOF | LEN | TYPE | PAYLOAD[LEN] | CRC_HI | CRC_LO  where
+ *              SOF is PROTO_SOF, LEN is 0 .. PROTO_MAX_PAYLOAD and the CRC is the
+ *              CRC-16/CCITT-FALSE of LEN, TYPE and PAYLOAD. Multi byte fields of the
+ *              payload are little endian.
+ *              The frames share UART0 with the single byte motor commands 0x00 to 0x0F
+ *              of the PC program: a byte is taken by the parser when it is PROTO_SOF or
+ *              a frame is under way (see PROTO_IDLE), else it is a motor command.
+ *              Every command is answered by a frame of type (TYPE | PROTO_REPLY) whose
+ *              first payload byte is a PROTO_STATUS_x code, followed by the data of the
+ *              query commands. After the first frame the range measurements are sent as
+ *              PROTO_RANGE_DATA frames instead of the status bytes of the motor
+ *              commands, until the next motor command.
+ *              The parser takes one byte at a time in constant time. A frame with a bad
+ *              length or CRC is dropped and the parser waits for the next SOF. A frame
+ *              never spans an idle line: PROTO_parserIdle(), called when bytes arrive
+ *              after the line was idle, drops the frame in progress, so that a stray or
+ *              corrupted SOF cannot take the next frame as its payload.
+ *              This file only needs <stdint.h> and <stdbool.h>, so the host tools use it
+ *              as their encoder and decoder.
+ * @file        PROTO_frame.h
+ */
+/* -----------------------          Include Files       --------------------- */
+#include <stdint.h>                         // Library of Standard Integer Types
+#include <stdbool.h>                        // Library of Standard Boolean Types
+
+#ifndef PROTO_FRAME_H_
+#define PROTO_FRAME_H_
+
+/* -----------------------      Macro Definitions       --------------------- */
+#define PROTO_SOF           0xA5                    // Macro for the Start Of Frame byte
+#ifndef PROTO_MAX_PAYLOAD
+#define PROTO_MAX_PAYLOAD   125                     // Macro for the largest payload in bytes (PROTO_GAIT_LOAD)
+#endif
+#if PROTO_MAX_PAYLOAD > 255
+#error "PROTO_MAX_PAYLOAD must fit in the LEN byte"
+#endif
+#define PROTO_OVERHEAD      5                       // Macro for the bytes of a frame besides the payload
+#define PROTO_MAX_FRAME     (PROTO_MAX_PAYLOAD + PROTO_OVERHEAD)
+
+// Command types, payloads are given after the type
+#define PROTO_GAIT_LOAD     0x01                    // u8 slot, gait table of GAIT_seq.h
+#define PROTO_GAIT_PLAY     0x02                    // u8 slot, u16 speed in % of the table timing, u16 blend ticks
+#define PROTO_GAIT_STOP     0x03                    // u8 1 to stop at once, 0 at the end of the cycle
+#define PROTO_GET_STATE     0x04                    // reply: u8 flags, u8 slot, u8 frame, u32 cycles, i8 echo change,
+                                                    //        PWM_CHANNELS x i16 pulse width
+#define PROTO_RANGE_DATA    0x40                    // i8 echo change, u32 echo duration, u8 flags
+#define PROTO_REPLY         0x80                    // Macro for the flag of the reply types
+
+// Status codes, first byte of every reply
+#define PROTO_STATUS_OK     0                       // Command executed
+#define PROTO_STATUS_LEN    1                       // Payload length does not match the type
+#define PROTO_STATUS_TYPE   2                       // Unknown type
+#define PROTO_STATUS_BUSY   3                       // The slot is being played
+#define PROTO_STATUS_FAIL   4                       // Bad slot or gait table
+
+// Bits of the flags byte of PROTO_GET_STATE and PROTO_RANGE_DATA
+#define PROTO_FLAG_IDLE     0x01                    // All legs have completed their motion
+#define PROTO_FLAG_PLAYING  0x02                    // The gait sequencer is playing
+
+// Macro for a parser waiting for PROTO_SOF
+#define PROTO_IDLE(psParser)    ((psParser)->ui8State == 0)
+
+/* -----------------------      Global Variables        --------------------- */
+typedef struct {
+    uint8_t ui8Type;                                // Type of the frame
+    uint8_t ui8Len;                                 // Payload length in bytes
+    uint8_t pui8Payload[PROTO_MAX_PAYLOAD];         // Payload
+} tProtoFrame;
+
+typedef struct {
+    uint8_t ui8State;                               // Field expected next
+    uint8_t ui8Index;                               // Payload bytes received
+    uint16_t ui16Crc;                               // CRC of the bytes received so far
+    uint16_t ui16CrcRx;                             // CRC sent with the frame
+    tProtoFrame sFrame;                             // Frame being received, valid when PROTO_parse returns true
+    uint32_t ui32Frames;                            // Number of valid frames
+    uint32_t ui32CrcErrors;                         // Number of frames dropped for their CRC
+    uint32_t ui32LenErrors;                         // Number of frames dropped for their length
+    uint32_t ui32Aborts;                            // Number of frames cut short by an idle line
+} tProtoParser;
+
+/* -----------------------      Function Prototypes     --------------------- */
+void PROTO_parserInit(tProtoParser *psParser);                          // Reset the parser
+bool PROTO_parse(tProtoParser *psParser, uint8_t ui8Byte);              // Feed a byte, true on a valid frame
+void PROTO_parserIdle(tProtoParser *psParser);                          // Drop the frame in progress
+uint32_t PROTO_encode(uint8_t ui8Type, const uint8_t *pui8Payload,
+                      uint8_t ui8Len, uint8_t *pui8Out);                // Build a frame, returns its length
+uint16_t PROTO_crc16(uint16_t ui16Crc, uint8_t ui8Byte);                // Add a byte to the CRC
+
+void PROTO_putU16(uint8_t *pui8Dst, uint16_t ui16Value);
+void PROTO_putU32(uint8_t *pui8Dst, uint32_t ui32Value);
+void PROTO_putU64(uint8_t *pui8Dst, uint64_t ui64Value);
+void PROTO_putF32(uint8_t *pui8Dst, float f32Value);
+uint16_t PROTO_getU16(const uint8_t *pui8Src);
+uint32_t PROTO_getU32(const uint8_t *pui8Src);
+uint64_t PROTO_getU64(const uint8_t *pui8Src);
+float PROTO_getF32(const uint8_t *pui8Src);
+
+#endif /* PROTO_FRAME_H_ */
@@ -8,176 +8,107 @@
 /* -----------------------          Include Files       --------------------- */
 #include "PWM_config.h"
 
-/* -----------------------      Function Definition     --------------------- */
-
-// Function for Initializing PWM0_5
-void PWM0_5_init(void){
-    // Set the PWM Clock as System Clock / 64
-    ROM_SysCtlPWMClockSet(SYSCTL_PWMDIV_64);
-
-    // Enable the clock for peripherals PortE and PWM0
-    ROM_SysCtlPeripheralEnable(SYSCTL_PERIPH_PWM0);
-    ROM_SysCtlPeripheralEnable(SYSCTL_PERIPH_GPIOE);
-
-    // Configure the PE5 for PWM signal (PWM module 0 generator 2)
-    ROM_GPIOPinTypePWM(GPIO_PORTE_BASE, GPIO_PIN_5);
-    ROM_GPIOPinConfigure(GPIO_PE5_M0PWM5);
+/* -----------------------      Macro Definitions       --------------------- */
+#define PWM_MODULE(ui32Base)    ((ui32Base) == PWM1_BASE)   // Macro for the index of a PWM module
+
+/* -----------------------      Global Variables        --------------------- */
+// Servo channels in the leg order of ui8MotorControl
+static const tPwmChannel psPwmChannel[PWM_CHANNELS] = {
+    // Servo_RightBack on PE4 (PWM module 1 generator 1)
+    {SYSCTL_PERIPH_PWM1, PWM1_BASE, PWM_GEN_1, PWM_GEN_1_BIT, PWM_OUT_2, PWM_OUT_2_BIT,
+     SYSCTL_PERIPH_GPIOE, GPIO_PORTE_BASE, GPIO_PIN_4, GPIO_PE4_M1PWM2, PWM_FREQUENCY},
+    // Servo_RightFront on PE5 (PWM module 0 generator 2)
+    {SYSCTL_PERIPH_PWM0, PWM0_BASE, PWM_GEN_2, PWM_GEN_2_BIT, PWM_OUT_5, PWM_OUT_5_BIT,
+     SYSCTL_PERIPH_GPIOE, GPIO_PORTE_BASE, GPIO_PIN_5, GPIO_PE5_M0PWM5, PWM_FREQUENCY},
+    // Servo_LeftFront on PB7 (PWM module 0 generator 0)
+    {SYSCTL_PERIPH_PWM0, PWM0_BASE, PWM_GEN_0, PWM_GEN_0_BIT, PWM_OUT_1, PWM_OUT_1_BIT,
+     SYSCTL_PERIPH_GPIOB, GPIO_PORTB_BASE, GPIO_PIN_7, GPIO_PB7_M0PWM1, PWM_FREQUENCY},
+    // Servo_LeftBack on PB5 (PWM module 0 generator 1)
+    {SYSCTL_PERIPH_PWM0, PWM0_BASE, PWM_GEN_1, PWM_GEN_1_BIT, PWM_OUT_3, PWM_OUT_3_BIT,
+     SYSCTL_PERIPH_GPIOB, GPIO_PORTB_BASE, GPIO_PIN_5, GPIO_PB5_M0PWM3, PWM_FREQUENCY}
+};
+
+static uint32_t ui32PwmPeriod[PWM_CHANNELS];        // Array to store the period of each channel in PWM clocks
+static uint32_t ui32PwmCmpReg[PWM_CHANNELS];        // Array to store the compare register of each channel
+static const tPwmLut *psPwmLut[PWM_CHANNELS];       // Array to store the compare table of each channel
+static uint32_t ui32PwmSyncBits[2];                 // Array to store the generator bits of PWM0 and PWM1
+
+static uint16_t ui16PwmCmp[PWM_LUTS][PWM_LUT_ENTRIES(PWM_RESOLUTION)];  // Array to store the compare values
+static tPwmLut sPwmLut[PWM_LUTS];                   // Duty cycle to compare value tables of the periods
+static uint32_t ui32PwmLutPeriod[PWM_LUTS];         // Array to store the period of each table
 
-    // Calculate the Timer period of the PWM Module.
-    uint32_t ui32PWMClock = ROM_SysCtlClockGet() >> 6;
-    ui32Period_PWM = (ui32PWMClock / PWM_FREQUENCY) - 1;
-    // Configure thE PWM0 Genrator2 to work in Count Down Mode
-    ROM_PWMGenConfigure(PWM0_BASE, PWM_GEN_2, PWM_GEN_MODE_DOWN);
-    // Load the calculated time period to the Generator2 of the PWM0 Module
-    ROM_PWMGenPeriodSet(PWM0_BASE, PWM_GEN_2, ui32Period_PWM);
-
-    // Set the PWM duty cycle to a specified value
-    ROM_PWMPulseWidthSet(PWM0_BASE, PWM_OUT_5, i16Adjust_PWM0_5[1] * ui32Period_PWM / 1000);
-    // Enable the PWM5 pin of the PWM Module 0 as output
-    ROM_PWMOutputState(PWM0_BASE, PWM_OUT_5_BIT, true);
-
-}
-
-// Function for Enabling PWM0_5
-void PWM0_5_enable(void){
-    // Enable the PWM0 Generator2
-    ROM_PWMGenEnable(PWM0_BASE, PWM_GEN_2);
-}
-
-// Function for Updating PWM0_5
-void PWM0_5_update(uint8_t index){
-    // Set the PWM duty cycle to a specified value
-    ROM_PWMPulseWidthSet(PWM0_BASE, PWM_OUT_5, i16Adjust_PWM0_5[index] * ui32Period_PWM / 1000);
-}
-
-/*!-------------------------------------------------------------------------------------------------*/
-/*!-------------------------------------------------------------------------------------------------*/
-/*!-------------------------------------------------------------------------------------------------*/
+/* -----------------------      Function Definition     --------------------- */
+// Function for Initializing the channels of psPwmChannel at duties in the unit PWM_RESOLUTION
+void PWM_init(const int16_t *pi16Duty){
+    uint8_t ui8Index, ui8Lut, ui8Luts = 0;
 
-// Function for Initializing PWM1_0
-void PWM1_2_init(void){
     // Set the PWM Clock as System Clock / 64
     ROM_SysCtlPWMClockSet(SYSCTL_PWMDIV_64);
-
-    // Enable the clock for peripherals PortE and PWM1
-    ROM_SysCtlPeripheralEnable(SYSCTL_PERIPH_PWM1);
-    ROM_SysCtlPeripheralEnable(SYSCTL_PERIPH_GPIOE);
-
-    // Configure the PE4 for PWM signal (PWM module 1 generator 1)
-    ROM_GPIOPinTypePWM(GPIO_PORTE_BASE, GPIO_PIN_4);
-    ROM_GPIOPinConfigure(GPIO_PE4_M1PWM2);
-
-    // Calculate the Timer period of the PWM Module.
     uint32_t ui32PWMClock = ROM_SysCtlClockGet() >> 6;
-    ui32Period_PWM = (ui32PWMClock / PWM_FREQUENCY) - 1;
-    // Configure thE PWM1 Genrator1 to work in Count Down Mode
-    ROM_PWMGenConfigure(PWM1_BASE, PWM_GEN_1, PWM_GEN_MODE_DOWN);
-    // Load the calculated time period to the Generator1 of the PWM1 Module
-    ROM_PWMGenPeriodSet(PWM1_BASE, PWM_GEN_1, ui32Period_PWM);
-
-    // Set the PWM duty cycle to a specified value
-    ROM_PWMPulseWidthSet(PWM1_BASE, PWM_OUT_2, i16Adjust_PWM1_2[1] * ui32Period_PWM / 1000);
-    // Enable the PWM2 pin of the PWM Module 1 as output
-    ROM_PWMOutputState(PWM1_BASE, PWM_OUT_2_BIT, true);
-
-}
-
-// Function for Enabling PWM1_2
-void PWM1_2_enable(void){
-    // Enable the PWM1 Generator1
-    ROM_PWMGenEnable(PWM1_BASE, PWM_GEN_1);
-}
 
-// Function for Updating PWM1_2
-void PWM1_2_update(uint8_t index){
-    // Set the PWM duty cycle to a specified value
-    ROM_PWMPulseWidthSet(PWM1_BASE, PWM_OUT_2, i16Adjust_PWM1_2[index] * ui32Period_PWM / 1000);
+    ui32PwmSyncBits[0] = 0;
+    ui32PwmSyncBits[1] = 0;
+
+    for (ui8Index = 0; ui8Index < PWM_CHANNELS; ui8Index++){
+        const tPwmChannel *psChannel = &psPwmChannel[ui8Index];
+
+        // Enable the clock for the PWM module and the port of the pin
+        ROM_SysCtlPeripheralEnable(psChannel->ui32PwmPeriph);
+        ROM_SysCtlPeripheralEnable(psChannel->ui32GpioPeriph);
+
+        // Configure the pin for the PWM signal of the output
+        ROM_GPIOPinTypePWM(psChannel->ui32GpioBase, psChannel->ui8GpioPin);
+        ROM_GPIOPinConfigure(psChannel->ui32PinMux);
+
+        // Calculate the Timer period of the generator
+        ui32PwmPeriod[ui8Index] = (ui32PWMClock / psChannel->ui16Frequency) - 1;
+        // Count Down Mode, the load and compare registers are updated on a global sync only
+        ROM_PWMGenConfigure(psChannel->ui32PwmBase, psChannel->ui32Gen, PWM_GEN_MODE_DOWN | PWM_GEN_MODE_SYNC);
+        ROM_PWMGenPeriodSet(psChannel->ui32PwmBase, psChannel->ui32Gen, ui32PwmPeriod[ui8Index]);
+
+        ui32PwmSyncBits[PWM_MODULE(psChannel->ui32PwmBase)] |= psChannel->ui32GenBit;
+        ui32PwmCmpReg[ui8Index] = PWM_LUT_CMP_REG(psChannel->ui32PwmBase, psChannel->ui32Out);
+
+        // Use the compare table of the same period, or build the next one (the last if PWM_LUTS is short)
+        for (ui8Lut = 0; ui8Lut < ui8Luts; ui8Lut++)
+            if (ui32PwmLutPeriod[ui8Lut] == ui32PwmPeriod[ui8Index]) break;
+        if (ui8Lut == ui8Luts && ui8Luts < PWM_LUTS){
+            PWM_lutInit(&sPwmLut[ui8Lut], PWM_RESOLUTION, ui32PwmPeriod[ui8Index], ui32PWMClock, ui16PwmCmp[ui8Lut]);
+            ui32PwmLutPeriod[ui8Lut] = ui32PwmPeriod[ui8Index];
+            ui8Luts++;
+        }
+        psPwmLut[ui8Index] = &sPwmLut[(ui8Lut < PWM_LUTS) ? ui8Lut : PWM_LUTS - 1];
+    }
+
+    // Load the initial duty cycles, latched with the periods when the generators first count to zero
+    PWM_updateAll(pi16Duty);
+
+    // Enable the outputs
+    for (ui8Index = 0; ui8Index < PWM_CHANNELS; ui8Index++)
+        ROM_PWMOutputState(psPwmChannel[ui8Index].ui32PwmBase, psPwmChannel[ui8Index].ui32OutBit, true);
 }
 
-/*!-------------------------------------------------------------------------------------------------*/
-/*!-------------------------------------------------------------------------------------------------*/
-/*!-------------------------------------------------------------------------------------------------*/
-
-// Function for Initializing PWM0_3
-void PWM0_3_init(void){
-    // Set the PWM Clock as System Clock / 64
-    ROM_SysCtlPWMClockSet(SYSCTL_PWMDIV_64);
-
-    // Enable the clock for peripherals PortB and PWM0
-    ROM_SysCtlPeripheralEnable(SYSCTL_PERIPH_PWM0);
-    ROM_SysCtlPeripheralEnable(SYSCTL_PERIPH_GPIOB);
-
-    // Configure the PB6 for PWM signal (PWM module 0 generator 1)
-    ROM_GPIOPinTypePWM(GPIO_PORTB_BASE, GPIO_PIN_5);
-    ROM_GPIOPinConfigure(GPIO_PB5_M0PWM3);
+// Function for Enabling the generators, those of a module count in phase
+void PWM_enable(void){
+    uint8_t ui8Index;
 
-    // Calculate the Timer period of the PWM Module.
-    uint32_t ui32PWMClock = ROM_SysCtlClockGet() >> 6;
-    ui32Period_PWM = (ui32PWMClock / PWM_FREQUENCY) - 1;
-    // Configure thE PWM0 Genrator1 to work in Count Down Mode
-    ROM_PWMGenConfigure(PWM0_BASE, PWM_GEN_1, PWM_GEN_MODE_DOWN);
-    // Load the calculated time period to the Generator1 of the PWM0 Module
-    ROM_PWMGenPeriodSet(PWM0_BASE, PWM_GEN_1, ui32Period_PWM);
-
-    // Set the PWM duty cycle to a specified value
-    ROM_PWMPulseWidthSet(PWM0_BASE, PWM_OUT_3, i16Adjust_PWM0_3[1] * ui32Period_PWM / 1000);
-    // Enable the PWM3 pin of the PWM Module 0 as output
-    ROM_PWMOutputState(PWM0_BASE, PWM_OUT_3_BIT, true);
-
-}
-
-// Function for Enabling PWM0_3
-void PWM0_3_enable(void){
-    // Enable the PWM0 Generator1
-    ROM_PWMGenEnable(PWM0_BASE, PWM_GEN_1);
-}
+    for (ui8Index = 0; ui8Index < PWM_CHANNELS; ui8Index++)
+        ROM_PWMGenEnable(psPwmChannel[ui8Index].ui32PwmBase, psPwmChannel[ui8Index].ui32Gen);
 
-// Function for Updating PWM0_3
-void PWM0_3_update(uint8_t index){
-    // Set the PWM duty cycle to a specified value
-    ROM_PWMPulseWidthSet(PWM0_BASE, PWM_OUT_3, i16Adjust_PWM0_3[index] * ui32Period_PWM / 1000);
+    // Reset the counters of the generators of each module together
+    if (ui32PwmSyncBits[0]) ROM_PWMSyncTimeBase(PWM0_BASE, ui32PwmSyncBits[0]);
+    if (ui32PwmSyncBits[1]) ROM_PWMSyncTimeBase(PWM1_BASE, ui32PwmSyncBits[1]);
 }
 
-/*!-------------------------------------------------------------------------------------------------*/
-/*!-------------------------------------------------------------------------------------------------*/
-/*!-------------------------------------------------------------------------------------------------*/
+// Function for Updating the duty cycles (in the unit PWM_RESOLUTION) of all the channels on the same period boundary
+void PWM_updateAll(const int16_t *pi16Duty){
+    uint8_t ui8Index;
 
-// Function for Initializing PWM0_1
-void PWM0_1_init(void){
-    // Set the PWM Clock as System Clock / 64
-    ROM_SysCtlPWMClockSet(SYSCTL_PWMDIV_64);
-
-    // Enable the clock for peripherals PortB and PWM0
-    ROM_SysCtlPeripheralEnable(SYSCTL_PERIPH_PWM0);
-    ROM_SysCtlPeripheralEnable(SYSCTL_PERIPH_GPIOB);
-
-    // Configure the PB7 for PWM signal (PWM module 0 generator 0)
-    ROM_GPIOPinTypePWM(GPIO_PORTB_BASE, GPIO_PIN_7);
-    ROM_GPIOPinConfigure(GPIO_PB7_M0PWM1);
-
-    // Calculate the Timer period of the PWM Module.
-    uint32_t ui32PWMClock = ROM_SysCtlClockGet() >> 6;
-    ui32Period_PWM = (ui32PWMClock / PWM_FREQUENCY) - 1;
-    // Configure thE PWM0 Genrator0 to work in Count Down Mode
-    ROM_PWMGenConfigure(PWM0_BASE, PWM_GEN_0, PWM_GEN_MODE_DOWN);
-    // Load the calculated time period to the Generator0 of the PWM0 Module
-    ROM_PWMGenPeriodSet(PWM0_BASE, PWM_GEN_0, ui32Period_PWM);
-
-    // Set the PWM duty cycle to a specified value
-    ROM_PWMPulseWidthSet(PWM0_BASE, PWM_OUT_1, i16Adjust_PWM0_1[1] * ui32Period_PWM / 1000);
-    // Enable the PWM1 pin of the PWM Module 0 as output
-    ROM_PWMOutputState(PWM0_BASE, PWM_OUT_1_BIT, true);
-
-}
-
-// Function for Enabling PWM0_1
-void PWM0_1_enable(void){
-    // Enable the PWM0 Generator0
-    ROM_PWMGenEnable(PWM0_BASE, PWM_GEN_0);
-}
+    // The new compare values, a table load each, wait in the compare registers until the sync
+    for (ui8Index = 0; ui8Index < PWM_CHANNELS; ui8Index++)
+        HWREG(ui32PwmCmpReg[ui8Index]) = PWM_LUT_CMP(psPwmLut[ui8Index], pi16Duty[ui8Index]);
 
-// Function for Updating PWM0_1
-void PWM0_1_update(uint8_t index){
-    // Set the PWM duty cycle to a specified value
-    ROM_PWMPulseWidthSet(PWM0_BASE, PWM_OUT_1, i16Adjust_PWM0_1[index] * ui32Period_PWM / 1000);
+    // Latch them at the next zero count of the generators of each module
+    if (ui32PwmSyncBits[0]) ROM_PWMSyncUpdate(PWM0_BASE, ui32PwmSyncBits[0]);
+    if (ui32PwmSyncBits[1]) ROM_PWMSyncUpdate(PWM1_BASE, ui32PwmSyncBits[1]);
 }
@@ -3,6 +3,18 @@
  * @date        2nd November 2017
  *
  * @brief       Header containing function prototypes for PWM configuration
+ * @details     The servo channels are described by the const table psPwmChannel of
+ *              PWM_config.c, in the leg order of ui8MotorControl. The generators run
+ *              with synchronous load and compare updates: PWM_updateAll() writes the
+ *              new pulse widths of every channel and then requests one global sync
+ *              per PWM module, so the new duties of a module latch together at the
+ *              next zero count of its generators (the generators of a module are
+ *              started in phase by PWM_enable()). PWM0 and PWM1 are separate modules
+ *              and latch at their own period boundaries.
+ *              The duties are in the unit PWM_RESOLUTION and are turned into compare
+ *              values through tables built by PWM_init(), one per distinct period of
+ *              the channels (PWM_LUTS of them). Channels sharing a generator must
+ *              share its frequency.
  * @file        PWM_config.h
  */
 /* -----------------------          Include Files       --------------------- */
@@ -10,25 +22,28 @@
 #include "macros.h"
 #include "Int_handlers.h"
 #include "globalVariables.h"
+#include "PWM_lut.h"
 
  /* -----------------------      Function Prototypes     --------------------- */
 #ifndef PWM_CONFIG_H_
 #define PWM_CONFIG_H_
 
- void PWM0_5_init(void);                            // Function for Initializing PWM0_5
- void PWM0_5_enable(void);                          // Function for Enabling PWM0_5
- void PWM0_5_update(uint8_t index);                 // Function for Updating PWM0_5
+typedef struct {
+    uint32_t ui32PwmPeriph;                         // SYSCTL_PERIPH_PWMx of the module
+    uint32_t ui32PwmBase;                           // PWMx_BASE of the module
+    uint32_t ui32Gen;                               // PWM_GEN_n of the generator
+    uint32_t ui32GenBit;                            // PWM_GEN_n_BIT of the generator
+    uint32_t ui32Out;                               // PWM_OUT_n of the output
+    uint32_t ui32OutBit;                            // PWM_OUT_n_BIT of the output
+    uint32_t ui32GpioPeriph;                        // SYSCTL_PERIPH_GPIOx of the pin
+    uint32_t ui32GpioBase;                          // GPIO_PORTx_BASE of the pin
+    uint8_t ui8GpioPin;                             // GPIO_PIN_n of the pin
+    uint32_t ui32PinMux;                            // GPIO_Pxn_MyPWMn pin mux of the output
+    uint16_t ui16Frequency;                         // Frequency of the generator in Hz
+} tPwmChannel;
 
- void PWM1_2_init(void);                            // Function for Initializing PWM1_2
- void PWM1_2_enable(void);                          // Function for Enabling PWM1_2
- void PWM1_2_update(uint8_t index);                 // Function for Updating PWM1_2
-
- void PWM0_3_init(void);                            // Function for Initializing PWM0_3
- void PWM0_3_enable(void);                          // Function for Enabling PWM0_3
- void PWM0_3_update(uint8_t index);                 // Function for Updating PWM0_3
-
- void PWM0_1_init(void);                            // Function for Initializing PWM0_1
- void PWM0_1_enable(void);                          // Function for Enabling PWM0_1
- void PWM0_1_update(uint8_t index);                 // Function for Updating PWM0_1
+ void PWM_init(const int16_t *pi16Duty);            // Function for Initializing the channels at the duties
+ void PWM_enable(void);                             // Function for Enabling the generators in phase
+ void PWM_updateAll(const int16_t *pi16Duty);       // Function for Updating the duties of all channels
 
 #endif /* PWM_CONFIG_H_ */
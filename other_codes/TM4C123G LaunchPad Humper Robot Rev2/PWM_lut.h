@@ -0,0 +1,57 @@
+/*!
+ * @author      Yash Bansod
+ * @date        17th October 2026
+ *
+ * @brief       Header containing the duty cycle to compare value tables of the PWM outputs
+ * @details     A table is built once for the period of a generator in count down mode
+ *              and holds the compare register value of every duty cycle of its unit:
+ *              0 to 100 %, 0 to 1000 per mille or a servo pulse of 0 to PWM_LUT_US_MAX
+ *              microseconds (pulses below PWM_LUT_US_MIN are raised to it). An update is
+ *              then a table load and a write of the compare register, with no multiply
+ *              or divide and no DriverLib call.
+ *              The entries equal what PWMPulseWidthSet() writes for the pulse widths
+ *              duty * period / 100 and duty * period / 1000 used so far, including
+ *              the full period (compare 0xFFFF, the output stays high). The servo unit
+ *              uses us * PWM clock / 10^6.
+ * @file        PWM_lut.h
+ */
+/* -----------------------          Include Files       --------------------- */
+#include <stdint.h>                         // Library of Standard Integer Types
+#include <stdbool.h>                        // Library of Standard Boolean Types
+
+#ifndef PWM_LUT_H_
+#define PWM_LUT_H_
+
+/* -----------------------      Macro Definitions       --------------------- */
+#define PWM_LUT_PERCENT     0                       // Macro for the duty cycle in %
+#define PWM_LUT_PERMILLE    1                       // Macro for the duty cycle in 1/1000
+#define PWM_LUT_SERVO_US    2                       // Macro for the pulse width in microseconds
+#define PWM_LUT_US_MIN      500                     // Macro for the shortest servo pulse in microseconds
+#define PWM_LUT_US_MAX      2500                    // Macro for the longest servo pulse in microseconds
+
+// Macro for the entries of a table of unit ui8Unit
+#define PWM_LUT_ENTRIES(ui8Unit)    ((ui8Unit) == PWM_LUT_PERCENT ? 101 : \
+                                     (ui8Unit) == PWM_LUT_PERMILLE ? 1001 : PWM_LUT_US_MAX + 1)
+
+// Macro for the compare value of ui32Duty, above the last entry the last entry is used
+#define PWM_LUT_CMP(psLut, ui32Duty) \
+    ((psLut)->pui16Cmp[((uint32_t)(ui32Duty) < (psLut)->ui16Last) ? (uint32_t)(ui32Duty) : (psLut)->ui16Last])
+
+// Macro for the address of the compare register (CMPA or CMPB) of PWM_OUT_n of a PWM module
+#define PWM_LUT_CMP_REG(ui32Base, ui32Out) \
+    ((ui32Base) + ((ui32Out) & ~0x3Fu) + (((ui32Out) & 1) ? PWM_O_X_CMPB : PWM_O_X_CMPA))
+
+/* -----------------------      Global Variables        --------------------- */
+typedef struct {
+    uint8_t ui8Unit;                                // PWM_LUT_PERCENT, PWM_LUT_PERMILLE or PWM_LUT_SERVO_US
+    uint16_t ui16Last;                              // Index of the last entry
+    uint16_t *pui16Cmp;                             // PWM_LUT_ENTRIES(ui8Unit) compare values
+} tPwmLut;
+
+/* -----------------------      Function Prototypes     --------------------- */
+uint32_t PWM_lutWidth(uint8_t ui8Unit, uint32_t ui32Duty, uint32_t ui32Period,
+                      uint32_t ui32PwmClock);       // Pulse width of a duty cycle in PWM clocks
+void PWM_lutInit(tPwmLut *psLut, uint8_t ui8Unit, uint32_t ui32Period,
+                 uint32_t ui32PwmClock, uint16_t *pui16Cmp);    // Fill the table of a generator
+
+#endif /* PWM_LUT_H_ */
@@ -0,0 +1,42 @@
+/*!
+ * @author      Yash Bansod
+ * @date        17th October 2026
+ *
+ * @brief       Source containing function definitions for the leg encoder GPIO configuration
+ * @file        QDEC_config.c
+ */
+/* -----------------------          Include Files       --------------------- */
+#include "QDEC_config.h"
+
+/* -----------------------      Function Definition     --------------------- */
+// Function for Initializing the encoder pins of PortC and PortE
+void QDEC_init(void){
+    // Enable the clock to the GPIOC and GPIOE peripherals
+    ROM_SysCtlPeripheralEnable(SYSCTL_PERIPH_GPIOC);
+    ROM_SysCtlPeripheralEnable(SYSCTL_PERIPH_GPIOE);
+
+    // Set the encoder pins as input with the internal Pull-up resistors (open collector encoders)
+    ROM_GPIOPinTypeGPIOInput(GPIO_PORTC_BASE, QDEC_PORTC_PINS);
+    ROM_GPIOPadConfigSet(GPIO_PORTC_BASE, QDEC_PORTC_PINS, GPIO_STRENGTH_2MA, GPIO_PIN_TYPE_STD_WPU);
+    ROM_GPIOPinTypeGPIOInput(GPIO_PORTE_BASE, QDEC_PORTE_PINS);
+    ROM_GPIOPadConfigSet(GPIO_PORTE_BASE, QDEC_PORTE_PINS, GPIO_STRENGTH_2MA, GPIO_PIN_TYPE_STD_WPU);
+
+    // Interrupt on both edges of both phases and drop the edges latched while configuring
+    ROM_GPIOIntTypeSet(GPIO_PORTC_BASE, QDEC_PORTC_PINS, GPIO_BOTH_EDGES);
+    ROM_GPIOIntTypeSet(GPIO_PORTE_BASE, QDEC_PORTE_PINS, GPIO_BOTH_EDGES);
+    GPIOIntClear(GPIO_PORTC_BASE, QDEC_PORTC_PINS);
+    GPIOIntClear(GPIO_PORTE_BASE, QDEC_PORTE_PINS);
+}
+
+// Function for Enabling the encoder pin interrupts
+void QDEC_enable(void){
+    // The encoders preempt the other interrupts (INT_PRIORITY_LOW) and the reply of CMD_service() masking them
+    ROM_IntPrioritySet(INT_GPIOC, QDEC_INT_PRIORITY);
+    ROM_IntPrioritySet(INT_GPIOE, QDEC_INT_PRIORITY);
+
+    // Edges since QDEC_init() are latched and raise the interrupt as soon as it is enabled
+    GPIOIntEnable(GPIO_PORTC_BASE, QDEC_PORTC_PINS);
+    GPIOIntEnable(GPIO_PORTE_BASE, QDEC_PORTE_PINS);
+    ROM_IntEnable(INT_GPIOC);
+    ROM_IntEnable(INT_GPIOE);
+}
@@ -0,0 +1,21 @@
+/*!
+ * @author      Yash Bansod
+ * @date        17th October 2026
+ *
+ * @brief       Header containing function prototypes for the leg encoder GPIO configuration
+ * @file        QDEC_config.h
+ */
+/* -----------------------          Include Files       --------------------- */
+#include "includes.h"
+#include "macros.h"
+#include "Int_handlers.h"
+#include "globalVariables.h"
+
+/* -----------------------      Function Prototypes     --------------------- */
+#ifndef QDEC_CONFIG_H_
+#define QDEC_CONFIG_H_
+
+void QDEC_init(void);                               // Function for Initializing the encoder pins of PortC and PortE
+void QDEC_enable(void);                             // Function for Enabling the encoder pin interrupts
+
+#endif /* QDEC_CONFIG_H_ */
@@ -0,0 +1,67 @@
+/*!
+ * @author      Yash Bansod
+ * @date        17th October 2026
+ *
+ * @brief       Source containing the GPIO quadrature decoder of the leg encoders
+ * @details     The state of a channel is PhB << 1 | PhA. Forward (PhA leading) runs
+ *              0 -> 1 -> 3 -> 2 -> 0 and the table is indexed by old << 2 | new.
+ * @file        QDEC_decode.c
+ */
+/* -----------------------          Include Files       --------------------- */
+#include "QDEC_decode.h"
+
+/* -----------------------      Global Variables        --------------------- */
+static const int8_t i8QdecTable[16] = {
+    0,            1,           -1,            QDEC_ILLEGAL,   // From 0
+   -1,            0,            QDEC_ILLEGAL, 1,              // From 1
+    1,            QDEC_ILLEGAL, 0,           -1,              // From 2
+    QDEC_ILLEGAL, -1,           1,            0               // From 3
+};
+
+/* -----------------------      Function Definition     --------------------- */
+// Function to reset the channels of a port, ui32Pins is the port read before its interrupt is enabled
+void QDEC_portInit(tQdecPort *psPort, uint8_t ui8Shift, uint8_t ui8Channels,
+                   tQdecChannel *psChannel, uint32_t ui32Pins){
+    uint8_t ui8Index;
+
+    if (ui8Channels > QDEC_PORT_CHANNELS) ui8Channels = QDEC_PORT_CHANNELS;
+
+    psPort->ui8Shift = ui8Shift;
+    psPort->ui8Channels = ui8Channels;
+    psPort->ui8Mask = (uint8_t)QDEC_PINS(0, ui8Channels);
+    psPort->ui8State = (uint8_t)(ui32Pins >> ui8Shift) & psPort->ui8Mask;
+    psPort->ui32Updates = 0;
+    psPort->psChannel = psChannel;
+
+    for (ui8Index = 0; ui8Index < ui8Channels; ui8Index++){
+        psChannel[ui8Index].i32Count = 0;
+        psChannel[ui8Index].ui32Illegal = 0;
+    }
+}
+
+// Function to decode every channel of a port from one read of its pins
+void QDEC_portUpdate(tQdecPort *psPort, uint32_t ui32Pins){
+    uint32_t ui32New = (ui32Pins >> psPort->ui8Shift) & psPort->ui8Mask;
+    uint32_t ui32Old = psPort->ui8State;
+    uint32_t ui32Changed = ui32New ^ ui32Old;
+    tQdecChannel *psChannel = psPort->psChannel;
+
+    psPort->ui8State = (uint8_t)ui32New;
+    psPort->ui32Updates++;
+
+    // Only the channels with a changed pin are looked up, the loop ends with the last of them
+    while (ui32Changed){
+        if (ui32Changed & 0x03){
+            int8_t i8Step = i8QdecTable[((ui32Old & 0x03) << 2) | (ui32New & 0x03)];
+
+            if (i8Step == QDEC_ILLEGAL)
+                psChannel->ui32Illegal++;
+            else
+                psChannel->i32Count += i8Step;
+        }
+        ui32Changed >>= 2;
+        ui32Old >>= 2;
+        ui32New >>= 2;
+        psChannel++;
+    }
+}
@@ -0,0 +1,55 @@
+/*!
+ * @author      Yash Bansod
+ * @date        17th October 2026
+ *
+ * @brief       Header containing the GPIO quadrature decoder of the leg encoders
+ * @details     The two QEI blocks of the TM4C123 are not enough for the leg encoders,
+ *              so their phases are read from GPIO pins interrupting on both edges.
+ *              The channels of a port sit on consecutive pin pairs, PhA on the lower
+ *              pin, starting at pin ui8Shift. The interrupt reads the whole port once
+ *              and decodes every channel from its last and new 2 bit state through a
+ *              16 entry transition table, so the edges of all the channels that are
+ *              pending when the interrupt runs cost a single pass.
+ *              A transition that changes both phases at once skipped a state, the
+ *              direction of the missed step is unknown and it is counted as illegal
+ *              instead of as a step. Two skipped states in a row are invisible, so the
+ *              edge rate has to stay below the rate at which the interrupt keeps up
+ *              (see QDEC_bench in Host Tools).
+ * @file        QDEC_decode.h
+ */
+/* -----------------------          Include Files       --------------------- */
+#include <stdint.h>                         // Library of Standard Integer Types
+#include <stdbool.h>                        // Library of Standard Boolean Types
+#include "macros.h"
+
+#ifndef QDEC_DECODE_H_
+#define QDEC_DECODE_H_
+
+/* -----------------------      Macro Definitions       --------------------- */
+#define QDEC_ILLEGAL        2                       // Macro for a transition table entry that skipped a state
+#define QDEC_PORT_CHANNELS  4                       // Macro for the most channels on one 8 pin port
+
+// Macro for the pins of ui8Channels channels starting at pin ui8Shift
+#define QDEC_PINS(ui8Shift, ui8Channels)    ((((1u << (2 * (ui8Channels))) - 1) << (ui8Shift)) & 0xFF)
+
+/* -----------------------      Global Variables        --------------------- */
+typedef struct {
+    volatile int32_t i32Count;                      // Quadrature count, 4 per line of the encoder
+    volatile uint32_t ui32Illegal;                  // Transitions that skipped a state
+} tQdecChannel;
+
+typedef struct {
+    uint8_t ui8Shift;                               // Pin of PhA of the first channel
+    uint8_t ui8Channels;                            // Channels on consecutive pin pairs
+    uint8_t ui8Mask;                                // Bits of the channels after the shift
+    uint8_t ui8State;                               // Pin state of the last read, 2 bits per channel
+    uint32_t ui32Updates;                           // Port reads decoded
+    tQdecChannel *psChannel;                        // ui8Channels channels of the port
+} tQdecPort;
+
+/* -----------------------      Function Prototypes     --------------------- */
+void QDEC_portInit(tQdecPort *psPort, uint8_t ui8Shift, uint8_t ui8Channels,
+                   tQdecChannel *psChannel, uint32_t ui32Pins);  // Reset, ui32Pins read now
+void QDEC_portUpdate(tQdecPort *psPort, uint32_t ui32Pins);      // Decode a read of the port
+
+#endif /* QDEC_DECODE_H_ */
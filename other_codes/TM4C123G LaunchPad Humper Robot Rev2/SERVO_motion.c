@@ -0,0 +1,128 @@
+/*!
+ * @author      Yash Bansod
+ * @date        17th October 2026
+ *
+ * @brief       Source containing the motion interpolation of the servo legs
+ * @details     Moving at speed s and braking by a per tick covers s + (s - a) + ...,
+ *              about s^2 / 2a + s / 2, so the fastest speed that still stops on the
+ *              target from a distance d is (sqrt(8ad + a^2) - a) / 2. A leg takes the
+ *              least of this, the velocity limit and its speed plus a, and arrives when
+ *              the step reaches the target, which it does once d is at most a.
+ *              A new target can be closer than the leg needs to stop. The speed then
+ *              still drops by no more than a per tick, so the leg passes the target and
+ *              turns back to it; it arrives only with a step the braking allows.
+ * @file        SERVO_motion.c
+ */
+/* -----------------------          Include Files       --------------------- */
+#include "SERVO_motion.h"
+
+/* -----------------------      Function Definition     --------------------- */
+// Function to get the integer square root of a 64 bit number
+static uint32_t SERVO_sqrt(uint64_t ui64Value){
+    uint64_t ui64Root = 0, ui64Bit = (uint64_t)1 << 62;
+
+    while (ui64Bit > ui64Value) ui64Bit >>= 2;
+    while (ui64Bit){
+        if (ui64Value >= ui64Root + ui64Bit){
+            ui64Value -= ui64Root + ui64Bit;
+            ui64Root = (ui64Root >> 1) + ui64Bit;
+        } else
+            ui64Root >>= 1;
+        ui64Bit >>= 2;
+    }
+    return (uint32_t)ui64Root;
+}
+
+// Function to reset the engine with the legs at rest on pi16Pulse, the limits in units per s and per s^2
+void SERVO_init(tServoMotion *psMotion, const int16_t *pi16Pulse, uint32_t ui32VelMax, uint32_t ui32Accel,
+                uint32_t ui32TickHz, uint8_t ui8SettleTicks){
+    uint8_t ui8Index;
+
+    psMotion->i32VelMax = (int32_t)(((uint64_t)ui32VelMax << SERVO_Q) / ui32TickHz);
+    psMotion->i32Accel = (int32_t)(((uint64_t)ui32Accel << SERVO_Q) / ((uint64_t)ui32TickHz * ui32TickHz));
+    if (psMotion->i32VelMax < 1) psMotion->i32VelMax = 1;
+    if (psMotion->i32Accel < 1) psMotion->i32Accel = 1;
+    psMotion->ui8SettleTicks = ui8SettleTicks;
+    psMotion->ui8Moving = 0;
+    psMotion->ui8Settling = 0;
+    psMotion->ui32Ticks = 0;
+
+    for (ui8Index = 0; ui8Index < SERVO_AXES; ui8Index++){
+        psMotion->psAxis[ui8Index].i32Pos = (int32_t)pi16Pulse[ui8Index] << SERVO_Q;
+        psMotion->psAxis[ui8Index].i32Vel = 0;
+        psMotion->psAxis[ui8Index].i16Target = pi16Pulse[ui8Index];
+        psMotion->psAxis[ui8Index].ui8Settle = 0;
+    }
+}
+
+// Function to set new targets of all the legs, a leg in motion turns towards its new target
+void SERVO_moveTo(tServoMotion *psMotion, const int16_t *pi16Target){
+    uint8_t ui8Index;
+
+    for (ui8Index = 0; ui8Index < SERVO_AXES; ui8Index++){
+        tServoAxis *psAxis = &psMotion->psAxis[ui8Index];
+        uint8_t ui8Bit = 1u << ui8Index;
+
+        psAxis->i16Target = pi16Target[ui8Index];
+        if (psAxis->i32Pos == ((int32_t)psAxis->i16Target << SERVO_Q) && psAxis->i32Vel == 0){
+            // Already there and at rest, complete at the next tick
+            psAxis->ui8Settle = 0;
+            psMotion->ui8Moving &= ~ui8Bit;
+            psMotion->ui8Settling |= ui8Bit;
+        } else{
+            psMotion->ui8Moving |= ui8Bit;
+            psMotion->ui8Settling &= ~ui8Bit;
+        }
+    }
+}
+
+// Function to advance all the legs by one tick, writes their pulse widths and returns the legs completing now
+uint8_t SERVO_tick(tServoMotion *psMotion, int16_t *pi16Pulse){
+    int64_t i64Accel = psMotion->i32Accel;
+    uint8_t ui8Index, ui8Done = 0;
+
+    psMotion->ui32Ticks++;
+
+    for (ui8Index = 0; ui8Index < SERVO_AXES; ui8Index++){
+        tServoAxis *psAxis = &psMotion->psAxis[ui8Index];
+        uint8_t ui8Bit = 1u << ui8Index;
+
+        if (psMotion->ui8Moving & ui8Bit){
+            int64_t i64Dist = ((int64_t)psAxis->i16Target << SERVO_Q) - psAxis->i32Pos;
+            int32_t i32Dir = (i64Dist < 0) ? -1 : 1;
+            int64_t i64Speed = (int64_t)psAxis->i32Vel * i32Dir;    // Speed towards the target
+            int64_t i64Allow, i64Next;
+
+            i64Dist *= i32Dir;
+            i64Allow = ((int64_t)SERVO_sqrt((uint64_t)(8 * i64Accel * i64Dist + i64Accel * i64Accel))
+                        - i64Accel) / 2;
+            i64Next = i64Speed + i64Accel;
+            if (i64Next > psMotion->i32VelMax) i64Next = psMotion->i32VelMax;
+            if (i64Next > i64Allow) i64Next = i64Allow;
+            if (i64Next < i64Speed - i64Accel) i64Next = i64Speed - i64Accel;     // Too fast to stop, brake
+
+            if (i64Next >= i64Dist && i64Next <= i64Allow){
+                // The step reaches the target, wait for the servo to follow
+                psAxis->i32Pos = (int32_t)psAxis->i16Target << SERVO_Q;
+                psAxis->i32Vel = 0;
+                psAxis->ui8Settle = psMotion->ui8SettleTicks;
+                psMotion->ui8Moving &= ~ui8Bit;
+                if (psAxis->ui8Settle)
+                    psMotion->ui8Settling |= ui8Bit;
+                else
+                    ui8Done |= ui8Bit;
+            } else{
+                psAxis->i32Vel = (int32_t)(i64Next * i32Dir);
+                psAxis->i32Pos += psAxis->i32Vel;
+            }
+        } else if (psMotion->ui8Settling & ui8Bit){
+            if (psAxis->ui8Settle) psAxis->ui8Settle--;
+            if (psAxis->ui8Settle == 0){
+                psMotion->ui8Settling &= ~ui8Bit;
+                ui8Done |= ui8Bit;
+            }
+        }
+        pi16Pulse[ui8Index] = (int16_t)((psAxis->i32Pos + (1 << (SERVO_Q - 1))) >> SERVO_Q);
+    }
+    return ui8Done;
+}
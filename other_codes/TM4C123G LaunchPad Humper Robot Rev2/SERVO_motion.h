@@ -0,0 +1,63 @@
+/*!
+ * @author      Yash Bansod
+ * @date        17th October 2026
+ *
+ * @brief       Header containing the motion interpolation of the servo legs
+ * @details     Instead of jumping each servo to a new pulse width, SERVO_moveTo() sets
+ *              targets and SERVO_tick(), called once per PWM period for all the legs,
+ *              moves the commanded pulse width of each leg towards its target along a
+ *              trapezoidal velocity profile: it accelerates at the acceleration limit
+ *              up to the velocity limit and brakes at the same rate so that it stops
+ *              on the target. A new target in the middle of a motion brakes and turns
+ *              the leg without a jump in velocity; if it is closer than the leg needs to
+ *              stop, the leg passes it and comes back. The servo lags the command, so an
+ *              arrived leg waits ui8SettleTicks more ticks before its completion bit
+ *              is returned; a leg already at its target completes at the next tick.
+ *              The pulse widths are in the unit of PWM_RESOLUTION, kept internally in
+ *              1/65536 of it, and the limits are given per second and converted to the
+ *              tick rate by SERVO_init(). The legs are the PWM_CHANNELS channels of
+ *              PWM_config.c, bit n of the masks is leg n (at most 8 legs).
+ * @file        SERVO_motion.h
+ */
+/* -----------------------          Include Files       --------------------- */
+#include <stdint.h>                         // Library of Standard Integer Types
+#include <stdbool.h>                        // Library of Standard Boolean Types
+#include "macros.h"
+
+#ifndef SERVO_MOTION_H_
+#define SERVO_MOTION_H_
+
+/* -----------------------      Macro Definitions       --------------------- */
+#define SERVO_AXES          PWM_CHANNELS            // Macro for the legs moved by one engine
+#define SERVO_Q             16                      // Macro for the fraction bits of positions and velocities
+#define SERVO_ALL           ((uint8_t)((1u << SERVO_AXES) - 1))     // Macro for the mask of all the legs
+
+// Macros for the state of an engine
+#define SERVO_MOVING(psMotion)  ((psMotion)->ui8Moving != 0)        // A commanded pulse width is changing
+#define SERVO_IDLE(psMotion)    (((psMotion)->ui8Moving | (psMotion)->ui8Settling) == 0)   // All legs completed
+
+/* -----------------------      Global Variables        --------------------- */
+typedef struct {
+    int32_t i32Pos;                                 // Commanded pulse width, 1/65536 of the unit
+    int32_t i32Vel;                                 // Velocity, 1/65536 of the unit per tick
+    int16_t i16Target;                              // Target pulse width
+    uint8_t ui8Settle;                              // Ticks left before the completion bit
+} tServoAxis;
+
+typedef struct {
+    tServoAxis psAxis[SERVO_AXES];                  // Legs in the order of the PWM channels
+    int32_t i32VelMax;                              // Velocity limit, 1/65536 of the unit per tick
+    int32_t i32Accel;                               // Acceleration limit, 1/65536 of the unit per tick^2
+    uint8_t ui8SettleTicks;                         // Ticks an arrived leg waits for the servo
+    uint8_t ui8Moving;                              // Legs whose commanded pulse width is changing
+    uint8_t ui8Settling;                            // Legs counting their settle ticks
+    uint32_t ui32Ticks;                             // Ticks run since SERVO_init()
+} tServoMotion;
+
+/* -----------------------      Function Prototypes     --------------------- */
+void SERVO_init(tServoMotion *psMotion, const int16_t *pi16Pulse, uint32_t ui32VelMax, uint32_t ui32Accel,
+                uint32_t ui32TickHz, uint8_t ui8SettleTicks);    // Reset at pulse widths, limits per s and s^2
+void SERVO_moveTo(tServoMotion *psMotion, const int16_t *pi16Target);   // Set new targets of all the legs
+uint8_t SERVO_tick(tServoMotion *psMotion, int16_t *pi16Pulse);         // Advance one tick, returns completions
+
+#endif /* SERVO_MOTION_H_ */
@@ -15,8 +15,8 @@ void TIMER0_init(void){
     ROM_SysCtlPeripheralEnable(SYSCTL_PERIPH_TIMER0);
     // Configure Timer0 to run in periodic mode
     ROM_TimerConfigure(TIMER0_BASE, TIMER_CFG_PERIODIC);
-    // Load the Timer with the calculated period (= 400ms).
-    ROM_TimerLoadSet(TIMER0_BASE, TIMER_A, (ROM_SysCtlClockGet() * 4 / 10) - 1);
+    // Load the Timer with the period of the servo motion tick (= 20ms)
+    ROM_TimerLoadSet(TIMER0_BASE, TIMER_A, (ROM_SysCtlClockGet() / SERVO_TICK_HZ) - 1);
 }
 
 // Function for Enabling TIMER0 Peripheral
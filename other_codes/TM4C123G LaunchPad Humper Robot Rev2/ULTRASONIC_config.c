@@ -41,3 +41,13 @@ void ULTRASONIC_enable(void){
     // Enables a specific event within the timer to generate an interrupt
     ROM_TimerIntEnable(TIMER1_BASE, TIMER_TIMA_TIMEOUT);
 }
+
+// Function for Starting a range measurement, Timer1 ends the trigger pulse
+void ULTRASONIC_trigger(void){
+    // Load the Timer with value for generating a  delay of 10 uS.
+    ROM_TimerLoadSet(TIMER1_BASE, TIMER_A, (ROM_SysCtlClockGet() / 100000) -1);
+    // Make the Trigger Pin (PA3) High
+    ROM_GPIOPinWrite(GPIO_PORTA_BASE, GPIO_PIN_3, GPIO_PIN_3);
+    // Enable the Timer1 to cause an interrupt when timeout occurs
+    ROM_TimerEnable(TIMER1_BASE, TIMER_A);
+}
@@ -17,5 +17,6 @@
 
  void ULTRASONIC_init(void);                           // Function for Initializing ULTRASONIC
  void ULTRASONIC_enable(void);                         // Function for Enabling ULTRASONIC
+ void ULTRASONIC_trigger(void);                        // Function for Starting a range measurement
 
 #endif /* ULTRASONIC_CONFIG_H_ */
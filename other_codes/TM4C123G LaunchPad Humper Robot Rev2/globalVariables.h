@@ -8,6 +8,12 @@
 /* -----------------------          Include Files       --------------------- */
 #include <stdint.h>                                 // Library of Standard Integer Types
 #include <stdbool.h>                                // Library of Standard Boolean Types
+#include "macros.h"
+#include "QDEC_decode.h"
+#include "SERVO_motion.h"
+#include "GAIT_seq.h"
+#include "PROTO_frame.h"
+#include "BTN_event.h"
 
 #ifndef GLOBALVARIABLES_H_
 #define GLOBALVARIABLES_H_
@@ -17,14 +23,47 @@ static bool boolTrigCondition = 1;                  // Variable to control the T
 static uint32_t ui32EchoDuration[2] = {0, 0};       // Array to store duration for which Echo Pin is high
 static int8_t i8EchoChange = 0;                     // Variable to store the change in Echo Duration
 
-static uint32_t ui32Period_PWM;                     // Variable to store PWM time period
-
-static int16_t i16Adjust_PWM0_5[2] = {60, 90};      // Array to store Duty Cycles of Servo_RightFront
-static int16_t i16Adjust_PWM1_2[2] = {100, 70};     // Array to store Duty Cycles of Servo_RightBack
-static int16_t i16Adjust_PWM0_3[2] = {70, 100};     // Array to store Duty Cycles of Servo_LeftBack
-static int16_t i16Adjust_PWM0_1[2] = {90, 60};      // Array to store Duty Cycles of Servo_LeftFront
+// Array to store the two Duty Cycles (1/1000) of each servo in the leg order of ui8MotorControl
+static const int16_t i16ServoDuty[PWM_CHANNELS][2] = {
+    {100, 70},                                      // Servo_RightBack (PWM1_2)
+    {60, 90},                                       // Servo_RightFront (PWM0_5)
+    {90, 60},                                       // Servo_LeftFront (PWM0_1)
+    {70, 100}                                       // Servo_LeftBack (PWM0_3)
+};
 
 static uint8_t ui8ServoStatus[2] = {0x00, 0x00};    // Array to store current and old servo status
 static uint8_t ui8TerminateStatus = 0x00;           // Variable to store the terminate condition
 
+static tQdecChannel sQdecChannel[QDEC_CHANNELS];    // Array of the leg encoder counts, PortC first
+static tQdecPort sQdecPortC;                        // Decoder state of the PortC encoders
+static tQdecPort sQdecPortE;                        // Decoder state of the PortE encoders
+
+static tServoMotion sServoMotion;                   // Motion of the servo legs, advanced by Timer0
+static uint16_t ui16PingTicks = 0;                  // Variable to count the ticks since the last range ping
+
+// Gait tables preloaded in the first slots, 15 ticks (300 ms) per frame at 100 % speed
+static const uint8_t ui8GaitTrot[GAIT_TABLE_LEN(2)] = {
+    GAIT_LEGS, 2, GAIT_LOOP, 0,
+    15, 70, 60, 60, 70,                             // Diagonal pair command 0x0A
+    15, 100, 90, 90, 100                            // Diagonal pair command 0x05
+};
+static const uint8_t ui8GaitToggle[GAIT_TABLE_LEN(2)] = {
+    GAIT_LEGS, 2, GAIT_LOOP, 0,
+    15, 100, 60, 90, 70,                            // Command 0x00
+    15, 70, 90, 60, 100                             // Command 0x0F
+};
+
+static uint8_t ui8GaitSlot[GAIT_SLOTS][GAIT_TABLE_MAX]; // Gait tables played by the sequencer
+static tBtnPort sBtnPort;                           // Debounced SW1 and SW2, sampled by Timer0
+static tGaitSeq sGaitSeq;                           // Gait sequencer, advanced by Timer0
+static uint8_t ui8GaitPlayed = 0xFF;                // Variable to store the slot played, 0xFF for none
+
+static tProtoParser sProtoParser;                   // Parser of the frames received by UART0
+static uint32_t ui32UartLast;                       // Motion tick of the last bytes received by UART0
+static tProtoFrame sCmdQueue[CMD_QUEUE_LEN];        // Command frames waiting for CMD_service()
+static volatile uint32_t ui32CmdHead = 0;           // Frames queued by UART0IntHandler
+static volatile uint32_t ui32CmdTail = 0;           // Frames executed by CMD_service()
+static volatile uint32_t ui32CmdDropped = 0;        // Frames dropped because the queue was full
+static volatile bool boolFramed = false;            // Variable to send the range as frames, set by the first frame
+
 #endif /* GLOBALVARIABLES_H_ */
@@ -16,10 +16,14 @@
 #include <string.h>                         // Library for String functions
 #include <inttypes.h>                       // Library for conversions to Integer types
 
+#ifdef HOST_SIM
+#include "HOST_regs.h"                      // Host register-level stand-in for the DriverLib API (see other_codes/Host Tools)
+#else
 #include "inc/tm4c123gh6pm.h"               // Definitions for interrupt and register assignments on Tiva C
 #include "inc/hw_memmap.h"                  // Macros defining the memory map of the Tiva C Series device
 #include "inc/hw_types.h"                   // Defines common types and macros
 #include "inc/hw_gpio.h"                    // Defines Macros for GPIO hardware
+#include "inc/hw_pwm.h"                     // Defines and Macros for Pulse Width Modulation (PWM) ports
 #include "inc/hw_timer.h"                   // Defines and macros used when accessing the timer
 
 #include "driverlib/timer.h"                // Defines and macros for Timer API of driverLib
@@ -31,5 +35,6 @@
 #include "driverlib/uart.h"                 // Defines and Macros for the UART
 #include "driverlib/pin_map.h"              // Mapping of peripherals to pins for all parts
 #include "driverlib/rom.h"                  // Defines and macros for ROM API of driverLib
+#endif
 
 #endif /* INCLUDES_H_ */
@@ -10,6 +10,33 @@
 #define MACROS_H_
 /* -----------------------      Macro Definitions       --------------------- */
 #define PWM_FREQUENCY   50                          // Macro for the frequency of PWM signal in Hz
+#define PWM_CHANNELS    4                           // Macro for the servo PWM channels
+#define PWM_RESOLUTION  PWM_LUT_PERMILLE            // Macro for the unit of the servo duty cycles (see PWM_lut.h)
+#define PWM_LUTS        1                           // Macro for the compare tables, one per distinct PWM period
 #define UART0_BAUDRATE  115200                      // Macro for UART0 Baud rate
+#define UART0_GAP_TICKS 2                           // Macro for the motion ticks of idle UART0 that end a frame in progress (20 to 40 ms)
+
+#define SERVO_TICK_HZ       PWM_FREQUENCY           // Macro for the motion ticks per second, one per PWM period
+#define SERVO_VEL_MAX       200                     // Macro for the velocity limit of the legs in 1/1000 per s
+#define SERVO_ACCEL         1500                    // Macro for the acceleration limit of the legs in 1/1000 per s^2
+#define SERVO_SETTLE_TICKS  3                       // Macro for the ticks the servos get to follow an arrived command
+#define SERVO_PING_TICKS    20                      // Macro for the ticks between range pings of idle legs (400 ms)
+
+#define BUTTON_SW1          4                       // Macro for the pin of SW1 (PF4) in the button events
+#define BUTTON_SW2          0                       // Macro for the pin of SW2 (PF0) in the button events
+#define BUTTON_PINS         (GPIO_PIN_4 | GPIO_PIN_0)   // Macro for the button pins of PortF
+
+#define GAIT_SLOTS          4                       // Macro for the gait tables held in RAM, the first two preloaded
+#define CMD_QUEUE_LEN       2                       // Macro for the command frames queued for the main loop (power of 2)
+
+#define QDEC_PORTC_SHIFT    4                       // Macro for the PhA pin of the first encoder on PortC (PC4)
+#define QDEC_PORTC_CHANNELS 2                       // Macro for the encoders on PortC (PC4/PC5, PC6/PC7)
+#define QDEC_PORTE_SHIFT    0                       // Macro for the PhA pin of the first encoder on PortE (PE0)
+#define QDEC_PORTE_CHANNELS 2                       // Macro for the encoders on PortE (PE0/PE1, PE2/PE3)
+#define QDEC_CHANNELS       (QDEC_PORTC_CHANNELS + QDEC_PORTE_CHANNELS) // Macro for the leg encoders
+#define QDEC_PORTC_PINS     QDEC_PINS(QDEC_PORTC_SHIFT, QDEC_PORTC_CHANNELS)    // Macro for the PortC encoder pins
+#define QDEC_PORTE_PINS     QDEC_PINS(QDEC_PORTE_SHIFT, QDEC_PORTE_CHANNELS)    // Macro for the PortE encoder pins
+#define QDEC_INT_PRIORITY   0x00                    // Macro for the priority of the encoder port interrupts
+#define INT_PRIORITY_LOW    0x20                    // Macro for the priority of the other interrupts
 
 #endif /* MACROS_H_ */
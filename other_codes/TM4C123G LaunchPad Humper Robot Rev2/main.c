@@ -9,6 +9,20 @@
  *              The Humper Robot is a Quadrupled Robot (4 x MG995 Servos)
  *              with a Range Sensor (HC-SR04) for measuring its
  *              distance from a wall.
+ *              The legs follow the single byte motor commands 0x00 to 0x0F of the PC
+ *              program, or play keyframe gaits (see "GAIT_seq.h") commanded by the
+ *              framed commands of "PROTO_frame.h": PROTO_GAIT_LOAD uploads a table to a
+ *              slot, PROTO_GAIT_PLAY walks it at a speed with a blend from the gait
+ *              played before, so the PC sends "walk at speed X" instead of every pose.
+ *              UART0IntHandler queues the frames, CMD_service() in the main loop
+ *              executes and answers them in order. Bytes received after UART0_GAP_TICKS
+ *              of idle line drop a frame left open by noise, which would otherwise take
+ *              the motor commands that follow.
+ *              SW1 and SW2 are sampled by the Timer0 tick and their debounced events
+ *              (see "BTN_event.h") are handled by BUTTON_service() in the main loop, so
+ *              no interrupt waits for a button to be released. SW1 inverts the motor
+ *              command, a double press of SW1 walks the built-in trot, SW2 sends the
+ *              terminate status.
  *
  * @note        The tm4c123ghpm_startup_ccs.c contains the vector table for the
  *              microcontroller.
@@ -24,10 +38,21 @@
 #include "GPIO_config.h"
 #include "TIMER_config.h"
 #include "ULTRASONIC_config.h"
+#include "QDEC_config.h"
+#include "SERVO_motion.h"
+#include "GAIT_seq.h"
+#include "PROTO_frame.h"
+#include "BTN_event.h"
+
+#if GAIT_TABLE_MAX + 1 > PROTO_MAX_PAYLOAD
+#error "A gait table does not fit in the payload of PROTO_GAIT_LOAD"
+#endif
 
 /* -----------------------      Global Variables        --------------------- */
 
 /* -----------------------      Function Prototypes     --------------------- */
+void CMD_service(void);                     // Function prototype for executing a received command
+void BUTTON_service(void);                  // Function prototype for executing the button events
 
 /* -----------------------          Main Program        --------------------- */
 int main(void) {
@@ -42,53 +67,89 @@ int main(void) {
     ULTRASONIC_init();
     // Initialize the UART0 module
     UART0_init();
-    // Initialize the PWM0 module for output from PIN5
-    PWM0_5_init();
-    // Initialize the PWM1 module for output from PIN2
-    PWM1_2_init();
-    // Initialize the PWM0 module for output from PIN3
-    PWM0_3_init();
-    // Initialize the PWM0 module for output from PIN1
-    PWM0_1_init();
-    // Initialize the Onboard Buttons
+    // Initialize the servo PWM channels at their second duty cycles
+    int16_t i16Duty[PWM_CHANNELS];
+    uint8_t ui8Index;
+    for (ui8Index = 0; ui8Index < PWM_CHANNELS; ui8Index++)
+        i16Duty[ui8Index] = i16ServoDuty[ui8Index][1];
+    PWM_init(i16Duty);
+    // Start the servo motion with the legs at rest on these duty cycles
+    SERVO_init(&sServoMotion, i16Duty, SERVO_VEL_MAX, SERVO_ACCEL, SERVO_TICK_HZ, SERVO_SETTLE_TICKS);
+    // Preload the built-in gaits and stop the sequencer at the same pose
+    memcpy(ui8GaitSlot[0], ui8GaitTrot, sizeof(ui8GaitTrot));
+    memcpy(ui8GaitSlot[1], ui8GaitToggle, sizeof(ui8GaitToggle));
+    GAIT_init(&sGaitSeq, i16Duty);
+    // Reset the command parser
+    PROTO_parserInit(&sProtoParser);
+    // Initialize the Onboard Buttons, sampled at the motion tick
     BUTTON_init();
-    // Initialize the Timer0
+    BTN_init(&sBtnPort, BUTTON_PINS, BUTTON_PINS, SERVO_TICK_HZ);
+    // Initialize the Timer0 for the servo motion tick
     TIMER0_init();
+    // Initialize the leg encoder pins
+    QDEC_init();
 
 
     // Enable the ULTRASONIC peripheral
     ULTRASONIC_enable();
     // Enable the UART0 peripheral
     UART0_enable();
-    // Enable the PWM0 PIN5
-    PWM0_5_enable();
-    // Enable the PWM1 PIN2
-    PWM1_2_enable();
-    // Enable the PWM0 PIN3
-    PWM0_3_enable();
-    // Enable the PWM0 PIN1
-    PWM0_1_enable();
-    // Enable the Onboard Buttons
-    BUTTON_enable();
+    // Enable the servo PWM generators
+    PWM_enable();
     // Enable the Timer0
     TIMER0_enable();
 
-    // Start an infinite loop
-    while (true);
+    // Run the other interrupts below the leg encoder ports
+    ROM_IntPrioritySet(INT_UART0, INT_PRIORITY_LOW);
+    ROM_IntPrioritySet(INT_TIMER0A, INT_PRIORITY_LOW);
+    ROM_IntPrioritySet(INT_TIMER1A, INT_PRIORITY_LOW);
+    ROM_IntPrioritySet(INT_GPIOA, INT_PRIORITY_LOW);
+    // Start the leg encoder counts from the pin state before their interrupts are enabled
+    QDEC_portInit(&sQdecPortC, QDEC_PORTC_SHIFT, QDEC_PORTC_CHANNELS, &sQdecChannel[0],
+                  ROM_GPIOPinRead(GPIO_PORTC_BASE, QDEC_PORTC_PINS));
+    QDEC_portInit(&sQdecPortE, QDEC_PORTE_SHIFT, QDEC_PORTE_CHANNELS, &sQdecChannel[QDEC_PORTC_CHANNELS],
+                  ROM_GPIOPinRead(GPIO_PORTE_BASE, QDEC_PORTE_PINS));
+    // Enable the leg encoder interrupts
+    QDEC_enable();
+
+    while (true){
+        // Execute the commands received over UART0
+        CMD_service();
+        // Execute the button events
+        BUTTON_service();
+    }
 }
 
 /* -----------------------      Function Definition     --------------------- */
 void Timer0IntHandler(void){
-    // The ISR for Timer0 Interrupt Handling
+    // The ISR for Timer0 Interrupt Handling, the servo motion tick
     // Clear the timer interrupt
     ROM_TimerIntClear(TIMER0_BASE, TIMER_TIMA_TIMEOUT);
 
-    // Load the Timer with value for generating a  delay of 10 uS.
-    ROM_TimerLoadSet(TIMER1_BASE, TIMER_A, (ROM_SysCtlClockGet() / 100000) -1);
-    // Make the Trigger Pin (PA3) High
-    ROM_GPIOPinWrite(GPIO_PORTA_BASE, GPIO_PIN_3, GPIO_PIN_3);
-    // Enable the Timer0 to cause an interrupt when timeout occurs
-    ROM_TimerEnable(TIMER1_BASE, TIMER_A);
+    // Sample SW1 and SW2, their events are handled by BUTTON_service()
+    BTN_sample(&sBtnPort, HWREG(GPIO_PORTF_BASE + GPIO_O_DATA + (BUTTON_PINS << 2)));
+
+    // Advance the gait by one tick, its pose is the new target of the legs
+    int16_t i16Duty[PWM_CHANNELS];
+    bool boolPlaying = GAIT_PLAYING(&sGaitSeq);
+    if (boolPlaying){
+        GAIT_tick(&sGaitSeq, i16Duty);
+        SERVO_moveTo(&sServoMotion, i16Duty);
+    }
+
+    // Advance the legs by one PWM period, the new duties latch together at the next one
+    bool boolMoving = SERVO_MOVING(&sServoMotion);
+    uint8_t ui8Done = SERVO_tick(&sServoMotion, i16Duty);
+    if (boolMoving)
+        PWM_updateAll(i16Duty);
+
+    // Measure the range once the last leg completes its motion, and every 400 ms while idle or walking
+    ui16PingTicks++;
+    if ((ui8Done && SERVO_IDLE(&sServoMotion)) ||
+        ((SERVO_IDLE(&sServoMotion) || boolPlaying) && ui16PingTicks >= SERVO_PING_TICKS)){
+        ui16PingTicks = 0;
+        ULTRASONIC_trigger();
+    }
 }
 
 void Timer1IntHandler(void){
@@ -106,19 +167,47 @@ void UART0IntHandler(void){
     // Clear the asserted UART interrupts
     ROM_UARTIntClear(UART0_BASE, ROM_UARTIntStatus(UART0_BASE, true));
 
-    // Disable the Timer
-    ROM_TimerDisable(TIMER0_BASE, TIMER_A);
-
     // Glow the Blue LED
     ROM_GPIOPinWrite(GPIO_PORTF_BASE, GPIO_PIN_3 | GPIO_PIN_2 | GPIO_PIN_1, GPIO_PIN_2);
 
+    // Bytes that come UART0_GAP_TICKS after the last ones cannot belong to the frame in progress
+    if (ROM_UARTCharsAvail(UART0_BASE)){
+        if (sServoMotion.ui32Ticks - ui32UartLast >= UART0_GAP_TICKS)
+            PROTO_parserIdle(&sProtoParser);
+        ui32UartLast = sServoMotion.ui32Ticks;
+    }
+
     // While there is a character available at input
+    bool boolMotorCmd = false;
     while(ROM_UARTCharsAvail(UART0_BASE)){
+        uint8_t ui8Byte = (uint8_t)ROM_UARTCharGetNonBlocking(UART0_BASE);
+        // A frame starts with PROTO_SOF, the motor commands never reach it
+        if (ui8Byte == PROTO_SOF || !PROTO_IDLE(&sProtoParser)){
+            if (PROTO_parse(&sProtoParser, ui8Byte)){
+                // Queue the frame for CMD_service(), drop it if the queue is full
+                boolFramed = true;
+                if (ui32CmdHead - ui32CmdTail >= CMD_QUEUE_LEN)
+                    ui32CmdDropped++;
+                else {
+                    sCmdQueue[ui32CmdHead & (CMD_QUEUE_LEN - 1)] = sProtoParser.sFrame;
+                    ui32CmdHead++;
+                }
+            }
+            continue;
+        }
         // Save the current Servo status as previous Servo status
         ui8ServoStatus[0] = ui8ServoStatus[1];
         // Update the current Servo status
-        ui8ServoStatus[1] = (uint8_t)ROM_UARTCharGet(UART0_BASE);
+        ui8ServoStatus[1] = ui8Byte;
+        boolMotorCmd = true;
     }
+    if (!boolMotorCmd)
+        return;
+
+    // A motor command stops the gait and is answered by the status bytes
+    GAIT_stop(&sGaitSeq, true);
+    ui8GaitPlayed = 0xFF;
+    boolFramed = false;
 
     // Convert the UART command message into motor control commands
     uint8_t ui8MotorControl[4];
@@ -127,94 +216,30 @@ void UART0IntHandler(void){
     ui8MotorControl[2] = (ui8ServoStatus[1] & 0b00000010) >> 1;
     ui8MotorControl[3] = (ui8ServoStatus[1] & 0b00000001);
 
-    // Update the PWM duty cycles of the motors
-    PWM1_2_update(ui8MotorControl[0]);
-    PWM0_5_update(ui8MotorControl[1]);
-    PWM0_1_update(ui8MotorControl[2]);
-    PWM0_3_update(ui8MotorControl[3]);
-
-    // Load the Timer with the calculated period (= 400ms)
-    // This is required to allow the Servo to actuate
-    ROM_TimerLoadSet(TIMER0_BASE, TIMER_A, (ROM_SysCtlClockGet() * 4 / 10) - 1);
-
-    // Enable the Timer
-    ROM_TimerEnable(TIMER0_BASE, TIMER_A);
+    // Move the motors to their new duty cycles, the range is measured when they complete
+    int16_t i16Duty[PWM_CHANNELS];
+    uint8_t ui8Index;
+    for (ui8Index = 0; ui8Index < PWM_CHANNELS; ui8Index++)
+        i16Duty[ui8Index] = i16ServoDuty[ui8Index][ui8MotorControl[ui8Index]];
+    SERVO_moveTo(&sServoMotion, i16Duty);
 }
 
-void PortFIntHandler(void){
-    // The ISR for GPIO PortF Interrupt Handling
-    GPIOIntClear(GPIO_PORTF_BASE , GPIO_INT_PIN_4 | GPIO_INT_PIN_0);
-
-    // If SW1(PF4) is pressed then reduce the duty cycle
-    if(ROM_GPIOPinRead(GPIO_PORTF_BASE, GPIO_PIN_4 | GPIO_PIN_0)== GPIO_PIN_0){
+void PortCIntHandler(void){
+    // The ISR for the leg encoders on GPIO PortC
+    // Clear before the read: an edge after the read latches again and the ISR runs once more
+    HWREG(GPIO_PORTC_BASE + GPIO_O_ICR) = HWREG(GPIO_PORTC_BASE + GPIO_O_MIS);
 
-        // Disable the Timer
-        ROM_TimerDisable(TIMER0_BASE, TIMER_A);
-
-        // Glow the Green LED
-        ROM_GPIOPinWrite(GPIO_PORTF_BASE, GPIO_PIN_3 | GPIO_PIN_2 | GPIO_PIN_1, GPIO_PIN_3);
-
-        // Save the current Servo command and invert it
-        ui8ServoStatus[0] = ui8ServoStatus[1];
-        ui8ServoStatus[1] = (~ui8ServoStatus[1]) & 0x0F;
-
-        // Convert the Servo command message into motor control commands
-        uint8_t ui8MotorControl[4];
-        ui8MotorControl[0] = (ui8ServoStatus[1] & 0b00001000) >> 3;
-        ui8MotorControl[1] = (ui8ServoStatus[1] & 0b00000100) >> 2;
-        ui8MotorControl[2] = (ui8ServoStatus[1] & 0b00000010) >> 1;
-        ui8MotorControl[3] = (ui8ServoStatus[1] & 0b00000001);
-
-        // Update the PWM duty cycles of the motors
-        PWM1_2_update(ui8MotorControl[0]);
-        PWM0_5_update(ui8MotorControl[1]);
-        PWM0_1_update(ui8MotorControl[2]);
-        PWM0_3_update(ui8MotorControl[3]);
-
-        // Load the Timer with the calculated period (= 400ms)
-        // This is required to allow the Servo to actuate
-        ROM_TimerLoadSet(TIMER0_BASE, TIMER_A, (ROM_SysCtlClockGet() * 4 / 10) - 1);
-
-        // While the SW1 is pressed, stall the program
-        while(ROM_GPIOPinRead(GPIO_PORTF_BASE, GPIO_PIN_4 | GPIO_PIN_0)== GPIO_PIN_0);
-        // Turn off the LED
-        ROM_GPIOPinWrite(GPIO_PORTF_BASE, GPIO_PIN_3 | GPIO_PIN_2 | GPIO_PIN_1, 0x00);
-
-        // Enable the Timer
-        ROM_TimerEnable(TIMER0_BASE, TIMER_A);
-    }
-    // If SW2(PW0) is pressed then increase the duty cycle
-    if(ROM_GPIOPinRead(GPIO_PORTF_BASE, GPIO_PIN_4 | GPIO_PIN_0)== GPIO_PIN_4){
-
-        // Disable the Timer
-        ROM_TimerDisable(TIMER0_BASE, TIMER_A);
-
-        // Glow the Red LED
-        ROM_GPIOPinWrite(GPIO_PORTF_BASE, GPIO_PIN_3 | GPIO_PIN_2 | GPIO_PIN_1, GPIO_PIN_1);
-
-        // Modify the terminate variable to send a terminate condition
-        ui8TerminateStatus = 0xFF;
-
-        // Transmit the UART Status messages to the computer
-        ROM_UARTCharPut(UART0_BASE, ui8ServoStatus[0]);
-        ROM_UARTCharPut(UART0_BASE, ui8ServoStatus[1]);
-        ROM_UARTCharPut(UART0_BASE, i8EchoChange);
-        ROM_UARTCharPut(UART0_BASE, ui8TerminateStatus);
-        ROM_UARTCharPut(UART0_BASE, '\r');
-        ROM_UARTCharPut(UART0_BASE, '\n');
-
-        // Load the Timer with the calculated period (= 400ms)
-        // This is required to allow the Servo to actuate
-        ROM_TimerLoadSet(TIMER0_BASE, TIMER_A, (ROM_SysCtlClockGet() * 4 /10) - 1);
+    // One read of the port decodes the pending edges of all its encoders
+    QDEC_portUpdate(&sQdecPortC, HWREG(GPIO_PORTC_BASE + GPIO_O_DATA + (QDEC_PORTC_PINS << 2)));
+}
 
-        // While the SW2 is pressed, stall the program
-        while(ROM_GPIOPinRead(GPIO_PORTF_BASE, GPIO_PIN_4 | GPIO_PIN_0)== GPIO_PIN_4);
-        // Turn off the LED
-        ROM_GPIOPinWrite(GPIO_PORTF_BASE, GPIO_PIN_3 | GPIO_PIN_2 | GPIO_PIN_1, 0x00);
+void PortEIntHandler(void){
+    // The ISR for the leg encoders on GPIO PortE
+    // Clear before the read: an edge after the read latches again and the ISR runs once more
+    HWREG(GPIO_PORTE_BASE + GPIO_O_ICR) = HWREG(GPIO_PORTE_BASE + GPIO_O_MIS);
 
-        // Enable the Timer
-        ROM_TimerEnable(TIMER0_BASE, TIMER_A);
-    }
+    // One read of the port decodes the pending edges of all its encoders
+    QDEC_portUpdate(&sQdecPortE, HWREG(GPIO_PORTE_BASE + GPIO_O_DATA + (QDEC_PORTE_PINS << 2)));
 }
 
 void PortAIntHandler(void){
@@ -242,15 +267,182 @@ void PortAIntHandler(void){
         // Disable Timer2 to stop measuring duration for which Echo Pin is High
         ROM_TimerDisable(TIMER2_BASE, TIMER_A);
 
-        // Transmit the UART Status messages to the computer
-        ROM_UARTCharPut(UART0_BASE, ui8ServoStatus[0]);
-        ROM_UARTCharPut(UART0_BASE, ui8ServoStatus[1]);
-        ROM_UARTCharPut(UART0_BASE, i8EchoChange);
-        ROM_UARTCharPut(UART0_BASE, ui8TerminateStatus);
-        ROM_UARTCharPut(UART0_BASE, '\r');
-        ROM_UARTCharPut(UART0_BASE, '\n');
+        if (boolFramed){
+            // Send the range as a frame to a PC driving the gaits
+            uint8_t pui8Range[6];
+            uint8_t pui8Frame[6 + PROTO_OVERHEAD];
+            pui8Range[0] = (uint8_t)i8EchoChange;
+            PROTO_putU32(pui8Range + 1, ui32EchoDuration[1]);
+            pui8Range[5] = (SERVO_IDLE(&sServoMotion) ? PROTO_FLAG_IDLE : 0) |
+                           (GAIT_PLAYING(&sGaitSeq) ? PROTO_FLAG_PLAYING : 0);
+            uint32_t ui32Len = PROTO_encode(PROTO_RANGE_DATA, pui8Range, sizeof(pui8Range), pui8Frame);
+            uint32_t ui32Index;
+            for (ui32Index = 0; ui32Index < ui32Len; ui32Index++)
+                ROM_UARTCharPut(UART0_BASE, pui8Frame[ui32Index]);
+        }
+        else {
+            // Transmit the UART Status messages to the computer
+            ROM_UARTCharPut(UART0_BASE, ui8ServoStatus[0]);
+            ROM_UARTCharPut(UART0_BASE, ui8ServoStatus[1]);
+            ROM_UARTCharPut(UART0_BASE, i8EchoChange);
+            ROM_UARTCharPut(UART0_BASE, ui8TerminateStatus);
+            ROM_UARTCharPut(UART0_BASE, '\r');
+            ROM_UARTCharPut(UART0_BASE, '\n');
+        }
 
         ROM_GPIOPinWrite(GPIO_PORTF_BASE, GPIO_PIN_3 | GPIO_PIN_2 | GPIO_PIN_1, 0x00);
     }
 
 }
+
+// Function to execute and answer the oldest command frame queued by UART0IntHandler
+void CMD_service(void){
+    uint8_t pui8Reply[1 + 3 + 4 + 1 + 2 * PWM_CHANNELS];
+    uint8_t pui8Frame[sizeof(pui8Reply) + PROTO_OVERHEAD];
+    uint8_t ui8Len = 1;
+    uint8_t ui8Index;
+
+    if (ui32CmdHead == ui32CmdTail)
+        return;
+
+    const tProtoFrame *psCmd = &sCmdQueue[ui32CmdTail & (CMD_QUEUE_LEN - 1)];
+    const uint8_t *pui8Payload = psCmd->pui8Payload;
+    uint8_t ui8Type = psCmd->ui8Type;
+
+    // The state shared with the interrupts below the leg encoders is accessed with them masked,
+    // the encoders keep counting. The reply is sent under the same mask, so that it does not
+    // mix with the range frames of PortAIntHandler.
+    ROM_IntPriorityMaskSet(INT_PRIORITY_LOW);
+    pui8Reply[0] = PROTO_STATUS_OK;
+    switch (ui8Type){
+    case PROTO_GAIT_LOAD:
+        if (psCmd->ui8Len < 1 + GAIT_HEADER)
+            pui8Reply[0] = PROTO_STATUS_LEN;
+        else if (pui8Payload[0] >= GAIT_SLOTS || !GAIT_check(pui8Payload + 1, psCmd->ui8Len - 1))
+            pui8Reply[0] = PROTO_STATUS_FAIL;
+        else if (sGaitSeq.sNew.pui8Table == ui8GaitSlot[pui8Payload[0]] ||
+                 (sGaitSeq.ui16Blend && sGaitSeq.sOld.pui8Table == ui8GaitSlot[pui8Payload[0]]))
+            pui8Reply[0] = PROTO_STATUS_BUSY;
+        else
+            memcpy(ui8GaitSlot[pui8Payload[0]], pui8Payload + 1, psCmd->ui8Len - 1);
+        break;
+
+    case PROTO_GAIT_PLAY:
+        if (psCmd->ui8Len != 5)
+            pui8Reply[0] = PROTO_STATUS_LEN;
+        else if (pui8Payload[0] >= GAIT_SLOTS ||
+                 !GAIT_check(ui8GaitSlot[pui8Payload[0]], GAIT_TABLE_LEN(ui8GaitSlot[pui8Payload[0]][GAIT_O_FRAMES])))
+            pui8Reply[0] = PROTO_STATUS_FAIL;
+        else {
+            GAIT_play(&sGaitSeq, ui8GaitSlot[pui8Payload[0]], PROTO_getU16(pui8Payload + 1),
+                      PROTO_getU16(pui8Payload + 3));
+            ui8GaitPlayed = pui8Payload[0];
+        }
+        break;
+
+    case PROTO_GAIT_STOP:
+        if (psCmd->ui8Len != 1)
+            pui8Reply[0] = PROTO_STATUS_LEN;
+        else
+            GAIT_stop(&sGaitSeq, pui8Payload[0] != 0);
+        break;
+
+    case PROTO_GET_STATE:
+        if (psCmd->ui8Len != 0){
+            pui8Reply[0] = PROTO_STATUS_LEN;
+            break;
+        }
+        pui8Reply[1] = (SERVO_IDLE(&sServoMotion) ? PROTO_FLAG_IDLE : 0) |
+                       (GAIT_PLAYING(&sGaitSeq) ? PROTO_FLAG_PLAYING : 0);
+        pui8Reply[2] = GAIT_PLAYING(&sGaitSeq) ? ui8GaitPlayed : 0xFF;
+        pui8Reply[3] = sGaitSeq.sNew.ui8Frame;
+        PROTO_putU32(pui8Reply + 4, sGaitSeq.sNew.ui32Cycles);
+        pui8Reply[8] = (uint8_t)i8EchoChange;
+        for (ui8Index = 0; ui8Index < PWM_CHANNELS; ui8Index++)
+            PROTO_putU16(pui8Reply + 9 + 2 * ui8Index, (uint16_t)((sServoMotion.psAxis[ui8Index].i32Pos +
+                         (1 << (SERVO_Q - 1))) >> SERVO_Q));
+        ui8Len = sizeof(pui8Reply);
+        break;
+
+    default:
+        pui8Reply[0] = PROTO_STATUS_TYPE;
+        break;
+    }
+    ui32CmdTail++;
+
+    // Answer with the type of the command and the reply flag
+    uint32_t ui32Len = PROTO_encode(ui8Type | PROTO_REPLY, pui8Reply, ui8Len, pui8Frame);
+    uint32_t ui32Index;
+    for (ui32Index = 0; ui32Index < ui32Len; ui32Index++)
+        ROM_UARTCharPut(UART0_BASE, pui8Frame[ui32Index]);
+    ROM_IntPriorityMaskSet(0);
+}
+
+// Function to execute the button events posted by Timer0IntHandler
+void BUTTON_service(void){
+    uint8_t ui8Event;
+
+    while (BTN_get(&sBtnPort, &ui8Event)){
+        // The state shared with the interrupts below the leg encoders is accessed with them masked
+        ROM_IntPriorityMaskSet(INT_PRIORITY_LOW);
+        switch (ui8Event){
+        case BTN_EVENT(BTN_PRESS, BUTTON_SW1):{
+            // Glow the Green LED
+            ROM_GPIOPinWrite(GPIO_PORTF_BASE, GPIO_PIN_3 | GPIO_PIN_2 | GPIO_PIN_1, GPIO_PIN_3);
+
+            // Stop the gait, then save the current Servo command and invert it
+            GAIT_stop(&sGaitSeq, true);
+            ui8GaitPlayed = 0xFF;
+            ui8ServoStatus[0] = ui8ServoStatus[1];
+            ui8ServoStatus[1] = (~ui8ServoStatus[1]) & 0x0F;
+
+            // Convert the Servo command message into motor control commands
+            uint8_t ui8MotorControl[4];
+            ui8MotorControl[0] = (ui8ServoStatus[1] & 0b00001000) >> 3;
+            ui8MotorControl[1] = (ui8ServoStatus[1] & 0b00000100) >> 2;
+            ui8MotorControl[2] = (ui8ServoStatus[1] & 0b00000010) >> 1;
+            ui8MotorControl[3] = (ui8ServoStatus[1] & 0b00000001);
+
+            // Move the motors to their new duty cycles
+            int16_t i16Duty[PWM_CHANNELS];
+            uint8_t ui8Index;
+            for (ui8Index = 0; ui8Index < PWM_CHANNELS; ui8Index++)
+                i16Duty[ui8Index] = i16ServoDuty[ui8Index][ui8MotorControl[ui8Index]];
+            SERVO_moveTo(&sServoMotion, i16Duty);
+            break;
+        }
+
+        case BTN_EVENT(BTN_DOUBLE, BUTTON_SW1):
+            // Walk the built-in trot of slot 0, its first frame is reached from the current pose
+            GAIT_play(&sGaitSeq, ui8GaitSlot[0], 100, 0);
+            ui8GaitPlayed = 0;
+            break;
+
+        case BTN_EVENT(BTN_PRESS, BUTTON_SW2):
+            // Glow the Red LED
+            ROM_GPIOPinWrite(GPIO_PORTF_BASE, GPIO_PIN_3 | GPIO_PIN_2 | GPIO_PIN_1, GPIO_PIN_1);
+
+            // Modify the terminate variable to send a terminate condition
+            ui8TerminateStatus = 0xFF;
+
+            // Transmit the UART Status messages to the computer
+            ROM_UARTCharPut(UART0_BASE, ui8ServoStatus[0]);
+            ROM_UARTCharPut(UART0_BASE, ui8ServoStatus[1]);
+            ROM_UARTCharPut(UART0_BASE, i8EchoChange);
+            ROM_UARTCharPut(UART0_BASE, ui8TerminateStatus);
+            ROM_UARTCharPut(UART0_BASE, '\r');
+            ROM_UARTCharPut(UART0_BASE, '\n');
+
+            // Restart the 400 ms of the next range ping
+            ui16PingTicks = 0;
+            break;
+
+        case BTN_EVENT(BTN_RELEASE, BUTTON_SW1):
+        case BTN_EVENT(BTN_RELEASE, BUTTON_SW2):
+            // Turn off the LED
+            ROM_GPIOPinWrite(GPIO_PORTF_BASE, GPIO_PIN_3 | GPIO_PIN_2 | GPIO_PIN_1, 0x00);
+            break;
+        }
+        ROM_IntPriorityMaskSet(0);
+    }
+}